@@ -88,6 +88,25 @@ namespace rocwmma
     template <typename FragT>
     using GetMappingUtil_t = typename GetMappingUtil<FragT>::type;
 
+    ///
+    /// IOCount access
+    /// Fewest memory instructions that a single fragment load is issued as
+    ///
+
+    template <typename FragT>
+    struct GetIOCount;
+
+    template <typename FragT>
+    constexpr uint32_t GetIOCount_v = GetIOCount<FragT>::value;
+
+    ///
+    /// PendingIO access
+    /// Memory instructions of an asynchronous fragment load, per address space
+    ///
+
+    template <typename T>
+    struct GetPendingIO;
+
 } // namespace rocwmma
 
 #include "accessors_impl.hpp"
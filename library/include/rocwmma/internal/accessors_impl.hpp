@@ -27,6 +27,7 @@
 #define ROCWMMA_ACCESSORS_IMPL_HPP
 
 #include "accessors.hpp"
+#include "api_fwd.hpp"
 #include "coop_io_config.hpp"
 #include "io_config.hpp"
 #include "io_shape.hpp"
@@ -129,6 +130,101 @@ namespace rocwmma
         using type = MappingUtil<IOShapeT::BlockHeight, IOShapeT::BlockWidth, DataT, DataLayoutT>;
     };
 
+    ///
+    /// IOCount access
+    ///
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    struct GetIOCount<fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>>
+    {
+        using IOConfigT = IOConfig<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>;
+        using LoadT     = typename IOConfigT::Loader::Traits::LoadT;
+
+        // Each vector is issued as one instruction per B128, but the backend may
+        // merge neighbouring vectors (e.g. ds_read2_b64). No instruction moves
+        // more than B128 per lane, which bounds the count from below.
+        enum : uint32_t
+        {
+            value = ceilDiv(IOConfigT::IOTraits::IOCount * (uint32_t)sizeof(LoadT), 16u)
+        };
+    };
+
+    // Layout is chosen at run-time, so take the lesser count of either layout.
+    // Under-counting pending loads only errs on the side of waiting longer.
+    template <typename MatrixT, uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename DataT>
+    struct GetIOCount<fragment<MatrixT, BlockM, BlockN, BlockK, DataT, void>>
+    {
+        using RowMajorCount
+            = GetIOCount<fragment<MatrixT, BlockM, BlockN, BlockK, DataT, row_major>>;
+        using ColMajorCount
+            = GetIOCount<fragment<MatrixT, BlockM, BlockN, BlockK, DataT, col_major>>;
+
+        enum : uint32_t
+        {
+            value = RowMajorCount::value < ColMajorCount::value ? RowMajorCount::value
+                                                                : ColMajorCount::value
+        };
+    };
+
+    ///
+    /// PendingIO access
+    ///
+
+    // The address space of an untagged fragment is unknown. Waiting on it waits
+    // on both global and LDS loads, and it is never counted as pending.
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    struct GetPendingIO<fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>>
+    {
+        using FragT = fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>;
+
+        enum : uint32_t
+        {
+            IOCount     = GetIOCount_v<FragT>,
+            GlobalCount = 0u,
+            LdsCount    = 0u,
+            IsGlobal    = 1u,
+            IsLds       = 1u
+        };
+    };
+
+    // Global loads are tracked by vmcnt
+    template <typename FragT>
+    struct GetPendingIO<loaded_fragment<global_memory, FragT>>
+    {
+        enum : uint32_t
+        {
+            IOCount     = GetIOCount_v<FragT>,
+            GlobalCount = IOCount,
+            LdsCount    = 0u,
+            IsGlobal    = 1u,
+            IsLds       = 0u
+        };
+    };
+
+    // LDS loads are tracked by lgkmcnt
+    template <typename FragT>
+    struct GetPendingIO<loaded_fragment<lds_memory, FragT>>
+    {
+        enum : uint32_t
+        {
+            IOCount     = GetIOCount_v<FragT>,
+            GlobalCount = 0u,
+            LdsCount    = IOCount,
+            IsGlobal    = 0u,
+            IsLds       = 1u
+        };
+    };
+
 } // namespace rocwmma
 
 #endif // ROCWMMA_ACCESSORS_IMPL_HPP
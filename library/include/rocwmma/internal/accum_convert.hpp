@@ -0,0 +1,334 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_ACCUM_CONVERT_HPP
+#define ROCWMMA_ACCUM_CONVERT_HPP
+
+#include "accum_layout.hpp"
+#include "mapping_util.hpp"
+#include "types.hpp"
+#include "utils.hpp"
+#include "vector.hpp"
+
+namespace rocwmma
+{
+    namespace detail
+    {
+        /*! \struct AccumConvertSchedule
+        *  \brief Gather schedule converting the AccumLayout register placement to
+        *  that of FragOutT.
+        *
+        * In step t, lane D fills its output register o = t ^ dstMask(D) with a
+        * single gather from lane srcLane(D) ^ stepLane(t). That lane S offers its
+        * register stepIndex(t) ^ srcMask(S), which lets the lanes reading the same
+        * source in one step each receive a different register, as when converting
+        * to matrix_a.
+        *
+        * Source lanes, registers and matrix coordinates are related by bit fields, so
+        * the masks and source lanes are linear (by XOR) in the lane bits. They are
+        * derived from the output elements of single lane and register bits, then
+        * verified against every element of the block.
+        *
+        * @tparam BlockM/N accumulator block dimensions
+        * @tparam DataT accumulator data type
+        * @tparam FragOutT output fragment type, with a data layout
+        */
+        template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename FragOutT>
+        struct AccumConvertSchedule
+        {
+            using Layout = AccumLayout<BlockM, BlockN, DataT>;
+
+            enum : uint32_t
+            {
+                LaneBits  = Log2<Layout::WaveSize>::value,
+                IndexBits = Log2<Layout::Size>::value,
+            };
+
+            struct Masks
+            {
+                // Values for each lane bit
+                uint32_t srcMask[LaneBits];
+                uint32_t dstMask[LaneBits];
+                uint32_t srcLane[LaneBits];
+
+                // Source lane offset and source register of each step
+                uint32_t stepLane[Layout::Size];
+                uint32_t stepIndex[Layout::Size];
+
+                // Register bits moved by any srcMask / dstMask
+                uint32_t srcMaskBits;
+                uint32_t dstMaskBits;
+
+                // Every lane is its own srcLane
+                bool isLaneLocal;
+                bool isValid;
+            };
+
+            // Combines the values of the set bits of lane
+            template <uint32_t Count>
+            ROCWMMA_HOST_DEVICE constexpr static inline uint32_t
+                xorBits(uint32_t const (&values)[Count], uint32_t lane)
+            {
+                uint32_t result = 0u;
+                for(uint32_t j = 0; j < Count; j++)
+                {
+                    result ^= ((lane >> j) & 1u) ? values[j] : 0u;
+                }
+                return result;
+            }
+
+            // Accumulator lane and register holding output register index of lane
+            ROCWMMA_HOST_DEVICE constexpr static inline uint32_t sourceLane(uint32_t lane,
+                                                                            uint32_t index)
+            {
+                return Layout::lane(FragOutT::elementCoord(lane, index));
+            }
+
+            ROCWMMA_HOST_DEVICE constexpr static inline uint32_t sourceIndex(uint32_t lane,
+                                                                             uint32_t index)
+            {
+                return Layout::index(FragOutT::elementCoord(lane, index));
+            }
+
+            ROCWMMA_HOST_DEVICE constexpr static inline Masks make()
+            {
+                auto result = Masks{};
+
+                for(uint32_t t = 0; t < Layout::Size; t++)
+                {
+                    result.stepLane[t] = sourceLane(0u, t);
+                }
+
+                // Register bits kept within the lane fix their source register bit.
+                // Those moving the source to another lane bit take their own register
+                // bit if still free, or else the lowest free one, and the srcMask of
+                // that lane bit accounts for the difference.
+                uint32_t usedBits = 0u;
+                for(uint32_t i = 0; i < IndexBits; i++)
+                {
+                    if(result.stepLane[1u << i] == 0u)
+                    {
+                        usedBits |= sourceIndex(0u, 1u << i);
+                    }
+                }
+
+                for(uint32_t i = 0; i < IndexBits; i++)
+                {
+                    auto index = 1u << i;
+                    for(uint32_t j = 0; j < LaneBits; j++)
+                    {
+                        if(result.stepLane[index] == (1u << j))
+                        {
+                            auto step = index;
+                            for(uint32_t bit = 1u; (usedBits & step) != 0u && bit < Layout::Size;
+                                bit <<= 1u)
+                            {
+                                step = bit;
+                            }
+
+                            usedBits |= step;
+                            result.srcMask[j] = sourceIndex(0u, index) ^ step;
+                        }
+                    }
+                }
+
+                // Step holding each source register, to place the lane bits
+                uint32_t steps[Layout::Size] = {};
+                for(uint32_t t = 0; t < Layout::Size; t++)
+                {
+                    result.stepIndex[t]
+                        = sourceIndex(0u, t) ^ xorBits(result.srcMask, result.stepLane[t]);
+                    steps[result.stepIndex[t]] = t;
+                }
+
+                for(uint32_t j = 0; j < LaneBits; j++)
+                {
+                    auto lane = sourceLane(1u << j, 0u);
+                    auto step = sourceIndex(1u << j, 0u) ^ xorBits(result.srcMask, lane);
+
+                    result.dstMask[j] = steps[step];
+                    result.srcLane[j] = lane ^ result.stepLane[result.dstMask[j]];
+
+                    result.srcMaskBits |= result.srcMask[j];
+                    result.dstMaskBits |= result.dstMask[j];
+                }
+
+                result.isLaneLocal = true;
+                result.isValid     = Layout::isInverse();
+                for(uint32_t lane = 0; lane < Layout::WaveSize; lane++)
+                {
+                    auto srcLane = xorBits(result.srcLane, lane);
+                    auto dstMask = xorBits(result.dstMask, lane);
+
+                    result.isLaneLocal &= (srcLane == lane);
+                    for(uint32_t t = 0; t < Layout::Size; t++)
+                    {
+                        auto coord = FragOutT::elementCoord(lane, t ^ dstMask);
+                        auto src   = Layout::lane(coord);
+
+                        result.isValid &= (src == (srcLane ^ result.stepLane[t]))
+                                          && (Layout::index(coord)
+                                              == (result.stepIndex[t]
+                                                  ^ xorBits(result.srcMask, src)));
+                    }
+                }
+
+                return result;
+            }
+        };
+
+        /*! \struct AccumConvert
+        *  \brief In-register conversion of accumulator fragment data to the
+        *  layout and data type of a matrix_a or matrix_b fragment spanning the
+        *  same matrix coordinates.
+        *
+        * Each output register is filled with one bpermute, following the
+        * AccumConvertSchedule. Registers are put in step order before the
+        * gathers, and back in index order after them, by XOR permutations of one
+        * mask bit at a time and a fixed register selection. Steps in which every
+        * lane reads its own registers skip the gather, so that matching layouts
+        * (e.g. accumulator to matrix_b) reduce to a type conversion.
+        *
+        * @tparam BlockM/N accumulator block dimensions
+        * @tparam DataT accumulator data type
+        * @tparam FragOutT output fragment type, with a data layout
+        */
+        template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename FragOutT>
+        struct AccumConvert
+        {
+            using Layout   = AccumLayout<BlockM, BlockN, DataT>;
+            using Schedule = AccumConvertSchedule<BlockM, BlockN, DataT, FragOutT>;
+
+            using OutputAccessT = typename FragOutT::Traits::AccessT;
+            using OutputT       = typename VecTraits<OutputAccessT>::DataT;
+
+            // Cross-lane gathers operate on B32
+            using PermuteT = typename Layout::CrossLaneT;
+            using GatherT  = VecT<PermuteT, Layout::Size>;
+
+            enum : uint32_t
+            {
+                Size       = Layout::Size,
+                OutputSize = VecTraits<OutputAccessT>::size(),
+            };
+
+            constexpr static typename Schedule::Masks Masks = Schedule::make();
+
+            static_assert(OutputSize == Size, "Output fragment must span the accumulator block");
+            static_assert(sizeof(PermuteT) % sizeof(uint32_t) == 0,
+                          "Permute type must be a multiple of 32b");
+            static_assert(Masks.isValid,
+                          "Output fragment layout has no single gather conversion schedule");
+
+            // For the current thread, read the value held by srcLane
+            template <typename T>
+            ROCWMMA_DEVICE static inline T gather(T value, uint32_t srcLane)
+            {
+                using WordsT = uint32_t[sizeof(T) / sizeof(uint32_t)];
+
+                auto& words = reinterpret_cast<WordsT&>(value);
+#pragma unroll
+                for(uint32_t i = 0; i < sizeof(T) / sizeof(uint32_t); i++)
+                {
+                    words[i] = __builtin_amdgcn_ds_bpermute(srcLane << 2u, words[i]);
+                }
+                return value;
+            }
+
+            // Reorders registers such that data[i] becomes data[i ^ mask].
+            // MaskBits bounds the bits that mask may set.
+            template <uint32_t MaskBits>
+            ROCWMMA_DEVICE static inline void xorPermute(GatherT& data, uint32_t mask)
+            {
+#pragma unroll
+                for(uint32_t bit = 1u; bit < Size; bit <<= 1u)
+                {
+                    if((MaskBits & bit) == 0u)
+                    {
+                        continue;
+                    }
+
+                    auto swap = (mask & bit) != 0u;
+#pragma unroll
+                    for(uint32_t i = 0; i < Size; i++)
+                    {
+                        if((i & bit) == 0u)
+                        {
+                            auto lo            = data.data[i];
+                            auto hi            = data.data[i | bit];
+                            data.data[i]       = swap ? hi : lo;
+                            data.data[i | bit] = swap ? lo : hi;
+                        }
+                    }
+                }
+            }
+
+            template <typename AccessT>
+            ROCWMMA_DEVICE static inline auto exec(AccessT const& data)
+            {
+                static_assert(VecTraits<AccessT>::size() == Size,
+                              "Accumulator size inconsistent with conversion layout");
+
+                auto laneId = WaveSpace<>::localLaneId();
+
+                auto regs = GatherT{};
+#pragma unroll
+                for(uint32_t i = 0; i < Size; i++)
+                {
+                    regs.data[i] = static_cast<PermuteT>(data.data[i]);
+                }
+                xorPermute<Masks.srcMaskBits>(regs, Schedule::xorBits(Masks.srcMask, laneId));
+
+                // One gather per output register, reading source registers in step order
+                auto srcLane = Schedule::xorBits(Masks.srcLane, laneId);
+                auto steps   = GatherT{};
+#pragma unroll
+                for(uint32_t t = 0; t < Size; t++)
+                {
+                    steps.data[t] = regs.data[Masks.stepIndex[t]];
+                    if(!Masks.isLaneLocal || Masks.stepLane[t] != 0u)
+                    {
+                        steps.data[t] = gather(steps.data[t], srcLane ^ Masks.stepLane[t]);
+                    }
+                }
+
+                // Output registers in index order
+                xorPermute<Masks.dstMaskBits>(steps, Schedule::xorBits(Masks.dstMask, laneId));
+
+                auto result = OutputAccessT{};
+#pragma unroll
+                for(uint32_t i = 0; i < Size; i++)
+                {
+                    result.data[i] = static_cast<OutputT>(steps.data[i]);
+                }
+                return result;
+            }
+        };
+
+    } // namespace detail
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_ACCUM_CONVERT_HPP
@@ -0,0 +1,142 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_ACCUM_LAYOUT_HPP
+#define ROCWMMA_ACCUM_LAYOUT_HPP
+
+#include "constants.hpp"
+#include "io_bounds.hpp"
+#include "io_layout.hpp"
+#include "io_shape.hpp"
+#include "types.hpp"
+
+namespace rocwmma
+{
+    namespace detail
+    {
+        /*! \struct AccumLayout
+        *  \brief Register placement of accumulator fragment data, shared by the
+        *  in-register accumulator transforms.
+        *
+        * Accumulator fragments use the RowNT matrix layout in both data layouts,
+        * for which each lane holds a single column of every BlockDim segment and
+        * the same set of rows in every BlockDim segment:
+        *
+        * lane(row, col)  = col % ColLanes + ColLanes * ((row % RowStride) / MaxVW)
+        * index(row, col) = (col / ColLanes) * RowsPerLane + (row / RowStride) * MaxVW
+        *                   + row % MaxVW
+        *
+        * lane() and index() are the inverse of elementCoord(), which follows the
+        * accumulator MatrixLayout. isInverse() verifies this for every element.
+        *
+        * @tparam BlockM/N accumulator block dimensions
+        * @tparam DataT accumulator data type
+        */
+        template <uint32_t BlockM, uint32_t BlockN, typename DataT>
+        struct AccumLayout
+        {
+            using IOShape = IOShape<accumulator, BlockM, BlockN, 1u>;
+
+            // Register positions are identical in row_major and col_major
+            using IOLayout = IOLayout<accumulator,
+                                      IOShape::BlockDim,
+                                      IOShape::KDim,
+                                      DataT,
+                                      row_major,
+                                      1u>;
+
+            using MatrixLayout    = typename IOLayout::MatrixLayout;
+            using RowLayoutTraits = typename MatrixLayout::Traits::OrthoLayout::Traits;
+
+            // Cross-lane backends operate on B32, so sub-dword data is widened
+            using CrossLaneT = conditional_t<(sizeof(DataT) >= sizeof(uint32_t)),
+                                             DataT,
+                                             conditional_t<is_integral<DataT>::value,
+                                                           int32_t,
+                                                           float32_t>>;
+
+            enum : uint32_t
+            {
+                WaveSize    = Constants::AMDGCN_WAVE_SIZE,
+                MaxVW       = IOLayout::MaxVW,
+                ColLanes    = RowLayoutTraits::BlockDimStride_X,
+                ColSegs     = RowLayoutTraits::BlockDimSegs,
+                RowSegs     = RowLayoutTraits::BlockKSegs,
+                RowsPerLane = RowSegs * MaxVW,
+                RowStride   = (WaveSize / ColLanes) * MaxVW,
+                Size        = ColSegs * RowsPerLane,
+            };
+
+            static_assert(Size * WaveSize == BlockM * BlockN,
+                          "Accumulator size inconsistent with register layout");
+
+            // Matrix coordinate of the element in register index of the lane
+            ROCWMMA_HOST_DEVICE constexpr static inline Coord2d elementCoord(uint32_t lane,
+                                                                             uint32_t index)
+            {
+                using Bounds = IOBounds<row_major, IOLayout::VW>;
+
+                return Bounds::elementCoord(MatrixLayout::baseOffset(lane)
+                                                + MatrixLayout::cumulativeOffset(index
+                                                                                 / IOLayout::VW),
+                                            index % IOLayout::VW);
+            }
+
+            // Lane holding the element at coord
+            ROCWMMA_HOST_DEVICE constexpr static inline uint32_t lane(Coord2d const& coord)
+            {
+                return get<1>(coord) % ColLanes
+                       + ColLanes * ((get<0>(coord) % RowStride) / MaxVW);
+            }
+
+            // Register index of the element at coord, within its lane
+            ROCWMMA_HOST_DEVICE constexpr static inline uint32_t index(Coord2d const& coord)
+            {
+                return (get<1>(coord) / ColLanes) * RowsPerLane
+                       + (get<0>(coord) / RowStride) * MaxVW + get<0>(coord) % MaxVW;
+            }
+
+            ROCWMMA_HOST_DEVICE constexpr static inline bool isInverse()
+            {
+                for(uint32_t l = 0; l < WaveSize; l++)
+                {
+                    for(uint32_t i = 0; i < Size; i++)
+                    {
+                        auto coord = elementCoord(l, i);
+                        if(lane(coord) != l || index(coord) != i)
+                        {
+                            return false;
+                        }
+                    }
+                }
+                return true;
+            }
+        };
+
+    } // namespace detail
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_ACCUM_LAYOUT_HPP
@@ -34,6 +34,17 @@ namespace rocwmma
     struct matrix_a;
     struct matrix_b;
     struct accumulator;
+    struct cache_default;
+    struct cache_streaming;
+
+    template <typename CachePolicy>
+    struct buffer_io;
+
+    struct global_memory;
+    struct lds_memory;
+
+    template <uint32_t ChunkSize, uint32_t ChunkCount, uint32_t LineGroup>
+    struct xor_swizzle;
 
     template <typename MatrixT,
               uint32_t BlockM,
@@ -43,6 +54,9 @@ namespace rocwmma
               typename DataLayoutT>
     class __align__(4) fragment;
 
+    template <typename MemoryT, typename FragT>
+    struct loaded_fragment;
+
 } // namespace rocwmma
 
 #endif // ROCWMMA_INTERNAL_API_FWD_HPP
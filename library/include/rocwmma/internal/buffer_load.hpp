@@ -0,0 +1,125 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_BUFFER_LOAD_HPP
+#define ROCWMMA_BUFFER_LOAD_HPP
+
+#include "buffer_resource.hpp"
+#include "cache_policy.hpp"
+#include "io_bounds.hpp"
+#include "opaque_load.hpp"
+#include "types.hpp"
+
+namespace rocwmma
+{
+
+    namespace detail
+    {
+        // Loads global memory with raw buffer instructions: the wave-uniform
+        // base address is held in an SRD in scalar registers, and each
+        // thread supplies only a 32-bit byte offset.
+        template <typename DataT, uint32_t VectorWidth, typename CachePolicy = cache_default>
+        struct amdgcn_buffer_load
+        {
+            static_assert(VectorWidth > 0, "Vector width must be greater than 0");
+            static_assert(sizeof(DataT[VectorWidth]) == sizeof(VecT<DataT, VectorWidth>),
+                          "Cannot vectorize input");
+
+            using LoadT    = VecT<DataT, VectorWidth>;
+            using AddressT = BufferAddress<DataT>;
+
+            enum : int32_t
+            {
+                Aux = CachePolicyTraits<CachePolicy>::BufferAux
+            };
+
+            // Builds the SRD once per fragment IO. Loads beyond numElements
+            // from dataPtr return zero.
+            ROCWMMA_DEVICE static inline AddressT makeAddress(DataT const* dataPtr)
+            {
+                return AddressT{BufferResource::make(dataPtr), 0};
+            }
+
+            ROCWMMA_DEVICE static inline AddressT makeAddress(DataT const* dataPtr,
+                                                              uint64_t     numElements)
+            {
+                return AddressT{BufferResource::make(dataPtr, numElements * sizeof(DataT)), 0};
+            }
+
+            ROCWMMA_DEVICE static inline void exec(LoadT& data, AddressT const& address)
+            {
+                amdgcn_raw_buffer::load<Aux>(data, address.mSrd, address.mOffset);
+            }
+
+            // Predicated load: elements outside of the extent are zero-filled.
+            // The hardware already zero-fills anything past the end of the
+            // resource, so the full vector is always safe to fetch. Only
+            // elements that overhang the extent in the minor dimension, but
+            // still reside within the resource, need to be masked.
+            template <typename DataLayoutT>
+            ROCWMMA_DEVICE static inline void exec(LoadT&          data,
+                                                   AddressT const& address,
+                                                   Coord2d const&  matrixCoord,
+                                                   Coord2d const&  extent)
+            {
+                using Bounds = IOBounds<DataLayoutT, VectorWidth>;
+
+                exec(data, address);
+
+                if(!Bounds::isVectorInBounds(matrixCoord, extent))
+                {
+#pragma unroll
+                    for(uint32_t i = 0; i < VectorWidth; i++)
+                    {
+                        data.data[i] = Bounds::isElementInBounds(matrixCoord, extent, i)
+                                           ? data.data[i]
+                                           : static_cast<DataT>(0);
+                    }
+                }
+            }
+        };
+
+    } // namespace detail
+
+    // OpaqueLoad, issued through buffer resources.
+    // Only valid for data residing in global memory.
+    template <uint32_t BlockDim,
+              uint32_t BlockK,
+              typename DataT,
+              class DataLayout,
+              class MatrixLayout,
+              uint32_t VectorWidth,
+              typename CachePolicy = cache_default>
+    using BufferLoad = OpaqueLoad<BlockDim,
+                                  BlockK,
+                                  DataT,
+                                  DataLayout,
+                                  MatrixLayout,
+                                  VectorWidth,
+                                  detail::amdgcn_buffer_load<DataT, VectorWidth, CachePolicy>>;
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_BUFFER_LOAD_HPP
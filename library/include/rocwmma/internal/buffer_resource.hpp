@@ -0,0 +1,274 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_BUFFER_RESOURCE_HPP
+#define ROCWMMA_BUFFER_RESOURCE_HPP
+
+#include "types.hpp"
+
+namespace rocwmma
+{
+
+    namespace detail
+    {
+        // Native operand types of the raw buffer intrinsics
+        using BufferSrdT  = int32_t __attribute__((ext_vector_type(4)));
+        using BufferB64T  = int32_t __attribute__((ext_vector_type(2)));
+        using BufferB128T = int32_t __attribute__((ext_vector_type(4)));
+
+        // Raw buffer intrinsics. Arguments are:
+        // (data), resource, vgpr byte offset, sgpr byte offset, cache policy (glc / slc)
+        ROCWMMA_DEVICE int8_t llvm_amdgcn_raw_buffer_load_b8(BufferSrdT srsrc,
+                                                             index_t    voffset,
+                                                             index_t    soffset,
+                                                             index_t    aux)
+            __asm("llvm.amdgcn.raw.buffer.load.i8");
+
+        ROCWMMA_DEVICE int16_t llvm_amdgcn_raw_buffer_load_b16(BufferSrdT srsrc,
+                                                               index_t    voffset,
+                                                               index_t    soffset,
+                                                               index_t    aux)
+            __asm("llvm.amdgcn.raw.buffer.load.i16");
+
+        ROCWMMA_DEVICE int32_t llvm_amdgcn_raw_buffer_load_b32(BufferSrdT srsrc,
+                                                               index_t    voffset,
+                                                               index_t    soffset,
+                                                               index_t    aux)
+            __asm("llvm.amdgcn.raw.buffer.load.i32");
+
+        ROCWMMA_DEVICE BufferB64T llvm_amdgcn_raw_buffer_load_b64(BufferSrdT srsrc,
+                                                                  index_t    voffset,
+                                                                  index_t    soffset,
+                                                                  index_t    aux)
+            __asm("llvm.amdgcn.raw.buffer.load.v2i32");
+
+        ROCWMMA_DEVICE BufferB128T llvm_amdgcn_raw_buffer_load_b128(BufferSrdT srsrc,
+                                                                    index_t    voffset,
+                                                                    index_t    soffset,
+                                                                    index_t    aux)
+            __asm("llvm.amdgcn.raw.buffer.load.v4i32");
+
+        ROCWMMA_DEVICE void llvm_amdgcn_raw_buffer_store_b8(
+            int8_t data, BufferSrdT srsrc, index_t voffset, index_t soffset, index_t aux)
+            __asm("llvm.amdgcn.raw.buffer.store.i8");
+
+        ROCWMMA_DEVICE void llvm_amdgcn_raw_buffer_store_b16(
+            int16_t data, BufferSrdT srsrc, index_t voffset, index_t soffset, index_t aux)
+            __asm("llvm.amdgcn.raw.buffer.store.i16");
+
+        ROCWMMA_DEVICE void llvm_amdgcn_raw_buffer_store_b32(
+            int32_t data, BufferSrdT srsrc, index_t voffset, index_t soffset, index_t aux)
+            __asm("llvm.amdgcn.raw.buffer.store.i32");
+
+        ROCWMMA_DEVICE void llvm_amdgcn_raw_buffer_store_b64(
+            BufferB64T data, BufferSrdT srsrc, index_t voffset, index_t soffset, index_t aux)
+            __asm("llvm.amdgcn.raw.buffer.store.v2i32");
+
+        ROCWMMA_DEVICE void llvm_amdgcn_raw_buffer_store_b128(
+            BufferB128T data, BufferSrdT srsrc, index_t voffset, index_t soffset, index_t aux)
+            __asm("llvm.amdgcn.raw.buffer.store.v4i32");
+
+        /*! \struct BufferResource
+        *  \brief Builds the buffer resource descriptor (SRD) used to address
+        *  global memory with raw buffer instructions.
+        *
+        * The SRD holds a wave-uniform 48-bit base address and the number of
+        * addressable bytes (num_records) from that base. Hardware bounds checks
+        * each access against num_records: loads past the end return zero and
+        * stores past the end are discarded.
+        */
+        struct BufferResource
+        {
+            enum : uint32_t
+            {
+                // Default data format, no swizzling.
+                ConfigDword = ROCWMMA_ARCH_GFX11 ? 0x31004000u : 0x00020000u,
+
+                // No effective bounds clamping
+                MaxRecords = 0xFFFFFFFFu
+            };
+
+            // The base address is expected to be the same for all threads
+            // in the wave, and is moved to scalar registers. Extents beyond
+            // the 32-bit addressable range are clamped.
+            ROCWMMA_DEVICE static inline BufferSrdT make(void const* baseAddr,
+                                                         uint64_t    numBytes = MaxRecords)
+            {
+                auto addr = reinterpret_cast<uint64_t>(baseAddr);
+                numBytes  = numBytes < MaxRecords ? numBytes : static_cast<uint64_t>(MaxRecords);
+
+                BufferSrdT srd;
+                srd[0] = __builtin_amdgcn_readfirstlane(static_cast<int32_t>(addr));
+                srd[1]
+                    = __builtin_amdgcn_readfirstlane(static_cast<int32_t>((addr >> 32) & 0xFFFFu));
+                srd[2] = __builtin_amdgcn_readfirstlane(static_cast<int32_t>(numBytes));
+                srd[3] = static_cast<int32_t>(ConfigDword);
+                return srd;
+            }
+        };
+
+        // Global memory address as a resource and a per-thread byte offset.
+        // Pointer-like arithmetic is in units of DataT.
+        template <typename DataT>
+        struct BufferAddress
+        {
+            BufferSrdT mSrd;
+            index_t    mOffset;
+
+            ROCWMMA_DEVICE inline BufferAddress& operator+=(index_t elementOffset)
+            {
+                mOffset += elementOffset * static_cast<index_t>(sizeof(DataT));
+                return *this;
+            }
+
+            ROCWMMA_DEVICE inline BufferAddress operator+(index_t elementOffset) const
+            {
+                auto result = *this;
+                return result += elementOffset;
+            }
+        };
+
+        // Dispatches raw buffer IO of any B8, B16 or B32 multiple sized type.
+        // Aux holds the cache policy bits, which must be a compile-time constant.
+        struct amdgcn_raw_buffer
+        {
+            template <int32_t Aux = 0, typename DataT>
+            ROCWMMA_DEVICE static inline void
+                load(DataT& data, BufferSrdT const& srd, index_t byteOffset)
+            {
+                constexpr uint32_t Bytes = sizeof(DataT);
+
+                if constexpr(Bytes == 1u)
+                {
+                    reinterpret_cast<int8_t&>(data)
+                        = llvm_amdgcn_raw_buffer_load_b8(srd, byteOffset, 0, Aux);
+                }
+                else if constexpr(Bytes == 2u)
+                {
+                    reinterpret_cast<int16_t&>(data)
+                        = llvm_amdgcn_raw_buffer_load_b16(srd, byteOffset, 0, Aux);
+                }
+                else
+                {
+                    static_assert(Bytes % sizeof(int32_t) == 0u,
+                                  "DataT size must be B8, B16 or a multiple of B32");
+
+                    // Vectorize to B32 so that we can support any B32 multiple.
+                    constexpr uint32_t B32VecSize = Bytes / sizeof(int32_t);
+                    using B32VecT                 = VecT<int32_t, B32VecSize>;
+                    auto& dwords                  = reinterpret_cast<B32VecT&>(data);
+
+                    if constexpr(B32VecSize == 1u)
+                    {
+                        dwords.data[0] = llvm_amdgcn_raw_buffer_load_b32(srd, byteOffset, 0, Aux);
+                    }
+                    else if constexpr(B32VecSize == 2u)
+                    {
+                        auto result    = llvm_amdgcn_raw_buffer_load_b64(srd, byteOffset, 0, Aux);
+                        dwords.data[0] = result[0];
+                        dwords.data[1] = result[1];
+                    }
+                    else
+                    {
+                        static_assert(B32VecSize % 4u == 0u,
+                                      "DataT size must be a multiple of B128");
+
+                        // Largest load is B128
+#pragma unroll
+                        for(uint32_t i = 0; i < B32VecSize / 4u; i++)
+                        {
+                            auto result = llvm_amdgcn_raw_buffer_load_b128(
+                                srd, byteOffset + i * sizeof(BufferB128T), 0, Aux);
+#pragma unroll
+                            for(uint32_t j = 0; j < 4u; j++)
+                            {
+                                dwords.data[i * 4u + j] = result[j];
+                            }
+                        }
+                    }
+                }
+            }
+
+            template <int32_t Aux = 0, typename DataT>
+            ROCWMMA_DEVICE static inline void
+                store(BufferSrdT const& srd, index_t byteOffset, DataT const& data)
+            {
+                constexpr uint32_t Bytes = sizeof(DataT);
+
+                if constexpr(Bytes == 1u)
+                {
+                    llvm_amdgcn_raw_buffer_store_b8(
+                        reinterpret_cast<int8_t const&>(data), srd, byteOffset, 0, Aux);
+                }
+                else if constexpr(Bytes == 2u)
+                {
+                    llvm_amdgcn_raw_buffer_store_b16(
+                        reinterpret_cast<int16_t const&>(data), srd, byteOffset, 0, Aux);
+                }
+                else
+                {
+                    static_assert(Bytes % sizeof(int32_t) == 0u,
+                                  "DataT size must be B8, B16 or a multiple of B32");
+
+                    // Vectorize to B32 so that we can support any B32 multiple.
+                    constexpr uint32_t B32VecSize = Bytes / sizeof(int32_t);
+                    using B32VecT                 = VecT<int32_t, B32VecSize>;
+                    auto const& dwords            = reinterpret_cast<B32VecT const&>(data);
+
+                    if constexpr(B32VecSize == 1u)
+                    {
+                        llvm_amdgcn_raw_buffer_store_b32(dwords.data[0], srd, byteOffset, 0, Aux);
+                    }
+                    else if constexpr(B32VecSize == 2u)
+                    {
+                        BufferB64T input = {dwords.data[0], dwords.data[1]};
+                        llvm_amdgcn_raw_buffer_store_b64(input, srd, byteOffset, 0, Aux);
+                    }
+                    else
+                    {
+                        static_assert(B32VecSize % 4u == 0u,
+                                      "DataT size must be a multiple of B128");
+
+                        // Largest store is B128
+#pragma unroll
+                        for(uint32_t i = 0; i < B32VecSize / 4u; i++)
+                        {
+                            BufferB128T input = {dwords.data[i * 4u],
+                                                 dwords.data[i * 4u + 1u],
+                                                 dwords.data[i * 4u + 2u],
+                                                 dwords.data[i * 4u + 3u]};
+                            llvm_amdgcn_raw_buffer_store_b128(
+                                input, srd, byteOffset + i * sizeof(BufferB128T), 0, Aux);
+                        }
+                    }
+                }
+            }
+        };
+
+    } // namespace detail
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_BUFFER_RESOURCE_HPP
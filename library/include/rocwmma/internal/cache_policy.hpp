@@ -0,0 +1,220 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_CACHE_POLICY_HPP
+#define ROCWMMA_CACHE_POLICY_HPP
+
+#include "api_fwd.hpp"
+#include "types.hpp"
+
+namespace rocwmma
+{
+
+    namespace detail
+    {
+        /*! \struct CachePolicyTraits
+        *  \brief Maps fragment IO cache policy tags to backend controls.
+        *
+        * @param IsNonTemporal flat IO uses non-temporal loads / stores
+        * @param BufferAux cache policy bits of raw buffer IO (glc = 1, slc = 2)
+        * @param IsBufferIO IO is issued as raw buffer instructions
+        * @param CacheT cache policy tag, without the IO backend
+        */
+        template <typename CachePolicy>
+        struct CachePolicyTraits;
+
+        template <>
+        struct CachePolicyTraits<cache_default>
+        {
+            enum : int32_t
+            {
+                IsNonTemporal = 0,
+                BufferAux     = 0,
+                IsBufferIO    = 0
+            };
+
+            using CacheT = cache_default;
+        };
+
+        // Streaming data is not expected to be re-used by the kernel, and is
+        // marked as such (slc / nt) so that it does not displace cache lines
+        // of data that is.
+        template <>
+        struct CachePolicyTraits<cache_streaming>
+        {
+            enum : int32_t
+            {
+                IsNonTemporal = 1,
+                BufferAux     = 2,
+                IsBufferIO    = 0
+            };
+
+            using CacheT = cache_streaming;
+        };
+
+        // Buffer IO keeps the cache controls of the wrapped policy
+        template <typename CachePolicy>
+        struct CachePolicyTraits<buffer_io<CachePolicy>>
+        {
+            static_assert(!(bool)CachePolicyTraits<CachePolicy>::IsBufferIO,
+                          "buffer_io must wrap a cache policy");
+
+            enum : int32_t
+            {
+                IsNonTemporal = CachePolicyTraits<CachePolicy>::IsNonTemporal,
+                BufferAux     = CachePolicyTraits<CachePolicy>::BufferAux,
+                IsBufferIO    = 1
+            };
+
+            using CacheT = CachePolicy;
+        };
+
+        // Native operand types of the non-temporal builtins
+        using NonTemporalB64T  = int32_t __attribute__((ext_vector_type(2)));
+        using NonTemporalB128T = int32_t __attribute__((ext_vector_type(4)));
+
+        // Dispatches non-temporal flat IO of any B8, B16 or B32 multiple sized type
+        struct amdgcn_nontemporal
+        {
+            template <typename DataT>
+            ROCWMMA_DEVICE static inline void load(DataT& data, DataT const* dataPtr)
+            {
+                constexpr uint32_t Bytes = sizeof(DataT);
+
+                if constexpr(Bytes == 1u)
+                {
+                    reinterpret_cast<int8_t&>(data)
+                        = __builtin_nontemporal_load(reinterpret_cast<int8_t const*>(dataPtr));
+                }
+                else if constexpr(Bytes == 2u)
+                {
+                    reinterpret_cast<int16_t&>(data)
+                        = __builtin_nontemporal_load(reinterpret_cast<int16_t const*>(dataPtr));
+                }
+                else
+                {
+                    static_assert(Bytes % sizeof(int32_t) == 0u,
+                                  "DataT size must be B8, B16 or a multiple of B32");
+
+                    // Vectorize to B32 so that we can support any B32 multiple.
+                    constexpr uint32_t B32VecSize = Bytes / sizeof(int32_t);
+                    using B32VecT                 = VecT<int32_t, B32VecSize>;
+                    auto& dwords                  = reinterpret_cast<B32VecT&>(data);
+
+                    if constexpr(B32VecSize == 1u)
+                    {
+                        dwords.data[0] = __builtin_nontemporal_load(
+                            reinterpret_cast<int32_t const*>(dataPtr));
+                    }
+                    else if constexpr(B32VecSize == 2u)
+                    {
+                        auto result = __builtin_nontemporal_load(
+                            reinterpret_cast<NonTemporalB64T const*>(dataPtr));
+                        dwords.data[0] = result[0];
+                        dwords.data[1] = result[1];
+                    }
+                    else
+                    {
+                        static_assert(B32VecSize % 4u == 0u,
+                                      "DataT size must be a multiple of B128");
+
+                        // Largest load is B128
+                        auto const* src = reinterpret_cast<NonTemporalB128T const*>(dataPtr);
+#pragma unroll
+                        for(uint32_t i = 0; i < B32VecSize / 4u; i++)
+                        {
+                            auto result = __builtin_nontemporal_load(src + i);
+#pragma unroll
+                            for(uint32_t j = 0; j < 4u; j++)
+                            {
+                                dwords.data[i * 4u + j] = result[j];
+                            }
+                        }
+                    }
+                }
+            }
+
+            template <typename DataT>
+            ROCWMMA_DEVICE static inline void store(DataT* dataPtr, DataT const& data)
+            {
+                constexpr uint32_t Bytes = sizeof(DataT);
+
+                if constexpr(Bytes == 1u)
+                {
+                    __builtin_nontemporal_store(reinterpret_cast<int8_t const&>(data),
+                                                reinterpret_cast<int8_t*>(dataPtr));
+                }
+                else if constexpr(Bytes == 2u)
+                {
+                    __builtin_nontemporal_store(reinterpret_cast<int16_t const&>(data),
+                                                reinterpret_cast<int16_t*>(dataPtr));
+                }
+                else
+                {
+                    static_assert(Bytes % sizeof(int32_t) == 0u,
+                                  "DataT size must be B8, B16 or a multiple of B32");
+
+                    // Vectorize to B32 so that we can support any B32 multiple.
+                    constexpr uint32_t B32VecSize = Bytes / sizeof(int32_t);
+                    using B32VecT                 = VecT<int32_t, B32VecSize>;
+                    auto const& dwords            = reinterpret_cast<B32VecT const&>(data);
+
+                    if constexpr(B32VecSize == 1u)
+                    {
+                        __builtin_nontemporal_store(dwords.data[0],
+                                                    reinterpret_cast<int32_t*>(dataPtr));
+                    }
+                    else if constexpr(B32VecSize == 2u)
+                    {
+                        NonTemporalB64T input = {dwords.data[0], dwords.data[1]};
+                        __builtin_nontemporal_store(input,
+                                                    reinterpret_cast<NonTemporalB64T*>(dataPtr));
+                    }
+                    else
+                    {
+                        static_assert(B32VecSize % 4u == 0u,
+                                      "DataT size must be a multiple of B128");
+
+                        // Largest store is B128
+                        auto* dst = reinterpret_cast<NonTemporalB128T*>(dataPtr);
+#pragma unroll
+                        for(uint32_t i = 0; i < B32VecSize / 4u; i++)
+                        {
+                            NonTemporalB128T input = {dwords.data[i * 4u],
+                                                      dwords.data[i * 4u + 1u],
+                                                      dwords.data[i * 4u + 2u],
+                                                      dwords.data[i * 4u + 3u]};
+                            __builtin_nontemporal_store(input, dst + i);
+                        }
+                    }
+                }
+            }
+        };
+
+    } // namespace detail
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_CACHE_POLICY_HPP
@@ -58,6 +58,10 @@ namespace rocwmma
  * @param MappingUtil global mapping utility for current fragment
  * @param Loader Issues cooperative load instructions for raw fragment data
  * @param Storer Issues cooperative store instructions for raw fragment data
+ * @param PolicyLoader Loader issuing load instructions with the given cache policy
+ * @param PolicyStorer Storer issuing store instructions with the given cache policy
+ * @param SwizzledLoader Loader issuing load instructions in xor swizzled memory
+ * @param SwizzledStorer Storer issuing store instructions in xor swizzled memory
  */
 
     template <typename MatrixT,
@@ -78,19 +82,53 @@ namespace rocwmma
         using MappingUtil
             = MappingUtil<IOShape::BlockHeight, IOShape::BlockWidth, DataT, DataLayoutT>;
 
-        using Loader = CooperativeLoad<IOShape::BlockDim,
-                                       IOShape::KDim,
-                                       DataT,
-                                       typename IOLayout::DataLayout,
-                                       typename IOLayout::MatrixLayout,
-                                       IOLayout::VW>;
+        template <typename CachePolicy>
+        using PolicyLoader = CooperativeLoad<IOShape::BlockDim,
+                                             IOShape::KDim,
+                                             DataT,
+                                             typename IOLayout::DataLayout,
+                                             typename IOLayout::MatrixLayout,
+                                             IOLayout::VW,
+                                             CachePolicy>;
 
-        using Storer = CooperativeStore<IOShape::BlockDim,
-                                        IOShape::KDim,
-                                        DataT,
-                                        typename IOLayout::DataLayout,
-                                        typename IOLayout::MatrixLayout,
-                                        IOLayout::VW>;
+        template <typename CachePolicy>
+        using PolicyStorer = CooperativeStore<IOShape::BlockDim,
+                                              IOShape::KDim,
+                                              DataT,
+                                              typename IOLayout::DataLayout,
+                                              typename IOLayout::MatrixLayout,
+                                              IOLayout::VW,
+                                              CachePolicy>;
+
+        template <uint32_t ChunkSize,
+                  uint32_t ChunkCount,
+                  uint32_t LineGroup,
+                  typename CachePolicy = cache_default>
+        using SwizzledLoader
+            = CooperativeLoad<IOShape::BlockDim,
+                              IOShape::KDim,
+                              DataT,
+                              DataLayout::XorSwizzle<DataLayoutT, ChunkSize, ChunkCount, LineGroup>,
+                              typename IOLayout::MatrixLayout,
+                              IOLayout::VW,
+                              CachePolicy>;
+
+        template <uint32_t ChunkSize,
+                  uint32_t ChunkCount,
+                  uint32_t LineGroup,
+                  typename CachePolicy = cache_default>
+        using SwizzledStorer
+            = CooperativeStore<IOShape::BlockDim,
+                               IOShape::KDim,
+                               DataT,
+                               DataLayout::
+                                   XorSwizzle<DataLayoutT, ChunkSize, ChunkCount, LineGroup>,
+                               typename IOLayout::MatrixLayout,
+                               IOLayout::VW,
+                               CachePolicy>;
+
+        using Loader = PolicyLoader<cache_default>;
+        using Storer = PolicyStorer<cache_default>;
     };
 
     /************************************************
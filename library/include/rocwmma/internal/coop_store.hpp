@@ -26,6 +26,7 @@
 #ifndef ROCWMMA_COOP_STORE_HPP
 #define ROCWMMA_COOP_STORE_HPP
 
+#include "io_bounds.hpp"
 #include "io_traits.hpp"
 #include "layout.hpp"
 #include "opaque_store.hpp"
@@ -40,7 +41,8 @@ namespace rocwmma
               typename DataT,
               class DataLayout,
               class MatrixLayout,
-              uint32_t VectorWidth>
+              uint32_t VectorWidth,
+              typename CachePolicy = cache_default>
     struct CooperativeStore
     {
         using IOTraits = IOTraits<BlockDim, BlockK, DataT, VectorWidth>;
@@ -53,7 +55,7 @@ namespace rocwmma
 
             // Store implementation
             // Iteratively stores the entire block
-            using Storer = detail::amdgcn_opaque_store<DataT, VectorWidth>;
+            using Storer = detail::amdgcn_opaque_store<DataT, VectorWidth, CachePolicy>;
             using StoreT = typename Storer::StoreT;
 
             // Block input vector
@@ -99,6 +101,89 @@ namespace rocwmma
             }
         }
 
+        // Bounds-aware variant of the above, which also tracks the
+        // matrix coordinate of each vector to predicate the store.
+        template <size_t Depth = 0, typename Iterator, typename StrideSpace, typename Strides2d>
+        ROCWMMA_DEVICE static inline auto unroll_right(DataT*         dataPtr,
+                                                       Iterator&      in,
+                                                       uint32_t       ldm,
+                                                       Coord2d        matrixCoord,
+                                                       Coord2d const& extent,
+                                                       StrideSpace&&  strideCounts,
+                                                       Strides2d&&    strides2d)
+        {
+            static_assert(VecTraits<decay_t<StrideSpace>>::size()
+                              == VecTraits<decay_t<Strides2d>>::size(),
+                          "Mismatched size");
+            auto stride2d     = get<Depth>(strides2d);
+            auto strideOffset = DataLayout::fromMatrixCoord(stride2d, ldm);
+            auto strideCount  = get<Depth>(strideCounts);
+
+            // Last depth layer will invoke the store
+            if constexpr(Depth == (VecTraits<decay_t<StrideSpace>>::size() - 1u))
+            {
+#pragma unroll
+                for(int i = 0; i < strideCount; i++)
+                {
+                    Traits::Storer::template exec<typename DataLayout::Orientation>(
+                        dataPtr, *in, matrixCoord, extent);
+                    dataPtr += strideOffset;
+                    matrixCoord = matrixCoord + stride2d;
+                    in++;
+                }
+            }
+            // Recurse to the next nested layer
+            else
+            {
+                for(int i = 0; i < strideCount; i++)
+                {
+                    unroll_right<Depth + 1>(
+                        dataPtr, in, ldm, matrixCoord, extent, strideCounts, strides2d);
+                    dataPtr += strideOffset;
+                    matrixCoord = matrixCoord + stride2d;
+                }
+            }
+        }
+
+        // Variant of the above for non-affine (e.g. swizzled) data layouts,
+        // where the offset of each vector is calculated from its matrix coordinate.
+        template <size_t Depth = 0, typename Iterator, typename StrideSpace, typename Strides2d>
+        ROCWMMA_DEVICE static inline auto unroll_right(DataT*        dataPtr,
+                                                       Iterator&     in,
+                                                       uint32_t      ldm,
+                                                       Coord2d       matrixCoord,
+                                                       StrideSpace&& strideCounts,
+                                                       Strides2d&&   strides2d)
+        {
+            static_assert(VecTraits<decay_t<StrideSpace>>::size()
+                              == VecTraits<decay_t<Strides2d>>::size(),
+                          "Mismatched size");
+            auto stride2d    = get<Depth>(strides2d);
+            auto strideCount = get<Depth>(strideCounts);
+
+            // Last depth layer will invoke the store
+            if constexpr(Depth == (VecTraits<decay_t<StrideSpace>>::size() - 1u))
+            {
+#pragma unroll
+                for(int i = 0; i < strideCount; i++)
+                {
+                    Traits::Storer::exec(
+                        dataPtr, *in, DataLayout::fromMatrixCoord(matrixCoord, ldm));
+                    matrixCoord = matrixCoord + stride2d;
+                    in++;
+                }
+            }
+            // Recurse to the next nested layer
+            else
+            {
+                for(int i = 0; i < strideCount; i++)
+                {
+                    unroll_right<Depth + 1>(dataPtr, in, ldm, matrixCoord, strideCounts, strides2d);
+                    matrixCoord = matrixCoord + stride2d;
+                }
+            }
+        }
+
         constexpr static uint32_t calcMaxWaves(uint32_t workItems, uint32_t waveCount)
         {
             return (workItems % waveCount == 0 ? waveCount
@@ -144,6 +229,142 @@ namespace rocwmma
             // Align threads to starting matrix offset coordinates
             auto baseOffset = MatrixLayout::baseOffset();
 
+            // Find current wave offset
+            constexpr auto sum               = [](auto... items) { return (items + ...); };
+            auto           currentWaveOffset = apply(
+                sum, inflate_coord_left(waveIndex * workItemsPerWave, strideSpaceR) * stridesR);
+
+            if constexpr((bool)DataLayout::IsAffine)
+            {
+                unroll_right(
+                    dataPtr + DataLayout::fromMatrixCoord(baseOffset + currentWaveOffset, ldm),
+                    it,
+                    ldm,
+                    strideSpaceW,
+                    strides);
+            }
+            else
+            {
+                unroll_right(
+                    dataPtr, it, ldm, baseOffset + currentWaveOffset, strideSpaceW, strides);
+            }
+        }
+
+        template <uint32_t WaveCount>
+        ROCWMMA_DEVICE static inline void exec(DataT*                         dataPtr,
+                                               typename Traits::InputT const& data,
+                                               uint32_t                       ldm,
+                                               uint32_t                       waveIndex)
+        {
+            // Full fragment work
+            constexpr auto strideSpace = MatrixLayout::strideCounts();
+            constexpr auto strides     = MatrixLayout::strides();
+
+            // Drop the VW strides for splitting (reduced stride space).
+            constexpr auto strideSpaceR = pop_right(strideSpace);
+            constexpr auto stridesR     = pop_right(strides);
+            constexpr auto totalWorkItems
+                = flatten_coord_left((strideSpaceR - 1u), strideSpaceR) + 1u;
+
+            // Determine max waves possible.
+            constexpr auto maxWaves = calcMaxWaves((uint32_t)totalWorkItems, (uint32_t)WaveCount);
+
+            // maxWaves is the maximum amount of waves split the work into.
+            // For the rest of the waves, bail out
+            if constexpr(WaveCount != maxWaves)
+            {
+                if(__builtin_amdgcn_readfirstlane(waveIndex) >= maxWaves)
+                {
+                    return; // bail
+                }
+            }
+
+            // Split the reduced stride space.
+            constexpr auto workItemsPerWave = max(totalWorkItems / maxWaves, 1u);
+            constexpr auto strideSpaceS
+                = inflate_coord_left(workItemsPerWave - 1u, strideSpaceR) + 1u;
+
+            // Add back in the VW dimension, for the full stride
+            // space of the current wave
+            constexpr auto strideSpaceW
+                = vector_cat(strideSpaceS, make_vector(get_last(strideSpace)));
+
+            // Alias the original frag due to smaller split size
+            auto& dataR = (typename StoreVecTraits::template VecT<
+                           DataT,
+                           workItemsPerWave * StoreVecTraits::size()> const&)(data);
+            auto  it    = makeVectorIterator<StoreVecTraits::size()>(dataR).begin();
+
+            // Align threads to starting matrix offset coordinates
+            auto baseOffset = MatrixLayout::baseOffset();
+
+            // Find current wave offset
+            constexpr auto sum               = [](auto... items) { return (items + ...); };
+            auto           currentWaveOffset = apply(
+                sum, inflate_coord_left(waveIndex * workItemsPerWave, strideSpaceR) * stridesR);
+
+            if constexpr((bool)DataLayout::IsAffine)
+            {
+                unroll_right(
+                    dataPtr + DataLayout::fromMatrixCoord(baseOffset + currentWaveOffset, ldm),
+                    it,
+                    ldm,
+                    strideSpaceW,
+                    strides);
+            }
+            else
+            {
+                unroll_right(
+                    dataPtr, it, ldm, baseOffset + currentWaveOffset, strideSpaceW, strides);
+            }
+        }
+
+        // Bounds-aware cooperative store of the block with (rows, cols) extent
+        // remaining in the matrix from dataPtr. Elements outside of the extent
+        // are not written.
+        ROCWMMA_DEVICE static inline void exec(DataT*                         dataPtr,
+                                               typename Traits::InputT const& data,
+                                               uint32_t                       ldm,
+                                               uint32_t                       waveIndex,
+                                               uint32_t                       waveCount,
+                                               Coord2d const&                 extent)
+        {
+            static_assert((bool)DataLayout::IsAffine,
+                          "Bounded stores are not supported for non-affine data layouts");
+
+            // Full fragment work
+            constexpr auto strideSpace = MatrixLayout::strideCounts();
+            constexpr auto strides     = MatrixLayout::strides();
+
+            // Drop the VW strides for splitting (reduced stride space).
+            constexpr auto strideSpaceR = pop_right(strideSpace);
+            constexpr auto stridesR     = pop_right(strides);
+            constexpr auto totalWorkItems
+                = flatten_coord_left((strideSpaceR - 1u), strideSpaceR) + 1u;
+
+            // Determine max waves possible.
+            auto maxWaves = calcMaxWaves((uint32_t)totalWorkItems, (uint32_t)waveCount);
+
+            // maxWaves is the maximum amount of waves split the work into.
+            // For the rest of the waves, bail out
+            if(__builtin_amdgcn_readfirstlane(waveIndex) >= maxWaves)
+            {
+                return; // bail
+            }
+
+            // Split the reduced stride space.
+            auto workItemsPerWave = max(totalWorkItems / maxWaves, 1u);
+            auto strideSpaceS     = inflate_coord_left(workItemsPerWave - 1u, strideSpaceR) + 1u;
+
+            // Add back in the VW dimension, for the full stride
+            // space of the current wave
+            auto strideSpaceW = vector_cat(strideSpaceS, make_vector(get_last(strideSpace)));
+
+            auto it = makeVectorIterator<StoreVecTraits::size()>(data).begin();
+
+            // Align threads to starting matrix offset coordinates
+            auto baseOffset = MatrixLayout::baseOffset();
+
             // Find current wave offset
             constexpr auto sum               = [](auto... items) { return (items + ...); };
             auto           currentWaveOffset = apply(
@@ -152,6 +373,8 @@ namespace rocwmma
             unroll_right(dataPtr + DataLayout::fromMatrixCoord(baseOffset + currentWaveOffset, ldm),
                          it,
                          ldm,
+                         baseOffset + currentWaveOffset,
+                         extent,
                          strideSpaceW,
                          strides);
         }
@@ -160,8 +383,12 @@ namespace rocwmma
         ROCWMMA_DEVICE static inline void exec(DataT*                         dataPtr,
                                                typename Traits::InputT const& data,
                                                uint32_t                       ldm,
-                                               uint32_t                       waveIndex)
+                                               uint32_t                       waveIndex,
+                                               Coord2d const&                 extent)
         {
+            static_assert((bool)DataLayout::IsAffine,
+                          "Bounded stores are not supported for non-affine data layouts");
+
             // Full fragment work
             constexpr auto strideSpace = MatrixLayout::strideCounts();
             constexpr auto strides     = MatrixLayout::strides();
@@ -212,6 +439,8 @@ namespace rocwmma
             unroll_right(dataPtr + DataLayout::fromMatrixCoord(baseOffset + currentWaveOffset, ldm),
                          it,
                          ldm,
+                         baseOffset + currentWaveOffset,
+                         extent,
                          strideSpaceW,
                          strides);
         }
@@ -0,0 +1,323 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_DEQUANT_LOAD_HPP
+#define ROCWMMA_DEQUANT_LOAD_HPP
+
+#include "cache_policy.hpp"
+#include "io_bounds.hpp"
+#include "io_traits.hpp"
+#include "layout.hpp"
+#include "opaque_load.hpp"
+#include "types.hpp"
+#include "vector_iterator.hpp"
+
+namespace rocwmma
+{
+
+    namespace detail
+    {
+        // Nibble access for packed 4-bit integers. Element i of the
+        // packed byte is held in bits [4i, 4i + 4).
+        template <typename PackedT>
+        struct Int4Traits;
+
+        template <>
+        struct Int4Traits<int4x2_t>
+        {
+            ROCWMMA_HOST_DEVICE constexpr static inline int32_t unpack(uint32_t byte, uint32_t i)
+            {
+                // Sign extend from 4 bits
+                return static_cast<int32_t>(((byte >> (i * 4u)) & 0xFu) ^ 0x8u) - 8;
+            }
+
+            ROCWMMA_HOST_DEVICE constexpr static inline uint8_t pack(int32_t first, int32_t second)
+            {
+                return static_cast<uint8_t>((static_cast<uint32_t>(first) & 0xFu)
+                                            | ((static_cast<uint32_t>(second) & 0xFu) << 4u));
+            }
+        };
+
+        template <>
+        struct Int4Traits<uint4x2_t>
+        {
+            ROCWMMA_HOST_DEVICE constexpr static inline int32_t unpack(uint32_t byte, uint32_t i)
+            {
+                return static_cast<int32_t>((byte >> (i * 4u)) & 0xFu);
+            }
+
+            ROCWMMA_HOST_DEVICE constexpr static inline uint8_t pack(int32_t first, int32_t second)
+            {
+                return Int4Traits<int4x2_t>::pack(first, second);
+            }
+        };
+
+    } // namespace detail
+
+    /*! \struct DequantLoad
+    *  \brief Loads packed 4-bit integers in the register layout of a DataT
+    *  fragment, expanding each vector to DataT in registers. Optionally, each
+    *  element is dequantized as (q - zero) * scale, with one scale and zero-point
+    *  per GroupSize consecutive elements in the K dimension.
+    *
+    * The packed data has the same layout as the DataT matrix, where each pair of
+    * consecutive elements in memory shares a byte. Offsets and the leading
+    * dimension are therefore counted in elements. Vectors of more than one
+    * element are read as whole bytes, so must begin at even offsets. Single
+    * element vectors select their nibble from the offset parity instead.
+    *
+    * The scale and zero-point matrices are the DataT matrix reduced by GroupSize
+    * in the K dimension, in the same data layout.
+    *
+    * @tparam BlockDim/BlockK fragment block dimensions
+    * @tparam PackedT packed storage type as int4x2_t or uint4x2_t
+    * @tparam DataT fragment data type
+    * @tparam DataLayout 1d layout of the matrix in memory
+    * @tparam MatrixLayout 2d layout of the fragment registers
+    * @tparam VectorWidth number of contiguous elements per IO
+    * @tparam KIndex index of the K dimension in matrix coordinates
+    * @tparam CachePolicy cache policy of the packed loads
+    */
+    template <uint32_t BlockDim,
+              uint32_t BlockK,
+              typename PackedT,
+              typename DataT,
+              class DataLayout,
+              class MatrixLayout,
+              uint32_t VectorWidth,
+              uint32_t KIndex,
+              typename CachePolicy = cache_default>
+    struct DequantLoad
+    {
+        using IOTraits = IOTraits<BlockDim, BlockK, DataT, VectorWidth>;
+
+        static_assert(VectorWidth == 1u || VectorWidth % 2u == 0u,
+                      "Packed vectors must contain whole bytes");
+        static_assert(KIndex < 2u, "K must be either the row or column index");
+
+        struct Traits
+        {
+            // Each vector of DataT is read as whole bytes of packed pairs.
+            using Loader = detail::
+                amdgcn_opaque_load<uint8_t, max(VectorWidth / 2u, 1u), CachePolicy>;
+            using LoadT   = typename Loader::LoadT;
+            using ResultT = VecT<DataT, VectorWidth>;
+            using OutputT = VecT<DataT, IOTraits::UnpackedSize>;
+        };
+
+        using ResultVecTraits = VecTraits<typename Traits::ResultT>;
+
+        // Element i of the vector at the given element offset
+        ROCWMMA_DEVICE static inline int32_t
+            unpack(typename Traits::LoadT const& packed, index_t offset, uint32_t i)
+        {
+            if constexpr(VectorWidth == 1u)
+            {
+                return detail::Int4Traits<PackedT>::unpack(packed.data[0], offset % 2u);
+            }
+            else
+            {
+                return detail::Int4Traits<PackedT>::unpack(packed.data[i / 2u], i % 2u);
+            }
+        }
+
+        template <typename Iterator>
+        ROCWMMA_DEVICE static inline void dequant(Iterator&      out,
+                                                  uint8_t const* dataPtr,
+                                                  index_t        offset,
+                                                  Coord2d const& /*matrixCoord*/)
+        {
+            auto packed = typename Traits::LoadT{};
+            Traits::Loader::exec(packed, dataPtr, offset / 2);
+
+            auto result = typename Traits::ResultT{};
+#pragma unroll
+            for(uint32_t i = 0; i < VectorWidth; i++)
+            {
+                auto q = unpack(packed, offset, i);
+                if constexpr(is_integral<DataT>::value)
+                {
+                    result.data[i] = static_cast<DataT>(q);
+                }
+                else
+                {
+                    result.data[i] = static_cast<DataT>(static_cast<float32_t>(q));
+                }
+            }
+            *out = result;
+        }
+
+        template <typename Iterator, uint32_t GroupSize>
+        ROCWMMA_DEVICE static inline void dequant(Iterator&      out,
+                                                  uint8_t const* dataPtr,
+                                                  index_t        offset,
+                                                  Coord2d const& matrixCoord,
+                                                  integral_constant<uint32_t, GroupSize>,
+                                                  DataT const* scales,
+                                                  DataT const* zeros,
+                                                  uint32_t     lds)
+        {
+            using Bounds = detail::IOBounds<typename DataLayout::Orientation, VectorWidth>;
+
+            // Vectors in K are aligned to their width, so a single
+            // group spans the whole vector if it divides the group.
+            constexpr bool SharedGroup
+                = (Bounds::MinorIndex != KIndex) ? false : (GroupSize % VectorWidth == 0u);
+
+            auto packed = typename Traits::LoadT{};
+            Traits::Loader::exec(packed, dataPtr, offset / 2);
+
+            auto result = typename Traits::ResultT{};
+#pragma unroll
+            for(uint32_t i = 0; i < VectorWidth; i++)
+            {
+                auto groupCoord = Bounds::elementCoord(matrixCoord, SharedGroup ? 0u : i);
+                get<KIndex>(groupCoord) /= GroupSize;
+
+                auto groupOffset = DataLayout::fromMatrixCoord(groupCoord, lds);
+                auto scale       = static_cast<float32_t>(scales[groupOffset]);
+                auto zero
+                    = zeros != nullptr ? static_cast<float32_t>(zeros[groupOffset]) : 0.0f;
+
+                auto q = unpack(packed, offset, i);
+                result.data[i] = static_cast<DataT>((static_cast<float32_t>(q) - zero) * scale);
+            }
+            *out = result;
+        }
+
+        // Outer loop = index 0,
+        // Inner loop = index N-1
+        template <size_t Depth = 0,
+                  typename Iterator,
+                  typename StrideCounts,
+                  typename Strides2d,
+                  typename... DequantArgs>
+        ROCWMMA_DEVICE static inline auto unroll_right(Iterator&      out,
+                                                       uint8_t const* dataPtr,
+                                                       index_t        offset,
+                                                       uint32_t       ldm,
+                                                       Coord2d        matrixCoord,
+                                                       StrideCounts&& strideCounts,
+                                                       Strides2d&&    strides2d,
+                                                       DequantArgs&&... dequantArgs)
+        {
+            auto stride2d     = get<Depth>(strides2d);
+            auto strideOffset = DataLayout::fromMatrixCoord(stride2d, ldm);
+            auto strideCount  = get<Depth>(strideCounts);
+
+            // Last depth layer will invoke the load
+            if constexpr(Depth == (VecTraits<decay_t<StrideCounts>>::size() - 1u))
+            {
+#pragma unroll
+                for(int i = 0; i < strideCount; i++)
+                {
+                    dequant(out, dataPtr, offset, matrixCoord, dequantArgs...);
+                    offset += strideOffset;
+                    matrixCoord = matrixCoord + stride2d;
+                    out++;
+                }
+            }
+            // Recurse to the next nested layer
+            else
+            {
+#pragma unroll
+                for(int i = 0; i < strideCount; i++)
+                {
+                    unroll_right<Depth + 1>(out,
+                                            dataPtr,
+                                            offset,
+                                            ldm,
+                                            matrixCoord,
+                                            strideCounts,
+                                            strides2d,
+                                            dequantArgs...);
+                    offset += strideOffset;
+                    matrixCoord = matrixCoord + stride2d;
+                }
+            }
+        }
+
+        // Loads and expands packed values to DataT.
+        ROCWMMA_DEVICE static void
+            exec(typename Traits::OutputT& data, PackedT const* dataPtr, uint32_t ldm)
+        {
+            // Arrange wave threads to starting matrix layout offsets.
+            auto baseOffset2d = MatrixLayout::baseOffset();
+            auto it           = makeVectorIterator<ResultVecTraits::size()>(data).begin();
+
+            static_assert(decltype(it)::range() == IOTraits::IOCount,
+                          "IOCount inconsistent with iterator range");
+
+            // Unroll loading in each strided dimension
+            // Offsets are tracked in elements, of which each byte holds two
+            unroll_right(it,
+                         reinterpret_cast<uint8_t const*>(dataPtr),
+                         DataLayout::fromMatrixCoord(baseOffset2d, ldm),
+                         ldm,
+                         baseOffset2d,
+                         MatrixLayout::strideCounts(),
+                         MatrixLayout::strides());
+        }
+
+        // Loads and dequantizes packed values with per-group scales and zero-points.
+        // Zero-points are not applied if zeros is null.
+        template <uint32_t GroupSize>
+        ROCWMMA_DEVICE static void exec(typename Traits::OutputT& data,
+                                        PackedT const*            dataPtr,
+                                        uint32_t                  ldm,
+                                        DataT const*              scales,
+                                        DataT const*              zeros,
+                                        uint32_t                  lds)
+        {
+            static_assert(GroupSize > 0u, "Group size must be greater than 0");
+            static_assert(GroupSize % BlockK == 0u || BlockK % GroupSize == 0u,
+                          "Groups must either span the block K or evenly divide it");
+
+            // Arrange wave threads to starting matrix layout offsets.
+            auto baseOffset2d = MatrixLayout::baseOffset();
+            auto it           = makeVectorIterator<ResultVecTraits::size()>(data).begin();
+
+            static_assert(decltype(it)::range() == IOTraits::IOCount,
+                          "IOCount inconsistent with iterator range");
+
+            // Unroll loading in each strided dimension
+            // Offsets are tracked in elements, of which each byte holds two
+            unroll_right(it,
+                         reinterpret_cast<uint8_t const*>(dataPtr),
+                         DataLayout::fromMatrixCoord(baseOffset2d, ldm),
+                         ldm,
+                         baseOffset2d,
+                         MatrixLayout::strideCounts(),
+                         MatrixLayout::strides(),
+                         integral_constant<uint32_t, GroupSize>{},
+                         scales,
+                         zeros,
+                         lds);
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DEQUANT_LOAD_HPP
@@ -0,0 +1,227 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_EPILOGUE_STORE_HPP
+#define ROCWMMA_EPILOGUE_STORE_HPP
+
+#include "cache_policy.hpp"
+#include "io_bounds.hpp"
+#include "io_traits.hpp"
+#include "layout.hpp"
+#include "opaque_load.hpp"
+#include "opaque_store.hpp"
+#include "types.hpp"
+#include "vector_iterator.hpp"
+
+namespace rocwmma
+{
+
+    /*! \struct EpilogueStore
+    *  \brief Fused accumulator store, which walks the accumulator register
+    *  layout once. For each vector it reads the source matrix C (if any),
+    *  applies the epilogue functor element-wise with the element's (row, col)
+    *  coordinate in the block, converts to the output type and stores D.
+    *
+    * @tparam BlockDim/BlockK accumulator block dimensions
+    * @tparam ComputeT accumulator data type
+    * @tparam OutputT data type of C and D
+    * @tparam DataLayout 1d layout of the accumulator in memory
+    * @tparam MatrixLayout 2d layout of the accumulator registers
+    * @tparam VectorWidth number of contiguous elements per IO
+    * @tparam CachePolicy cache policy of the D stores
+    */
+    template <uint32_t BlockDim,
+              uint32_t BlockK,
+              typename ComputeT,
+              typename OutputT,
+              class DataLayout,
+              class MatrixLayout,
+              uint32_t VectorWidth,
+              typename CachePolicy = cache_default>
+    struct EpilogueStore
+    {
+        using IOTraits = IOTraits<BlockDim, BlockK, ComputeT, VectorWidth>;
+
+        struct Traits
+        {
+            // Source reads and output writes are of the same width as the
+            // accumulator vectors, such that their coordinates coincide.
+            using Loader = detail::amdgcn_opaque_load<OutputT, VectorWidth>;
+            using Storer = detail::amdgcn_opaque_store<OutputT, VectorWidth, CachePolicy>;
+            using LoadT  = typename Loader::LoadT;
+            using StoreT = typename Storer::StoreT;
+            using AccumT = VecT<ComputeT, VectorWidth>;
+            using InputT = VecT<ComputeT, IOTraits::UnpackedSize>;
+        };
+
+        using AccumVecTraits = VecTraits<typename Traits::AccumT>;
+
+        template <bool ReadSource, typename EpilogueT>
+        ROCWMMA_DEVICE static inline void applyEpilogue(OutputT*                       dataPtr,
+                                                        OutputT const*                 srcPtr,
+                                                        typename Traits::AccumT const& accum,
+                                                        Coord2d const&                 matrixCoord,
+                                                        EpilogueT const&               epilogue)
+        {
+            using Bounds = detail::IOBounds<typename DataLayout::Orientation, VectorWidth>;
+
+            auto src = typename Traits::LoadT{};
+            if constexpr(ReadSource)
+            {
+                Traits::Loader::exec(src, srcPtr);
+            }
+
+            auto result = typename Traits::StoreT{};
+#pragma unroll
+            for(uint32_t i = 0; i < VectorWidth; i++)
+            {
+                auto elementCoord = Bounds::elementCoord(matrixCoord, i);
+                result.data[i]    = static_cast<OutputT>(epilogue(accum.data[i],
+                                                               src.data[i],
+                                                               get<0>(elementCoord),
+                                                               get<1>(elementCoord)));
+            }
+
+            Traits::Storer::exec(dataPtr, result);
+        }
+
+        template <bool   ReadSource,
+                  size_t Depth = 0,
+                  typename Iterator,
+                  typename EpilogueT,
+                  typename StrideCounts,
+                  typename Strides2d>
+        ROCWMMA_DEVICE static inline auto unroll_right(OutputT*         dataPtr,
+                                                       OutputT const*   srcPtr,
+                                                       Iterator&        in,
+                                                       uint32_t         ldm,
+                                                       uint32_t         ldsrc,
+                                                       Coord2d          matrixCoord,
+                                                       EpilogueT const& epilogue,
+                                                       StrideCounts&&   strideCounts,
+                                                       Strides2d&&      strides2d)
+        {
+            auto stride2d        = get<Depth>(strides2d);
+            auto strideOffset    = DataLayout::fromMatrixCoord(stride2d, ldm);
+            auto srcStrideOffset = DataLayout::fromMatrixCoord(stride2d, ldsrc);
+            auto strideCount     = get<Depth>(strideCounts);
+
+            // Last depth layer will invoke the epilogue
+            if constexpr(Depth == (VecTraits<decay_t<StrideCounts>>::size() - 1u))
+            {
+#pragma unroll
+                for(int i = 0; i < strideCount; i++)
+                {
+                    applyEpilogue<ReadSource>(dataPtr, srcPtr, *in, matrixCoord, epilogue);
+                    dataPtr += strideOffset;
+                    if constexpr(ReadSource)
+                    {
+                        srcPtr += srcStrideOffset;
+                    }
+                    matrixCoord = matrixCoord + stride2d;
+                    in++;
+                }
+            }
+            // Recurse to the next nested layer
+            else
+            {
+#pragma unroll
+                for(int i = 0; i < strideCount; i++)
+                {
+                    unroll_right<ReadSource, Depth + 1>(dataPtr,
+                                                        srcPtr,
+                                                        in,
+                                                        ldm,
+                                                        ldsrc,
+                                                        matrixCoord,
+                                                        epilogue,
+                                                        strideCounts,
+                                                        strides2d);
+                    dataPtr += strideOffset;
+                    if constexpr(ReadSource)
+                    {
+                        srcPtr += srcStrideOffset;
+                    }
+                    matrixCoord = matrixCoord + stride2d;
+                }
+            }
+        }
+
+        // Stores epilogue(accum, C, row, col) to D. The source matrix C is
+        // not read if srcPtr is null, in which case the epilogue receives zero.
+        template <typename EpilogueT>
+        ROCWMMA_DEVICE static void exec(OutputT*                       dataPtr,
+                                        typename Traits::InputT const& data,
+                                        uint32_t                       ldm,
+                                        OutputT const*                 srcPtr,
+                                        uint32_t                       ldsrc,
+                                        EpilogueT const&               epilogue)
+        {
+            // Arrange wave threads to starting matrix layout offsets.
+            auto baseOffset2d = MatrixLayout::baseOffset();
+            auto it           = makeVectorIterator<AccumVecTraits::size()>(data).begin();
+
+            static_assert(decltype(it)::range() == IOTraits::IOCount,
+                          "IOCount inconsistent with iterator range");
+
+            // Make sure that the IOCount is consistent with the number of total strides
+            static_assert(IOTraits::IOCount
+                              == apply([](auto... items) { return (items * ...); },
+                                       MatrixLayout::strideCounts()),
+                          "IOCount inconsistent with total strides");
+
+            auto* dstAddr = dataPtr + DataLayout::fromMatrixCoord(baseOffset2d, ldm);
+
+            // Presence of C is wave-uniform, so only branch once.
+            if(srcPtr != nullptr)
+            {
+                unroll_right<true>(dstAddr,
+                                   srcPtr + DataLayout::fromMatrixCoord(baseOffset2d, ldsrc),
+                                   it,
+                                   ldm,
+                                   ldsrc,
+                                   baseOffset2d,
+                                   epilogue,
+                                   MatrixLayout::strideCounts(),
+                                   MatrixLayout::strides());
+            }
+            else
+            {
+                unroll_right<false>(dstAddr,
+                                    srcPtr,
+                                    it,
+                                    ldm,
+                                    ldsrc,
+                                    baseOffset2d,
+                                    epilogue,
+                                    MatrixLayout::strideCounts(),
+                                    MatrixLayout::strides());
+            }
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_EPILOGUE_STORE_HPP
@@ -70,11 +70,18 @@ namespace rocwmma
         template <int32_t vmcnt, int32_t lgkmcnt>
         struct amdgcn_s_waitcnt
         {
-            enum : const int16_t
+            // Counter fields are encoded differently per arch.
+            // Unused fields (e.g. expcnt) are zero and wait for completion.
+            enum : const uint16_t
             {
+#if ROCWMMA_ARCH_GFX11
+                vmcnt16   = (((0x3F) & vmcnt) << 10),
+                lgkmcnt16 = (((0x3F) & lgkmcnt) << 4),
+#else
                 vmcnt16   = (((0xF) & vmcnt) | (((0x30) & vmcnt) << 10)),
                 lgkmcnt16 = (((0xF) & lgkmcnt) << 8),
-                cnt       = vmcnt16 | lgkmcnt16
+#endif // ROCWMMA_ARCH_GFX11
+                cnt = vmcnt16 | lgkmcnt16
             };
 
             ROCWMMA_DEVICE static inline auto exec()
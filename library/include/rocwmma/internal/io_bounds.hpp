@@ -0,0 +1,115 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_IO_BOUNDS_HPP
+#define ROCWMMA_IO_BOUNDS_HPP
+
+#include "types.hpp"
+#include "utils.hpp"
+
+namespace rocwmma
+{
+    namespace detail
+    {
+        /*! \struct IOBounds
+        *  \brief Predicates used to mask partial tile IO at ragged matrix edges.
+        *
+        * Matrix coordinates are (row, col) offsets relative to the start of the
+        * block, and the extent is the number of (rows, cols) remaining in the
+        * matrix from that same starting point. Consecutive elements of a
+        * vector are contiguous in memory, and therefore advance along the
+        * minor dimension of the data layout.
+        *
+        * All predicates are available on host so that masking behaviour may
+        * be validated against host references.
+        *
+        * @tparam DataLayoutT in-memory layout as col_major or row_major
+        * @tparam VectorWidth number of contiguous elements per IO
+        */
+        template <typename DataLayoutT, uint32_t VectorWidth>
+        struct IOBounds
+        {
+            static_assert(VectorWidth > 0, "Vector width must be greater than 0");
+
+            enum : uint32_t
+            {
+                MinorIndex = is_same<DataLayoutT, row_major>::value ? 1u : 0u
+            };
+
+            // Matrix coordinate of the i'th vector element
+            ROCWMMA_HOST_DEVICE constexpr static inline Coord2d
+                elementCoord(Coord2d const& matrixCoord, uint32_t i)
+            {
+                return MinorIndex == 1u
+                           ? make_coord2d(get<0>(matrixCoord), get<1>(matrixCoord) + i)
+                           : make_coord2d(get<0>(matrixCoord) + i, get<1>(matrixCoord));
+            }
+
+            ROCWMMA_HOST_DEVICE constexpr static inline bool
+                isElementInBounds(Coord2d const& matrixCoord, Coord2d const& extent)
+            {
+                return (get<0>(matrixCoord) < get<0>(extent))
+                       && (get<1>(matrixCoord) < get<1>(extent));
+            }
+
+            ROCWMMA_HOST_DEVICE constexpr static inline bool isElementInBounds(
+                Coord2d const& matrixCoord, Coord2d const& extent, uint32_t i)
+            {
+                return isElementInBounds(elementCoord(matrixCoord, i), extent);
+            }
+
+            // Vector elements only differ in the minor dimension, so the
+            // entire vector is in bounds if the last element is.
+            ROCWMMA_HOST_DEVICE constexpr static inline bool
+                isVectorInBounds(Coord2d const& matrixCoord, Coord2d const& extent)
+            {
+                return isElementInBounds(matrixCoord, extent, VectorWidth - 1u);
+            }
+
+            // Number of elements in memory from the block origin up to and
+            // including the last element within the extent.
+            ROCWMMA_HOST_DEVICE constexpr static inline uint64_t
+                linearExtent(Coord2d const& extent, uint32_t ldm)
+            {
+                return (get<0>(extent) == 0u || get<1>(extent) == 0u)
+                           ? 0ull
+                           : static_cast<uint64_t>(get<1u - MinorIndex>(extent) - 1u) * ldm
+                                 + get<MinorIndex>(extent);
+            }
+        };
+
+        // Interior blocks are entirely covered by the extent, and
+        // may use IO without any predication.
+        template <uint32_t BlockHeight, uint32_t BlockWidth>
+        ROCWMMA_HOST_DEVICE constexpr static inline bool isBlockInBounds(Coord2d const& extent)
+        {
+            return (get<0>(extent) >= BlockHeight) && (get<1>(extent) >= BlockWidth);
+        }
+
+    } // namespace detail
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_IO_BOUNDS_HPP
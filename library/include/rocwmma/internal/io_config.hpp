@@ -27,6 +27,8 @@
 #define ROCWMMA_IO_CONFIG_HPP
 
 #include "broadcast.hpp"
+#include "buffer_load.hpp"
+#include "buffer_store.hpp"
 #include "coop_load.hpp"
 #include "coop_store.hpp"
 #include "io_shape.hpp"
@@ -60,6 +62,17 @@ namespace rocwmma
  * @param MappingUtil global mapping utility for current fragment
  * @param Loader Issues load instructions for raw fragment data
  * @param Storer Issues store instructions for raw fragment data
+ * @param OpaqueLoader Issues flat load instructions for raw fragment data
+ * @param OpaqueStorer Issues flat store instructions for raw fragment data
+ * @param BufferLoader Issues buffer load instructions for raw fragment data in global memory
+ * @param BufferStorer Issues buffer store instructions for raw fragment data in global memory
+ * @param PolicyLoader Loader issuing load instructions with the given cache policy
+ * @param PolicyStorer Storer issuing store instructions with the given cache policy
+ * @param SwizzledLoader Issues flat load instructions for raw fragment data in xor swizzled memory
+ * @param SwizzledStorer Issues flat store instructions for raw fragment data in xor swizzled memory
+ *
+ * Loader and Storer use the opaque (flat) backend, which addresses both global
+ * memory and LDS. The buffer backend is only selected per call, with buffer_io.
  */
 
     template <typename MatrixT,
@@ -81,19 +94,100 @@ namespace rocwmma
         using MappingUtil
             = MappingUtil<IOShape::BlockHeight, IOShape::BlockWidth, DataT, DataLayoutT>;
 
-        using Loader = OpaqueLoad<IOShape::BlockDim,
-                                  IOShape::KDim,
-                                  DataT,
-                                  typename IOLayout::DataLayout,
-                                  typename IOLayout::MatrixLayout,
-                                  IOLayout::VW>;
-
-        using Storer = OpaqueStore<IOShape::BlockDim,
-                                   IOShape::KDim,
-                                   DataT,
-                                   typename IOLayout::DataLayout,
-                                   typename IOLayout::MatrixLayout,
-                                   IOLayout::VW>;
+        using OpaqueLoader = OpaqueLoad<IOShape::BlockDim,
+                                        IOShape::KDim,
+                                        DataT,
+                                        typename IOLayout::DataLayout,
+                                        typename IOLayout::MatrixLayout,
+                                        IOLayout::VW>;
+
+        using OpaqueStorer = OpaqueStore<IOShape::BlockDim,
+                                         IOShape::KDim,
+                                         DataT,
+                                         typename IOLayout::DataLayout,
+                                         typename IOLayout::MatrixLayout,
+                                         IOLayout::VW>;
+
+        using BufferLoader = BufferLoad<IOShape::BlockDim,
+                                        IOShape::KDim,
+                                        DataT,
+                                        typename IOLayout::DataLayout,
+                                        typename IOLayout::MatrixLayout,
+                                        IOLayout::VW>;
+
+        using BufferStorer = BufferStore<IOShape::BlockDim,
+                                         IOShape::KDim,
+                                         DataT,
+                                         typename IOLayout::DataLayout,
+                                         typename IOLayout::MatrixLayout,
+                                         IOLayout::VW>;
+
+        // Flat IO by default, or raw buffer IO for the buffer_io policy
+        template <typename CachePolicy>
+        using PolicyLoader = conditional_t<
+            (bool)detail::CachePolicyTraits<CachePolicy>::IsBufferIO,
+            BufferLoad<IOShape::BlockDim,
+                       IOShape::KDim,
+                       DataT,
+                       typename IOLayout::DataLayout,
+                       typename IOLayout::MatrixLayout,
+                       IOLayout::VW,
+                       typename detail::CachePolicyTraits<CachePolicy>::CacheT>,
+            OpaqueLoad<IOShape::BlockDim,
+                       IOShape::KDim,
+                       DataT,
+                       typename IOLayout::DataLayout,
+                       typename IOLayout::MatrixLayout,
+                       IOLayout::VW,
+                       detail::amdgcn_opaque_load<DataT, IOLayout::VW, CachePolicy>>>;
+
+        template <typename CachePolicy>
+        using PolicyStorer = conditional_t<
+            (bool)detail::CachePolicyTraits<CachePolicy>::IsBufferIO,
+            BufferStore<IOShape::BlockDim,
+                        IOShape::KDim,
+                        DataT,
+                        typename IOLayout::DataLayout,
+                        typename IOLayout::MatrixLayout,
+                        IOLayout::VW,
+                        typename detail::CachePolicyTraits<CachePolicy>::CacheT>,
+            OpaqueStore<IOShape::BlockDim,
+                        IOShape::KDim,
+                        DataT,
+                        typename IOLayout::DataLayout,
+                        typename IOLayout::MatrixLayout,
+                        IOLayout::VW,
+                        detail::amdgcn_opaque_store<DataT, IOLayout::VW, CachePolicy>>>;
+
+        // Swizzled layouts are intended for LDS, which may only be addressed by flat IO.
+        template <uint32_t ChunkSize,
+                  uint32_t ChunkCount,
+                  uint32_t LineGroup,
+                  typename CachePolicy = cache_default>
+        using SwizzledLoader
+            = OpaqueLoad<IOShape::BlockDim,
+                         IOShape::KDim,
+                         DataT,
+                         DataLayout::XorSwizzle<DataLayoutT, ChunkSize, ChunkCount, LineGroup>,
+                         typename IOLayout::MatrixLayout,
+                         IOLayout::VW,
+                         detail::amdgcn_opaque_load<DataT, IOLayout::VW, CachePolicy>>;
+
+        template <uint32_t ChunkSize,
+                  uint32_t ChunkCount,
+                  uint32_t LineGroup,
+                  typename CachePolicy = cache_default>
+        using SwizzledStorer
+            = OpaqueStore<IOShape::BlockDim,
+                          IOShape::KDim,
+                          DataT,
+                          DataLayout::XorSwizzle<DataLayoutT, ChunkSize, ChunkCount, LineGroup>,
+                          typename IOLayout::MatrixLayout,
+                          IOLayout::VW,
+                          detail::amdgcn_opaque_store<DataT, IOLayout::VW, CachePolicy>>;
+
+        using Loader = OpaqueLoader;
+        using Storer = OpaqueStorer;
     };
 
     /************************************************
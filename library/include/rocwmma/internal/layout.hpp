@@ -41,6 +41,15 @@ namespace rocwmma
         using RowMajor = Array1d<row_major>;
         using ColMajor = Array1d<col_major>;
 
+        // Array1d with chunks of each line permuted by XOR with the line index.
+        // Used to avoid bank conflicts of fragment IO in LDS.
+        template <typename DataLayoutT,
+                  uint32_t ChunkSize,
+                  uint32_t ChunkCount,
+                  uint32_t LineGroup = 1u>
+        using XorSwizzle = typename ::rocwmma::detail::
+            template XorSwizzleSpace<DataLayoutT, ChunkSize, ChunkCount, LineGroup>;
+
     } // namespace DataLayout
 
     // In 2D space, Matrix Layouts describe per-thread offset coordinates and iterative spaces
@@ -141,14 +141,14 @@ namespace rocwmma
                 using MatrixCoordT = Coord2d;
             };
 
-            ROCWMMA_DEVICE constexpr static inline auto strideCounts()
+            ROCWMMA_HOST_DEVICE constexpr static inline auto strideCounts()
             {
                 return make_vector((uint32_t)Traits::BlockDimSegs, // BlockDim Segments
                                    (uint32_t)Traits::BlockKSegs, // BlockK Segments
                                    (uint32_t)Traits::VWSegs); // VW Segments
             }
 
-            ROCWMMA_DEVICE constexpr static inline auto strides()
+            ROCWMMA_HOST_DEVICE constexpr static inline auto strides()
             {
                 return make_vector(
                     make_coord2d((uint32_t)Traits::BlockDimStride_X,
@@ -159,17 +159,24 @@ namespace rocwmma
             }
 
             ROCWMMA_DEVICE static inline typename Traits::MatrixCoordT baseOffset()
+            {
+                return baseOffset(threadIdx.x);
+            }
+
+            // Base offset of the given thread, also available on host
+            ROCWMMA_HOST_DEVICE constexpr static inline typename Traits::MatrixCoordT
+                baseOffset(uint32_t threadId)
             {
                 if constexpr((uint32_t)Traits::BlockDimStride_X >= (uint32_t)Traits::WaveSize)
                 {
                     // Don't need initial offset calc in Y direction: all threads fit in neighbouring rows
-                    return make_coord2d(threadIdx.x % (uint32_t)Traits::BlockDimStride_X, 0u);
+                    return make_coord2d(threadId % (uint32_t)Traits::BlockDimStride_X, 0u);
                 }
                 else
                 {
                     // Threads need to spread over the Y direction as well
-                    return make_coord2d(threadIdx.x % (uint32_t)Traits::BlockDimStride_X,
-                                        (threadIdx.x / (uint32_t)Traits::BlockDimStride_X)
+                    return make_coord2d(threadId % (uint32_t)Traits::BlockDimStride_X,
+                                        (threadId / (uint32_t)Traits::BlockDimStride_X)
                                             * MaxVectorWidth % (uint32_t)Traits::BlockKStride_Y);
                 }
             }
@@ -243,7 +250,7 @@ namespace rocwmma
                 return make_coord2d(BlockDimOffsetX, VWOffsetY + BlockKOffsetY);
             }
 
-            ROCWMMA_DEVICE static inline typename Traits::MatrixCoordT
+            ROCWMMA_HOST_DEVICE constexpr static inline typename Traits::MatrixCoordT
                 cumulativeOffset(uint32_t iteration)
             {
                 int32_t cumVWOffsetY
@@ -402,14 +409,14 @@ namespace rocwmma
                 using MatrixCoordT = Coord2d;
             };
 
-            ROCWMMA_DEVICE constexpr static inline auto strideCounts()
+            ROCWMMA_HOST_DEVICE constexpr static inline auto strideCounts()
             {
                 return make_vector((uint32_t)Traits::BlockDimSegs, // BlockDim Segments
                                    (uint32_t)Traits::BlockKSegs, // BlockK Segments
                                    (uint32_t)Traits::VWSegs); // VW Segments
             }
 
-            ROCWMMA_DEVICE constexpr static inline auto strides()
+            ROCWMMA_HOST_DEVICE constexpr static inline auto strides()
             {
                 return make_vector(
                     make_coord2d((uint32_t)Traits::BlockDimStride_X,
@@ -420,19 +427,26 @@ namespace rocwmma
             }
 
             ROCWMMA_DEVICE static inline typename Traits::MatrixCoordT baseOffset()
+            {
+                return baseOffset(threadIdx.x);
+            }
+
+            // Base offset of the given thread, also available on host
+            ROCWMMA_HOST_DEVICE constexpr static inline typename Traits::MatrixCoordT
+                baseOffset(uint32_t threadId)
             {
                 if constexpr(((uint32_t)Traits::BlockDimStride_X >= (uint32_t)Traits::WaveSize)
                              && (MaxVectorWidth == 1))
                 {
                     // Don't need initial offset calc in Y direction: all threads fit in neighbouring rows
-                    return make_coord2d(threadIdx.x % (uint32_t)Traits::BlockDimStride_X, 0u);
+                    return make_coord2d(threadId % (uint32_t)Traits::BlockDimStride_X, 0u);
                 }
                 else
                 {
                     // Threads need to spread over the Y direction as well
                     return make_coord2d(
-                        threadIdx.x * MaxVectorWidth % (uint32_t)Traits::BlockDimStride_X,
-                        threadIdx.x * MaxVectorWidth / (uint32_t)Traits::BlockDimStride_X
+                        threadId * MaxVectorWidth % (uint32_t)Traits::BlockDimStride_X,
+                        threadId * MaxVectorWidth / (uint32_t)Traits::BlockDimStride_X
                             % (uint32_t)Traits::BlockKStride_Y);
                 }
             }
@@ -508,7 +522,7 @@ namespace rocwmma
             }
 
             // Cumulative iteration offset
-            ROCWMMA_DEVICE static inline typename Traits::MatrixCoordT
+            ROCWMMA_HOST_DEVICE constexpr static inline typename Traits::MatrixCoordT
                 cumulativeOffset(uint32_t iteration)
             {
                 int32_t cumVWOffsetX
@@ -546,12 +560,18 @@ namespace rocwmma
                 return swap(Traits::OrthoLayout::baseOffset());
             }
 
-            ROCWMMA_DEVICE constexpr static inline auto strideCounts()
+            ROCWMMA_HOST_DEVICE constexpr static inline typename Traits::MatrixCoordT
+                baseOffset(uint32_t threadId)
+            {
+                return swap(Traits::OrthoLayout::baseOffset(threadId));
+            }
+
+            ROCWMMA_HOST_DEVICE constexpr static inline auto strideCounts()
             {
                 return Traits::OrthoLayout::strideCounts();
             }
 
-            ROCWMMA_DEVICE constexpr static inline auto strides()
+            ROCWMMA_HOST_DEVICE constexpr static inline auto strides()
             {
                 auto t = Traits::OrthoLayout::strides();
                 return make_vector(
@@ -563,7 +583,7 @@ namespace rocwmma
             {
                 return swap(Traits::OrthoLayout::incrementalOffset(iteration));
             }
-            ROCWMMA_DEVICE static inline typename Traits::MatrixCoordT
+            ROCWMMA_HOST_DEVICE constexpr static inline typename Traits::MatrixCoordT
                 cumulativeOffset(uint32_t iteration)
             {
                 return swap(Traits::OrthoLayout::cumulativeOffset(iteration));
@@ -592,12 +612,18 @@ namespace rocwmma
                 return swap(Traits::OrthoLayout::baseOffset());
             }
 
-            ROCWMMA_DEVICE constexpr static inline auto strideCounts()
+            ROCWMMA_HOST_DEVICE constexpr static inline typename Traits::MatrixCoordT
+                baseOffset(uint32_t threadId)
+            {
+                return swap(Traits::OrthoLayout::baseOffset(threadId));
+            }
+
+            ROCWMMA_HOST_DEVICE constexpr static inline auto strideCounts()
             {
                 return Traits::OrthoLayout::strideCounts();
             }
 
-            ROCWMMA_DEVICE constexpr static inline auto strides()
+            ROCWMMA_HOST_DEVICE constexpr static inline auto strides()
             {
                 auto t = Traits::OrthoLayout::strides();
                 return make_vector(
@@ -609,7 +635,7 @@ namespace rocwmma
             {
                 return swap(Traits::OrthoLayout::incrementalOffset(iteration));
             }
-            ROCWMMA_DEVICE static inline typename Traits::MatrixCoordT
+            ROCWMMA_HOST_DEVICE constexpr static inline typename Traits::MatrixCoordT
                 cumulativeOffset(uint32_t iteration)
             {
                 return swap(Traits::OrthoLayout::cumulativeOffset(iteration));
@@ -770,55 +796,60 @@ namespace rocwmma
     };
 
     // Special cases for MatrixLayouts, the VectorWidth used does not matter in determining orthogonality, however all other properties must match.
+    // The DataT may also differ, as long as element sizes match (e.g. mixed fp8 / bf8 inputs).
     template <uint32_t BlockDim,
               uint32_t BlockK,
-              typename DataT,
+              typename DataTL,
+              typename DataTR,
               uint32_t VectorWidthL,
               uint32_t VectorWidthR,
               uint32_t MaxVectorWidth>
     struct is_orthogonal<
-        MatrixLayout::template ColOrthoVW<BlockDim, BlockK, DataT, VectorWidthL, MaxVectorWidth>,
-        MatrixLayout::template RowOrthoVW<BlockDim, BlockK, DataT, VectorWidthR, MaxVectorWidth>>
-        : public true_type
+        MatrixLayout::template ColOrthoVW<BlockDim, BlockK, DataTL, VectorWidthL, MaxVectorWidth>,
+        MatrixLayout::template RowOrthoVW<BlockDim, BlockK, DataTR, VectorWidthR, MaxVectorWidth>>
+        : public integral_constant<bool, sizeof(DataTL) == sizeof(DataTR)>
     {
     };
 
     template <uint32_t BlockDim,
               uint32_t BlockK,
-              typename DataT,
+              typename DataTL,
+              typename DataTR,
               uint32_t VectorWidthL,
               uint32_t VectorWidthR,
               uint32_t MaxVectorWidth>
     struct is_orthogonal<
-        MatrixLayout::template RowOrthoVW<BlockDim, BlockK, DataT, VectorWidthL, MaxVectorWidth>,
-        MatrixLayout::template ColOrthoVW<BlockDim, BlockK, DataT, VectorWidthR, MaxVectorWidth>>
-        : public true_type
+        MatrixLayout::template RowOrthoVW<BlockDim, BlockK, DataTL, VectorWidthL, MaxVectorWidth>,
+        MatrixLayout::template ColOrthoVW<BlockDim, BlockK, DataTR, VectorWidthR, MaxVectorWidth>>
+        : public integral_constant<bool, sizeof(DataTL) == sizeof(DataTR)>
     {
     };
 
     template <uint32_t BlockDim,
               uint32_t BlockK,
-              typename DataT,
+              typename DataTL,
+              typename DataTR,
               uint32_t VectorWidthL,
               uint32_t VectorWidthR,
               uint32_t MaxVectorWidth>
     struct is_orthogonal<
-        MatrixLayout::template ColInlineVW<BlockDim, BlockK, DataT, VectorWidthL, MaxVectorWidth>,
-        MatrixLayout::template RowInlineVW<BlockDim, BlockK, DataT, VectorWidthR, MaxVectorWidth>>
-        : public true_type
+        MatrixLayout::template ColInlineVW<BlockDim, BlockK, DataTL, VectorWidthL, MaxVectorWidth>,
+        MatrixLayout::template RowInlineVW<BlockDim, BlockK, DataTR, VectorWidthR, MaxVectorWidth>>
+        : public integral_constant<bool, sizeof(DataTL) == sizeof(DataTR)>
     {
     };
 
     template <uint32_t BlockDim,
               uint32_t BlockK,
-              typename DataT,
+              typename DataTL,
+              typename DataTR,
               uint32_t VectorWidthL,
               uint32_t VectorWidthR,
               uint32_t MaxVectorWidth>
     struct is_orthogonal<
-        MatrixLayout::template RowInlineVW<BlockDim, BlockK, DataT, VectorWidthL, MaxVectorWidth>,
-        MatrixLayout::template ColInlineVW<BlockDim, BlockK, DataT, VectorWidthR, MaxVectorWidth>>
-        : public true_type
+        MatrixLayout::template RowInlineVW<BlockDim, BlockK, DataTL, VectorWidthL, MaxVectorWidth>,
+        MatrixLayout::template ColInlineVW<BlockDim, BlockK, DataTR, VectorWidthR, MaxVectorWidth>>
+        : public integral_constant<bool, sizeof(DataTL) == sizeof(DataTR)>
     {
     };
 
@@ -61,7 +61,7 @@ namespace rocwmma
             // Size of workgroup, normalized to wave count.
             template <bool IsConst          = (TBlockX > 0u && TBlockY > 0u),
                       enable_if_t<IsConst>* = nullptr>
-            ROCWMMA_DEVICE constexpr static inline WorkgroupDimT workgroupDim();
+            ROCWMMA_HOST_DEVICE constexpr static inline WorkgroupDimT workgroupDim();
 
             template <bool IsConst           = (TBlockX > 0u && TBlockY > 0u),
                       enable_if_t<!IsConst>* = nullptr>
@@ -95,20 +95,83 @@ namespace rocwmma
             enum : uint32_t
             {
                 MajorIndex = is_same<DataOrientation, row_major>::value ? 0 : 1,
-                MinorIndex = is_same<DataOrientation, row_major>::value ? 1 : 0
+                MinorIndex = is_same<DataOrientation, row_major>::value ? 1 : 0,
+
+                // Offsets of strided coordinates may be accumulated
+                IsAffine = 1
             };
 
             // Determine the leading dimension of a matrix.
-            ROCWMMA_DEVICE constexpr static inline auto leadingDim(MatrixSizeT const& matrixSize);
+            ROCWMMA_HOST_DEVICE constexpr static inline auto
+                leadingDim(MatrixSizeT const& matrixSize);
 
             // Global data coordinate space (1d element) transform for a matrix coordinate.
-            ROCWMMA_DEVICE constexpr static inline auto
+            ROCWMMA_HOST_DEVICE constexpr static inline auto
                 fromMatrixCoord(MatrixCoordT const& matrixCoord, uint32_t leadingDim);
         };
 
         template <>
         struct DataSpace<void>;
 
+        /*
+    Data space where each line of memory (row for row_major, col for col_major) is
+    divided into chunks of ChunkSize contiguous elements. Within every aligned group
+    of ChunkCount chunks, the chunk index is permuted by XOR with the line index
+    divided by LineGroup, such that the same chunk of consecutive lines falls into
+    different LDS banks. LineGroup > 1 accounts for lines shorter than the bank width,
+    where LineGroup consecutive lines already occupy different banks.
+
+    The permutation is not affine: offsets must be calculated per matrix coordinate
+    and cannot be accumulated from strides. The permutation is also relative to the
+    origin of the data pointer, so sub-blocks of the same swizzled matrix must begin
+    at line offsets that are multiples of (ChunkCount * LineGroup), and at minor offsets
+    that are multiples of (ChunkSize * ChunkCount). Leading dimensions must be multiples
+    of (ChunkSize * ChunkCount).
+    */
+        template <typename DataOrientation,
+                  uint32_t ChunkSize,
+                  uint32_t ChunkCount,
+                  uint32_t LineGroup = 1u>
+        struct XorSwizzleSpace
+        {
+            static_assert(ChunkSize > 0u && (ChunkSize & (ChunkSize - 1u)) == 0u,
+                          "ChunkSize must be a power of 2");
+            static_assert(ChunkCount > 0u && (ChunkCount & (ChunkCount - 1u)) == 0u,
+                          "ChunkCount must be a power of 2");
+            static_assert(LineGroup > 0u && (LineGroup & (LineGroup - 1u)) == 0u,
+                          "LineGroup must be a power of 2");
+
+            using MatrixCoordT = Coord2d;
+            using MatrixSizeT  = Coord2d;
+
+            using Orientation = DataOrientation;
+
+            enum : uint32_t
+            {
+                MajorIndex = is_same<DataOrientation, row_major>::value ? 0 : 1,
+                MinorIndex = is_same<DataOrientation, row_major>::value ? 1 : 0,
+
+                IsAffine = 0,
+
+                SwizzleChunkSize  = ChunkSize,
+                SwizzleChunkCount = ChunkCount,
+                SwizzleLineGroup  = LineGroup,
+
+                // Alignment of sub-blocks in the minor and major dimensions
+                SwizzleMinorSpan = ChunkSize * ChunkCount,
+                SwizzleMajorSpan = ChunkCount * LineGroup
+            };
+
+            // Determine the leading dimension of a matrix.
+            ROCWMMA_HOST_DEVICE constexpr static inline auto
+                leadingDim(MatrixSizeT const& matrixSize);
+
+            // Swizzled data coordinate space (1d element) transform for a matrix coordinate.
+            // Available on host for validation and analysis of access patterns.
+            ROCWMMA_HOST_DEVICE constexpr static inline auto
+                fromMatrixCoord(MatrixCoordT const& matrixCoord, uint32_t leadingDim);
+        };
+
     } // namespace detail;
 
     /*
@@ -49,7 +49,7 @@ namespace rocwmma
             return threadIdx.x & (Constants::AMDGCN_WAVE_SIZE - 1u);
         }
 
-        ROCWMMA_DEVICE constexpr inline Coord2d waveCount(Coord2d const& threadCount)
+        ROCWMMA_HOST_DEVICE constexpr inline Coord2d waveCount(Coord2d const& threadCount)
         {
             // waveCount.x = threadCount.x / AMDGCN_WAVE_SIZE
             // waveCount.y = threadCount.y
@@ -57,7 +57,7 @@ namespace rocwmma
                                 get<1>(threadCount));
         }
 
-        ROCWMMA_DEVICE constexpr inline Coord2d threadCount(Coord2d const& waveCount)
+        ROCWMMA_HOST_DEVICE constexpr inline Coord2d threadCount(Coord2d const& waveCount)
         {
             // threadCount.x = waveCount.x * AMDGCN_WAVE_SIZE
             // threadCount.y = waveCount.y
@@ -106,7 +106,7 @@ namespace rocwmma
         template <uint32_t TBlockX, uint32_t TBlockY>
         template <bool IsConst /* = (TBlockX > 0u && TBlockY > 0u) */,
                   enable_if_t<IsConst>* /* = nullptr */>
-        ROCWMMA_DEVICE constexpr inline auto WaveSpace<TBlockX, TBlockY>::workgroupDim()
+        ROCWMMA_HOST_DEVICE constexpr inline auto WaveSpace<TBlockX, TBlockY>::workgroupDim()
             -> WorkgroupDimT
         {
             return waveCount(make_coord2d(TBlockX, TBlockY));
@@ -133,14 +133,14 @@ namespace rocwmma
 
         /// DataSpace
         template <typename DataOrientation>
-        ROCWMMA_DEVICE constexpr inline auto
+        ROCWMMA_HOST_DEVICE constexpr inline auto
             DataSpace<DataOrientation>::leadingDim(MatrixSizeT const& matrixSize)
         {
             return get<MinorIndex>(matrixSize);
         }
 
         template <typename DataOrientation>
-        ROCWMMA_DEVICE constexpr inline auto
+        ROCWMMA_HOST_DEVICE constexpr inline auto
             DataSpace<DataOrientation>::fromMatrixCoord(MatrixCoordT const& matrixCoord,
                                                         uint32_t            leadingDim)
         {
@@ -148,6 +148,34 @@ namespace rocwmma
             return get<MajorIndex>(matrixCoord) * leadingDim + get<MinorIndex>(matrixCoord);
         }
 
+        /// XorSwizzleSpace
+        template <typename DataOrientation,
+                  uint32_t ChunkSize,
+                  uint32_t ChunkCount,
+                  uint32_t LineGroup>
+        ROCWMMA_HOST_DEVICE constexpr inline auto
+            XorSwizzleSpace<DataOrientation, ChunkSize, ChunkCount, LineGroup>::leadingDim(
+                MatrixSizeT const& matrixSize)
+        {
+            return get<MinorIndex>(matrixSize);
+        }
+
+        template <typename DataOrientation,
+                  uint32_t ChunkSize,
+                  uint32_t ChunkCount,
+                  uint32_t LineGroup>
+        ROCWMMA_HOST_DEVICE constexpr inline auto
+            XorSwizzleSpace<DataOrientation, ChunkSize, ChunkCount, LineGroup>::fromMatrixCoord(
+                MatrixCoordT const& matrixCoord, uint32_t leadingDim)
+        {
+            auto line  = get<MajorIndex>(matrixCoord);
+            auto minor = get<MinorIndex>(matrixCoord);
+
+            // Permute the chunk index within the line, keep the element offset within the chunk
+            auto chunk = (minor / ChunkSize) ^ ((line / LineGroup) % ChunkCount);
+            return line * leadingDim + chunk * ChunkSize + minor % ChunkSize;
+        }
+
     } // namespace detail
 
     template <uint32_t BlockHeight, uint32_t BlockWidth, typename DataT, typename DataLayout>
@@ -35,32 +35,40 @@
 namespace rocwmma
 {
     // MFMA interface
+    // InputTB may differ from InputT (A) for mixed fp8 / bf8 inputs only.
     template <typename InputT,
               typename ComputeT,
               uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
+              typename InputTB = InputT,
               typename Enabler = void>
-    struct Mfma : public detail::amdgcn_mfma<InputT, ComputeT, BlockM, BlockN>
+    struct Mfma : public detail::amdgcn_mfma<InputT, ComputeT, BlockM, BlockN, InputTB>
     {
     };
 
     // Unlock the mfma backend only on MI cards
-    template <typename InputT, typename ComputeT, uint32_t BlockM, uint32_t BlockN, uint32_t BlockK>
+    template <typename InputT,
+              typename ComputeT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputTB>
     struct Mfma<InputT,
                 ComputeT,
                 BlockM,
                 BlockN,
                 BlockK,
+                InputTB,
                 enable_if_t<ROCWMMA_ARCH_GFX9 && (BlockM == BlockN)>>
     {
         // Full-fragment IO traits
         using IOTraitsA   = IOTraits<BlockM, BlockK, InputT>;
-        using IOTraitsB   = IOTraits<BlockK, BlockN, InputT>;
+        using IOTraitsB   = IOTraits<BlockK, BlockN, InputTB>;
         using IOTraitsAcc = IOTraits<BlockM, BlockN, ComputeT>;
 
         // Functional
-        using MFMA = detail::amdgcn_mfma<InputT, ComputeT, BlockM, BlockN>;
+        using MFMA = detail::amdgcn_mfma<InputT, ComputeT, BlockM, BlockN, InputTB>;
 
         // Per-MFMA iterative vector requirements
         using VecTraitsA = VecTraits<typename MFMA::Traits::ARegsT>;
@@ -37,7 +37,13 @@ namespace rocwmma
     namespace detail
     {
 
-        template <typename InputT, typename ComputeT, uint32_t BlockM, uint32_t BlockN>
+        // InputT is the type of A, and InputTB the type of B. These only differ
+        // for the mixed fp8 / bf8 instructions.
+        template <typename InputT,
+                  typename ComputeT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  typename InputTB = InputT>
         struct amdgcn_mfma
         {
             template <typename RegsA, typename RegsB, typename RegsC>
@@ -871,6 +877,143 @@ namespace rocwmma
             }
         };
 
+        // Mixed fp8 / bf8 inputs
+        template <>
+        struct amdgcn_mfma<float8_t, float32_t, 16, 16, bfloat8_t>
+        {
+            // Packed register traits
+            struct Traits
+            {
+                enum : uint32_t
+                {
+                    KPerMfma = 32
+                };
+                using ARegsT = VRegF32x2;
+                using BRegsT = VRegF32x2;
+                using CRegsT = AccRegF32x4;
+                using DRegsT = AccRegF32x4;
+            };
+
+            ROCWMMA_DEVICE static inline auto exec(typename Traits::ARegsT const& regsA,
+                                                   typename Traits::BRegsT const& regsB,
+                                                   typename Traits::CRegsT const& regsC) ->
+                typename Traits::DRegsT
+            {
+                typename Traits::DRegsT result;
+                using inputType = VRegI64x1;
+                result.data     = {
+                    __builtin_amdgcn_mfma_f32_16x16x32_fp8_bf8(((inputType const&)(regsA)).data[0],
+                                                               ((inputType const&)(regsB)).data[0],
+                                                               regsC.data,
+                                                               0,
+                                                               0,
+                                                               0)};
+                return result;
+            }
+        };
+
+        template <>
+        struct amdgcn_mfma<float8_t, float32_t, 32, 32, bfloat8_t>
+        {
+            // Packed register traits
+            struct Traits
+            {
+                enum : uint32_t
+                {
+                    KPerMfma = 16
+                };
+                using ARegsT = VRegF32x2;
+                using BRegsT = VRegF32x2;
+                using CRegsT = AccRegF32x16;
+                using DRegsT = AccRegF32x16;
+            };
+
+            ROCWMMA_DEVICE static inline auto exec(typename Traits::ARegsT const& regsA,
+                                                   typename Traits::BRegsT const& regsB,
+                                                   typename Traits::CRegsT const& regsC) ->
+                typename Traits::DRegsT
+            {
+                typename Traits::DRegsT result;
+                using inputType = VRegI64x1;
+                result.data     = {
+                    __builtin_amdgcn_mfma_f32_32x32x16_fp8_bf8(((inputType const&)(regsA)).data[0],
+                                                               ((inputType const&)(regsB)).data[0],
+                                                               regsC.data,
+                                                               0,
+                                                               0,
+                                                               0)};
+                return result;
+            }
+        };
+
+        template <>
+        struct amdgcn_mfma<bfloat8_t, float32_t, 16, 16, float8_t>
+        {
+            // Packed register traits
+            struct Traits
+            {
+                enum : uint32_t
+                {
+                    KPerMfma = 32
+                };
+                using ARegsT = VRegF32x2;
+                using BRegsT = VRegF32x2;
+                using CRegsT = AccRegF32x4;
+                using DRegsT = AccRegF32x4;
+            };
+
+            ROCWMMA_DEVICE static inline auto exec(typename Traits::ARegsT const& regsA,
+                                                   typename Traits::BRegsT const& regsB,
+                                                   typename Traits::CRegsT const& regsC) ->
+                typename Traits::DRegsT
+            {
+                typename Traits::DRegsT result;
+                using inputType = VRegI64x1;
+                result.data     = {
+                    __builtin_amdgcn_mfma_f32_16x16x32_bf8_fp8(((inputType const&)(regsA)).data[0],
+                                                               ((inputType const&)(regsB)).data[0],
+                                                               regsC.data,
+                                                               0,
+                                                               0,
+                                                               0)};
+                return result;
+            }
+        };
+
+        template <>
+        struct amdgcn_mfma<bfloat8_t, float32_t, 32, 32, float8_t>
+        {
+            // Packed register traits
+            struct Traits
+            {
+                enum : uint32_t
+                {
+                    KPerMfma = 16
+                };
+                using ARegsT = VRegF32x2;
+                using BRegsT = VRegF32x2;
+                using CRegsT = AccRegF32x16;
+                using DRegsT = AccRegF32x16;
+            };
+
+            ROCWMMA_DEVICE static inline auto exec(typename Traits::ARegsT const& regsA,
+                                                   typename Traits::BRegsT const& regsB,
+                                                   typename Traits::CRegsT const& regsC) ->
+                typename Traits::DRegsT
+            {
+                typename Traits::DRegsT result;
+                using inputType = VRegI64x1;
+                result.data     = {
+                    __builtin_amdgcn_mfma_f32_32x32x16_bf8_fp8(((inputType const&)(regsA)).data[0],
+                                                               ((inputType const&)(regsB)).data[0],
+                                                               regsC.data,
+                                                               0,
+                                                               0,
+                                                               0)};
+                return result;
+            }
+        };
+
         template <>
         struct amdgcn_mfma<xfloat32_t, float32_t, 16, 16>
         {
@@ -1049,6 +1192,123 @@ namespace rocwmma
             }
         };
 
+        // Required for mixed fp8 / bf8 support
+        template <>
+        struct amdgcn_mfma<float8_t, float32_t, 16, 16, bfloat8_t>
+        {
+            // Packed register traits
+            struct Traits
+            {
+                enum : uint32_t
+                {
+                    KPerMfma = 32
+                };
+                using ARegsT = VRegF32x2;
+                using BRegsT = VRegF32x2;
+                using CRegsT = AccRegF32x4;
+                using DRegsT = AccRegF32x4;
+            };
+
+            // This implementation is needed to satisfy the MmaSyncTest interface,
+            // and WILL not function as intended.
+            // gfx908 and gfx90a lacks support for fp8 x bf8 MFMA instructions.
+            ROCWMMA_UNSUPPORTED_IMPL("fp8 x bf8 mfma not supported on gfx908/gfx90a")
+            ROCWMMA_DEVICE static inline auto exec(typename Traits::ARegsT const& regsA,
+                                                   typename Traits::BRegsT const& regsB,
+                                                   typename Traits::CRegsT const& regsC) ->
+                typename Traits::DRegsT
+            {
+                return regsC;
+            }
+        };
+
+        template <>
+        struct amdgcn_mfma<float8_t, float32_t, 32, 32, bfloat8_t>
+        {
+            // Packed register traits
+            struct Traits
+            {
+                enum : uint32_t
+                {
+                    KPerMfma = 16
+                };
+                using ARegsT = VRegF32x2;
+                using BRegsT = VRegF32x2;
+                using CRegsT = AccRegF32x16;
+                using DRegsT = AccRegF32x16;
+            };
+
+            // This implementation is needed to satisfy the MmaSyncTest interface,
+            // and WILL not function as intended.
+            // gfx908 and gfx90a lacks support for fp8 x bf8 MFMA instructions.
+            ROCWMMA_UNSUPPORTED_IMPL("fp8 x bf8 mfma not supported on gfx908/gfx90a")
+            ROCWMMA_DEVICE static inline auto exec(typename Traits::ARegsT const& regsA,
+                                                   typename Traits::BRegsT const& regsB,
+                                                   typename Traits::CRegsT const& regsC) ->
+                typename Traits::DRegsT
+            {
+                return regsC;
+            }
+        };
+
+        template <>
+        struct amdgcn_mfma<bfloat8_t, float32_t, 16, 16, float8_t>
+        {
+            // Packed register traits
+            struct Traits
+            {
+                enum : uint32_t
+                {
+                    KPerMfma = 32
+                };
+                using ARegsT = VRegF32x2;
+                using BRegsT = VRegF32x2;
+                using CRegsT = AccRegF32x4;
+                using DRegsT = AccRegF32x4;
+            };
+
+            // This implementation is needed to satisfy the MmaSyncTest interface,
+            // and WILL not function as intended.
+            // gfx908 and gfx90a lacks support for bf8 x fp8 MFMA instructions.
+            ROCWMMA_UNSUPPORTED_IMPL("bf8 x fp8 mfma not supported on gfx908/gfx90a")
+            ROCWMMA_DEVICE static inline auto exec(typename Traits::ARegsT const& regsA,
+                                                   typename Traits::BRegsT const& regsB,
+                                                   typename Traits::CRegsT const& regsC) ->
+                typename Traits::DRegsT
+            {
+                return regsC;
+            }
+        };
+
+        template <>
+        struct amdgcn_mfma<bfloat8_t, float32_t, 32, 32, float8_t>
+        {
+            // Packed register traits
+            struct Traits
+            {
+                enum : uint32_t
+                {
+                    KPerMfma = 16
+                };
+                using ARegsT = VRegF32x2;
+                using BRegsT = VRegF32x2;
+                using CRegsT = AccRegF32x16;
+                using DRegsT = AccRegF32x16;
+            };
+
+            // This implementation is needed to satisfy the MmaSyncTest interface,
+            // and WILL not function as intended.
+            // gfx908 and gfx90a lacks support for bf8 x fp8 MFMA instructions.
+            ROCWMMA_UNSUPPORTED_IMPL("bf8 x fp8 mfma not supported on gfx908/gfx90a")
+            ROCWMMA_DEVICE static inline auto exec(typename Traits::ARegsT const& regsA,
+                                                   typename Traits::BRegsT const& regsB,
+                                                   typename Traits::CRegsT const& regsC) ->
+                typename Traits::DRegsT
+            {
+                return regsC;
+            }
+        };
+
         template <>
         struct amdgcn_mfma<xfloat32_t, float32_t, 16, 16>
         {
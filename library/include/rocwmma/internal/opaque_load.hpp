@@ -26,6 +26,8 @@
 #ifndef ROCWMMA_OPAQUE_LOAD_HPP
 #define ROCWMMA_OPAQUE_LOAD_HPP
 
+#include "cache_policy.hpp"
+#include "io_bounds.hpp"
 #include "io_traits.hpp"
 #include "layout.hpp"
 #include "tuple.hpp"
@@ -38,19 +40,63 @@ namespace rocwmma
     namespace detail
     {
 
-        template <typename DataT, uint32_t VectorWidth>
+        template <typename DataT, uint32_t VectorWidth, typename CachePolicy = cache_default>
         struct amdgcn_opaque_load
         {
             static_assert(VectorWidth > 0, "Vector width must be greater than 0");
             static_assert(sizeof(DataT[VectorWidth]) == sizeof(VecT<DataT, VectorWidth>),
                           "Cannot vectorize input");
+            static_assert(!(bool)CachePolicyTraits<CachePolicy>::IsBufferIO,
+                          "buffer_io is only supported by load_matrix_sync / store_matrix_sync");
 
-            using LoadT = VecT<DataT, VectorWidth>;
+            using LoadT    = VecT<DataT, VectorWidth>;
+            using AddressT = DataT const*;
+
+            // Flat addressing has no notion of extent.
+            ROCWMMA_DEVICE static inline AddressT makeAddress(DataT const* dataPtr,
+                                                              uint64_t /*numElements*/ = 0u)
+            {
+                return dataPtr;
+            }
 
             ROCWMMA_DEVICE static inline void
                 exec(LoadT& data, DataT const* dataPtr, index_t offset = 0)
             {
-                data = *reinterpret_cast<LoadT const*>(&(dataPtr[offset]));
+                if constexpr((bool)CachePolicyTraits<CachePolicy>::IsNonTemporal)
+                {
+                    amdgcn_nontemporal::load(data,
+                                             reinterpret_cast<LoadT const*>(&(dataPtr[offset])));
+                }
+                else
+                {
+                    data = *reinterpret_cast<LoadT const*>(&(dataPtr[offset]));
+                }
+            }
+
+            // Predicated load: elements outside of the extent are zero-filled
+            // and are never dereferenced.
+            template <typename DataLayoutT>
+            ROCWMMA_DEVICE static inline void exec(LoadT&         data,
+                                                   DataT const*   dataPtr,
+                                                   Coord2d const& matrixCoord,
+                                                   Coord2d const& extent)
+            {
+                using Bounds = IOBounds<DataLayoutT, VectorWidth>;
+
+                if(Bounds::isVectorInBounds(matrixCoord, extent))
+                {
+                    exec(data, dataPtr);
+                }
+                else
+                {
+#pragma unroll
+                    for(uint32_t i = 0; i < VectorWidth; i++)
+                    {
+                        data.data[i] = Bounds::isElementInBounds(matrixCoord, extent, i)
+                                           ? dataPtr[i]
+                                           : static_cast<DataT>(0);
+                    }
+                }
             }
         };
 
@@ -61,7 +107,8 @@ namespace rocwmma
               typename DataT,
               class DataLayout,
               class MatrixLayout,
-              uint32_t VectorWidth>
+              uint32_t VectorWidth,
+              class LoaderT = detail::amdgcn_opaque_load<DataT, VectorWidth>>
     struct OpaqueLoad
     {
         using IOTraits = IOTraits<BlockDim, BlockK, DataT, VectorWidth>;
@@ -69,9 +116,10 @@ namespace rocwmma
         struct Traits
         {
             // Raw IO on unpacked register data.
-            using Loader  = detail::amdgcn_opaque_load<DataT, VectorWidth>;
-            using LoadT   = typename Loader::LoadT;
-            using OutputT = VecT<DataT, IOTraits::UnpackedSize>;
+            using Loader   = LoaderT;
+            using LoadT    = typename Loader::LoadT;
+            using AddressT = typename Loader::AddressT;
+            using OutputT  = VecT<DataT, IOTraits::UnpackedSize>;
         };
 
         using LoadVecTraits = VecTraits<typename Traits::LoadT>;
@@ -82,11 +130,11 @@ namespace rocwmma
                   typename Iterator,
                   typename StrideCounts,
                   typename Strides2d>
-        ROCWMMA_DEVICE static inline auto unroll_right(Iterator&      out,
-                                                       DataT const*   dataPtr,
-                                                       uint32_t       ldm,
-                                                       StrideCounts&& strideCounts,
-                                                       Strides2d&&    strides2d)
+        ROCWMMA_DEVICE static inline auto unroll_right(Iterator&                 out,
+                                                       typename Traits::AddressT dataPtr,
+                                                       uint32_t                  ldm,
+                                                       StrideCounts&&            strideCounts,
+                                                       Strides2d&&               strides2d)
         {
             auto strideOffset = DataLayout::fromMatrixCoord(get<Depth>(strides2d), ldm);
             auto strideCount  = get<Depth>(strideCounts);
@@ -114,6 +162,92 @@ namespace rocwmma
             }
         }
 
+        // Bounds-aware variant of the above, which also tracks the
+        // matrix coordinate of each vector to predicate the load.
+        template <size_t Depth = 0,
+                  typename Iterator,
+                  typename StrideCounts,
+                  typename Strides2d>
+        ROCWMMA_DEVICE static inline auto unroll_right(Iterator&                 out,
+                                                       typename Traits::AddressT dataPtr,
+                                                       uint32_t                  ldm,
+                                                       Coord2d                   matrixCoord,
+                                                       Coord2d const&            extent,
+                                                       StrideCounts&&            strideCounts,
+                                                       Strides2d&&               strides2d)
+        {
+            auto stride2d     = get<Depth>(strides2d);
+            auto strideOffset = DataLayout::fromMatrixCoord(stride2d, ldm);
+            auto strideCount  = get<Depth>(strideCounts);
+
+            // Last depth layer will invoke the load
+            if constexpr(Depth == (VecTraits<decay_t<StrideCounts>>::size() - 1u))
+            {
+#pragma unroll
+                for(int i = 0; i < strideCount; i++)
+                {
+                    Traits::Loader::template exec<typename DataLayout::Orientation>(
+                        *out, dataPtr, matrixCoord, extent);
+                    dataPtr += strideOffset;
+                    matrixCoord = matrixCoord + stride2d;
+                    out++;
+                }
+            }
+            // Recurse to the next nested layer
+            else
+            {
+#pragma unroll
+                for(int i = 0; i < strideCount; i++)
+                {
+                    unroll_right<Depth + 1>(
+                        out, dataPtr, ldm, matrixCoord, extent, strideCounts, strides2d);
+                    dataPtr += strideOffset;
+                    matrixCoord = matrixCoord + stride2d;
+                }
+            }
+        }
+
+        // Variant of the above for non-affine (e.g. swizzled) data layouts,
+        // where the offset of each vector is calculated from its matrix coordinate.
+        template <size_t Depth = 0,
+                  typename Iterator,
+                  typename StrideCounts,
+                  typename Strides2d>
+        ROCWMMA_DEVICE static inline auto unroll_right(Iterator&                 out,
+                                                       typename Traits::AddressT dataPtr,
+                                                       uint32_t                  ldm,
+                                                       Coord2d                   matrixCoord,
+                                                       StrideCounts&&            strideCounts,
+                                                       Strides2d&&               strides2d)
+        {
+            auto stride2d    = get<Depth>(strides2d);
+            auto strideCount = get<Depth>(strideCounts);
+
+            // Last depth layer will invoke the load
+            if constexpr(Depth == (VecTraits<decay_t<StrideCounts>>::size() - 1u))
+            {
+#pragma unroll
+                for(int i = 0; i < strideCount; i++)
+                {
+                    Traits::Loader::exec(
+                        *out, dataPtr, DataLayout::fromMatrixCoord(matrixCoord, ldm));
+                    matrixCoord = matrixCoord + stride2d;
+                    out++;
+                }
+            }
+            // Recurse to the next nested layer
+            else
+            {
+#pragma unroll
+                for(int i = 0; i < strideCount; i++)
+                {
+                    unroll_right<Depth + 1>(
+                        out, dataPtr, ldm, matrixCoord, strideCounts, strides2d);
+                    matrixCoord = matrixCoord + stride2d;
+                }
+            }
+        }
+
         ROCWMMA_DEVICE static void
             exec(typename Traits::OutputT& data, DataT const* dataPtr, uint32_t ldm)
         {
@@ -130,10 +264,54 @@ namespace rocwmma
                                        MatrixLayout::strideCounts()),
                           "IOCount inconsistent with total strides");
 
+            // Unroll loading in each strided dimension
+            if constexpr((bool)DataLayout::IsAffine)
+            {
+                unroll_right(it,
+                             Traits::Loader::makeAddress(dataPtr)
+                                 + DataLayout::fromMatrixCoord(baseOffset2d, ldm),
+                             ldm,
+                             MatrixLayout::strideCounts(),
+                             MatrixLayout::strides());
+            }
+            else
+            {
+                unroll_right(it,
+                             Traits::Loader::makeAddress(dataPtr),
+                             ldm,
+                             baseOffset2d,
+                             MatrixLayout::strideCounts(),
+                             MatrixLayout::strides());
+            }
+        }
+
+        // Loads the block with (rows, cols) extent remaining in the matrix
+        // from dataPtr. Elements outside of the extent are zero-filled.
+        ROCWMMA_DEVICE static void exec(typename Traits::OutputT& data,
+                                        DataT const*              dataPtr,
+                                        uint32_t                  ldm,
+                                        Coord2d const&            extent)
+        {
+            static_assert((bool)DataLayout::IsAffine,
+                          "Bounded loads are not supported for non-affine data layouts");
+
+            // Arrange wave threads to starting matrix layout offsets.
+            auto baseOffset2d = MatrixLayout::baseOffset();
+            auto it           = makeVectorIterator<LoadVecTraits::size()>(data).begin();
+
+            static_assert(decltype(it)::range() == IOTraits::IOCount,
+                          "IOCount inconsistent with iterator range");
+
+            // Addressing may be limited to the memory spanned by the extent
+            using Bounds = detail::IOBounds<typename DataLayout::Orientation, VectorWidth>;
+            auto address = Traits::Loader::makeAddress(dataPtr, Bounds::linearExtent(extent, ldm));
+
             // Unroll loading in each strided dimension
             unroll_right(it,
-                         dataPtr + DataLayout::fromMatrixCoord(baseOffset2d, ldm),
+                         address + DataLayout::fromMatrixCoord(baseOffset2d, ldm),
                          ldm,
+                         baseOffset2d,
+                         extent,
                          MatrixLayout::strideCounts(),
                          MatrixLayout::strides());
         }
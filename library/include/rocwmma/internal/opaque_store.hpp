@@ -26,6 +26,8 @@
 #ifndef ROCWMMA_OPAQUE_STORE_HPP
 #define ROCWMMA_OPAQUE_STORE_HPP
 
+#include "cache_policy.hpp"
+#include "io_bounds.hpp"
 #include "io_traits.hpp"
 #include "layout.hpp"
 #include "types.hpp"
@@ -37,18 +39,228 @@ namespace rocwmma
     namespace detail
     {
 
-        template <typename DataT, uint32_t VectorWidth>
+        template <typename DataT, uint32_t VectorWidth, typename CachePolicy = cache_default>
         struct amdgcn_opaque_store
         {
             static_assert(VectorWidth > 0, "Vector width must be greater than 0");
             static_assert(sizeof(DataT[VectorWidth]) == sizeof(VecT<DataT, VectorWidth>),
                           "Cannot vectorize output");
+            static_assert(!(bool)CachePolicyTraits<CachePolicy>::IsBufferIO,
+                          "buffer_io is only supported by load_matrix_sync / store_matrix_sync");
+
+            using StoreT   = VecT<DataT, VectorWidth>;
+            using AddressT = DataT*;
+
+            // Flat addressing has no notion of extent.
+            ROCWMMA_DEVICE static inline AddressT makeAddress(DataT* dataPtr,
+                                                              uint64_t /*numElements*/ = 0u)
+            {
+                return dataPtr;
+            }
 
-            using StoreT = VecT<DataT, VectorWidth>;
             ROCWMMA_DEVICE static inline void
                 exec(DataT* dataPtr, StoreT const& data, index_t offset = 0)
             {
-                *reinterpret_cast<StoreT*>(&(dataPtr[offset])) = data;
+                if constexpr((bool)CachePolicyTraits<CachePolicy>::IsNonTemporal)
+                {
+                    amdgcn_nontemporal::store(reinterpret_cast<StoreT*>(&(dataPtr[offset])), data);
+                }
+                else
+                {
+                    *reinterpret_cast<StoreT*>(&(dataPtr[offset])) = data;
+                }
+            }
+
+            // Predicated store: elements outside of the extent are discarded.
+            template <typename DataLayoutT>
+            ROCWMMA_DEVICE static inline void exec(DataT*         dataPtr,
+                                                   StoreT const&  data,
+                                                   Coord2d const& matrixCoord,
+                                                   Coord2d const& extent)
+            {
+                using Bounds = IOBounds<DataLayoutT, VectorWidth>;
+
+                if(Bounds::isVectorInBounds(matrixCoord, extent))
+                {
+                    exec(dataPtr, data);
+                }
+                else
+                {
+#pragma unroll
+                    for(uint32_t i = 0; i < VectorWidth; i++)
+                    {
+                        if(Bounds::isElementInBounds(matrixCoord, extent, i))
+                        {
+                            dataPtr[i] = data.data[i];
+                        }
+                    }
+                }
+            }
+        };
+
+        // Atomic accumulation of a single 32b or 64b element.
+        template <typename DataT>
+        ROCWMMA_DEVICE static inline void amdgcn_atomic_add(DataT* dataPtr, DataT value)
+        {
+#if ROCWMMA_ARCH_GFX90A || ROCWMMA_ARCH_GFX940 || ROCWMMA_ARCH_GFX941 || ROCWMMA_ARCH_GFX942
+            if constexpr(is_same<DataT, float32_t>::value || is_same<DataT, float64_t>::value)
+            {
+                // Native float atomics, which do not honor denorm mode.
+                unsafeAtomicAdd(dataPtr, value);
+            }
+            else
+#endif // ROCWMMA_ARCH_GFX90A || ROCWMMA_ARCH_GFX94X
+            {
+                atomicAdd(dataPtr, value);
+            }
+        }
+
+        // Accumulates up to two neighbouring 16b elements into their naturally
+        // aligned 32b word. The packed addend is {lo, hi}; either half may be
+        // skipped. f16 uses the packed atomic on gfx90a and gfx94x. Other
+        // targets and types accumulate in float32 and swap the word in with a
+        // compare and swap.
+        template <typename DataT>
+        ROCWMMA_DEVICE static inline void amdgcn_atomic_add_x2(
+            uint32_t* wordPtr, DataT lo, DataT hi, bool addLo = true, bool addHi = true)
+        {
+            static_assert(sizeof(DataT) == 2u, "Packed atomics require 16b elements");
+
+#if(ROCWMMA_ARCH_GFX90A || ROCWMMA_ARCH_GFX940 || ROCWMMA_ARCH_GFX941 || ROCWMMA_ARCH_GFX942) \
+    && __has_builtin(__builtin_amdgcn_global_atomic_fadd_v2f16)
+            // Native packed f16 atomic add, which only addresses global memory. LDS
+            // falls back to the CAS loop. A skipped half adds -0, which is the
+            // identity for every value, including -0 itself.
+            if constexpr(is_same<DataT, float16_t>::value
+#if !ROCWMMA_NO_HALF
+                         || is_same<DataT, hfloat16_t>::value
+#endif // !ROCWMMA_NO_HALF
+            )
+            {
+                if(!__builtin_amdgcn_is_shared(reinterpret_cast<void const*>(wordPtr)))
+                {
+                    using PackedF16x2T = float16_t __attribute__((ext_vector_type(2)));
+
+                    auto addend = [](bool add, DataT value) {
+                        return add ? __builtin_bit_cast(float16_t, value)
+                                   : __builtin_bit_cast(float16_t, static_cast<uint16_t>(0x8000u));
+                    };
+
+                    __builtin_amdgcn_global_atomic_fadd_v2f16(
+                        (__attribute__((address_space(1))) PackedF16x2T*)wordPtr,
+                        PackedF16x2T{addend(addLo, lo), addend(addHi, hi)});
+                    return;
+                }
+            }
+#endif // (ROCWMMA_ARCH_GFX90A || ROCWMMA_ARCH_GFX94X) && global_atomic_fadd_v2f16
+
+            auto accum = [](uint16_t bits, DataT value) {
+                auto sum = static_cast<float32_t>(__builtin_bit_cast(DataT, bits))
+                           + static_cast<float32_t>(value);
+                return static_cast<uint32_t>(__builtin_bit_cast(uint16_t, static_cast<DataT>(sum)));
+            };
+
+            uint32_t old = *wordPtr;
+            uint32_t assumed;
+            do
+            {
+                assumed     = old;
+                auto loBits = static_cast<uint16_t>(assumed & 0xFFFFu);
+                auto hiBits = static_cast<uint16_t>(assumed >> 16u);
+                auto newLo  = addLo ? accum(loBits, lo) : static_cast<uint32_t>(loBits);
+                auto newHi  = addHi ? accum(hiBits, hi) : static_cast<uint32_t>(hiBits);
+                old         = atomicCAS(wordPtr, assumed, newLo | (newHi << 16u));
+            } while(assumed != old);
+        }
+
+        template <typename DataT, uint32_t VectorWidth>
+        struct amdgcn_atomic_add_store
+        {
+            static_assert(VectorWidth > 0, "Vector width must be greater than 0");
+            static_assert(sizeof(DataT[VectorWidth]) == sizeof(VecT<DataT, VectorWidth>),
+                          "Cannot vectorize output");
+            static_assert(sizeof(DataT) == 2u || sizeof(DataT) == 4u || sizeof(DataT) == 8u,
+                          "Atomic accumulation requires 16b, 32b or 64b elements");
+
+            using StoreT   = VecT<DataT, VectorWidth>;
+            using AddressT = DataT*;
+
+            // Flat addressing has no notion of extent.
+            ROCWMMA_DEVICE static inline AddressT makeAddress(DataT* dataPtr,
+                                                              uint64_t /*numElements*/ = 0u)
+            {
+                return dataPtr;
+            }
+
+            // Accumulates a single element.
+            ROCWMMA_DEVICE static inline void addElement(DataT* dataPtr, DataT value)
+            {
+                if constexpr(sizeof(DataT) == 2u)
+                {
+                    auto address = reinterpret_cast<uintptr_t>(dataPtr);
+                    auto wordPtr = reinterpret_cast<uint32_t*>(address & ~uintptr_t(3u));
+                    bool isHi    = (address & uintptr_t(2u)) != 0u;
+                    amdgcn_atomic_add_x2(wordPtr, value, value, !isHi, isHi);
+                }
+                else
+                {
+                    amdgcn_atomic_add(dataPtr, value);
+                }
+            }
+
+            ROCWMMA_DEVICE static inline void
+                exec(DataT* dataPtr, StoreT const& data, index_t offset = 0)
+            {
+                dataPtr += offset;
+
+                // Even 16b vectors are packed into f16x2 atomics, if the vector
+                // is aligned to 32b words.
+                if constexpr(sizeof(DataT) == 2u && VectorWidth % 2u == 0u)
+                {
+                    if((reinterpret_cast<uintptr_t>(dataPtr) & uintptr_t(3u)) == 0u)
+                    {
+                        auto wordPtr = reinterpret_cast<uint32_t*>(dataPtr);
+#pragma unroll
+                        for(uint32_t i = 0; i < VectorWidth / 2u; i++)
+                        {
+                            amdgcn_atomic_add_x2(
+                                wordPtr + i, data.data[2u * i], data.data[2u * i + 1u]);
+                        }
+                        return;
+                    }
+                }
+
+#pragma unroll
+                for(uint32_t i = 0; i < VectorWidth; i++)
+                {
+                    addElement(dataPtr + i, data.data[i]);
+                }
+            }
+
+            // Predicated accumulation: elements outside of the extent are discarded.
+            template <typename DataLayoutT>
+            ROCWMMA_DEVICE static inline void exec(DataT*         dataPtr,
+                                                   StoreT const&  data,
+                                                   Coord2d const& matrixCoord,
+                                                   Coord2d const& extent)
+            {
+                using Bounds = IOBounds<DataLayoutT, VectorWidth>;
+
+                if(Bounds::isVectorInBounds(matrixCoord, extent))
+                {
+                    exec(dataPtr, data);
+                }
+                else
+                {
+#pragma unroll
+                    for(uint32_t i = 0; i < VectorWidth; i++)
+                    {
+                        if(Bounds::isElementInBounds(matrixCoord, extent, i))
+                        {
+                            addElement(dataPtr + i, data.data[i]);
+                        }
+                    }
+                }
             }
         };
 
@@ -59,16 +271,18 @@ namespace rocwmma
               typename DataT,
               class DataLayout,
               class MatrixLayout,
-              uint32_t VectorWidth>
+              uint32_t VectorWidth,
+              class StorerT = detail::amdgcn_opaque_store<DataT, VectorWidth>>
     struct OpaqueStore
     {
         using IOTraits = IOTraits<BlockDim, BlockK, DataT, VectorWidth>;
         struct Traits
         {
             // Raw IO on unpacked register data.
-            using Storer = detail::amdgcn_opaque_store<DataT, VectorWidth>;
-            using StoreT = typename Storer::StoreT;
-            using InputT = VecT<DataT, IOTraits::UnpackedSize>;
+            using Storer   = StorerT;
+            using StoreT   = typename Storer::StoreT;
+            using AddressT = typename Storer::AddressT;
+            using InputT   = VecT<DataT, IOTraits::UnpackedSize>;
         };
 
         using StoreVecTraits = VecTraits<typename Traits::StoreT>;
@@ -77,11 +291,11 @@ namespace rocwmma
                   typename Iterator,
                   typename StrideCounts,
                   typename Strides2d>
-        ROCWMMA_DEVICE static inline auto unroll_right(DataT*         dataPtr,
-                                                       Iterator&      in,
-                                                       uint32_t       ldm,
-                                                       StrideCounts&& strideCounts,
-                                                       Strides2d&&    strides2d)
+        ROCWMMA_DEVICE static inline auto unroll_right(typename Traits::AddressT dataPtr,
+                                                       Iterator&                 in,
+                                                       uint32_t                  ldm,
+                                                       StrideCounts&&            strideCounts,
+                                                       Strides2d&&               strides2d)
         {
             auto strideOffset = DataLayout::fromMatrixCoord(get<Depth>(strides2d), ldm);
             auto strideCount  = get<Depth>(strideCounts);
@@ -109,6 +323,92 @@ namespace rocwmma
             }
         }
 
+        // Bounds-aware variant of the above, which also tracks the
+        // matrix coordinate of each vector to predicate the store.
+        template <size_t Depth = 0,
+                  typename Iterator,
+                  typename StrideCounts,
+                  typename Strides2d>
+        ROCWMMA_DEVICE static inline auto unroll_right(typename Traits::AddressT dataPtr,
+                                                       Iterator&                 in,
+                                                       uint32_t                  ldm,
+                                                       Coord2d                   matrixCoord,
+                                                       Coord2d const&            extent,
+                                                       StrideCounts&&            strideCounts,
+                                                       Strides2d&&               strides2d)
+        {
+            auto stride2d     = get<Depth>(strides2d);
+            auto strideOffset = DataLayout::fromMatrixCoord(stride2d, ldm);
+            auto strideCount  = get<Depth>(strideCounts);
+
+            // Last depth layer will invoke the store
+            if constexpr(Depth == (VecTraits<decay_t<StrideCounts>>::size() - 1u))
+            {
+#pragma unroll
+                for(int i = 0; i < strideCount; i++)
+                {
+                    Traits::Storer::template exec<typename DataLayout::Orientation>(
+                        dataPtr, *in, matrixCoord, extent);
+                    dataPtr += strideOffset;
+                    matrixCoord = matrixCoord + stride2d;
+                    in++;
+                }
+            }
+            // Recurse to the next nested layer
+            else
+            {
+#pragma unroll
+                for(int i = 0; i < strideCount; i++)
+                {
+                    unroll_right<Depth + 1>(
+                        dataPtr, in, ldm, matrixCoord, extent, strideCounts, strides2d);
+                    dataPtr += strideOffset;
+                    matrixCoord = matrixCoord + stride2d;
+                }
+            }
+        }
+
+        // Variant of the above for non-affine (e.g. swizzled) data layouts,
+        // where the offset of each vector is calculated from its matrix coordinate.
+        template <size_t Depth = 0,
+                  typename Iterator,
+                  typename StrideCounts,
+                  typename Strides2d>
+        ROCWMMA_DEVICE static inline auto unroll_right(typename Traits::AddressT dataPtr,
+                                                       Iterator&                 in,
+                                                       uint32_t                  ldm,
+                                                       Coord2d                   matrixCoord,
+                                                       StrideCounts&&            strideCounts,
+                                                       Strides2d&&               strides2d)
+        {
+            auto stride2d    = get<Depth>(strides2d);
+            auto strideCount = get<Depth>(strideCounts);
+
+            // Last depth layer will invoke the store
+            if constexpr(Depth == (VecTraits<decay_t<StrideCounts>>::size() - 1u))
+            {
+#pragma unroll
+                for(int i = 0; i < strideCount; i++)
+                {
+                    Traits::Storer::exec(
+                        dataPtr, *in, DataLayout::fromMatrixCoord(matrixCoord, ldm));
+                    matrixCoord = matrixCoord + stride2d;
+                    in++;
+                }
+            }
+            // Recurse to the next nested layer
+            else
+            {
+#pragma unroll
+                for(int i = 0; i < strideCount; i++)
+                {
+                    unroll_right<Depth + 1>(
+                        dataPtr, in, ldm, matrixCoord, strideCounts, strides2d);
+                    matrixCoord = matrixCoord + stride2d;
+                }
+            }
+        }
+
         ROCWMMA_DEVICE static void
             exec(DataT* dataPtr, typename Traits::InputT const& data, uint32_t ldm)
         {
@@ -125,9 +425,52 @@ namespace rocwmma
                                        MatrixLayout::strideCounts()),
                           "IOCount inconsistent with total strides");
 
-            unroll_right(dataPtr + DataLayout::fromMatrixCoord(baseOffset2d, ldm),
+            if constexpr((bool)DataLayout::IsAffine)
+            {
+                unroll_right(Traits::Storer::makeAddress(dataPtr)
+                                 + DataLayout::fromMatrixCoord(baseOffset2d, ldm),
+                             it,
+                             ldm,
+                             MatrixLayout::strideCounts(),
+                             MatrixLayout::strides());
+            }
+            else
+            {
+                unroll_right(Traits::Storer::makeAddress(dataPtr),
+                             it,
+                             ldm,
+                             baseOffset2d,
+                             MatrixLayout::strideCounts(),
+                             MatrixLayout::strides());
+            }
+        }
+
+        // Stores the block with (rows, cols) extent remaining in the matrix
+        // from dataPtr. Elements outside of the extent are not written.
+        ROCWMMA_DEVICE static void exec(DataT*                         dataPtr,
+                                        typename Traits::InputT const& data,
+                                        uint32_t                       ldm,
+                                        Coord2d const&                 extent)
+        {
+            static_assert((bool)DataLayout::IsAffine,
+                          "Bounded stores are not supported for non-affine data layouts");
+
+            // Arrange wave threads to starting matrix layout offsets.
+            auto baseOffset2d = MatrixLayout::baseOffset();
+            auto it           = makeVectorIterator<StoreVecTraits::size()>(data).begin();
+
+            static_assert(decltype(it)::range() == IOTraits::IOCount,
+                          "IOCount inconsistent with iterator range");
+
+            // Addressing may be limited to the memory spanned by the extent
+            using Bounds = detail::IOBounds<typename DataLayout::Orientation, VectorWidth>;
+            auto address = Traits::Storer::makeAddress(dataPtr, Bounds::linearExtent(extent, ldm));
+
+            unroll_right(address + DataLayout::fromMatrixCoord(baseOffset2d, ldm),
                          it,
                          ldm,
+                         baseOffset2d,
+                         extent,
                          MatrixLayout::strideCounts(),
                          MatrixLayout::strides());
         }
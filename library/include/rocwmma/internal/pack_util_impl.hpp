@@ -57,6 +57,30 @@ namespace rocwmma
         using PackedT   = uint32_t;
     };
 
+    template <>
+    struct PackTraits<int4x2_t>
+    {
+        enum : uint32_t
+        {
+            PackRatio = 4
+        };
+
+        using UnpackedT = int4x2_t;
+        using PackedT   = int32_t;
+    };
+
+    template <>
+    struct PackTraits<uint4x2_t>
+    {
+        enum : uint32_t
+        {
+            PackRatio = 4
+        };
+
+        using UnpackedT = uint4x2_t;
+        using PackedT   = uint32_t;
+    };
+
     template <>
     struct PackTraits<int16_t>
     {
@@ -0,0 +1,206 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_REDUCE_HPP
+#define ROCWMMA_REDUCE_HPP
+
+#include "accum_layout.hpp"
+#include "dpp.hpp"
+#include "permute.hpp"
+#include "swizzle.hpp"
+#include "types.hpp"
+#include "vector.hpp"
+
+namespace rocwmma
+{
+    namespace detail
+    {
+        // Exchanges values with the lane at (laneId ^ XorMask), choosing the
+        // cheapest cross-lane backend that supports each distance.
+        template <uint32_t XorMask>
+        struct LaneSwap;
+
+        template <>
+        struct LaneSwap<1u> : public Dpp::Shuffle2<1u, 0u>
+        {
+        };
+
+        template <>
+        struct LaneSwap<2u> : public Dpp::Swap2<>
+        {
+        };
+
+        template <>
+        struct LaneSwap<4u> : public Swizzle::Swap4
+        {
+        };
+
+        // Rotation by half a row of 16 is equivalent to xor 8
+        template <>
+        struct LaneSwap<8u> : public Dpp::RotateR16<8u>
+        {
+        };
+
+        template <>
+        struct LaneSwap<16u> : public Swizzle::Swap16
+        {
+        };
+
+        // Rotation by half of wave64 is equivalent to xor 32
+        template <>
+        struct LaneSwap<32u> : public Permute::RotateWaveL<32u>
+        {
+        };
+
+        // Reduces each element of the partials with those of the lanes at every
+        // (laneId ^ mask), for masks in [XorMask, EndMask) by powers of two.
+        // The result is available in every participating lane.
+        template <typename ReduceOp,
+                  uint32_t XorMask,
+                  uint32_t EndMask,
+                  typename DataT,
+                  uint32_t VecSize>
+        ROCWMMA_DEVICE static inline auto laneButterfly(VecT<DataT, VecSize> const& partial)
+        {
+            if constexpr(XorMask >= EndMask)
+            {
+                return partial;
+            }
+            else
+            {
+                auto other  = LaneSwap<XorMask>::exec(partial);
+                auto result = VecT<DataT, VecSize>{};
+#pragma unroll
+                for(uint32_t i = 0; i < VecSize; i++)
+                {
+                    result.data[i] = ReduceOp{}(partial.data[i], other.data[i]);
+                }
+                return laneButterfly<ReduceOp, XorMask * 2u, EndMask>(result);
+            }
+        }
+
+        /*! \struct AccumReduce
+        *  \brief Row and column reductions of accumulator fragment data.
+        *
+        * In the AccumLayout register placement, each lane holds the same
+        * RowsPerLane rows of each of its ColSegs columns, and lanes ColLanes
+        * apart hold the other rows of the same columns.
+        *
+        * Reductions first combine partials in registers, then finish with a
+        * butterfly across the lanes sharing the same rows or columns. Results are
+        * broadcast back to every element of the reduced row or column.
+        *
+        * Sub-dword data is reduced in 32b, as the cross-lane backends operate on B32.
+        *
+        * @tparam BlockM/N accumulator block dimensions
+        * @tparam DataT accumulator data type
+        */
+        template <uint32_t BlockM, uint32_t BlockN, typename DataT>
+        struct AccumReduce
+        {
+            using Layout  = AccumLayout<BlockM, BlockN, DataT>;
+            using ReduceT = typename Layout::CrossLaneT;
+
+            template <uint32_t VecSize>
+            using PartialT = VecT<ReduceT, VecSize>;
+
+            // Reduces each row across all columns
+            template <typename ReduceOp, typename AccessT>
+            ROCWMMA_DEVICE static inline auto rows(AccessT const& data)
+            {
+                static_assert(VecTraits<AccessT>::size() == Layout::Size,
+                              "Accumulator size inconsistent with reduction layout");
+
+                // Combine column segments in registers
+                auto partial = PartialT<Layout::RowsPerLane>{};
+#pragma unroll
+                for(uint32_t r = 0; r < Layout::RowsPerLane; r++)
+                {
+                    partial.data[r] = static_cast<ReduceT>(data.data[r]);
+                }
+#pragma unroll
+                for(uint32_t c = 1; c < Layout::ColSegs; c++)
+                {
+#pragma unroll
+                    for(uint32_t r = 0; r < Layout::RowsPerLane; r++)
+                    {
+                        partial.data[r] = ReduceOp{}(
+                            partial.data[r],
+                            static_cast<ReduceT>(data.data[c * Layout::RowsPerLane + r]));
+                    }
+                }
+
+                // Combine neighbouring lanes holding the other columns
+                partial = laneButterfly<ReduceOp, 1u, Layout::ColLanes>(partial);
+
+                auto result = AccessT{};
+#pragma unroll
+                for(uint32_t i = 0; i < Layout::Size; i++)
+                {
+                    result.data[i] = static_cast<DataT>(partial.data[i % Layout::RowsPerLane]);
+                }
+                return result;
+            }
+
+            // Reduces each column across all rows
+            template <typename ReduceOp, typename AccessT>
+            ROCWMMA_DEVICE static inline auto cols(AccessT const& data)
+            {
+                static_assert(VecTraits<AccessT>::size() == Layout::Size,
+                              "Accumulator size inconsistent with reduction layout");
+
+                // Combine rows of each column segment in registers
+                auto partial = PartialT<Layout::ColSegs>{};
+#pragma unroll
+                for(uint32_t c = 0; c < Layout::ColSegs; c++)
+                {
+                    partial.data[c] = static_cast<ReduceT>(data.data[c * Layout::RowsPerLane]);
+#pragma unroll
+                    for(uint32_t r = 1; r < Layout::RowsPerLane; r++)
+                    {
+                        partial.data[c] = ReduceOp{}(
+                            partial.data[c],
+                            static_cast<ReduceT>(data.data[c * Layout::RowsPerLane + r]));
+                    }
+                }
+
+                // Combine lanes ColLanes apart holding the other rows
+                partial = laneButterfly<ReduceOp, Layout::ColLanes, Layout::WaveSize>(partial);
+
+                auto result = AccessT{};
+#pragma unroll
+                for(uint32_t i = 0; i < Layout::Size; i++)
+                {
+                    result.data[i] = static_cast<DataT>(partial.data[i / Layout::RowsPerLane]);
+                }
+                return result;
+            }
+        };
+
+    } // namespace detail
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_REDUCE_HPP
@@ -0,0 +1,135 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_SMFMAC_HPP
+#define ROCWMMA_SMFMAC_HPP
+
+#include "config.hpp"
+#include "vector.hpp"
+#include "vector_iterator.hpp"
+
+#include "smfmac_impl.hpp"
+
+namespace rocwmma
+{
+    // Sparse MFMA interface
+    template <typename InputT,
+              typename ComputeT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename Enabler = void>
+    struct Smfmac : public detail::amdgcn_smfmac<InputT, ComputeT, BlockM, BlockN>
+    {
+    };
+
+    // Unlock the smfmac backend only on gfx94x cards
+    template <typename InputT, typename ComputeT, uint32_t BlockM, uint32_t BlockN, uint32_t BlockK>
+    struct Smfmac<InputT,
+                  ComputeT,
+                  BlockM,
+                  BlockN,
+                  BlockK,
+                  enable_if_t<(ROCWMMA_ARCH_GFX940 || ROCWMMA_ARCH_GFX941 || ROCWMMA_ARCH_GFX942)
+                              && (BlockM == BlockN)>>
+    {
+        // Full-fragment IO traits. A is the logical (uncompressed) block.
+        using IOTraitsB   = IOTraits<BlockK, BlockN, InputT>;
+        using IOTraitsAcc = IOTraits<BlockM, BlockN, ComputeT>;
+
+        // Functional
+        using SMFMAC = detail::amdgcn_smfmac<InputT, ComputeT, BlockM, BlockN>;
+
+        // Per-SMFMAC iterative vector requirements
+        using VecTraitsA = VecTraits<typename SMFMAC::Traits::ARegsT>;
+        using VecTraitsB = VecTraits<typename SMFMAC::Traits::BRegsT>;
+        using VecTraitsC = VecTraits<typename SMFMAC::Traits::CRegsT>;
+        using VecTraitsD = VecTraits<typename SMFMAC::Traits::DRegsT>;
+
+        struct Traits
+        {
+            enum : uint32_t
+            {
+                SmfmacCount = BlockK / SMFMAC::Traits::KPerSmfmac,
+                MinK        = SMFMAC::Traits::KPerSmfmac,
+            };
+
+            // Create full-fragment vector sizes
+            using ARegsT = typename VecTraitsA::template VecT<typename VecTraitsA::DataT,
+                                                              SmfmacCount * VecTraitsA::size()>;
+            using BRegsT = typename VecTraitsB::template VecT<typename VecTraitsB::DataT,
+                                                              SmfmacCount * VecTraitsB::size()>;
+            using CRegsT = typename VecTraitsC::template VecT<>;
+            using DRegsT = typename VecTraitsD::template VecT<>;
+
+            // One index register per smfmac
+            using IdxRegsT = VecT<uint32_t, SmfmacCount>;
+
+            // Sanity checks
+            static_assert(BlockK >= MinK, "BlockK is not a minimum of MinK");
+            static_assert(BlockK % MinK == 0, "BlockK is not a multiple of MinK");
+
+            static_assert(
+                is_same<typename VecTraitsC::DataT, typename VecTraitsD::DataT>::value,
+                "C and D registers must be of same type");
+
+            // Compressed A holds half of the packed B register count
+            static_assert(2u * VecTraits<ARegsT>::size() == IOTraitsB::PackedSize,
+                          "Unexpected packed vector size for A");
+            static_assert(VecTraits<BRegsT>::size() == IOTraitsB::PackedSize,
+                          "Unexpected packed vector size for B");
+            static_assert(VecTraits<CRegsT>::size() == IOTraitsAcc::PackedSize,
+                          "Unexpected packed vector size for C");
+            static_assert(VecTraits<DRegsT>::size() == IOTraitsAcc::PackedSize,
+                          "Unexpected packed vector size for D");
+        };
+
+        ROCWMMA_DEVICE static inline auto exec(typename Traits::ARegsT const&   regsA,
+                                               typename Traits::BRegsT const&   regsB,
+                                               typename Traits::CRegsT const&   regsC,
+                                               typename Traits::IdxRegsT const& regsIdx) ->
+            typename Traits::DRegsT
+        {
+            typename Traits::DRegsT result = regsC;
+
+            // Iterate over SMFMAC input requirements
+            auto aIt = makeVectorIterator<VecTraitsA::size()>(regsA).begin();
+            auto bIt = makeVectorIterator<VecTraitsB::size()>(regsB).begin();
+
+            // Accumulate over SMFMAC count
+#pragma unroll
+            for(unsigned i = 0; i < Traits::SmfmacCount; i++)
+            {
+                result = SMFMAC::exec(*aIt, *bIt, result, regsIdx.data[i]);
+                aIt++;
+                bIt++;
+            }
+            return result;
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_SMFMAC_HPP
@@ -0,0 +1,484 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_SMFMAC_IMPL_HPP
+#define ROCWMMA_SMFMAC_IMPL_HPP
+
+#include "io_traits.hpp"
+#include "types.hpp"
+#include "vector.hpp"
+
+namespace rocwmma
+{
+
+    namespace detail
+    {
+
+        // Sparse MFMA multiplies a 2:4 structured sparse A with a dense B.
+        // Each lane provides half of its A values (the non-zeros), and the
+        // index of each value within its group of four K elements, 2 bits each.
+        // The per-lane index register holds the indices of all of the lane's
+        // A values in its low bits, in order of K.
+        template <typename InputT, typename ComputeT, uint32_t BlockM, uint32_t BlockN>
+        struct amdgcn_smfmac
+        {
+            template <typename RegsA, typename RegsB, typename RegsC, typename RegsIdx>
+            ROCWMMA_DEVICE static inline auto
+                exec(RegsA&& regsA, RegsB&& regsB, RegsC& regsC, RegsIdx&& regsIdx)
+            {
+                return regsC;
+            }
+        };
+
+// Sparse MFMA is gfx94x specific
+#if ROCWMMA_ARCH_GFX940 || ROCWMMA_ARCH_GFX941 || ROCWMMA_ARCH_GFX942
+
+        template <>
+        struct amdgcn_smfmac<float16_t, float32_t, 16, 16>
+        {
+            // Packed register traits
+            struct Traits
+            {
+                enum : uint32_t
+                {
+                    KPerSmfmac = 32
+                };
+                using ARegsT = VRegF32x2;
+                using BRegsT = VRegF32x4;
+                using CRegsT = AccRegF32x4;
+                using DRegsT = AccRegF32x4;
+            };
+
+            ROCWMMA_DEVICE static inline auto exec(typename Traits::ARegsT const& regsA,
+                                                   typename Traits::BRegsT const& regsB,
+                                                   typename Traits::CRegsT const& regsC,
+                                                   uint32_t                       regsIdx) ->
+                typename Traits::DRegsT
+            {
+                using TypeA = VRegF16x4;
+                using TypeB = VRegF16x8;
+
+                static_assert(sizeof(TypeA) == sizeof(decltype(regsA)),
+                              "Inconsistent data formats");
+                static_assert(sizeof(TypeB) == sizeof(decltype(regsB)),
+                              "Inconsistent data formats");
+
+                typename Traits::DRegsT result;
+                result.data = {__builtin_amdgcn_smfmac_f32_16x16x32_f16(
+                    reinterpret_cast<TypeA const&>(regsA).data,
+                    reinterpret_cast<TypeB const&>(regsB).data,
+                    regsC.data,
+                    static_cast<int>(regsIdx),
+                    0,
+                    0)};
+                return result;
+            }
+        };
+
+        template <>
+        struct amdgcn_smfmac<float16_t, float32_t, 32, 32>
+        {
+            // Packed register traits
+            struct Traits
+            {
+                enum : uint32_t
+                {
+                    KPerSmfmac = 16
+                };
+                using ARegsT = VRegF32x2;
+                using BRegsT = VRegF32x4;
+                using CRegsT = AccRegF32x16;
+                using DRegsT = AccRegF32x16;
+            };
+
+            ROCWMMA_DEVICE static inline auto exec(typename Traits::ARegsT const& regsA,
+                                                   typename Traits::BRegsT const& regsB,
+                                                   typename Traits::CRegsT const& regsC,
+                                                   uint32_t                       regsIdx) ->
+                typename Traits::DRegsT
+            {
+                using TypeA = VRegF16x4;
+                using TypeB = VRegF16x8;
+
+                static_assert(sizeof(TypeA) == sizeof(decltype(regsA)),
+                              "Inconsistent data formats");
+                static_assert(sizeof(TypeB) == sizeof(decltype(regsB)),
+                              "Inconsistent data formats");
+
+                typename Traits::DRegsT result;
+                result.data = {__builtin_amdgcn_smfmac_f32_32x32x16_f16(
+                    reinterpret_cast<TypeA const&>(regsA).data,
+                    reinterpret_cast<TypeB const&>(regsB).data,
+                    regsC.data,
+                    static_cast<int>(regsIdx),
+                    0,
+                    0)};
+                return result;
+            }
+        };
+
+        template <>
+        struct amdgcn_smfmac<bfloat16_t, float32_t, 16, 16>
+        {
+            // Packed register traits
+            struct Traits
+            {
+                enum : uint32_t
+                {
+                    KPerSmfmac = 32
+                };
+                using ARegsT = VRegF32x2;
+                using BRegsT = VRegF32x4;
+                using CRegsT = AccRegF32x4;
+                using DRegsT = AccRegF32x4;
+            };
+
+            ROCWMMA_DEVICE static inline auto exec(typename Traits::ARegsT const& regsA,
+                                                   typename Traits::BRegsT const& regsB,
+                                                   typename Traits::CRegsT const& regsC,
+                                                   uint32_t                       regsIdx) ->
+                typename Traits::DRegsT
+            {
+                using TypeA = VecT<short, 4>;
+                using TypeB = VecT<short, 8>;
+
+                static_assert(sizeof(TypeA) == sizeof(decltype(regsA)),
+                              "Inconsistent data formats");
+                static_assert(sizeof(TypeB) == sizeof(decltype(regsB)),
+                              "Inconsistent data formats");
+
+                typename Traits::DRegsT result;
+                result.data = {__builtin_amdgcn_smfmac_f32_16x16x32_bf16(
+                    reinterpret_cast<TypeA const&>(regsA).data,
+                    reinterpret_cast<TypeB const&>(regsB).data,
+                    regsC.data,
+                    static_cast<int>(regsIdx),
+                    0,
+                    0)};
+                return result;
+            }
+        };
+
+        template <>
+        struct amdgcn_smfmac<bfloat16_t, float32_t, 32, 32>
+        {
+            // Packed register traits
+            struct Traits
+            {
+                enum : uint32_t
+                {
+                    KPerSmfmac = 16
+                };
+                using ARegsT = VRegF32x2;
+                using BRegsT = VRegF32x4;
+                using CRegsT = AccRegF32x16;
+                using DRegsT = AccRegF32x16;
+            };
+
+            ROCWMMA_DEVICE static inline auto exec(typename Traits::ARegsT const& regsA,
+                                                   typename Traits::BRegsT const& regsB,
+                                                   typename Traits::CRegsT const& regsC,
+                                                   uint32_t                       regsIdx) ->
+                typename Traits::DRegsT
+            {
+                using TypeA = VecT<short, 4>;
+                using TypeB = VecT<short, 8>;
+
+                static_assert(sizeof(TypeA) == sizeof(decltype(regsA)),
+                              "Inconsistent data formats");
+                static_assert(sizeof(TypeB) == sizeof(decltype(regsB)),
+                              "Inconsistent data formats");
+
+                typename Traits::DRegsT result;
+                result.data = {__builtin_amdgcn_smfmac_f32_32x32x16_bf16(
+                    reinterpret_cast<TypeA const&>(regsA).data,
+                    reinterpret_cast<TypeB const&>(regsB).data,
+                    regsC.data,
+                    static_cast<int>(regsIdx),
+                    0,
+                    0)};
+                return result;
+            }
+        };
+
+        template <>
+        struct amdgcn_smfmac<int8_t, int32_t, 16, 16>
+        {
+            // Packed register traits
+            struct Traits
+            {
+                enum : uint32_t
+                {
+                    KPerSmfmac = 64
+                };
+                using ARegsT = VRegI32x2;
+                using BRegsT = VRegI32x4;
+                using CRegsT = AccRegI32x4;
+                using DRegsT = AccRegI32x4;
+            };
+
+            ROCWMMA_DEVICE static inline auto exec(typename Traits::ARegsT const& regsA,
+                                                   typename Traits::BRegsT const& regsB,
+                                                   typename Traits::CRegsT const& regsC,
+                                                   uint32_t                       regsIdx) ->
+                typename Traits::DRegsT
+            {
+                using TypeA = VRegI32x2;
+                using TypeB = VRegI32x4;
+
+                static_assert(sizeof(TypeA) == sizeof(decltype(regsA)),
+                              "Inconsistent data formats");
+                static_assert(sizeof(TypeB) == sizeof(decltype(regsB)),
+                              "Inconsistent data formats");
+
+                typename Traits::DRegsT result;
+                result.data = {__builtin_amdgcn_smfmac_i32_16x16x64_i8(
+                    reinterpret_cast<TypeA const&>(regsA).data,
+                    reinterpret_cast<TypeB const&>(regsB).data,
+                    regsC.data,
+                    static_cast<int>(regsIdx),
+                    0,
+                    0)};
+                return result;
+            }
+        };
+
+        template <>
+        struct amdgcn_smfmac<int8_t, int32_t, 32, 32>
+        {
+            // Packed register traits
+            struct Traits
+            {
+                enum : uint32_t
+                {
+                    KPerSmfmac = 32
+                };
+                using ARegsT = VRegI32x2;
+                using BRegsT = VRegI32x4;
+                using CRegsT = AccRegI32x16;
+                using DRegsT = AccRegI32x16;
+            };
+
+            ROCWMMA_DEVICE static inline auto exec(typename Traits::ARegsT const& regsA,
+                                                   typename Traits::BRegsT const& regsB,
+                                                   typename Traits::CRegsT const& regsC,
+                                                   uint32_t                       regsIdx) ->
+                typename Traits::DRegsT
+            {
+                using TypeA = VRegI32x2;
+                using TypeB = VRegI32x4;
+
+                static_assert(sizeof(TypeA) == sizeof(decltype(regsA)),
+                              "Inconsistent data formats");
+                static_assert(sizeof(TypeB) == sizeof(decltype(regsB)),
+                              "Inconsistent data formats");
+
+                typename Traits::DRegsT result;
+                result.data = {__builtin_amdgcn_smfmac_i32_32x32x32_i8(
+                    reinterpret_cast<TypeA const&>(regsA).data,
+                    reinterpret_cast<TypeB const&>(regsB).data,
+                    regsC.data,
+                    static_cast<int>(regsIdx),
+                    0,
+                    0)};
+                return result;
+            }
+        };
+
+        template <>
+        struct amdgcn_smfmac<float8_t, float32_t, 16, 16>
+        {
+            // Packed register traits
+            struct Traits
+            {
+                enum : uint32_t
+                {
+                    KPerSmfmac = 64
+                };
+                using ARegsT = VRegF32x2;
+                using BRegsT = VRegF32x4;
+                using CRegsT = AccRegF32x4;
+                using DRegsT = AccRegF32x4;
+            };
+
+            ROCWMMA_DEVICE static inline auto exec(typename Traits::ARegsT const& regsA,
+                                                   typename Traits::BRegsT const& regsB,
+                                                   typename Traits::CRegsT const& regsC,
+                                                   uint32_t                       regsIdx) ->
+                typename Traits::DRegsT
+            {
+                using TypeA = VRegI32x2;
+                using TypeB = VRegI32x4;
+
+                static_assert(sizeof(TypeA) == sizeof(decltype(regsA)),
+                              "Inconsistent data formats");
+                static_assert(sizeof(TypeB) == sizeof(decltype(regsB)),
+                              "Inconsistent data formats");
+
+                typename Traits::DRegsT result;
+                result.data = {__builtin_amdgcn_smfmac_f32_16x16x64_fp8_fp8(
+                    reinterpret_cast<TypeA const&>(regsA).data,
+                    reinterpret_cast<TypeB const&>(regsB).data,
+                    regsC.data,
+                    static_cast<int>(regsIdx),
+                    0,
+                    0)};
+                return result;
+            }
+        };
+
+        template <>
+        struct amdgcn_smfmac<float8_t, float32_t, 32, 32>
+        {
+            // Packed register traits
+            struct Traits
+            {
+                enum : uint32_t
+                {
+                    KPerSmfmac = 32
+                };
+                using ARegsT = VRegF32x2;
+                using BRegsT = VRegF32x4;
+                using CRegsT = AccRegF32x16;
+                using DRegsT = AccRegF32x16;
+            };
+
+            ROCWMMA_DEVICE static inline auto exec(typename Traits::ARegsT const& regsA,
+                                                   typename Traits::BRegsT const& regsB,
+                                                   typename Traits::CRegsT const& regsC,
+                                                   uint32_t                       regsIdx) ->
+                typename Traits::DRegsT
+            {
+                using TypeA = VRegI32x2;
+                using TypeB = VRegI32x4;
+
+                static_assert(sizeof(TypeA) == sizeof(decltype(regsA)),
+                              "Inconsistent data formats");
+                static_assert(sizeof(TypeB) == sizeof(decltype(regsB)),
+                              "Inconsistent data formats");
+
+                typename Traits::DRegsT result;
+                result.data = {__builtin_amdgcn_smfmac_f32_32x32x32_fp8_fp8(
+                    reinterpret_cast<TypeA const&>(regsA).data,
+                    reinterpret_cast<TypeB const&>(regsB).data,
+                    regsC.data,
+                    static_cast<int>(regsIdx),
+                    0,
+                    0)};
+                return result;
+            }
+        };
+
+        template <>
+        struct amdgcn_smfmac<bfloat8_t, float32_t, 16, 16>
+        {
+            // Packed register traits
+            struct Traits
+            {
+                enum : uint32_t
+                {
+                    KPerSmfmac = 64
+                };
+                using ARegsT = VRegF32x2;
+                using BRegsT = VRegF32x4;
+                using CRegsT = AccRegF32x4;
+                using DRegsT = AccRegF32x4;
+            };
+
+            ROCWMMA_DEVICE static inline auto exec(typename Traits::ARegsT const& regsA,
+                                                   typename Traits::BRegsT const& regsB,
+                                                   typename Traits::CRegsT const& regsC,
+                                                   uint32_t                       regsIdx) ->
+                typename Traits::DRegsT
+            {
+                using TypeA = VRegI32x2;
+                using TypeB = VRegI32x4;
+
+                static_assert(sizeof(TypeA) == sizeof(decltype(regsA)),
+                              "Inconsistent data formats");
+                static_assert(sizeof(TypeB) == sizeof(decltype(regsB)),
+                              "Inconsistent data formats");
+
+                typename Traits::DRegsT result;
+                result.data = {__builtin_amdgcn_smfmac_f32_16x16x64_bf8_bf8(
+                    reinterpret_cast<TypeA const&>(regsA).data,
+                    reinterpret_cast<TypeB const&>(regsB).data,
+                    regsC.data,
+                    static_cast<int>(regsIdx),
+                    0,
+                    0)};
+                return result;
+            }
+        };
+
+        template <>
+        struct amdgcn_smfmac<bfloat8_t, float32_t, 32, 32>
+        {
+            // Packed register traits
+            struct Traits
+            {
+                enum : uint32_t
+                {
+                    KPerSmfmac = 32
+                };
+                using ARegsT = VRegF32x2;
+                using BRegsT = VRegF32x4;
+                using CRegsT = AccRegF32x16;
+                using DRegsT = AccRegF32x16;
+            };
+
+            ROCWMMA_DEVICE static inline auto exec(typename Traits::ARegsT const& regsA,
+                                                   typename Traits::BRegsT const& regsB,
+                                                   typename Traits::CRegsT const& regsC,
+                                                   uint32_t                       regsIdx) ->
+                typename Traits::DRegsT
+            {
+                using TypeA = VRegI32x2;
+                using TypeB = VRegI32x4;
+
+                static_assert(sizeof(TypeA) == sizeof(decltype(regsA)),
+                              "Inconsistent data formats");
+                static_assert(sizeof(TypeB) == sizeof(decltype(regsB)),
+                              "Inconsistent data formats");
+
+                typename Traits::DRegsT result;
+                result.data = {__builtin_amdgcn_smfmac_f32_32x32x32_bf8_bf8(
+                    reinterpret_cast<TypeA const&>(regsA).data,
+                    reinterpret_cast<TypeB const&>(regsB).data,
+                    regsC.data,
+                    static_cast<int>(regsIdx),
+                    0,
+                    0)};
+                return result;
+            }
+        };
+
+#endif // ROCWMMA_ARCH_GFX940 || ROCWMMA_ARCH_GFX941 || ROCWMMA_ARCH_GFX942
+
+    } // namespace detail
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_SMFMAC_IMPL_HPP
@@ -0,0 +1,146 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_SPARSE_LAYOUT_HPP
+#define ROCWMMA_SPARSE_LAYOUT_HPP
+
+#include "api_fwd.hpp"
+#include "constants.hpp"
+#include "io_layout.hpp"
+#include "io_shape.hpp"
+#include "types.hpp"
+#include "vector.hpp"
+
+namespace rocwmma
+{
+    namespace detail
+    {
+        /*! \struct SparseLayout
+        *  \brief Mapping of 2:4 structured sparse matrix_a data to threads.
+        *
+        * The logical (uncompressed) BlockM x BlockK block is distributed exactly as
+        * a dense row_major matrix_a fragment, such that each lane holds vectors of
+        * DenseVW consecutive K elements of a single row. These vectors pair with the
+        * K vectors of matrix_b in the same lanes, one vector per sparse mfma.
+        *
+        * In every group of 4 consecutive K elements only 2 may be non-zero. Those
+        * are kept in the compressed values matrix of BlockM x BlockK / 2 in row_major
+        * order, and each lane holds ValueVW = DenseVW / 2 of them per vector.
+        *
+        * The position of each kept value within its group is given by 2 bits of
+        * metadata. Groups use 4 bits, the first value in the low bits, such that
+        * each row of metadata is stored as one 32b word per 32 logical K elements:
+        *
+        * word(row, k)  = metadata[row * ldi + k / 32]
+        * shift(row, k) = k % 32
+        *
+        * All mappings are available on host so that compressed data may be
+        * prepared and validated against host references.
+        *
+        * @tparam BlockM/N/K logical block dimensions
+        * @tparam DataT data type
+        */
+        template <uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename DataT>
+        struct SparseLayout
+        {
+            using IOShape  = IOShape<matrix_a, BlockM, BlockN, BlockK>;
+            using IOLayout = IOLayout<matrix_a,
+                                      IOShape::BlockDim,
+                                      IOShape::KDim,
+                                      DataT,
+                                      row_major,
+                                      1u>;
+
+            using MatrixLayout = typename IOLayout::MatrixLayout;
+
+            enum : uint32_t
+            {
+                WaveSize       = Constants::AMDGCN_WAVE_SIZE,
+                GroupSize      = 4u,
+                GroupValues    = 2u,
+                IndexBits      = 2u,
+                MetadataWordK  = 32u,
+                DenseVW        = IOLayout::MaxVW,
+                ValueVW        = DenseVW / 2u,
+                DenseSize      = BlockM * BlockK / WaveSize,
+                VectorCount    = DenseSize / DenseVW,
+                Size           = DenseSize / 2u,
+                MetadataBits   = DenseVW / GroupSize * GroupValues * IndexBits,
+            };
+
+            static_assert(IOShape::BlockDim <= 32u, "Sparse matrix_a BlockM must be 16 or 32");
+            static_assert(DenseVW % GroupSize == 0u,
+                          "Vectors must contain whole groups of sparse elements");
+            static_assert(MetadataWordK % DenseVW == 0u,
+                          "Vector metadata must not straddle metadata words");
+            static_assert(VectorCount * DenseVW == DenseSize, "Inconsistent vector count");
+
+            // Logical (row, k) of the first element of the given vector
+            ROCWMMA_HOST_DEVICE constexpr static inline Coord2d vectorCoord(uint32_t threadId,
+                                                                            uint32_t vector)
+            {
+                return MatrixLayout::baseOffset(threadId) + MatrixLayout::cumulativeOffset(vector);
+            }
+
+            // (row, col) of the given element in the compressed values matrix
+            ROCWMMA_HOST_DEVICE constexpr static inline Coord2d valueCoord(uint32_t threadId,
+                                                                           uint32_t index)
+            {
+                auto coord = vectorCoord(threadId, index / ValueVW);
+                return make_coord2d(get<0>(coord), get<1>(coord) / 2u + index % ValueVW);
+            }
+
+            // (row, word) of the metadata for the given vector
+            ROCWMMA_HOST_DEVICE constexpr static inline Coord2d metadataCoord(uint32_t threadId,
+                                                                              uint32_t vector)
+            {
+                auto coord = vectorCoord(threadId, vector);
+                return make_coord2d(get<0>(coord), get<1>(coord) / MetadataWordK);
+            }
+
+            // Extracts the metadata of the given vector from its metadata word
+            ROCWMMA_HOST_DEVICE constexpr static inline uint32_t
+                vectorMetadata(uint32_t threadId, uint32_t vector, uint32_t word)
+            {
+                auto shift = get<1>(vectorCoord(threadId, vector)) % MetadataWordK;
+                return (word >> shift) & ((1u << MetadataBits) - 1u);
+            }
+
+            // Logical K offset within the vector of the given compressed value
+            ROCWMMA_HOST_DEVICE constexpr static inline uint32_t
+                valueOffset(uint32_t index, uint32_t metadata)
+            {
+                auto vectorIndex = index % ValueVW;
+                auto group       = vectorIndex / GroupValues;
+                return group * GroupSize
+                       + ((metadata >> (vectorIndex * IndexBits)) & ((1u << IndexBits) - 1u));
+            }
+        };
+
+    } // namespace detail
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_SPARSE_LAYOUT_HPP
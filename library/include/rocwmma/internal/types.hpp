@@ -93,6 +93,18 @@ namespace rocwmma
 
     using xfloat32_t = rocwmma_xfloat32;
 
+    // Packed 4-bit integers, two per byte with the first element in the low nibble.
+    // These are storage types only, which are expanded to wider types on load.
+    struct int4x2_t
+    {
+        uint8_t data;
+    };
+
+    struct uint4x2_t
+    {
+        uint8_t data;
+    };
+
     /** @}*/
 
 } // namespace rocwmma
@@ -268,6 +268,18 @@ namespace rocwmma
         return "u8";
     }
 
+    template <>
+    constexpr const char* dataTypeToString<int4x2_t>()
+    {
+        return "i4";
+    }
+
+    template <>
+    constexpr const char* dataTypeToString<uint4x2_t>()
+    {
+        return "u4";
+    }
+
     template <>
     constexpr const char* dataTypeToString<int16_t>()
     {
@@ -99,6 +99,56 @@ namespace rocwmma
     {
     };
 
+    //! @struct cache_default
+    //! @brief Meta-tag indicating fragment memory accesses use the default cache policy.
+    struct cache_default
+    {
+    };
+
+    //! @struct cache_streaming
+    //! @brief Meta-tag indicating fragment memory accesses are non-temporal (streaming). Use for data that is
+    //! not re-used by the kernel, such as the final output, so that it does not displace cached data that is.
+    struct cache_streaming
+    {
+    };
+
+    //! @struct buffer_io
+    //! @brief Meta-tag indicating that fragment memory accesses are issued as raw buffer instructions, with the given cache policy.
+    //! The wave-uniform base address is held in scalar registers, and the bounded overloads let the hardware drop accesses past the
+    //! end of the matrix. Only load_matrix_sync and store_matrix_sync accept it.
+    //! @tparam CachePolicy Cache policy of the memory accesses as cache_default or cache_streaming
+    //! @note Buffer instructions cannot address LDS: the data pointer must point to global memory.
+    template <typename CachePolicy = cache_default>
+    struct buffer_io
+    {
+    };
+
+    //! @struct global_memory
+    //! @brief Meta-tag indicating that fragment data was loaded from global memory.
+    struct global_memory
+    {
+    };
+
+    //! @struct lds_memory
+    //! @brief Meta-tag indicating that fragment data was loaded from local (LDS) memory.
+    struct lds_memory
+    {
+    };
+
+    //! @struct xor_swizzle
+    //! @brief Meta-tag indicating that fragment data in memory is xor swizzled. Each line of the data layout (row for row_major, col for col_major)
+    //! is divided into chunks of ChunkSize contiguous elements, and chunk indices are permuted by XOR with (line index / LineGroup) in aligned groups of ChunkCount.
+    //! Used for fragment IO in LDS, such that accesses of consecutive lines fall into different banks.
+    //! @tparam ChunkSize Elements per chunk, as a power of 2 multiple of the fragment IO vector width
+    //! @tparam ChunkCount Chunks per permuted group, as a power of 2
+    //! @tparam LineGroup Consecutive lines sharing the same permutation, as a power of 2. Use > 1 when lines are shorter than the LDS bank width.
+    //! @note The swizzle is relative to the data pointer. Fragments of the same swizzled matrix must begin at line offsets that are multiples of
+    //! (ChunkCount * LineGroup) and at minor offsets that are multiples of (ChunkSize * ChunkCount), and ldm must be a multiple of (ChunkSize * ChunkCount).
+    template <uint32_t ChunkSize, uint32_t ChunkCount, uint32_t LineGroup = 1u>
+    struct xor_swizzle
+    {
+    };
+
     //! @struct layout_t
     //! @brief Runtime data layout tags
     //! @var mem_row_major
@@ -185,6 +235,16 @@ namespace rocwmma
         ROCWMMA_DEVICE constexpr static inline uint32_t kDim();
         //! @returns The size of the unpacked elements vector
         ROCWMMA_DEVICE constexpr static inline uint32_t size();
+        //! @param index Element index
+        //! @returns The (row, col) coordinate relative to the block origin of the unpacked element at given index, held by the calling thread
+        //! @note Requires a fragment data layout. Elements may be masked, biased or scaled in registers with these coordinates instead of a round trip through memory.
+        ROCWMMA_DEVICE static inline Coord2d elementCoord(uint32_t index);
+        //! @param threadId Index of the thread in the wave
+        //! @param index Element index
+        //! @returns The (row, col) coordinate relative to the block origin of the unpacked element at given index, held by the given thread
+        //! @note Requires a fragment data layout. Also available on host to inspect or validate fragment mappings.
+        ROCWMMA_HOST_DEVICE constexpr static inline Coord2d elementCoord(uint32_t threadId,
+                                                                         uint32_t index);
 
         //! Internal data storage views. Compatibility with nvcuda::wmma
         union
@@ -226,7 +286,9 @@ namespace rocwmma
     //! @tparam BlockM/N/K Block dimensions
     //! @tparam DataT Datatype
     //! @tparam DataLayoutT In-memory layout as col_major or row_major
-    template <typename MatrixT,
+    //! @tparam CachePolicy Cache policy of the memory accesses as cache_default or cache_streaming, or buffer_io thereof for global memory
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -246,10 +308,70 @@ namespace rocwmma
     //! @tparam MatrixT Fragment context
     //! @tparam BlockM/N/K Block dimensions
     //! @tparam DataT Datatype
-    template <typename MatrixT, uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename DataT>
+    //! @tparam CachePolicy Cache policy of the memory accesses as cache_default or cache_streaming, or buffer_io thereof for global memory
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT>
+    ROCWMMA_DEVICE void load_matrix_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT>& frag,
+                                         const DataT*                                      data,
+                                         uint32_t                                          ldm,
+                                         layout_t                                          layout);
+
+    //! Loads the fragment from the data pointer according to its matrix and data layout contexts, where the fragment may overlap the matrix edge.
+    //! Elements beyond the remaining rows or columns of the matrix are not read and are zero-filled in the fragment. Data pointer may point to either local or global memory.
+    //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @param data Data pointer to global or local memory
+    //! @param ldm Leading dimension size
+    //! @param rows Number of matrix rows remaining from the data pointer
+    //! @param cols Number of matrix columns remaining from the data pointer
+    //! @tparam MatrixT Fragment context
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DataT Datatype
+    //! @tparam DataLayoutT In-memory layout as col_major or row_major
+    //! @tparam CachePolicy Cache policy of the memory accesses as cache_default or cache_streaming, or buffer_io thereof for global memory
+    //! @note Interior fragments (rows >= height and cols >= width) take the unpredicated load path.
+    //! Where a fragment is known to be interior at compile time, prefer the overload without bounds.
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void
+        load_matrix_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag,
+                         const DataT*                                                   data,
+                         uint32_t                                                       ldm,
+                         uint32_t                                                       rows,
+                         uint32_t                                                       cols);
+
+    //! Loads the fragment from the data pointer according to its matrix layout and data layout contexts, where the fragment may overlap the matrix edge.
+    //! Elements beyond the remaining rows or columns of the matrix are not read and are zero-filled in the fragment.
+    //! Data pointer may point to either local or global memory. This overload provides a run-time ability to choose the data layout of the target fragment.
+    //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @param data Data pointer to global/local memory
+    //! @param ldm Leading dimension size
+    //! @param rows Number of matrix rows remaining from the data pointer
+    //! @param cols Number of matrix columns remaining from the data pointer
+    //! @param layout Data layout
+    //! @tparam MatrixT Fragment context
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DataT Datatype
+    //! @tparam CachePolicy Cache policy of the memory accesses as cache_default or cache_streaming, or buffer_io thereof for global memory
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT>
     ROCWMMA_DEVICE void load_matrix_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT>& frag,
                                          const DataT*                                      data,
                                          uint32_t                                          ldm,
+                                         uint32_t                                          rows,
+                                         uint32_t                                          cols,
                                          layout_t                                          layout);
 
     //! Stores the entire fragment to the data pointer according to its matrix and data layouts. Data pointer may point to either local or global memory.
@@ -260,7 +382,9 @@ namespace rocwmma
     //! @tparam BlockM/N/K Block dimensions
     //! @tparam DataT Datatype
     //! @tparam DataLayoutT in-memory layout as col_major or row_major
-    template <typename MatrixT,
+    //! @tparam CachePolicy Cache policy of the memory accesses as cache_default or cache_streaming, or buffer_io thereof for global memory
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -280,27 +404,224 @@ namespace rocwmma
     //! @tparam MatrixT Fragment context
     //! @tparam BlockM/N/K Block dimensions
     //! @tparam DataT Datatype
-    template <typename MatrixT, uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename DataT>
+    //! @tparam CachePolicy Cache policy of the memory accesses as cache_default or cache_streaming, or buffer_io thereof for global memory
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT>
     ROCWMMA_DEVICE void
         store_matrix_sync(DataT*                                                  data,
                           fragment<MatrixT, BlockM, BlockN, BlockK, DataT> const& frag,
                           uint32_t                                                ldm,
                           layout_t                                                layout);
 
+    //! Stores the fragment to the data pointer according to its matrix and data layouts, where the fragment may overlap the matrix edge.
+    //! Elements beyond the remaining rows or columns of the matrix are not written. Data pointer may point to either local or global memory.
+    //! @param data Data pointer to global/local memory
+    //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @param ldm Leading dimension size
+    //! @param rows Number of matrix rows remaining from the data pointer
+    //! @param cols Number of matrix columns remaining from the data pointer
+    //! @tparam MatrixT Fragment context
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DataT Datatype
+    //! @tparam DataLayoutT in-memory layout as col_major or row_major
+    //! @tparam CachePolicy Cache policy of the memory accesses as cache_default or cache_streaming, or buffer_io thereof for global memory
+    //! @note Interior fragments (rows >= height and cols >= width) take the unpredicated store path.
+    //! Where a fragment is known to be interior at compile time, prefer the overload without bounds.
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void
+        store_matrix_sync(DataT*                                                               data,
+                          fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag,
+                          uint32_t                                                             ldm,
+                          uint32_t                                                             rows,
+                          uint32_t                                                             cols);
+
+    //! Stores the fragment to the data pointer according to its matrix layout, where the fragment may overlap the matrix edge.
+    //! Elements beyond the remaining rows or columns of the matrix are not written. Data pointer may point to either local or global memory.
+    //! This overload provides a run-time ability to choose the data layout of the target fragment.
+    //! @param data Data pointer to global/local memory
+    //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @param ldm Leading dimension size
+    //! @param rows Number of matrix rows remaining from the data pointer
+    //! @param cols Number of matrix columns remaining from the data pointer
+    //! @param layout Data layout
+    //! @tparam MatrixT Fragment context
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DataT Datatype
+    //! @tparam CachePolicy Cache policy of the memory accesses as cache_default or cache_streaming, or buffer_io thereof for global memory
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT>
+    ROCWMMA_DEVICE void
+        store_matrix_sync(DataT*                                                  data,
+                          fragment<MatrixT, BlockM, BlockN, BlockK, DataT> const& frag,
+                          uint32_t                                                ldm,
+                          uint32_t                                                rows,
+                          uint32_t                                                cols,
+                          layout_t                                                layout);
+
+    //! Loads the entire fragment from xor swizzled memory according to its matrix and data layout contexts. Data pointer must point to local memory.
+    //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @param data Data pointer to local memory
+    //! @param ldm Leading dimension size
+    //! @param swizzle Swizzle of the data in memory
+    //! @tparam MatrixT Fragment context
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DataT Datatype
+    //! @tparam DataLayoutT In-memory layout as col_major or row_major
+    //! @tparam ChunkSize/ChunkCount/LineGroup Swizzle parameters
+    //! @tparam CachePolicy Cache policy of the memory accesses as cache_default or cache_streaming
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT,
+              uint32_t ChunkSize,
+              uint32_t ChunkCount,
+              uint32_t LineGroup>
+    ROCWMMA_DEVICE void
+        load_matrix_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag,
+                         const DataT*                                                   data,
+                         uint32_t                                                       ldm,
+                         xor_swizzle<ChunkSize, ChunkCount, LineGroup>                  swizzle);
+
+    //! Stores the entire fragment to xor swizzled memory according to its matrix and data layouts. Data pointer must point to local memory.
+    //! @param data Data pointer to local memory
+    //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @param ldm Leading dimension size
+    //! @param swizzle Swizzle of the data in memory
+    //! @tparam MatrixT Fragment context
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DataT Datatype
+    //! @tparam DataLayoutT in-memory layout as col_major or row_major
+    //! @tparam ChunkSize/ChunkCount/LineGroup Swizzle parameters
+    //! @tparam CachePolicy Cache policy of the memory accesses as cache_default or cache_streaming
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT,
+              uint32_t ChunkSize,
+              uint32_t ChunkCount,
+              uint32_t LineGroup>
+    ROCWMMA_DEVICE void
+        store_matrix_sync(DataT*                                                               data,
+                          fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag,
+                          uint32_t                                                             ldm,
+                          xor_swizzle<ChunkSize, ChunkCount, LineGroup>                        swizzle);
+
+    //! Issues the loads for the entire fragment from the data pointer according to its matrix and data layout contexts, without waiting for them to complete.
+    //! Fragment data must not be consumed until a matching wait_fragment, wait_global_loads or wait_lds_loads. Data pointer may point to either local or global memory.
+    //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @param data Data pointer to global or local memory
+    //! @param ldm Leading dimension size
+    //! @tparam MatrixT Fragment context
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DataT Datatype
+    //! @tparam DataLayoutT In-memory layout as col_major or row_major
+    //! @note Loads are issued at this point in program order, so that independent work (e.g. mma_sync) placed before the wait may overlap with memory latency.
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void
+        load_matrix_async(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag,
+                          const DataT*                                                   data,
+                          uint32_t                                                       ldm);
+
+    //! Issues the loads for the entire fragment from the data pointer according to its matrix layout and data layout contexts, without waiting for them to complete.
+    //! Fragment data must not be consumed until a matching wait_fragment, wait_global_loads or wait_lds_loads. Data pointer may point to either local or global memory.
+    //! This overload provides a run-time ability to choose the data layout of the target fragment.
+    //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @param data Data pointer to global/local memory
+    //! @param ldm Leading dimension size
+    //! @param layout Data layout
+    //! @tparam MatrixT Fragment context
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DataT Datatype
+    template <typename MatrixT, uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename DataT>
+    ROCWMMA_DEVICE void load_matrix_async(fragment<MatrixT, BlockM, BlockN, BlockK, DataT>& frag,
+                                          const DataT*                                      data,
+                                          uint32_t                                          ldm,
+                                          layout_t                                          layout);
+
+    //! @struct loaded_fragment
+    //! @brief Reference to a fragment, tagged with the memory that it was asynchronously loaded from.
+    //! Global and LDS loads are tracked by separate counters, so wait_fragment needs to know which one each fragment is counted by.
+    //! @tparam MemoryT Memory the fragment was loaded from, as global_memory or lds_memory
+    //! @tparam FragT Fragment type
+    template <typename MemoryT, typename FragT>
+    struct loaded_fragment
+    {
+        FragT const& frag;
+    };
+
+    //! Tags a fragment with the memory that it was asynchronously loaded from, for use with wait_fragment.
+    //! @param frag Fragment whose loads were issued with load_matrix_async
+    //! @tparam MemoryT Memory the fragment was loaded from, as global_memory or lds_memory
+    //! @tparam FragT Fragment type of frag
+    template <typename MemoryT, typename FragT>
+    ROCWMMA_DEVICE constexpr loaded_fragment<MemoryT, FragT> loaded_from(FragT const& frag);
+
+    //! Waits for the loads of a fragment previously issued with load_matrix_async to complete.
+    //! Loads of the same memory complete in the order they were issued, so loads of fragments issued after frag may remain in flight by passing them as pending.
+    //! Each fragment is tagged with loaded_from<global_memory> or loaded_from<lds_memory>: only pending fragments of the same memory as frag are left in flight.
+    //! For example, wait_fragment(loaded_from<lds_memory>(fragA), loaded_from<global_memory>(nextA)) waits for all LDS loads, but leaves the loads of nextA in flight.
+    //! @param frag Fragment whose loads must complete, optionally tagged with loaded_from
+    //! @param pending Tagged fragments whose loads were issued with load_matrix_async after frag, and may remain in flight
+    //! @tparam FragT Fragment type of frag, or loaded_fragment thereof
+    //! @tparam PendingTs Fragment types of pending, or loaded_fragment thereof
+    //! @note Pending load counts are determined at compile time from the fragment types. Untagged frag waits on both global and LDS loads, and
+    //! untagged pending fragments are not left in flight. Other memory operations issued in between are not tracked and are also waited on.
+    template <typename FragT, typename... PendingTs>
+    ROCWMMA_DEVICE void wait_fragment(FragT const& frag, PendingTs const&... pending);
+
+    //! Waits until no more than PendingLoads global memory instructions issued by this wave remain in flight. LDS loads are not waited on.
+    //! @tparam PendingLoads Number of most recently issued global memory instructions that may remain in flight
+    //! @note GetIOCount_v<FragT> gives the fewest memory instructions that a load of FragT is issued as.
+    template <uint32_t PendingLoads = 0u>
+    ROCWMMA_DEVICE void wait_global_loads();
+
+    //! Waits until no more than PendingLoads LDS instructions issued by this wave remain in flight. Global loads are not waited on.
+    //! @tparam PendingLoads Number of most recently issued LDS instructions that may remain in flight
+    //! @note GetIOCount_v<FragT> gives the fewest memory instructions that a load of FragT is issued as.
+    template <uint32_t PendingLoads = 0u>
+    ROCWMMA_DEVICE void wait_lds_loads();
+
     //! Performs the Multiply-Accumulate operation on the fragments A, B, C and D (D = A * B + C)
     //! @param d Accumulator output D
     //! @param a Input fragment A
     //! @param b Input fragment B
     //! @param c Input accumulator fragment C
     //! @tparam BlockM/N/K block dimensions
-    //! @tparam InputT Datatype of input frags A and B
+    //! @tparam InputTA/InputTB Datatypes of input frags A and B
     //! @tparam ComputeT Datatype of accumulator fragment C / D
     //! @tparam LayoutA/B/C/D In-memory layout of frag as col_major or row_major
     //! @note Frag c = d is valid
+    //! @note InputTA and InputTB must match, except for mixed float8_t / bfloat8_t inputs which are supported on gfx940, gfx941 and gfx942.
     template <uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
-              typename InputT,
+              typename InputTA,
+              typename InputTB,
               typename ComputeT,
               typename LayoutA,
               typename LayoutB,
@@ -308,8 +629,8 @@ namespace rocwmma
               typename LayoutD>
     ROCWMMA_DEVICE void
         mma_sync(fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutD>&       d,
-                 fragment<matrix_a, BlockM, BlockN, BlockK, InputT, LayoutA> const&      a,
-                 fragment<matrix_b, BlockM, BlockN, BlockK, InputT, LayoutB> const&      b,
+                 fragment<matrix_a, BlockM, BlockN, BlockK, InputTA, LayoutA> const&     a,
+                 fragment<matrix_b, BlockM, BlockN, BlockK, InputTB, LayoutB> const&     b,
                  fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutC> const& c);
 
     //! Synchronization point for all wavefronts in a workgroup. Guarantees pending reads / writes to LDS are flushed.
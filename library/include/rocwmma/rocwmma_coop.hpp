@@ -110,7 +110,9 @@ namespace rocwmma
     //! @tparam BlockM/N/K block dimensions
     //! @tparam DataT data type
     //! @tparam DataLayoutT in-memory layout as col_major or row_major
-    template <typename MatrixT,
+    //! @tparam CachePolicy cache policy of the memory accesses as cache_default or cache_streaming
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -141,7 +143,9 @@ namespace rocwmma
     //! @tparam BlockM/N/K block dimensions
     //! @tparam DataT data type
     //! @tparam DataLayoutT in-memory layout as col_major or row_major
-    template <typename MatrixT,
+    //! @tparam CachePolicy cache policy of the memory accesses as cache_default or cache_streaming
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -216,7 +220,9 @@ namespace rocwmma
     //! @tparam BlockM/N/K block dimensions
     //! @tparam DataT data type
     //! @tparam DataLayoutT in-memory layout as col_major or row_major
+    //! @tparam CachePolicy cache policy of the memory accesses as cache_default or cache_streaming
     template <uint32_t WaveCount,
+              typename CachePolicy = cache_default,
               typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
@@ -288,7 +294,9 @@ namespace rocwmma
     //! @tparam BlockM/N/K block dimensions
     //! @tparam DataT data type
     //! @tparam DataLayoutT in-memory layout as col_major or row_major
-    template <typename MatrixT,
+    //! @tparam CachePolicy cache policy of the memory accesses as cache_default or cache_streaming
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -320,7 +328,9 @@ namespace rocwmma
     //! @tparam BlockM/N/K block dimensions
     //! @tparam DataT data type
     //! @tparam DataLayoutT in-memory layout as col_major or row_major
-    template <typename MatrixT,
+    //! @tparam CachePolicy cache policy of the memory accesses as cache_default or cache_streaming
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -398,7 +408,9 @@ namespace rocwmma
     //! @tparam BlockM/N/K block dimensions
     //! @tparam DataT data type
     //! @tparam DataLayoutT in-memory layout as col_major or row_major
+    //! @tparam CachePolicy cache policy of the memory accesses as cache_default or cache_streaming
     template <uint32_t WaveCount,
+              typename CachePolicy = cache_default,
               typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
@@ -411,6 +423,298 @@ namespace rocwmma
         uint32_t                                                             ldm,
         uint32_t                                                             waveIndex);
 
+    //! Loads the fragment from memory address cooperatively across wavefronts, where the fragment may overlap the matrix edge.
+    //! Each cooperating wavefront is responsible in loading a portion of the final fragment.
+    //! Elements beyond the remaining rows or columns of the matrix are not read and are zero-filled in the fragment.
+    //! @note Individual wavefronts only load a smaller portion of the full data that they are responsible for.
+    //!
+    //! The full load is split into work items (default = waveCount).
+    //! Work items are assigned in round robin fashion to waves in the range of [0, waveCount).
+    //! The current wave index determines the order of the current wave in the collaboration pool.
+    //! Work items are consumed in order by waves [0, waveCount) until there are no more
+    //! work items and the operation is completed.
+    //!
+    //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @param data Data pointer to global/local memory
+    //! @param ldm Leading dimension size
+    //! @param waveIndex Index assignment of current wave in collaboration
+    //! @param waveCount Number of waves assigned for collaboration
+    //! @param rows Number of matrix rows remaining from the data pointer
+    //! @param cols Number of matrix columns remaining from the data pointer
+    //! @tparam MatrixT fragment context
+    //! @tparam BlockM/N/K block dimensions
+    //! @tparam DataT data type
+    //! @tparam DataLayoutT in-memory layout as col_major or row_major
+    //! @tparam CachePolicy cache policy of the memory accesses as cache_default or cache_streaming
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void
+        load_matrix_coop_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag,
+                              const DataT*                                                   data,
+                              uint32_t                                                       ldm,
+                              uint32_t waveIndex,
+                              uint32_t waveCount,
+                              uint32_t rows,
+                              uint32_t cols);
+
+    //! Loads the fragment from memory address cooperatively across wavefronts, where the fragment may overlap the matrix edge.
+    //! Each cooperating wavefront is responsible in loading a portion of the final fragment.
+    //! Elements beyond the remaining rows or columns of the matrix are not read and are zero-filled in the fragment.
+    //! @note Individual wavefronts only load a smaller portion of the full data that they are responsible for.
+    //!
+    //! This flavor of cooperative load includes WaveCount as a template parameter that may be used
+    //! to optimize during compile time, and is preferred over providing this value as runtime function argument.
+    //!
+    //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @param data Data pointer to global/local memory
+    //! @param ldm Leading dimension size
+    //! @param waveIndex Index assignment of current wave in collaboration
+    //! @param rows Number of matrix rows remaining from the data pointer
+    //! @param cols Number of matrix columns remaining from the data pointer
+    //! @tparam uint32_t WaveCount
+    //! @tparam MatrixT fragment context
+    //! @tparam BlockM/N/K block dimensions
+    //! @tparam DataT data type
+    //! @tparam DataLayoutT in-memory layout as col_major or row_major
+    //! @tparam CachePolicy cache policy of the memory accesses as cache_default or cache_streaming
+    template <uint32_t WaveCount,
+              typename CachePolicy = cache_default,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void
+        load_matrix_coop_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag,
+                              const DataT*                                                   data,
+                              uint32_t                                                       ldm,
+                              uint32_t waveIndex,
+                              uint32_t rows,
+                              uint32_t cols);
+
+    //! Cooperative Store Matrix - Stores the fragment to data address cooperatively across waves, where the fragment may overlap the matrix edge.
+    //! Each cooperative wave is responsible in storing a portion of the final fragment.
+    //! Elements beyond the remaining rows or columns of the matrix are not written.
+    //!
+    //! The full store is split into work items (default = waveCount). Work items are assigned
+    //! in round robin fashion to waves in the range of [0, waveCount). The current
+    //! wave index determines the order of the current wave in the collaboration pool.
+    //! Work items are consumed in order by waves [0, waveCount) until there are no more
+    //! work items and the operation is completed.
+    //!
+    //! @param data Data pointer to global/local memory
+    //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @param ldm Leading dimension size
+    //! @param waveIndex Index assignment of current wave in collaboration
+    //! @param waveCount Number of waves assigned for collaboration
+    //! @param rows Number of matrix rows remaining from the data pointer
+    //! @param cols Number of matrix columns remaining from the data pointer
+    //! @tparam MatrixT fragment context
+    //! @tparam BlockM/N/K block dimensions
+    //! @tparam DataT data type
+    //! @tparam DataLayoutT in-memory layout as col_major or row_major
+    //! @tparam CachePolicy cache policy of the memory accesses as cache_default or cache_streaming
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void store_matrix_coop_sync(
+        DataT*                                                               data,
+        fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag,
+        uint32_t                                                             ldm,
+        uint32_t                                                             waveIndex,
+        uint32_t                                                             waveCount,
+        uint32_t                                                             rows,
+        uint32_t                                                             cols);
+
+    //! Cooperative Store Matrix - Stores the fragment to data address cooperatively across waves, where the fragment may overlap the matrix edge.
+    //! Each cooperative wave is responsible in storing a portion of the final fragment.
+    //! Elements beyond the remaining rows or columns of the matrix are not written.
+    //!
+    //! This flavor of cooperative store includes WaveCount as a template parameter that may be used
+    //! to optimize during compile time, and is preferred over providing this value as runtime function argument.
+    //!
+    //! @param data Data pointer to global/local memory
+    //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @param ldm Leading dimension size
+    //! @param waveIndex Index assignment of current wave in collaboration
+    //! @param rows Number of matrix rows remaining from the data pointer
+    //! @param cols Number of matrix columns remaining from the data pointer
+    //! @tparam WaveCount Number of waves participating
+    //! @tparam MatrixT fragment context
+    //! @tparam BlockM/N/K block dimensions
+    //! @tparam DataT data type
+    //! @tparam DataLayoutT in-memory layout as col_major or row_major
+    //! @tparam CachePolicy cache policy of the memory accesses as cache_default or cache_streaming
+    template <uint32_t WaveCount,
+              typename CachePolicy = cache_default,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void store_matrix_coop_sync(
+        DataT*                                                               data,
+        fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag,
+        uint32_t                                                             ldm,
+        uint32_t                                                             waveIndex,
+        uint32_t                                                             rows,
+        uint32_t                                                             cols);
+
+    //! Loads the fragment from xor swizzled memory cooperatively across wavefronts.
+    //! Each cooperating wavefront is responsible in loading a portion of the final fragment.
+    //! Data pointer must point to local memory.
+    //! @note Individual wavefronts only load a smaller portion of the full data that they are responsible for.
+    //!
+    //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @param data Data pointer to local memory
+    //! @param ldm Leading dimension size
+    //! @param waveIndex Index assignment of current wave in collaboration
+    //! @param waveCount Number of waves assigned for collaboration
+    //! @param swizzle Swizzle of the data in memory
+    //! @tparam MatrixT fragment context
+    //! @tparam BlockM/N/K block dimensions
+    //! @tparam DataT data type
+    //! @tparam DataLayoutT in-memory layout as col_major or row_major
+    //! @tparam ChunkSize/ChunkCount/LineGroup swizzle parameters
+    //! @tparam CachePolicy cache policy of the memory accesses as cache_default or cache_streaming
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT,
+              uint32_t ChunkSize,
+              uint32_t ChunkCount,
+              uint32_t LineGroup>
+    ROCWMMA_DEVICE void
+        load_matrix_coop_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag,
+                              const DataT*                                                   data,
+                              uint32_t                                                       ldm,
+                              uint32_t waveIndex,
+                              uint32_t waveCount,
+                              xor_swizzle<ChunkSize, ChunkCount, LineGroup> swizzle);
+
+    //! Loads the fragment from xor swizzled memory cooperatively across wavefronts.
+    //! Each cooperating wavefront is responsible in loading a portion of the final fragment.
+    //! Data pointer must point to local memory.
+    //! @note Individual wavefronts only load a smaller portion of the full data that they are responsible for.
+    //!
+    //! This flavor of cooperative load includes WaveCount as a template parameter that may be used
+    //! to optimize during compile time, and is preferred over providing this value as runtime function argument.
+    //!
+    //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @param data Data pointer to local memory
+    //! @param ldm Leading dimension size
+    //! @param waveIndex Index assignment of current wave in collaboration
+    //! @param swizzle Swizzle of the data in memory
+    //! @tparam uint32_t WaveCount
+    //! @tparam MatrixT fragment context
+    //! @tparam BlockM/N/K block dimensions
+    //! @tparam DataT data type
+    //! @tparam DataLayoutT in-memory layout as col_major or row_major
+    //! @tparam ChunkSize/ChunkCount/LineGroup swizzle parameters
+    //! @tparam CachePolicy cache policy of the memory accesses as cache_default or cache_streaming
+    template <uint32_t WaveCount,
+              typename CachePolicy = cache_default,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT,
+              uint32_t ChunkSize,
+              uint32_t ChunkCount,
+              uint32_t LineGroup>
+    ROCWMMA_DEVICE void
+        load_matrix_coop_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag,
+                              const DataT*                                                   data,
+                              uint32_t                                                       ldm,
+                              uint32_t waveIndex,
+                              xor_swizzle<ChunkSize, ChunkCount, LineGroup> swizzle);
+
+    //! Cooperative Store Matrix - Stores the fragment to xor swizzled memory cooperatively across waves.
+    //! Each cooperative wave is responsible in storing a portion of the final fragment.
+    //! Data pointer must point to local memory.
+    //!
+    //! @param data Data pointer to local memory
+    //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @param ldm Leading dimension size
+    //! @param waveIndex Index assignment of current wave in collaboration
+    //! @param waveCount Number of waves assigned for collaboration
+    //! @param swizzle Swizzle of the data in memory
+    //! @tparam MatrixT fragment context
+    //! @tparam BlockM/N/K block dimensions
+    //! @tparam DataT data type
+    //! @tparam DataLayoutT in-memory layout as col_major or row_major
+    //! @tparam ChunkSize/ChunkCount/LineGroup swizzle parameters
+    //! @tparam CachePolicy cache policy of the memory accesses as cache_default or cache_streaming
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT,
+              uint32_t ChunkSize,
+              uint32_t ChunkCount,
+              uint32_t LineGroup>
+    ROCWMMA_DEVICE void store_matrix_coop_sync(
+        DataT*                                                               data,
+        fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag,
+        uint32_t                                                             ldm,
+        uint32_t                                                             waveIndex,
+        uint32_t                                                             waveCount,
+        xor_swizzle<ChunkSize, ChunkCount, LineGroup>                        swizzle);
+
+    //! Cooperative Store Matrix - Stores the fragment to xor swizzled memory cooperatively across waves.
+    //! Each cooperative wave is responsible in storing a portion of the final fragment.
+    //! Data pointer must point to local memory.
+    //!
+    //! This flavor of cooperative store includes WaveCount as a template parameter that may be used
+    //! to optimize during compile time, and is preferred over providing this value as runtime function argument.
+    //!
+    //! @param data Data pointer to local memory
+    //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @param ldm Leading dimension size
+    //! @param waveIndex Index assignment of current wave in collaboration
+    //! @param swizzle Swizzle of the data in memory
+    //! @tparam WaveCount Number of waves participating
+    //! @tparam MatrixT fragment context
+    //! @tparam BlockM/N/K block dimensions
+    //! @tparam DataT data type
+    //! @tparam DataLayoutT in-memory layout as col_major or row_major
+    //! @tparam ChunkSize/ChunkCount/LineGroup swizzle parameters
+    //! @tparam CachePolicy cache policy of the memory accesses as cache_default or cache_streaming
+    template <uint32_t WaveCount,
+              typename CachePolicy = cache_default,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT,
+              uint32_t ChunkSize,
+              uint32_t ChunkCount,
+              uint32_t LineGroup>
+    ROCWMMA_DEVICE void store_matrix_coop_sync(
+        DataT*                                                               data,
+        fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag,
+        uint32_t                                                             ldm,
+        uint32_t                                                             waveIndex,
+        xor_swizzle<ChunkSize, ChunkCount, LineGroup>                        swizzle);
+
 } // namespace rocwmma
 
 #include "rocwmma_coop_impl.hpp"
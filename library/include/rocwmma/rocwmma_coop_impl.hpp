@@ -29,6 +29,7 @@
 #include "internal/coop_io_config.hpp"
 #include "internal/coop_load.hpp"
 #include "internal/coop_store.hpp"
+#include "internal/io_bounds.hpp"
 
 #include "rocwmma_coop.hpp"
 
@@ -52,7 +53,8 @@ namespace rocwmma
         load_matrix_coop_sync(frag, data, ldm, waveIndex, waveCount);
     }
 
-    template <typename MatrixT,
+    template <typename CachePolicy,
+              typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -67,7 +69,7 @@ namespace rocwmma
     {
 
         using FragT  = decay_t<decltype(frag)>;
-        using Loader = typename GetCoopIOConfig_t<FragT>::Loader;
+        using Loader = typename GetCoopIOConfig_t<FragT>::template PolicyLoader<CachePolicy>;
 
         // Sanity checks
         static_assert(!is_same<DataLayoutT, void>::value,
@@ -84,7 +86,8 @@ namespace rocwmma
         Loader::exec(frag.mAccess, data, ldm, waveIndex, waveCount);
     }
 
-    template <typename MatrixT,
+    template <typename CachePolicy,
+              typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -104,7 +107,7 @@ namespace rocwmma
 
         auto waveIndex = get<0>(waveCoord) * get<1>(wgDim) + get<1>(waveCoord);
         auto waveCount = get<0>(wgDim) * get<1>(wgDim);
-        load_matrix_coop_sync(frag, data, ldm, waveIndex, waveCount);
+        load_matrix_coop_sync<CachePolicy>(frag, data, ldm, waveIndex, waveCount);
     }
 
     // @cond
@@ -128,6 +131,7 @@ namespace rocwmma
     // @endcond
 
     template <uint32_t WaveCount,
+              typename CachePolicy,
               typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
@@ -141,7 +145,8 @@ namespace rocwmma
                               uint32_t waveIndex)
     {
         using FragT  = decay_t<decltype(frag)>;
-        using Loader = typename GetCoopIOConfig_t<FragT, WaveCount>::Loader;
+        using Loader
+            = typename GetCoopIOConfig_t<FragT, WaveCount>::template PolicyLoader<CachePolicy>;
 
         // Sanity checks
         static_assert(!is_same<DataLayoutT, void>::value,
@@ -176,7 +181,8 @@ namespace rocwmma
         store_matrix_coop_sync(data, frag, ldm, waveIndex, waveCount);
     }
 
-    template <typename MatrixT,
+    template <typename CachePolicy,
+              typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -190,7 +196,7 @@ namespace rocwmma
         uint32_t                                                             waveCount)
     {
         using FragT  = decay_t<decltype(frag)>;
-        using Storer = typename GetCoopIOConfig_t<FragT>::Storer;
+        using Storer = typename GetCoopIOConfig_t<FragT>::template PolicyStorer<CachePolicy>;
 
         // Sanity checks
         static_assert(!is_same<DataLayoutT, void>::value,
@@ -207,7 +213,8 @@ namespace rocwmma
         Storer::exec(data, frag.mAccess, ldm, waveIndex, waveCount);
     }
 
-    template <typename MatrixT,
+    template <typename CachePolicy,
+              typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -227,7 +234,7 @@ namespace rocwmma
 
         auto waveIndex = get<0>(waveCoord) * get<1>(wgDim) + get<1>(waveCoord);
         auto waveCount = get<0>(wgDim) * get<1>(wgDim);
-        store_matrix_coop_sync(data, frag, ldm, waveIndex, waveCount);
+        store_matrix_coop_sync<CachePolicy>(data, frag, ldm, waveIndex, waveCount);
     }
 
     // @cond
@@ -253,6 +260,7 @@ namespace rocwmma
     // @endcond
 
     template <uint32_t WaveCount,
+              typename CachePolicy,
               typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
@@ -267,7 +275,8 @@ namespace rocwmma
     {
 
         using FragT  = decay_t<decltype(frag)>;
-        using Storer = typename GetCoopIOConfig_t<FragT, WaveCount>::Storer;
+        using Storer
+            = typename GetCoopIOConfig_t<FragT, WaveCount>::template PolicyStorer<CachePolicy>;
 
         // Sanity checks
         static_assert(!is_same<DataLayoutT, void>::value,
@@ -284,6 +293,352 @@ namespace rocwmma
         Storer::template exec<WaveCount>(data, frag.mAccess, ldm, waveIndex);
     }
 
+    template <typename CachePolicy,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void
+        load_matrix_coop_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag,
+                              const DataT*                                                   data,
+                              uint32_t                                                       ldm,
+                              uint32_t waveIndex,
+                              uint32_t waveCount,
+                              uint32_t rows,
+                              uint32_t cols)
+    {
+        using FragT   = decay_t<decltype(frag)>;
+        using IOShape = GetIOShape_t<FragT>;
+        using Loader  = typename GetCoopIOConfig_t<FragT>::template PolicyLoader<CachePolicy>;
+
+        // Sanity checks
+        static_assert(!is_same<DataLayoutT, void>::value,
+                      "Must provide layout information. Either statically assign data layout in "
+                      "fragment declaration or use the run-time function overload.");
+
+        static_assert(
+            is_same<typename FragT::Traits::AccessT, typename Loader::Traits::OutputT>::value,
+            "Fragment access and coop load output types do not match");
+
+        auto extent = make_coord2d(rows, cols);
+
+        // Load and implicit pack
+        // Note: the frag will only be partially filled with useful data.
+        // Layout and thread locality is not guaranteed.
+        // Interior blocks don't need predication.
+        if(detail::isBlockInBounds<IOShape::BlockHeight, IOShape::BlockWidth>(extent))
+        {
+            Loader::exec(frag.mAccess, data, ldm, waveIndex, waveCount);
+        }
+        else
+        {
+            Loader::exec(frag.mAccess, data, ldm, waveIndex, waveCount, extent);
+        }
+    }
+
+    template <uint32_t WaveCount,
+              typename CachePolicy,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void
+        load_matrix_coop_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag,
+                              const DataT*                                                   data,
+                              uint32_t                                                       ldm,
+                              uint32_t waveIndex,
+                              uint32_t rows,
+                              uint32_t cols)
+    {
+        using FragT   = decay_t<decltype(frag)>;
+        using IOShape = GetIOShape_t<FragT>;
+        using Loader
+            = typename GetCoopIOConfig_t<FragT, WaveCount>::template PolicyLoader<CachePolicy>;
+
+        // Sanity checks
+        static_assert(!is_same<DataLayoutT, void>::value,
+                      "Must provide layout information. Either statically assign data layout in "
+                      "fragment declaration or use the run-time function overload.");
+
+        static_assert(
+            is_same<typename FragT::Traits::AccessT, typename Loader::Traits::OutputT>::value,
+            "Fragment access and coop load output types do not match");
+
+        auto extent = make_coord2d(rows, cols);
+
+        // Load and implicit pack
+        // Note: the frag will only be partially filled with useful data.
+        // Layout and thread locality is not guaranteed.
+        // Interior blocks don't need predication.
+        if(detail::isBlockInBounds<IOShape::BlockHeight, IOShape::BlockWidth>(extent))
+        {
+            Loader::template exec<WaveCount>(frag.mAccess, data, ldm, waveIndex);
+        }
+        else
+        {
+            Loader::template exec<WaveCount>(frag.mAccess, data, ldm, waveIndex, extent);
+        }
+    }
+
+    template <typename CachePolicy,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void store_matrix_coop_sync(
+        DataT*                                                               data,
+        fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag,
+        uint32_t                                                             ldm,
+        uint32_t                                                             waveIndex,
+        uint32_t                                                             waveCount,
+        uint32_t                                                             rows,
+        uint32_t                                                             cols)
+    {
+        using FragT   = decay_t<decltype(frag)>;
+        using IOShape = GetIOShape_t<FragT>;
+        using Storer  = typename GetCoopIOConfig_t<FragT>::template PolicyStorer<CachePolicy>;
+
+        // Sanity checks
+        static_assert(!is_same<DataLayoutT, void>::value,
+                      "Must provide data layout. Either statically assign data layout in "
+                      "fragment declaration or use the run-time function overload.");
+
+        static_assert(
+            is_same<typename FragT::Traits::AccessT, typename Storer::Traits::InputT>::value,
+            "Fragment access and coop store input types do not match");
+
+        auto extent = make_coord2d(rows, cols);
+
+        // Implicit unpack and store
+        // Note: the frag is only be partially filled with useful data.
+        // Layout and thread locality is not guaranteed.
+        // Interior blocks don't need predication.
+        if(detail::isBlockInBounds<IOShape::BlockHeight, IOShape::BlockWidth>(extent))
+        {
+            Storer::exec(data, frag.mAccess, ldm, waveIndex, waveCount);
+        }
+        else
+        {
+            Storer::exec(data, frag.mAccess, ldm, waveIndex, waveCount, extent);
+        }
+    }
+
+    template <uint32_t WaveCount,
+              typename CachePolicy,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void store_matrix_coop_sync(
+        DataT*                                                               data,
+        fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag,
+        uint32_t                                                             ldm,
+        uint32_t                                                             waveIndex,
+        uint32_t                                                             rows,
+        uint32_t                                                             cols)
+    {
+        using FragT   = decay_t<decltype(frag)>;
+        using IOShape = GetIOShape_t<FragT>;
+        using Storer
+            = typename GetCoopIOConfig_t<FragT, WaveCount>::template PolicyStorer<CachePolicy>;
+
+        // Sanity checks
+        static_assert(!is_same<DataLayoutT, void>::value,
+                      "Must provide data layout. Either statically assign data layout in "
+                      "fragment declaration or use the run-time function overload.");
+
+        static_assert(
+            is_same<typename FragT::Traits::AccessT, typename Storer::Traits::InputT>::value,
+            "Fragment access and coop store input types do not match");
+
+        auto extent = make_coord2d(rows, cols);
+
+        // Implicit unpack and store
+        // Note: the frag is only be partially filled with useful data.
+        // Layout and thread locality is not guaranteed.
+        // Interior blocks don't need predication.
+        if(detail::isBlockInBounds<IOShape::BlockHeight, IOShape::BlockWidth>(extent))
+        {
+            Storer::template exec<WaveCount>(data, frag.mAccess, ldm, waveIndex);
+        }
+        else
+        {
+            Storer::template exec<WaveCount>(data, frag.mAccess, ldm, waveIndex, extent);
+        }
+    }
+
+    template <typename CachePolicy,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT,
+              uint32_t ChunkSize,
+              uint32_t ChunkCount,
+              uint32_t LineGroup>
+    ROCWMMA_DEVICE inline void
+        load_matrix_coop_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag,
+                              const DataT*                                                   data,
+                              uint32_t                                                       ldm,
+                              uint32_t waveIndex,
+                              uint32_t waveCount,
+                              xor_swizzle<ChunkSize, ChunkCount, LineGroup>)
+    {
+        using FragT  = decay_t<decltype(frag)>;
+        using Config = GetCoopIOConfig_t<FragT>;
+        using Loader = typename Config::
+            template SwizzledLoader<ChunkSize, ChunkCount, LineGroup, CachePolicy>;
+
+        // Sanity checks
+        static_assert(!is_same<DataLayoutT, void>::value,
+                      "Must provide layout information. Swizzled loads require the data layout "
+                      "to be statically assigned in the fragment declaration.");
+
+        static_assert(ChunkSize % Config::IOLayout::VW == 0,
+                      "Swizzle chunks must contain whole IO vectors");
+
+        static_assert(
+            is_same<typename FragT::Traits::AccessT, typename Loader::Traits::OutputT>::value,
+            "Fragment access and coop load output types do not match");
+
+        // Load and implicit pack
+        // Note: the frag will only be partially filled with useful data.
+        // Layout and thread locality is not guaranteed.
+        Loader::exec(frag.mAccess, data, ldm, waveIndex, waveCount);
+    }
+
+    template <uint32_t WaveCount,
+              typename CachePolicy,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT,
+              uint32_t ChunkSize,
+              uint32_t ChunkCount,
+              uint32_t LineGroup>
+    ROCWMMA_DEVICE void
+        load_matrix_coop_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag,
+                              const DataT*                                                   data,
+                              uint32_t                                                       ldm,
+                              uint32_t waveIndex,
+                              xor_swizzle<ChunkSize, ChunkCount, LineGroup>)
+    {
+        using FragT  = decay_t<decltype(frag)>;
+        using Config = GetCoopIOConfig_t<FragT, WaveCount>;
+        using Loader = typename Config::
+            template SwizzledLoader<ChunkSize, ChunkCount, LineGroup, CachePolicy>;
+
+        // Sanity checks
+        static_assert(!is_same<DataLayoutT, void>::value,
+                      "Must provide layout information. Swizzled loads require the data layout "
+                      "to be statically assigned in the fragment declaration.");
+
+        static_assert(ChunkSize % Config::IOLayout::VW == 0,
+                      "Swizzle chunks must contain whole IO vectors");
+
+        static_assert(
+            is_same<typename FragT::Traits::AccessT, typename Loader::Traits::OutputT>::value,
+            "Fragment access and coop load output types do not match");
+
+        // Load and implicit pack
+        // Note: the frag will only be partially filled with useful data.
+        // Layout and thread locality is not guaranteed.
+        Loader::template exec<WaveCount>(frag.mAccess, data, ldm, waveIndex);
+    }
+
+    template <typename CachePolicy,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT,
+              uint32_t ChunkSize,
+              uint32_t ChunkCount,
+              uint32_t LineGroup>
+    ROCWMMA_DEVICE void store_matrix_coop_sync(
+        DataT*                                                               data,
+        fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag,
+        uint32_t                                                             ldm,
+        uint32_t                                                             waveIndex,
+        uint32_t                                                             waveCount,
+        xor_swizzle<ChunkSize, ChunkCount, LineGroup>)
+    {
+        using FragT  = decay_t<decltype(frag)>;
+        using Config = GetCoopIOConfig_t<FragT>;
+        using Storer = typename Config::
+            template SwizzledStorer<ChunkSize, ChunkCount, LineGroup, CachePolicy>;
+
+        // Sanity checks
+        static_assert(!is_same<DataLayoutT, void>::value,
+                      "Must provide data layout. Swizzled stores require the data layout "
+                      "to be statically assigned in the fragment declaration.");
+
+        static_assert(ChunkSize % Config::IOLayout::VW == 0,
+                      "Swizzle chunks must contain whole IO vectors");
+
+        static_assert(
+            is_same<typename FragT::Traits::AccessT, typename Storer::Traits::InputT>::value,
+            "Fragment access and coop store input types do not match");
+
+        // Implicit unpack and store
+        // Note: the frag is only be partially filled with useful data.
+        // Layout and thread locality is not guaranteed.
+        Storer::exec(data, frag.mAccess, ldm, waveIndex, waveCount);
+    }
+
+    template <uint32_t WaveCount,
+              typename CachePolicy,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT,
+              uint32_t ChunkSize,
+              uint32_t ChunkCount,
+              uint32_t LineGroup>
+    ROCWMMA_DEVICE void store_matrix_coop_sync(
+        DataT*                                                               data,
+        fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag,
+        uint32_t                                                             ldm,
+        uint32_t                                                             waveIndex,
+        xor_swizzle<ChunkSize, ChunkCount, LineGroup>)
+    {
+        using FragT  = decay_t<decltype(frag)>;
+        using Config = GetCoopIOConfig_t<FragT, WaveCount>;
+        using Storer = typename Config::
+            template SwizzledStorer<ChunkSize, ChunkCount, LineGroup, CachePolicy>;
+
+        // Sanity checks
+        static_assert(!is_same<DataLayoutT, void>::value,
+                      "Must provide data layout. Swizzled stores require the data layout "
+                      "to be statically assigned in the fragment declaration.");
+
+        static_assert(ChunkSize % Config::IOLayout::VW == 0,
+                      "Swizzle chunks must contain whole IO vectors");
+
+        static_assert(
+            is_same<typename FragT::Traits::AccessT, typename Storer::Traits::InputT>::value,
+            "Fragment access and coop store input types do not match");
+
+        // Implicit unpack and store
+        // Note: the frag is only be partially filled with useful data.
+        // Layout and thread locality is not guaranteed.
+        Storer::template exec<WaveCount>(data, frag.mAccess, ldm, waveIndex);
+    }
+
 } // namespace rocwmma
 
 #endif // ROCWMMA_COOP_API_IMPL_HPP
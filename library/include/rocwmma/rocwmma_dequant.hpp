@@ -0,0 +1,114 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_DEQUANT_API_HPP
+#define ROCWMMA_DEQUANT_API_HPP
+
+#include "rocwmma.hpp"
+
+//! rocWMMA dequant API complements the rocWMMA API with loads of packed low precision inputs.
+//!
+//! \n
+//! **load_matrix_sync_dequant**
+//!
+//! Weight-only quantized inference stores weights as packed 4-bit integers, which would otherwise
+//! be expanded to a wider type by a separate pass through memory before the GEMM. The dequant load
+//! reads the packed nibbles directly in the register layout of a matrix_a or matrix_b fragment of
+//! a wider type, such as float16_t, bfloat16_t or int8_t, and expands them in registers.
+//!
+//! Packed data uses int4x2_t (signed) or uint4x2_t (unsigned), which hold two elements per byte.
+//! The packed matrix has the same data layout as the fragment data type, where each pair of
+//! consecutive elements in memory shares a byte with the first element in the low nibble. Leading
+//! dimensions and offsets are counted in elements, and must be even.
+//!
+//! Values may be dequantized as (q - zero) * scale, with a scale and a zero-point for every group
+//! of GroupSize consecutive elements in K. Scales and zero-points are stored as matrices of the
+//! fragment data type, which have the same data layout as the packed matrix reduced by GroupSize
+//! in K. For matrix_b, that is (K / GroupSize) x N.
+
+namespace rocwmma
+{
+    //! Loads packed 4-bit data into the fragment according to its data layout, expanding it to the fragment datatype.
+    //! Data pointer may point to either local or global memory.
+    //! @param frag matrix_a or matrix_b fragment with its associated block sizes, data type and layout
+    //! @param data Data pointer to the packed byte that holds the first element of the block
+    //! @param ldm Leading dimension size in elements, which must be even
+    //! @tparam CachePolicy Cache policy of the packed loads as cache_default or cache_streaming
+    //! @tparam MatrixT Fragment context
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DataT Fragment datatype
+    //! @tparam DataLayoutT In-memory layout as col_major or row_major
+    //! @tparam PackedT Packed datatype as int4x2_t or uint4x2_t
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT,
+              typename PackedT>
+    ROCWMMA_DEVICE void load_matrix_sync_dequant(
+        fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag,
+        PackedT const*                                                 data,
+        uint32_t                                                       ldm);
+
+    //! Loads packed 4-bit data into the fragment according to its data layout, dequantizing each element q
+    //! as (q - zero) * scale with the scale and zero-point of its group in K. Data pointers may point to either
+    //! local or global memory.
+    //! @param frag matrix_a or matrix_b fragment with its associated block sizes, floating point data type and layout
+    //! @param data Data pointer to the packed byte that holds the first element of the block
+    //! @param ldm Leading dimension size in elements, which must be even
+    //! @param scales Data pointer to the scale of the first group of the block
+    //! @param zeros Data pointer to the zero-point of the first group of the block, or nullptr for symmetric quantization
+    //! @param lds Leading dimension size of the scale and zero-point matrices
+    //! @tparam GroupSize Number of consecutive elements in K that share a scale, which either divides BlockK or is a multiple of it
+    //! @tparam CachePolicy Cache policy of the packed loads as cache_default or cache_streaming
+    //! @tparam MatrixT Fragment context
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DataT Fragment datatype
+    //! @tparam DataLayoutT In-memory layout as col_major or row_major
+    //! @tparam PackedT Packed datatype as int4x2_t or uint4x2_t
+    template <uint32_t GroupSize,
+              typename CachePolicy = cache_default,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT,
+              typename PackedT>
+    ROCWMMA_DEVICE void load_matrix_sync_dequant(
+        fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag,
+        PackedT const*                                                 data,
+        uint32_t                                                       ldm,
+        DataT const*                                                   scales,
+        DataT const*                                                   zeros,
+        uint32_t                                                       lds);
+
+} // namespace rocwmma
+
+#include "rocwmma_dequant_impl.hpp"
+
+#endif // ROCWMMA_DEQUANT_API_HPP
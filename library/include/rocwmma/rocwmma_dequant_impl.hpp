@@ -0,0 +1,140 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_DEQUANT_API_IMPL_HPP
+#define ROCWMMA_DEQUANT_API_IMPL_HPP
+
+#include "internal/dequant_load.hpp"
+#include "internal/io_config.hpp"
+
+#include "rocwmma_dequant.hpp"
+
+namespace rocwmma
+{
+    namespace detail
+    {
+        template <typename FragT, typename PackedT, typename CachePolicy>
+        struct GetDequantLoader;
+
+        template <typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT,
+                  typename DataLayoutT,
+                  typename PackedT,
+                  typename CachePolicy>
+        struct GetDequantLoader<fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>,
+                                PackedT,
+                                CachePolicy>
+        {
+            static_assert(is_same<MatrixT, matrix_a>::value || is_same<MatrixT, matrix_b>::value,
+                          "Packed data may only be loaded to matrix_a or matrix_b fragments");
+
+            static_assert(!is_same<DataLayoutT, void>::value,
+                          "Must provide data layout in the fragment declaration");
+
+            using FragT    = fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>;
+            using IOConfig = GetIOConfig_t<FragT>;
+            using IOShape  = typename IOConfig::IOShape;
+            using IOLayout = typename IOConfig::IOLayout;
+
+            // K is the column of matrix_a (M x K) and the row of matrix_b (K x N)
+            using type = DequantLoad<IOShape::BlockDim,
+                                     IOShape::KDim,
+                                     PackedT,
+                                     DataT,
+                                     typename IOLayout::DataLayout,
+                                     typename IOLayout::MatrixLayout,
+                                     IOLayout::VW,
+                                     is_same<MatrixT, matrix_a>::value ? 1u : 0u,
+                                     CachePolicy>;
+        };
+
+        template <typename FragT, typename PackedT, typename CachePolicy>
+        using GetDequantLoader_t = typename GetDequantLoader<FragT, PackedT, CachePolicy>::type;
+
+    } // namespace detail
+
+    template <typename CachePolicy,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT,
+              typename PackedT>
+    ROCWMMA_DEVICE void load_matrix_sync_dequant(
+        fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag,
+        PackedT const*                                                 data,
+        uint32_t                                                       ldm)
+    {
+        using FragT  = decay_t<decltype(frag)>;
+        using Loader = detail::GetDequantLoader_t<FragT, PackedT, CachePolicy>;
+
+        // Sanity check
+        static_assert(
+            is_same<typename FragT::Traits::AccessT, typename Loader::Traits::OutputT>::value,
+            "Fragment access and dequant load output types do not match");
+
+        // Load and expand, then implicit pack
+        Loader::exec(frag.mAccess, data, ldm);
+    }
+
+    template <uint32_t GroupSize,
+              typename CachePolicy,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT,
+              typename PackedT>
+    ROCWMMA_DEVICE void load_matrix_sync_dequant(
+        fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag,
+        PackedT const*                                                 data,
+        uint32_t                                                       ldm,
+        DataT const*                                                   scales,
+        DataT const*                                                   zeros,
+        uint32_t                                                       lds)
+    {
+        using FragT  = decay_t<decltype(frag)>;
+        using Loader = detail::GetDequantLoader_t<FragT, PackedT, CachePolicy>;
+
+        // Sanity checks
+        static_assert(!is_integral<DataT>::value,
+                      "Scaled dequantization requires a floating point fragment type");
+
+        static_assert(
+            is_same<typename FragT::Traits::AccessT, typename Loader::Traits::OutputT>::value,
+            "Fragment access and dequant load output types do not match");
+
+        // Load and dequantize, then implicit pack
+        Loader::template exec<GroupSize>(frag.mAccess, data, ldm, scales, zeros, lds);
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DEQUANT_API_IMPL_HPP
@@ -0,0 +1,272 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_EPILOGUE_API_HPP
+#define ROCWMMA_EPILOGUE_API_HPP
+
+#include "rocwmma.hpp"
+
+//! rocWMMA epilogue API complements the rocWMMA API with fused accumulator stores.
+//!
+//! \n
+//! **store_matrix_sync_epilogue**
+//!
+//! GEMM epilogues typically compute D = f(alpha * acc + beta * C + bias) with separate passes
+//! over the accumulator registers to load C, to scale and accumulate, to activate and to convert
+//! to the output type before the store of D. The epilogue store fuses all of these into a single
+//! sweep over the accumulator registers, in which each vector of C is read right before the
+//! matching vector of D is written.
+//!
+//! The epilogue is a user functor that is invoked for every element of the accumulator as:
+//! epilogue(acc, c, row, col), where acc is the accumulator value, c is the value of the source
+//! matrix C at the same position and (row, col) is the element coordinate relative to the block.
+//! The result is converted to the output type and stored to D.
+//!
+//! The epilogue must also provide the source matrix C as members:
+//! - OutputT const* c: pointer to the block of C, or nullptr if C is not to be read (c = 0)
+//! - uint32_t ldc: leading dimension of C, in the same data layout as D
+//!
+//! epilogue_linear implements the common D = activation(alpha * acc + beta * C + bias[col]).
+//!
+//! \n
+//! **FP8 GEMM epilogues**
+//!
+//! FP8 GEMMs consume per-tensor or per-channel input scales and produce the amax (largest absolute
+//! value) of the output, from which the next iteration derives its output scale.
+//! epilogue_fp8_quantize applies the input scales to the accumulator, quantizes the result to
+//! float8_t or bfloat8_t with saturation and optionally stochastic rounding, and tracks the amax of
+//! the unquantized result in each thread. reduce_amax_sync then combines the per-thread amax of
+//! the whole workgroup, which is folded into the global amax with a single atomic per workgroup.
+//! Neither the scaling nor the amax requires an extra pass over the output tensor.
+//!
+//! \n
+//! **store_matrix_atomic_add_sync**
+//!
+//! Split-K GEMMs partition the K dimension between several workgroups, each of which produces a
+//! partial sum of the same block of D. The atomic add store accumulates the partial sums into D
+//! (D += acc) without a separate reduction pass. 32b and 64b data types use native atomics. 16b
+//! data types accumulate pairs of neighbouring elements at once: f16 in global memory uses the
+//! native packed f16x2 atomic add on gfx90a and gfx94x, and everything else uses a compare and swap
+//! of the packed pair. The order of accumulation is not deterministic.
+
+namespace rocwmma
+{
+    //! @struct epilogue_identity
+    //! @brief Epilogue activation that passes values through unchanged.
+    struct epilogue_identity
+    {
+        template <typename DataT>
+        ROCWMMA_DEVICE constexpr inline DataT operator()(DataT x) const;
+    };
+
+    //! @struct epilogue_relu
+    //! @brief Epilogue activation that computes max(x, 0).
+    struct epilogue_relu
+    {
+        template <typename DataT>
+        ROCWMMA_DEVICE constexpr inline DataT operator()(DataT x) const;
+    };
+
+    //! @struct epilogue_gelu
+    //! @brief Epilogue activation that computes the tanh approximation of GELU in single precision.
+    struct epilogue_gelu
+    {
+        template <typename DataT>
+        ROCWMMA_DEVICE inline DataT operator()(DataT x) const;
+    };
+
+    //! @struct epilogue_linear
+    //! @brief Epilogue functor that computes D = activation(alpha * acc + beta * C + bias[col]) in the compute type.
+    //! @tparam OutputT Data type of matrices C and D
+    //! @tparam ComputeT Data type of the accumulator
+    //! @tparam ActivationT Activation functor applied last
+    //! @var alpha Scale of the accumulator
+    //! @var beta Scale of the source matrix C
+    //! @var c Pointer to the block of C, or nullptr if C is not read
+    //! @var ldc Leading dimension of C
+    //! @var bias Pointer to the bias of the first column of the block, or nullptr if there is no bias
+    //! @var activation Activation functor
+    template <typename OutputT, typename ComputeT, typename ActivationT = epilogue_identity>
+    struct epilogue_linear
+    {
+        ComputeT        alpha      = static_cast<ComputeT>(1);
+        ComputeT        beta       = static_cast<ComputeT>(0);
+        OutputT const*  c          = nullptr;
+        uint32_t        ldc        = 0u;
+        ComputeT const* bias       = nullptr;
+        ActivationT     activation = {};
+
+        ROCWMMA_DEVICE inline ComputeT
+            operator()(ComputeT acc, OutputT source, uint32_t row, uint32_t col) const;
+    };
+
+    //! @struct epilogue_fp8_quantize
+    //! @brief Epilogue functor that computes y = activation(scale_a * scale_b * acc + bias[col]), tracks the amax of y and
+    //! quantizes D = saturate(scale_d * y) to fp8.
+    //! @tparam OutputT Data type of D, as float8_t or bfloat8_t
+    //! @tparam ComputeT Data type of the accumulator
+    //! @tparam ActivationT Activation functor applied before quantization
+    //! @tparam StochasticRounding Quantize with stochastic rounding instead of round to nearest even
+    //! @var scale_a Per-tensor scale of A
+    //! @var scale_b Per-tensor scale of B
+    //! @var scale_a_rows Pointer to the per-channel scales of A for the first row of the block, or nullptr
+    //! @var scale_b_cols Pointer to the per-channel scales of B for the first column of the block, or nullptr
+    //! @var bias Pointer to the bias of the first column of the block, or nullptr if there is no bias
+    //! @var scale_d Quantization scale of D
+    //! @var seed Random seed of stochastic rounding, which should be unique to each block of D
+    //! @var activation Activation functor
+    //! @var amax Largest absolute value of y seen by the calling thread
+    //! @note Values beyond the range of OutputT, including infinities, saturate to its largest finite value.
+    //! The source matrix C is not read.
+    template <typename OutputT,
+              typename ComputeT    = float32_t,
+              typename ActivationT = epilogue_identity,
+              bool StochasticRounding = false>
+    struct epilogue_fp8_quantize
+    {
+        static_assert(is_same<OutputT, float8_t>::value || is_same<OutputT, bfloat8_t>::value,
+                      "Output must be float8_t or bfloat8_t");
+
+        static constexpr OutputT const* c   = nullptr;
+        static constexpr uint32_t       ldc = 0u;
+
+        ComputeT         scale_a      = static_cast<ComputeT>(1);
+        ComputeT         scale_b      = static_cast<ComputeT>(1);
+        ComputeT const*  scale_a_rows = nullptr;
+        ComputeT const*  scale_b_cols = nullptr;
+        ComputeT const*  bias         = nullptr;
+        ComputeT         scale_d      = static_cast<ComputeT>(1);
+        uint32_t         seed         = 0u;
+        ActivationT      activation   = {};
+        mutable ComputeT amax         = static_cast<ComputeT>(0);
+
+        ROCWMMA_DEVICE inline OutputT
+            operator()(ComputeT acc, OutputT source, uint32_t row, uint32_t col) const;
+    };
+
+    //! Reduces the amax of every thread in the workgroup, then folds the workgroup amax into the global amax with a single
+    //! atomic max. Must be called by all threads of the workgroup, as it synchronizes the workgroup.
+    //! @param amax Pointer to the global amax, which must be non-negative (e.g. zero-initialized) before the kernel launch
+    //! @param partial Amax of the calling thread, e.g. from epilogue_fp8_quantize::amax
+    //! @tparam ComputeT Datatype of the partial amax
+    //! @note The workgroup amax may also be written to LDS, with amax pointing to shared memory.
+    //! The first thread of the workgroup updates amax after the last barrier of the reduction, so the result is only
+    //! visible to the other threads of the workgroup after a subsequent synchronize_workgroup(). In global memory, amax
+    //! holds the amax of every workgroup only once the kernel has completed.
+    template <typename ComputeT>
+    ROCWMMA_DEVICE void reduce_amax_sync(float32_t* amax, ComputeT partial);
+
+    //! Stores the accumulator fragment to the data pointer through a fused epilogue, according to its data layout.
+    //! Each element of D is computed as epilogue(acc, c, row, col), converted to OutputT, in a single sweep over the
+    //! accumulator registers. Matrix C is read from epilogue.c if not null. Data pointer may point to either local or global memory.
+    //! @param data Data pointer to D in global/local memory
+    //! @param frag Accumulator fragment with its associated block sizes, data type and layout
+    //! @param ldm Leading dimension size of D
+    //! @param epilogue Epilogue functor
+    //! @tparam CachePolicy Cache policy of the D stores as cache_default or cache_streaming
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam ComputeT Accumulator datatype
+    //! @tparam DataLayoutT In-memory layout as col_major or row_major
+    //! @tparam OutputT Datatype of C and D
+    //! @tparam EpilogueT Epilogue functor type
+    template <typename CachePolicy = cache_default,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename ComputeT,
+              typename DataLayoutT,
+              typename OutputT,
+              typename EpilogueT>
+    ROCWMMA_DEVICE void store_matrix_sync_epilogue(
+        OutputT*                                                                     data,
+        fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, DataLayoutT> const& frag,
+        uint32_t                                                                     ldm,
+        EpilogueT const&                                                             epilogue);
+
+    //! Stores the accumulator fragment to the data pointer through a fused epilogue.
+    //! This overload provides a run-time ability to choose the data layout of D and C.
+    //! @param data Data pointer to D in global/local memory
+    //! @param frag Accumulator fragment with its associated block sizes and data type
+    //! @param ldm Leading dimension size of D
+    //! @param epilogue Epilogue functor
+    //! @param layout Data layout of D and C
+    //! @tparam CachePolicy Cache policy of the D stores as cache_default or cache_streaming
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam ComputeT Accumulator datatype
+    //! @tparam OutputT Datatype of C and D
+    //! @tparam EpilogueT Epilogue functor type
+    template <typename CachePolicy = cache_default,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename ComputeT,
+              typename OutputT,
+              typename EpilogueT>
+    ROCWMMA_DEVICE void store_matrix_sync_epilogue(
+        OutputT*                                                       data,
+        fragment<accumulator, BlockM, BlockN, BlockK, ComputeT> const& frag,
+        uint32_t                                                       ldm,
+        EpilogueT const&                                               epilogue,
+        layout_t                                                       layout);
+
+    //! Atomically accumulates the fragment into the data pointer, according to its data layout: D += frag.
+    //! Accumulation order between concurrent stores is not deterministic. Data pointer may point to either local or
+    //! global memory.
+    //! @param data Data pointer to D in global/local memory
+    //! @param frag Accumulator fragment with its associated block sizes, data type and layout
+    //! @param ldm Leading dimension size of D
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DataT Datatype of the fragment and of D, which must be 16b, 32b or 64b wide
+    //! @tparam DataLayoutT In-memory layout as col_major or row_major
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void store_matrix_atomic_add_sync(
+        DataT*                                                                    data,
+        fragment<accumulator, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag,
+        uint32_t                                                                  ldm);
+
+    //! Atomically accumulates the fragment into the data pointer: D += frag.
+    //! This overload provides a run-time ability to choose the data layout of D.
+    //! @param data Data pointer to D in global/local memory
+    //! @param frag Accumulator fragment with its associated block sizes and data type
+    //! @param ldm Leading dimension size of D
+    //! @param layout Data layout of D
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DataT Datatype of the fragment and of D, which must be 16b, 32b or 64b wide
+    template <uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename DataT>
+    ROCWMMA_DEVICE void store_matrix_atomic_add_sync(
+        DataT*                                                      data,
+        fragment<accumulator, BlockM, BlockN, BlockK, DataT> const& frag,
+        uint32_t                                                    ldm,
+        layout_t                                                    layout);
+
+} // namespace rocwmma
+
+#include "rocwmma_epilogue_impl.hpp"
+
+#endif // ROCWMMA_EPILOGUE_API_HPP
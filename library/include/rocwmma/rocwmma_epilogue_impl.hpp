@@ -0,0 +1,299 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_EPILOGUE_API_IMPL_HPP
+#define ROCWMMA_EPILOGUE_API_IMPL_HPP
+
+#include "internal/epilogue_store.hpp"
+#include "internal/io_config.hpp"
+#include "internal/mapping_util.hpp"
+#include "internal/opaque_store.hpp"
+#include "internal/reduce.hpp"
+
+#include "rocwmma_epilogue.hpp"
+
+namespace rocwmma
+{
+    template <typename DataT>
+    ROCWMMA_DEVICE constexpr inline DataT epilogue_identity::operator()(DataT x) const
+    {
+        return x;
+    }
+
+    template <typename DataT>
+    ROCWMMA_DEVICE constexpr inline DataT epilogue_relu::operator()(DataT x) const
+    {
+        return x > static_cast<DataT>(0) ? x : static_cast<DataT>(0);
+    }
+
+    template <typename DataT>
+    ROCWMMA_DEVICE inline DataT epilogue_gelu::operator()(DataT x) const
+    {
+        // 0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x^3)))
+        auto xf    = static_cast<float32_t>(x);
+        auto inner = 0.7978845608f * (xf + 0.044715f * xf * xf * xf);
+        return static_cast<DataT>(0.5f * xf * (1.0f + tanhf(inner)));
+    }
+
+    template <typename OutputT, typename ComputeT, typename ActivationT>
+    ROCWMMA_DEVICE inline ComputeT epilogue_linear<OutputT, ComputeT, ActivationT>::operator()(
+        ComputeT acc, OutputT source, uint32_t /*row*/, uint32_t col) const
+    {
+        auto result = alpha * acc + beta * static_cast<ComputeT>(source);
+        if(bias != nullptr)
+        {
+            result += bias[col];
+        }
+        return activation(result);
+    }
+
+    namespace detail
+    {
+        // Integer hash, such that neighbouring elements draw uncorrelated
+        // stochastic rounding bits from the same seed.
+        ROCWMMA_DEVICE constexpr inline uint32_t hashRng(uint32_t x)
+        {
+            x ^= x >> 16u;
+            x *= 0x7feb352du;
+            x ^= x >> 15u;
+            x *= 0x846ca68bu;
+            x ^= x >> 16u;
+            return x;
+        }
+
+        struct AmaxOp
+        {
+            ROCWMMA_DEVICE constexpr inline float32_t operator()(float32_t lhs,
+                                                                  float32_t rhs) const
+            {
+                return lhs > rhs ? lhs : rhs;
+            }
+        };
+
+    } // namespace detail
+
+    template <typename OutputT, typename ComputeT, typename ActivationT, bool StochasticRounding>
+    ROCWMMA_DEVICE inline OutputT
+        epilogue_fp8_quantize<OutputT, ComputeT, ActivationT, StochasticRounding>::operator()(
+            ComputeT acc, OutputT /*source*/, uint32_t row, uint32_t col) const
+    {
+        auto scale = scale_a * scale_b;
+        if(scale_a_rows != nullptr)
+        {
+            scale *= scale_a_rows[row];
+        }
+        if(scale_b_cols != nullptr)
+        {
+            scale *= scale_b_cols[col];
+        }
+
+        auto result = scale * acc;
+        if(bias != nullptr)
+        {
+            result += bias[col];
+        }
+        result = activation(result);
+
+        // Amax of the unquantized result
+        auto absResult = result < static_cast<ComputeT>(0) ? -result : result;
+        amax           = absResult > amax ? absResult : amax;
+
+        // Saturate to the finite range of the output, NaN propagates
+        auto const maxVal = static_cast<float32_t>(numeric_limits<OutputT>::max());
+        auto       scaled = static_cast<float32_t>(result * scale_d);
+        scaled = scaled > maxVal ? maxVal : (scaled < -maxVal ? -maxVal : scaled);
+
+        if constexpr(StochasticRounding)
+        {
+            auto rng = detail::hashRng(seed ^ detail::hashRng((row << 16u) ^ col));
+            return OutputT(scaled, OutputT::rocwmma_hip_f8_rounding_mode::stochastic, rng);
+        }
+        else
+        {
+            return OutputT(scaled);
+        }
+    }
+
+    template <typename ComputeT>
+    ROCWMMA_DEVICE void reduce_amax_sync(float32_t* amax, ComputeT partial)
+    {
+        // Non-negative floats are ordered the same as their bits as unsigned
+        // integers, which allows for integer atomic max.
+        __shared__ uint32_t workgroupAmax;
+
+        auto threadId = threadIdx.x + blockDim.x * (threadIdx.y + blockDim.y * threadIdx.z);
+        if(threadId == 0u)
+        {
+            workgroupAmax = 0u;
+        }
+
+        // Wave amax is available in every lane
+        auto waveAmax = detail::laneButterfly<detail::AmaxOp, 1u, Constants::AMDGCN_WAVE_SIZE>(
+            VecT<float32_t, 1u>{static_cast<float32_t>(partial)});
+
+        synchronize_workgroup();
+
+        if(detail::laneId() == 0u)
+        {
+            atomicMax(&workgroupAmax, __float_as_uint(waveAmax.data[0]));
+        }
+
+        synchronize_workgroup();
+
+        if(threadId == 0u)
+        {
+            atomicMax(reinterpret_cast<uint32_t*>(amax), workgroupAmax);
+        }
+    }
+
+    template <typename CachePolicy,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename ComputeT,
+              typename DataLayoutT,
+              typename OutputT,
+              typename EpilogueT>
+    ROCWMMA_DEVICE void store_matrix_sync_epilogue(
+        OutputT*                                                                     data,
+        fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, DataLayoutT> const& frag,
+        uint32_t                                                                     ldm,
+        EpilogueT const&                                                             epilogue)
+    {
+        using FragT    = decay_t<decltype(frag)>;
+        using IOConfig = GetIOConfig_t<FragT>;
+        using IOShape  = typename IOConfig::IOShape;
+        using IOLayout = typename IOConfig::IOLayout;
+        using Storer   = EpilogueStore<IOShape::BlockDim,
+                                     IOShape::KDim,
+                                     ComputeT,
+                                     OutputT,
+                                     typename IOLayout::DataLayout,
+                                     typename IOLayout::MatrixLayout,
+                                     IOLayout::VW,
+                                     CachePolicy>;
+
+        // Sanity check
+        static_assert(!is_same<DataLayoutT, void>::value,
+                      "Must provide data layout. Either statically assign data layout in "
+                      "fragment declaration or use the run-time function overload.");
+
+        static_assert(
+            is_same<typename FragT::Traits::AccessT, typename Storer::Traits::InputT>::value,
+            "Fragment access and epilogue store input types do not match");
+
+        // Implicit unpack, then fused read of C, epilogue, convert and store of D
+        Storer::exec(data, frag.mAccess, ldm, epilogue.c, epilogue.ldc, epilogue);
+    }
+
+    template <typename CachePolicy,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename ComputeT,
+              typename OutputT,
+              typename EpilogueT>
+    ROCWMMA_DEVICE void store_matrix_sync_epilogue(
+        OutputT*                                                       data,
+        fragment<accumulator, BlockM, BlockN, BlockK, ComputeT> const& frag,
+        uint32_t                                                       ldm,
+        EpilogueT const&                                               epilogue,
+        layout_t                                                       layout)
+    {
+        using FragRowMajor = fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, row_major>;
+        using FragColMajor = fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, col_major>;
+
+        // Dispatch on layout type
+        if(layout == layout_t::mem_row_major)
+        {
+            store_matrix_sync_epilogue<CachePolicy>(
+                data, reinterpret_cast<FragRowMajor const&>(frag), ldm, epilogue);
+        }
+        else
+        {
+            store_matrix_sync_epilogue<CachePolicy>(
+                data, reinterpret_cast<FragColMajor const&>(frag), ldm, epilogue);
+        }
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void store_matrix_atomic_add_sync(
+        DataT*                                                                    data,
+        fragment<accumulator, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag,
+        uint32_t                                                                  ldm)
+    {
+        using FragT    = decay_t<decltype(frag)>;
+        using IOConfig = GetIOConfig_t<FragT>;
+        using IOShape  = typename IOConfig::IOShape;
+        using IOLayout = typename IOConfig::IOLayout;
+        using Storer   = OpaqueStore<IOShape::BlockDim,
+                                   IOShape::KDim,
+                                   DataT,
+                                   typename IOLayout::DataLayout,
+                                   typename IOLayout::MatrixLayout,
+                                   IOLayout::VW,
+                                   detail::amdgcn_atomic_add_store<DataT, IOLayout::VW>>;
+
+        // Sanity check
+        static_assert(!is_same<DataLayoutT, void>::value,
+                      "Must provide data layout. Either statically assign data layout in "
+                      "fragment declaration or use the run-time function overload.");
+
+        static_assert(
+            is_same<typename FragT::Traits::AccessT, typename Storer::Traits::InputT>::value,
+            "Fragment access and atomic store input types do not match");
+
+        // Implicit unpack and accumulate
+        Storer::exec(data, frag.mAccess, ldm);
+    }
+
+    template <uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename DataT>
+    ROCWMMA_DEVICE void store_matrix_atomic_add_sync(
+        DataT*                                                      data,
+        fragment<accumulator, BlockM, BlockN, BlockK, DataT> const& frag,
+        uint32_t                                                    ldm,
+        layout_t                                                    layout)
+    {
+        using FragRowMajor = fragment<accumulator, BlockM, BlockN, BlockK, DataT, row_major>;
+        using FragColMajor = fragment<accumulator, BlockM, BlockN, BlockK, DataT, col_major>;
+
+        // Dispatch on layout type
+        if(layout == layout_t::mem_row_major)
+        {
+            store_matrix_atomic_add_sync(data, reinterpret_cast<FragRowMajor const&>(frag), ldm);
+        }
+        else
+        {
+            store_matrix_atomic_add_sync(data, reinterpret_cast<FragColMajor const&>(frag), ldm);
+        }
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_EPILOGUE_API_IMPL_HPP
@@ -31,10 +31,13 @@
 #include "internal/accessors.hpp"
 #include "internal/blend.hpp"
 #include "internal/broadcast.hpp"
+#include "internal/buffer_load.hpp"
+#include "internal/buffer_store.hpp"
 #include "internal/constants.hpp"
 #include "internal/convert.hpp"
 #include "internal/dpp.hpp"
 #include "internal/flow_control.hpp"
+#include "internal/io_bounds.hpp"
 #include "internal/io_config.hpp"
 #include "internal/io_layout.hpp"
 #include "internal/io_shape.hpp"
@@ -195,6 +198,42 @@ namespace rocwmma
         return num_elements;
     }
 
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE inline Coord2d
+        fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>::elementCoord(uint32_t index)
+    {
+        return elementCoord(threadIdx.x, index);
+    }
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_HOST_DEVICE constexpr inline Coord2d
+        fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>::elementCoord(
+            uint32_t threadId, uint32_t index)
+    {
+        static_assert(!is_same<DataLayoutT, void>::value,
+                      "Must provide data layout to map fragment elements to matrix coordinates");
+
+        using IOLayout     = typename GetIOConfig_t<fragment>::IOLayout;
+        using MatrixLayout = typename IOLayout::MatrixLayout;
+        using Bounds       = detail::IOBounds<DataLayoutT, IOLayout::VW>;
+
+        // Elements are held in vectors of VW, in the same order as they are
+        // loaded and stored. Vector elements advance in the data layout's minor dimension.
+        return Bounds::elementCoord(MatrixLayout::baseOffset(threadId)
+                                        + MatrixLayout::cumulativeOffset(index / IOLayout::VW),
+                                    index % IOLayout::VW);
+    }
+
     template <typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
@@ -216,7 +255,8 @@ namespace rocwmma
         Broadcaster::exec(frag.mAccess, value);
     }
 
-    template <typename MatrixT,
+    template <typename CachePolicy,
+              typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -228,7 +268,7 @@ namespace rocwmma
                          uint32_t                                                       ldm)
     {
         using FragT  = decay_t<decltype(frag)>;
-        using Loader = typename GetIOConfig_t<FragT>::Loader;
+        using Loader = typename GetIOConfig_t<FragT>::template PolicyLoader<CachePolicy>;
 
         // Sanity checks
         static_assert(!is_same<DataLayoutT, void>::value,
@@ -243,7 +283,12 @@ namespace rocwmma
         Loader::exec(frag.mAccess, data, ldm);
     }
 
-    template <typename MatrixT, uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename DataT>
+    template <typename CachePolicy,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT>
     ROCWMMA_DEVICE void load_matrix_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT>& frag,
                                          const DataT*                                      data,
                                          uint32_t                                          ldm,
@@ -255,15 +300,85 @@ namespace rocwmma
         // Dispatch on layout type
         if(layout == layout_t::mem_row_major)
         {
-            load_matrix_sync(reinterpret_cast<FragRowMajor&>(frag), data, ldm);
+            load_matrix_sync<CachePolicy>(reinterpret_cast<FragRowMajor&>(frag), data, ldm);
         }
         else
         {
-            load_matrix_sync(reinterpret_cast<FragColMajor&>(frag), data, ldm);
+            load_matrix_sync<CachePolicy>(reinterpret_cast<FragColMajor&>(frag), data, ldm);
         }
     }
 
-    template <typename MatrixT,
+    template <typename CachePolicy,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void
+        load_matrix_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag,
+                         const DataT*                                                   data,
+                         uint32_t                                                       ldm,
+                         uint32_t                                                       rows,
+                         uint32_t                                                       cols)
+    {
+        using FragT   = decay_t<decltype(frag)>;
+        using IOShape = GetIOShape_t<FragT>;
+        using Loader  = typename GetIOConfig_t<FragT>::template PolicyLoader<CachePolicy>;
+
+        // Sanity checks
+        static_assert(!is_same<DataLayoutT, void>::value,
+                      "Must provide layout information. Either statically assign data layout in "
+                      "fragment declaration or use the run-time function overload.");
+
+        static_assert(
+            is_same<typename FragT::Traits::AccessT, typename Loader::Traits::OutputT>::value,
+            "Fragment access and load output types do not match");
+
+        auto extent = make_coord2d(rows, cols);
+
+        // Interior blocks don't need predication
+        if(detail::isBlockInBounds<IOShape::BlockHeight, IOShape::BlockWidth>(extent))
+        {
+            Loader::exec(frag.mAccess, data, ldm);
+        }
+        else
+        {
+            Loader::exec(frag.mAccess, data, ldm, extent);
+        }
+    }
+
+    template <typename CachePolicy,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT>
+    ROCWMMA_DEVICE void load_matrix_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT>& frag,
+                                         const DataT*                                      data,
+                                         uint32_t                                          ldm,
+                                         uint32_t                                          rows,
+                                         uint32_t                                          cols,
+                                         layout_t                                          layout)
+    {
+        using FragRowMajor = fragment<MatrixT, BlockM, BlockN, BlockK, DataT, row_major>;
+        using FragColMajor = fragment<MatrixT, BlockM, BlockN, BlockK, DataT, col_major>;
+
+        // Dispatch on layout type
+        if(layout == layout_t::mem_row_major)
+        {
+            load_matrix_sync<CachePolicy>(
+                reinterpret_cast<FragRowMajor&>(frag), data, ldm, rows, cols);
+        }
+        else
+        {
+            load_matrix_sync<CachePolicy>(
+                reinterpret_cast<FragColMajor&>(frag), data, ldm, rows, cols);
+        }
+    }
+
+    template <typename CachePolicy,
+              typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -275,7 +390,7 @@ namespace rocwmma
                           uint32_t                                                             ldm)
     {
         using FragT  = decay_t<decltype(frag)>;
-        using Storer = typename GetIOConfig_t<FragT>::Storer;
+        using Storer = typename GetIOConfig_t<FragT>::template PolicyStorer<CachePolicy>;
 
         // Sanity check
         static_assert(!is_same<DataLayoutT, void>::value,
@@ -290,7 +405,12 @@ namespace rocwmma
         Storer::exec(data, frag.mAccess, ldm);
     }
 
-    template <typename MatrixT, uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename DataT>
+    template <typename CachePolicy,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT>
     ROCWMMA_DEVICE void
         store_matrix_sync(DataT*                                                  data,
                           fragment<MatrixT, BlockM, BlockN, BlockK, DataT> const& frag,
@@ -303,18 +423,246 @@ namespace rocwmma
         // Dispatch on layout type
         if(layout == layout_t::mem_row_major)
         {
-            store_matrix_sync(data, reinterpret_cast<FragRowMajor const&>(frag), ldm);
+            store_matrix_sync<CachePolicy>(data, reinterpret_cast<FragRowMajor const&>(frag), ldm);
         }
         else
         {
-            store_matrix_sync(data, reinterpret_cast<FragColMajor const&>(frag), ldm);
+            store_matrix_sync<CachePolicy>(data, reinterpret_cast<FragColMajor const&>(frag), ldm);
         }
     }
 
+    template <typename CachePolicy,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void
+        store_matrix_sync(DataT*                                                               data,
+                          fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag,
+                          uint32_t                                                             ldm,
+                          uint32_t                                                             rows,
+                          uint32_t                                                             cols)
+    {
+        using FragT   = decay_t<decltype(frag)>;
+        using IOShape = GetIOShape_t<FragT>;
+        using Storer  = typename GetIOConfig_t<FragT>::template PolicyStorer<CachePolicy>;
+
+        // Sanity check
+        static_assert(!is_same<DataLayoutT, void>::value,
+                      "Must provide data layout. Either statically assign data layout in "
+                      "fragment declaration or use the run-time function overload.");
+
+        static_assert(
+            is_same<typename FragT::Traits::AccessT, typename Storer::Traits::InputT>::value,
+            "Fragment access and store input types do not match");
+
+        auto extent = make_coord2d(rows, cols);
+
+        // Interior blocks don't need predication
+        if(detail::isBlockInBounds<IOShape::BlockHeight, IOShape::BlockWidth>(extent))
+        {
+            Storer::exec(data, frag.mAccess, ldm);
+        }
+        else
+        {
+            Storer::exec(data, frag.mAccess, ldm, extent);
+        }
+    }
+
+    template <typename CachePolicy,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT>
+    ROCWMMA_DEVICE void
+        store_matrix_sync(DataT*                                                  data,
+                          fragment<MatrixT, BlockM, BlockN, BlockK, DataT> const& frag,
+                          uint32_t                                                ldm,
+                          uint32_t                                                rows,
+                          uint32_t                                                cols,
+                          layout_t                                                layout)
+    {
+        using FragRowMajor = fragment<MatrixT, BlockM, BlockN, BlockK, DataT, row_major>;
+        using FragColMajor = fragment<MatrixT, BlockM, BlockN, BlockK, DataT, col_major>;
+
+        // Dispatch on layout type
+        if(layout == layout_t::mem_row_major)
+        {
+            store_matrix_sync<CachePolicy>(
+                data, reinterpret_cast<FragRowMajor const&>(frag), ldm, rows, cols);
+        }
+        else
+        {
+            store_matrix_sync<CachePolicy>(
+                data, reinterpret_cast<FragColMajor const&>(frag), ldm, rows, cols);
+        }
+    }
+
+    template <typename CachePolicy,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT,
+              uint32_t ChunkSize,
+              uint32_t ChunkCount,
+              uint32_t LineGroup>
+    ROCWMMA_DEVICE void
+        load_matrix_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag,
+                         const DataT*                                                   data,
+                         uint32_t                                                       ldm,
+                         xor_swizzle<ChunkSize, ChunkCount, LineGroup>)
+    {
+        using FragT  = decay_t<decltype(frag)>;
+        using Config = GetIOConfig_t<FragT>;
+        using Loader = typename Config::
+            template SwizzledLoader<ChunkSize, ChunkCount, LineGroup, CachePolicy>;
+
+        // Sanity checks
+        static_assert(!is_same<DataLayoutT, void>::value,
+                      "Must provide layout information. Swizzled loads require the data layout "
+                      "to be statically assigned in the fragment declaration.");
+
+        static_assert(ChunkSize % Config::IOLayout::VW == 0,
+                      "Swizzle chunks must contain whole IO vectors");
+
+        static_assert(
+            is_same<typename FragT::Traits::AccessT, typename Loader::Traits::OutputT>::value,
+            "Fragment access and load output types do not match");
+
+        // Load then implicit pack
+        Loader::exec(frag.mAccess, data, ldm);
+    }
+
+    template <typename CachePolicy,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT,
+              uint32_t ChunkSize,
+              uint32_t ChunkCount,
+              uint32_t LineGroup>
+    ROCWMMA_DEVICE void
+        store_matrix_sync(DataT*                                                               data,
+                          fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag,
+                          uint32_t                                                             ldm,
+                          xor_swizzle<ChunkSize, ChunkCount, LineGroup>)
+    {
+        using FragT  = decay_t<decltype(frag)>;
+        using Config = GetIOConfig_t<FragT>;
+        using Storer = typename Config::
+            template SwizzledStorer<ChunkSize, ChunkCount, LineGroup, CachePolicy>;
+
+        // Sanity checks
+        static_assert(!is_same<DataLayoutT, void>::value,
+                      "Must provide data layout. Swizzled stores require the data layout "
+                      "to be statically assigned in the fragment declaration.");
+
+        static_assert(ChunkSize % Config::IOLayout::VW == 0,
+                      "Swizzle chunks must contain whole IO vectors");
+
+        static_assert(
+            is_same<typename FragT::Traits::AccessT, typename Storer::Traits::InputT>::value,
+            "Fragment access and store input types do not match");
+
+        // Implicit unpack and then store
+        Storer::exec(data, frag.mAccess, ldm);
+    }
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void
+        load_matrix_async(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag,
+                          const DataT*                                                   data,
+                          uint32_t                                                       ldm)
+    {
+        // Issue the loads, then pin them in program order so that the
+        // scheduler does not sink them down towards their first use.
+        load_matrix_sync(frag, data, ldm);
+        SchedBarrier<0>::exec();
+    }
+
+    template <typename MatrixT, uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename DataT>
+    ROCWMMA_DEVICE void load_matrix_async(fragment<MatrixT, BlockM, BlockN, BlockK, DataT>& frag,
+                                          const DataT*                                      data,
+                                          uint32_t                                          ldm,
+                                          layout_t                                          layout)
+    {
+        using FragRowMajor = fragment<MatrixT, BlockM, BlockN, BlockK, DataT, row_major>;
+        using FragColMajor = fragment<MatrixT, BlockM, BlockN, BlockK, DataT, col_major>;
+
+        // Dispatch on layout type
+        if(layout == layout_t::mem_row_major)
+        {
+            load_matrix_async(reinterpret_cast<FragRowMajor&>(frag), data, ldm);
+        }
+        else
+        {
+            load_matrix_async(reinterpret_cast<FragColMajor&>(frag), data, ldm);
+        }
+    }
+
+    template <typename MemoryT, typename FragT>
+    ROCWMMA_DEVICE constexpr loaded_fragment<MemoryT, FragT> loaded_from(FragT const& frag)
+    {
+        static_assert(is_same<MemoryT, global_memory>::value || is_same<MemoryT, lds_memory>::value,
+                      "Memory must be global_memory or lds_memory");
+        return loaded_fragment<MemoryT, FragT>{frag};
+    }
+
+    template <typename FragT, typename... PendingTs>
+    ROCWMMA_DEVICE void wait_fragment(FragT const& frag, PendingTs const&... pending)
+    {
+        using WaitIO = GetPendingIO<FragT>;
+        static_assert(WaitIO::IOCount > 0u, "Fragment does not issue any loads");
+
+        // Global loads are tracked by vmcnt and LDS loads by lgkmcnt. Each
+        // completes in order, so frag is complete once no more than the loads
+        // of the pending fragments of the same memory are outstanding.
+        // Counts beyond the range of either counter are clamped, which only
+        // errs on the side of waiting longer. The other counter is not waited on.
+        constexpr uint32_t PendingGlobal = (0u + ... + GetPendingIO<PendingTs>::GlobalCount);
+        constexpr uint32_t PendingLds    = (0u + ... + GetPendingIO<PendingTs>::LdsCount);
+
+        constexpr int32_t VmCnt
+            = (bool)WaitIO::IsGlobal ? (PendingGlobal < 63u ? PendingGlobal : 63u) : 63;
+        constexpr int32_t LgkmCnt
+            = (bool)WaitIO::IsLds ? (PendingLds < 15u ? PendingLds : 15u) : 15;
+
+        Waitcnt<VmCnt, LgkmCnt>::exec();
+    }
+
+    template <uint32_t PendingLoads>
+    ROCWMMA_DEVICE void wait_global_loads()
+    {
+        // vmcnt is clamped to its range, lgkmcnt is left at its maximum
+        constexpr int32_t VmCnt = PendingLoads < 63u ? PendingLoads : 63u;
+        Waitcnt<VmCnt, 15>::exec();
+    }
+
+    template <uint32_t PendingLoads>
+    ROCWMMA_DEVICE void wait_lds_loads()
+    {
+        // lgkmcnt is clamped to its range, vmcnt is left at its maximum
+        constexpr int32_t LgkmCnt = PendingLoads < 15u ? PendingLoads : 15u;
+        Waitcnt<63, LgkmCnt>::exec();
+    }
+
     template <uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
-              typename InputT,
+              typename InputTA,
+              typename InputTB,
               typename ComputeT,
               typename LayoutA,
               typename LayoutB,
@@ -322,10 +670,16 @@ namespace rocwmma
               typename LayoutD>
     ROCWMMA_DEVICE void
         mma_sync(fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutD>&       d,
-                 fragment<matrix_a, BlockM, BlockN, BlockK, InputT, LayoutA> const&      a,
-                 fragment<matrix_b, BlockM, BlockN, BlockK, InputT, LayoutB> const&      b,
+                 fragment<matrix_a, BlockM, BlockN, BlockK, InputTA, LayoutA> const&     a,
+                 fragment<matrix_b, BlockM, BlockN, BlockK, InputTB, LayoutB> const&     b,
                  fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutC> const& c)
     {
+        // Only the fp8 / bf8 formats may be mixed
+        constexpr bool IsF8A = is_same_v<InputTA, float8_t> || is_same_v<InputTA, bfloat8_t>;
+        constexpr bool IsF8B = is_same_v<InputTB, float8_t> || is_same_v<InputTB, bfloat8_t>;
+        static_assert(is_same_v<InputTA, InputTB> || (IsF8A && IsF8B),
+                      "Input fragment datatypes must match, or be mixed float8_t / bfloat8_t");
+
         using FragA = decay_t<decltype(a)>;
         using FragB = decay_t<decltype(b)>;
 
@@ -356,8 +710,8 @@ namespace rocwmma
 
         // Gfx9 uses MFMA, gfx11 uses WMMA
         using MMA = conditional_t<ROCWMMA_ARCH_GFX9,
-                                  Mfma<InputT, ComputeT, BlockM, BlockN, BlockK>,
-                                  Wmma<InputT, ComputeT, BlockM, BlockN, BlockK>>;
+                                  Mfma<InputTA, ComputeT, BlockM, BlockN, BlockK, InputTB>,
+                                  Wmma<InputTA, ComputeT, BlockM, BlockN, BlockK>>;
 
         // mma functions operate on packed vectors
         (*d) = MMA::exec(*a, *b, *c);
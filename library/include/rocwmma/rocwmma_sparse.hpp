@@ -0,0 +1,172 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_SPARSE_API_HPP
+#define ROCWMMA_SPARSE_API_HPP
+
+#include "rocwmma.hpp"
+
+#include "internal/sparse_layout.hpp"
+
+//! rocWMMA sparse API complements the rocWMMA API with 2:4 structured sparse matrix_a support.
+//!
+//! \n
+//! **sparse_fragment**
+//!
+//! In 2:4 structured sparse (pruned) matrices, at most 2 of every group of 4 consecutive elements
+//! in K are non-zero. Sparse mfma instructions skip the zeros, doubling the effective throughput
+//! of the multiplication over the dense equivalent. The sparse matrix_a is stored compressed as:
+//! - values: the kept elements of BlockM x BlockK / 2, in row_major order
+//! - metadata: the 2b position of each kept element within its group, with the first element in
+//!   the low bits. Each row is stored as 32b words of 32 consecutive K elements (8 groups).
+//!
+//! For a sparse M x K matrix, values is therefore M x K / 2 (ldv >= K / 2) and metadata is
+//! M x ceil(K / 32) words (ldi >= ceil(K / 32)), both row_major.
+//!
+//! \n
+//! **mma_sync**
+//!
+//! Multiplies a sparse_fragment with a dense matrix_b fragment of the same logical BlockK.
+//! Sparse mfma is supported on gfx940, gfx941 and gfx942 for BlockM = BlockN of 16 or 32 and the
+//! following types: f16, bf16 and f8 / bf8 with f32 accumulation, and i8 with i32 accumulation.
+
+namespace rocwmma
+{
+    //! @class sparse_fragment
+    //! @brief 2:4 structured sparse matrix_a fragment, which holds the compressed values and index
+    //! metadata of a logical BlockM x BlockK block in registers.
+    //!
+    //! @tparam BlockM/N/K logical block dimensions
+    //! @tparam DataT datatype
+    //!
+    //! @note Fragments are stored in packed registers, however vector elements have no guaranteed order or locality.
+    template <uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename DataT>
+    class __align__(4) sparse_fragment
+    {
+    public:
+        //! Mapping of compressed values and metadata to threads
+        using Layout = detail::SparseLayout<BlockM, BlockN, BlockK, DataT>;
+
+        struct Traits
+        {
+        private:
+            //! The packed type for element data
+            using PackedElementT = typename PackTraits<DataT>::PackedT;
+
+            //! The unpacked type for element data
+            using UnpackedElementT = typename PackTraits<DataT>::UnpackedT;
+
+        public:
+            //! Unpacked compressed values access view
+            using AccessT = VecT<UnpackedElementT, Layout::Size>;
+
+            //! Packed compressed values storage view
+            using StorageT = VecT<PackedElementT, Layout::Size / PackTraits<DataT>::PackRatio>;
+
+            //! Index metadata, one register per vector of K
+            using MetadataT = VecT<uint32_t, Layout::VectorCount>;
+
+            constexpr static uint32_t Size = Layout::Size;
+
+            static_assert(Layout::Size % PackTraits<DataT>::PackRatio == 0,
+                          "Unable to pack fragment elements");
+        };
+
+        ROCWMMA_DEVICE sparse_fragment() = default;
+
+        //! @param index Compressed element index
+        //! @returns Mutable unpacked compressed element accessor at given index
+        ROCWMMA_DEVICE inline DataT& operator[](uint32_t index);
+        //! @param index Compressed element index
+        //! @returns Immutable unpacked compressed element accessor at given index
+        ROCWMMA_DEVICE inline DataT const& operator[](uint32_t index) const;
+        //! @returns Mutable packed storage vector accessor
+        ROCWMMA_DEVICE inline typename Traits::StorageT& operator*();
+        //! @returns Immutable packed storage vector accessor
+        ROCWMMA_DEVICE inline typename Traits::StorageT const& operator*() const;
+
+        //! Internal data storage views
+        union
+        {
+            typename Traits::StorageT mStorage; // Packed
+            typename Traits::AccessT  mAccess; // Unpacked
+            static_assert(sizeof(typename Traits::AccessT) == sizeof(typename Traits::StorageT),
+                          "Storage type and access type should be views into the same raw data");
+        };
+
+        //! Index metadata
+        typename Traits::MetadataT mMetadata;
+
+        constexpr static uint32_t num_elements = Traits::Size;
+        using element_type                     = DataT;
+    };
+
+    //! Loads the compressed values and index metadata of a 2:4 structured sparse matrix_a block.
+    //! @param frag Sparse fragment with its associated logical block sizes and data type
+    //! @param values Pointer to the compressed values of the block in row_major order
+    //! @param ldv Leading dimension of the compressed values
+    //! @param metadata Pointer to the metadata words of the block, in row_major order
+    //! @param ldi Leading dimension of the metadata, in 32b words
+    //! @tparam BlockM/N/K Logical block dimensions
+    //! @tparam DataT Datatype
+    //! @note The block origin of K must be a multiple of 32, so that it is aligned with the metadata words.
+    template <uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename DataT>
+    ROCWMMA_DEVICE void load_matrix_sync(sparse_fragment<BlockM, BlockN, BlockK, DataT>& frag,
+                                         const DataT*                                    values,
+                                         uint32_t                                        ldv,
+                                         const uint32_t*                                 metadata,
+                                         uint32_t                                        ldi);
+
+    //! Performs the sparse multiply-accumulate operation D = A x B + C, where A is 2:4 structured sparse.
+    //! @param d Accumulator output D
+    //! @param a Sparse input A
+    //! @param b Dense input B of the same logical BlockK
+    //! @param c Accumulator input C
+    //! @tparam BlockM/N/K Logical block dimensions
+    //! @tparam InputT Datatype of input frags A and B
+    //! @tparam ComputeT Datatype of accumulator fragment C / D
+    //! @tparam LayoutB In-memory layout of frag B as row_major or col_major
+    //! @tparam LayoutC In-memory layout of frag C as row_major or col_major
+    //! @tparam LayoutD In-memory layout of frag D as row_major or col_major
+    //! @note Frag c = d is valid
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename ComputeT,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    ROCWMMA_DEVICE void
+        mma_sync(fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutD>&       d,
+                 sparse_fragment<BlockM, BlockN, BlockK, InputT> const&                  a,
+                 fragment<matrix_b, BlockM, BlockN, BlockK, InputT, LayoutB> const&      b,
+                 fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutC> const& c);
+
+} // namespace rocwmma
+
+#include "rocwmma_sparse_impl.hpp"
+
+#endif // ROCWMMA_SPARSE_API_HPP
@@ -0,0 +1,139 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_SPARSE_API_IMPL_HPP
+#define ROCWMMA_SPARSE_API_IMPL_HPP
+
+#include "internal/io_config.hpp"
+#include "internal/mapping_util.hpp"
+#include "internal/opaque_load.hpp"
+#include "internal/smfmac.hpp"
+#include "internal/sparse_layout.hpp"
+#include "internal/vector_iterator.hpp"
+
+#include "rocwmma_sparse.hpp"
+
+namespace rocwmma
+{
+    template <uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename DataT>
+    ROCWMMA_DEVICE inline DataT&
+        sparse_fragment<BlockM, BlockN, BlockK, DataT>::operator[](uint32_t index)
+    {
+        return mAccess.data[index];
+    }
+
+    template <uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename DataT>
+    ROCWMMA_DEVICE inline DataT const&
+        sparse_fragment<BlockM, BlockN, BlockK, DataT>::operator[](uint32_t index) const
+    {
+        return mAccess.data[index];
+    }
+
+    template <uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename DataT>
+    ROCWMMA_DEVICE inline auto sparse_fragment<BlockM, BlockN, BlockK, DataT>::operator*() ->
+        typename Traits::StorageT&
+    {
+        return mStorage;
+    }
+
+    template <uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename DataT>
+    ROCWMMA_DEVICE inline auto sparse_fragment<BlockM, BlockN, BlockK, DataT>::operator*() const
+        -> typename Traits::StorageT const&
+    {
+        return mStorage;
+    }
+
+    template <uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename DataT>
+    ROCWMMA_DEVICE void load_matrix_sync(sparse_fragment<BlockM, BlockN, BlockK, DataT>& frag,
+                                         const DataT*                                    values,
+                                         uint32_t                                        ldv,
+                                         const uint32_t*                                 metadata,
+                                         uint32_t                                        ldi)
+    {
+        using FragT  = decay_t<decltype(frag)>;
+        using Layout = typename FragT::Layout;
+        using Loader = detail::amdgcn_opaque_load<DataT, Layout::ValueVW>;
+
+        auto laneId = detail::WaveSpace<>::localLaneId();
+        auto it     = makeVectorIterator<Layout::ValueVW>(frag.mAccess).begin();
+
+        static_assert(decltype(it)::range() == Layout::VectorCount,
+                      "VectorCount inconsistent with iterator range");
+
+        // Each vector of K reads its compressed values, and the bits of
+        // its metadata word that belong to it.
+#pragma unroll
+        for(uint32_t i = 0; i < Layout::VectorCount; i++)
+        {
+            auto valueCoord = Layout::valueCoord(laneId, i * Layout::ValueVW);
+            Loader::exec(*it, values, get<0>(valueCoord) * ldv + get<1>(valueCoord));
+            it++;
+
+            auto metadataCoord = Layout::metadataCoord(laneId, i);
+            frag.mMetadata.data[i] = Layout::vectorMetadata(
+                laneId, i, metadata[get<0>(metadataCoord) * ldi + get<1>(metadataCoord)]);
+        }
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename ComputeT,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    ROCWMMA_DEVICE void
+        mma_sync(fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutD>&       d,
+                 sparse_fragment<BlockM, BlockN, BlockK, InputT> const&                  a,
+                 fragment<matrix_b, BlockM, BlockN, BlockK, InputT, LayoutB> const&      b,
+                 fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutC> const& c)
+    {
+        using FragB   = decay_t<decltype(b)>;
+        using LayoutA = typename decay_t<decltype(a)>::Layout;
+
+        using IOConfigB = GetIOConfig_t<FragB>;
+
+        // Sanity checks
+        static_assert((BlockM == BlockN) && (BlockM == 16u || BlockM == 32u),
+                      "Sparse mma requires BlockM = BlockN of 16 or 32");
+
+        static_assert(LayoutA::IOShape::KDim == IOConfigB::IOShape::KDim,
+                      "KDim of input fragments must match");
+
+        // Each lane must pair its vectors of K in A and B
+        static_assert(is_orthogonal_v<typename LayoutA::MatrixLayout,
+                                      typename IOConfigB::IOLayout::MatrixLayout>,
+                      "Input fragment matrix layouts are not orthogonal");
+
+        using SMMA = Smfmac<InputT, ComputeT, BlockM, BlockN, BlockK>;
+
+        // smfmac functions operate on packed vectors
+        (*d) = SMMA::exec(*a, *b, *c, a.mMetadata);
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_SPARSE_API_IMPL_HPP
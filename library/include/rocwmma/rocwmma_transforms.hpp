@@ -48,6 +48,19 @@ namespace rocwmma
     template <typename FragT>
     using ApplyRegisterFile_t = typename detail::template ApplyRegisterFile<FragT>::Type;
 
+    //! Static fragment type transform that converts an accumulator fragment into an input fragment
+    //! of the next multiplication, spanning the same block of the matrix.
+    //! E.g. accumulator BlockM x BlockN becomes matrix_a BlockM x BlockK, where BlockK = BlockN,
+    //! or matrix_b BlockK x BlockN, where BlockK = BlockM.
+    //! @note To be paired with usage of applyAccumConversion() below
+    template <typename FragT,
+              typename MatrixT,
+              uint32_t BlockNext,
+              typename OutputT,
+              typename DataLayoutT>
+    using ApplyAccumConversion_t = typename detail::
+        template ApplyAccumConversion<FragT, MatrixT, BlockNext, OutputT, DataLayoutT>::Type;
+
     //! Applies the transpose transform the input fragment. Transpose is defined as orthogonal matrix and data layout.
     //! E.g. T(fragment<matrix_a, BlockM, BlockN, BlockK, DataT, row_major>) = fragment<matrix_b, BlockN, BlockM, BlockK, DataT, col_major>
     //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
@@ -65,6 +78,95 @@ namespace rocwmma
     template <typename DataLayoutT, uint32_t WaveCount = 1, typename FragT>
     ROCWMMA_DEVICE static inline decltype(auto) applyDataLayout(FragT&& frag);
 
+    //! Converts the accumulator fragment in registers into a matrix_a or matrix_b fragment, in which
+    //! every element keeps its matrix coordinate. Values are converted to OutputT, and are exchanged
+    //! across lanes where the accumulator and output layouts differ.
+    //! E.g. back-to-back gemm, where D1 = A1 x B1 is consumed as the matrix_a of D2 = D1 x B2
+    //! without a round trip through memory.
+    //! @param frag Accumulator fragment with its associated block sizes, data type and layout
+    //! @tparam MatrixT Output fragment context as matrix_a or matrix_b
+    //! @tparam BlockNext Free block dimension of the next multiplication: BlockN for matrix_a, or BlockM for matrix_b
+    //! @tparam OutputT Output fragment datatype, which may be narrower than the accumulator
+    //! @tparam DataLayoutT Output fragment in-memory layout as col_major or row_major
+    //! @tparam FragT The incoming accumulator fragment type
+    //! @returns Fragment of type ApplyAccumConversion_t<FragT, MatrixT, BlockNext, OutputT, DataLayoutT>
+    //! @note Conversion to matrix_b usually maps registers in place, whereas conversion to matrix_a
+    //! transposes the lane distribution using ds_bpermute.
+    template <typename MatrixT,
+              uint32_t BlockNext,
+              typename OutputT,
+              typename DataLayoutT,
+              typename FragT>
+    ROCWMMA_DEVICE static inline auto applyAccumConversion(FragT const& frag);
+
+    //! @struct reduce_sum
+    //! @brief Reduction operator that sums elements
+    struct reduce_sum
+    {
+        template <typename DataT>
+        ROCWMMA_DEVICE constexpr inline DataT operator()(DataT lhs, DataT rhs) const
+        {
+            return lhs + rhs;
+        }
+    };
+
+    //! @struct reduce_max
+    //! @brief Reduction operator that selects the largest element
+    struct reduce_max
+    {
+        template <typename DataT>
+        ROCWMMA_DEVICE constexpr inline DataT operator()(DataT lhs, DataT rhs) const
+        {
+            return lhs > rhs ? lhs : rhs;
+        }
+    };
+
+    //! @struct reduce_min
+    //! @brief Reduction operator that selects the smallest element
+    struct reduce_min
+    {
+        template <typename DataT>
+        ROCWMMA_DEVICE constexpr inline DataT operator()(DataT lhs, DataT rhs) const
+        {
+            return lhs < rhs ? lhs : rhs;
+        }
+    };
+
+    //! Reduces each row of the accumulator fragment across all of its columns, in registers and across lanes.
+    //! E.g. the row max and row sum of a softmax, without a round trip through LDS.
+    //! @param frag Accumulator fragment with its associated block sizes, data type and layout
+    //! @tparam ReduceOp Reduction operator as reduce_sum, reduce_max or reduce_min
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DataT Datatype
+    //! @tparam DataLayoutT In-memory layout as col_major, row_major or void
+    //! @returns Fragment of the same type, in which every element holds the reduction of its row
+    //! @note Data types smaller than 32b are reduced in 32b precision
+    template <typename ReduceOp,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE static inline auto
+        reduce_rows(fragment<accumulator, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag);
+
+    //! Reduces each column of the accumulator fragment across all of its rows, in registers and across lanes.
+    //! @param frag Accumulator fragment with its associated block sizes, data type and layout
+    //! @tparam ReduceOp Reduction operator as reduce_sum, reduce_max or reduce_min
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DataT Datatype
+    //! @tparam DataLayoutT In-memory layout as col_major, row_major or void
+    //! @returns Fragment of the same type, in which every element holds the reduction of its column
+    //! @note Data types smaller than 32b are reduced in 32b precision
+    template <typename ReduceOp,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE static inline auto
+        reduce_cols(fragment<accumulator, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag);
+
 } // namespace rocwmma
 
 #endif // ROCWMMA_TRANSFORMS_API_HPP
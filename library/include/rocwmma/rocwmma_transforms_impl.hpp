@@ -26,6 +26,8 @@
 #ifndef ROCWMMA_TRANSFORMS_API_IMPL_HPP
 #define ROCWMMA_TRANSFORMS_API_IMPL_HPP
 
+#include "internal/accum_convert.hpp"
+#include "internal/reduce.hpp"
 #include "internal/transforms.hpp"
 #include "rocwmma_transforms.hpp"
 
@@ -287,6 +289,66 @@ namespace rocwmma
             using Type = fragment<matrix_b, 1, registerFileWidth, FragT::size(), DataT, DataLayout>;
         };
 
+        // Below are defined accumulator conversions:
+        // - Accumulator data is re-arranged in the register layout of an input
+        //   fragment spanning the same block, to be consumed by the next mma_sync.
+        // - The accumulator BlockM x BlockN becomes matrix_a BlockM x BlockK with
+        //   BlockK = BlockN, or matrix_b BlockK x BlockN with BlockK = BlockM.
+        // Assumptions:
+        // - The output fragment holds exactly the same set of matrix coordinates.
+        // - Element data types are converted with static_cast.
+        // Example:
+        // - Accumulator RowNT layouts distribute columns across lanes, as do matrix_b.
+        //   Conversion to matrix_b is therefore only a type conversion, whereas conversion
+        //   to matrix_a (ColNT, rows across lanes) must move data across lanes.
+        template <typename FragT,
+                  typename MatrixT,
+                  uint32_t BlockNext,
+                  typename OutputT,
+                  typename DataLayoutT>
+        struct ApplyAccumConversion;
+
+        template <uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT,
+                  typename DataLayoutAcc,
+                  typename MatrixT,
+                  uint32_t BlockNext,
+                  typename OutputT,
+                  typename DataLayoutT>
+        struct ApplyAccumConversion<
+            fragment<accumulator, BlockM, BlockN, BlockK, DataT, DataLayoutAcc>,
+            MatrixT,
+            BlockNext,
+            OutputT,
+            DataLayoutT>
+        {
+        private:
+            using FragAcc = fragment<accumulator, BlockM, BlockN, BlockK, DataT, DataLayoutAcc>;
+
+            static_assert(is_same_v<MatrixT, matrix_a> || is_same_v<MatrixT, matrix_b>,
+                          "Accumulators may only be converted to matrix_a or matrix_b");
+            static_assert(!is_same_v<DataLayoutT, void>,
+                          "Must provide the data layout of the converted fragment");
+
+        public:
+            // Interface
+            using Type = conditional_t<
+                is_same_v<MatrixT, matrix_a>,
+                fragment<matrix_a, BlockM, BlockNext, BlockN, OutputT, DataLayoutT>,
+                fragment<matrix_b, BlockNext, BlockN, BlockM, OutputT, DataLayoutT>>;
+
+            ROCWMMA_DEVICE static inline Type exec(FragAcc const& frag)
+            {
+                using Convert = AccumConvert<BlockM, BlockN, DataT, Type>;
+
+                auto result    = Type{};
+                result.mAccess = Convert::exec(frag.mAccess);
+                return result;
+            }
+        };
+
     } // namespace detail
 
     /// These wrappers must perfect-forward and perfect-return because the return types and
@@ -304,6 +366,52 @@ namespace rocwmma
         return detail::template ApplyDataLayout<decay_t<FragT>, DataLayoutT>::template exec<
             WaveCount>(forward<FragT>(frag));
     }
+
+    template <typename MatrixT,
+              uint32_t BlockNext,
+              typename OutputT,
+              typename DataLayoutT,
+              typename FragT>
+    ROCWMMA_DEVICE static inline auto applyAccumConversion(FragT const& frag)
+    {
+        return detail::template ApplyAccumConversion<FragT,
+                                                     MatrixT,
+                                                     BlockNext,
+                                                     OutputT,
+                                                     DataLayoutT>::exec(frag);
+    }
+
+    template <typename ReduceOp,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE static inline auto
+        reduce_rows(fragment<accumulator, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag)
+    {
+        using Reduce = detail::AccumReduce<BlockM, BlockN, DataT>;
+
+        auto result    = decay_t<decltype(frag)>{};
+        result.mAccess = Reduce::template rows<ReduceOp>(frag.mAccess);
+        return result;
+    }
+
+    template <typename ReduceOp,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE static inline auto
+        reduce_cols(fragment<accumulator, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag)
+    {
+        using Reduce = detail::AccumReduce<BlockM, BlockN, DataT>;
+
+        auto result    = decay_t<decltype(frag)>{};
+        result.mAccess = Reduce::template cols<ReduceOp>(frag.mAccess);
+        return result;
+    }
     // @endcond
 
 } // namespace rocwmma
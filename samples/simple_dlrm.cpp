@@ -183,22 +183,20 @@ constexpr static const int T_BLOCK_X = 128;
 // context of wave-level BMM computation, and is not optimized.
 __global__ void dlrmDotFwd(const float16_t* __restrict input,
                            float16_t* __restrict output,
-                           float* acc,
-                           uint   m,
-                           uint   k,
-                           uint   b,
-                           uint   inputBatchOffset,
-                           uint   outputBatchOffset,
-                           uint   accBatchOffset)
+                           uint m,
+                           uint k,
+                           uint b,
+                           uint inputBatchOffset,
+                           uint outputBatchOffset)
 {
-    using MappingA   = rocwmma::MappingUtil<TILE_DIM, TILE_DIM, float16_t, row_major>;
-    using MappingB   = rocwmma::MappingUtil<TILE_DIM, TILE_DIM, float16_t, col_major>;
-    using MappingC   = rocwmma::MappingUtil<TILE_DIM, TILE_DIM, float16_t, row_major>;
-    using MappingAcc = rocwmma::MappingUtil<TILE_DIM, TILE_DIM, float, row_major>;
+    using MappingA = rocwmma::MappingUtil<TILE_DIM, TILE_DIM, float16_t, row_major>;
+    using MappingB = rocwmma::MappingUtil<TILE_DIM, TILE_DIM, float16_t, col_major>;
+    using MappingC = rocwmma::MappingUtil<TILE_DIM, TILE_DIM, float16_t, row_major>;
 
-    using FragA   = rocwmma::fragment<matrix_a, TILE_DIM, TILE_DIM, TILE_DIM, float16_t, row_major>;
-    using FragB   = rocwmma::fragment<matrix_b, TILE_DIM, TILE_DIM, TILE_DIM, float16_t, col_major>;
-    using FragAcc = rocwmma::fragment<accumulator, TILE_DIM, TILE_DIM, TILE_DIM, float>;
+    using FragA = rocwmma::fragment<matrix_a, TILE_DIM, TILE_DIM, TILE_DIM, float16_t, row_major>;
+    using FragB = rocwmma::fragment<matrix_b, TILE_DIM, TILE_DIM, TILE_DIM, float16_t, col_major>;
+    using FragAcc
+        = rocwmma::fragment<accumulator, TILE_DIM, TILE_DIM, TILE_DIM, float, row_major>;
 
     // Copy bottom MLP to output
     // Threads with a global index < k are responsible for copying MLP data
@@ -256,28 +254,18 @@ __global__ void dlrmDotFwd(const float16_t* __restrict input,
         }
         rocwmma::synchronize_workgroup();
 
-        // Store fragAcc to global acc
-        auto* accWithOffset = acc + accBatchOffset * blockIdx.z;
-        auto* addrAcc       = MappingAcc::dataCoord(accWithOffset, matrixCoordC, m);
-        rocwmma::store_matrix_sync(addrAcc, fragAcc, m, rocwmma::mem_row_major);
-
-        // Copy lower triangular from acc to output
-        auto fragColIdx   = threadIdx.x % TILE_DIM;
-        auto globalColIdx = get<1>(matrixCoordC) + fragColIdx;
-        auto rowsPerStep  = rocwmma::Constants::AMDGCN_WAVE_SIZE / TILE_DIM;
-
-        count = (TILE_DIM * TILE_DIM) >> Log2<rocwmma::Constants::AMDGCN_WAVE_SIZE>::value;
-        for(int i = 0; i < count; i++)
+        // Copy lower triangular to output directly from the accumulator
+        // registers, using the matrix coordinate of each fragment element.
+        for(uint i = 0; i < FragAcc::num_elements; i++)
         {
-            auto fragRowIdx
-                = i * rowsPerStep
-                  + ((threadIdx.x & (rocwmma::Constants::AMDGCN_WAVE_SIZE - 1)) / TILE_DIM);
-            auto globalRowIdx = get<0>(matrixCoordC) + fragRowIdx;
+            auto elementCoord = matrixCoordC + FragAcc::elementCoord(i);
+            auto globalRowIdx = get<0>(elementCoord);
+            auto globalColIdx = get<1>(elementCoord);
             if(globalRowIdx > globalColIdx)
             {
                 auto outputOffset = k + ((globalRowIdx * (globalRowIdx - 1)) >> 1);
                 output[outputBatchOffset * blockIdx.z + outputOffset + globalColIdx]
-                    = float16_t(acc[accBatchOffset * blockIdx.z + globalRowIdx * m + globalColIdx]);
+                    = float16_t(fragAcc.x[i]);
             }
         }
     }
@@ -465,11 +453,9 @@ __host__ void dlrm_test(uint32_t m, uint32_t k, uint32_t b, DlrmDirection_t pass
 
     // Allocate and copy device memory
     float16_t *d_input, *d_output, *d_upstreamGrad, *d_grad, *d_bottomMlpGrad, *d_accBwd;
-    float*     d_accFwd;
 
     const size_t inputBytes         = h_input.size() * sizeof(float16_t);
     const size_t outputBytes        = h_output.size() * sizeof(float16_t);
-    const size_t accFwdBytes        = m * m * b * sizeof(float32_t);
     const size_t accBwdBytes        = m * m * b * sizeof(float16_t);
     const size_t upstreamGradBytes  = h_upstreamGrad.size() * sizeof(float16_t);
     const size_t gradBytes          = h_grad.size() * sizeof(float16_t);
@@ -480,7 +466,6 @@ __host__ void dlrm_test(uint32_t m, uint32_t k, uint32_t b, DlrmDirection_t pass
     if(passDirection == DlrmDirection_t::Forward)
     {
         CHECK_HIP_ERROR(hipMalloc(&d_output, outputBytes));
-        CHECK_HIP_ERROR(hipMalloc(&d_accFwd, accFwdBytes));
 
         CHECK_HIP_ERROR(hipMemcpy(d_input, h_input.data(), inputBytes, hipMemcpyHostToDevice));
     }
@@ -500,7 +485,7 @@ __host__ void dlrm_test(uint32_t m, uint32_t k, uint32_t b, DlrmDirection_t pass
 
     if(passDirection == DlrmDirection_t::Forward)
     {
-        dlrmKernel = [d_input, d_output, d_accFwd, m, k, b]() {
+        dlrmKernel = [d_input, d_output, m, k, b]() {
             auto gridDim  = dim3(rocwmma::ceilDiv(m, TILE_DIM * T_BLOCK_X / WAVE_SIZE),
                                 rocwmma::ceilDiv(m, TILE_DIM),
                                 b);
@@ -508,7 +493,6 @@ __host__ void dlrm_test(uint32_t m, uint32_t k, uint32_t b, DlrmDirection_t pass
 
             uint inputBatchOffset  = m * k;
             uint outputBatchOffset = ((m * (m - 1)) / 2) + k;
-            uint accBatchOffset    = m * m;
 
             hipExtLaunchKernelGGL((dlrmDotFwd),
                                   gridDim,
@@ -520,13 +504,11 @@ __host__ void dlrm_test(uint32_t m, uint32_t k, uint32_t b, DlrmDirection_t pass
                                   0, // flags
                                   d_input,
                                   d_output,
-                                  d_accFwd,
                                   m,
                                   k,
                                   b,
                                   inputBatchOffset,
-                                  outputBatchOffset,
-                                  accBatchOffset);
+                                  outputBatchOffset);
         };
     }
     else
@@ -694,7 +676,6 @@ __host__ void dlrm_test(uint32_t m, uint32_t k, uint32_t b, DlrmDirection_t pass
     if(passDirection == DlrmDirection_t::Forward)
     {
         CHECK_HIP_ERROR(hipFree(d_output));
-        CHECK_HIP_ERROR(hipFree(d_accFwd));
     }
     else
     {
@@ -0,0 +1,114 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_TEST_COALESCING_ANALYZER_HPP
+#define ROCWMMA_TEST_COALESCING_ANALYZER_HPP
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "coop_split.hpp"
+
+namespace rocwmma
+{
+    // Host analysis of global memory coalescing of fragment IO. The matrix
+    // layout of an IOConfig is expanded for every lane, giving the byte offset
+    // of each lane's vector in every unrolled load / store instruction. The
+    // block is assumed to start on a cache line boundary.
+
+    // One global IO instruction of a wave
+    struct GlobalAccess
+    {
+        uint32_t              instruction;
+        uint32_t              ioBytes;
+        std::vector<uint64_t> laneOffsets;
+
+        uint64_t bytesRequested() const;
+
+        // Distinct cache lines of lineBytes spanned by the lane vectors
+        uint32_t linesTouched(uint32_t lineBytes) const;
+
+        // Fewest cache lines that could hold the requested bytes
+        uint32_t idealLines(uint32_t lineBytes) const;
+
+        // Lane vectors that span more than one cache line
+        uint32_t splitVectors(uint32_t lineBytes) const;
+    };
+
+    // Global IO instructions of one or more waves
+    class CoalescingReport
+    {
+    public:
+        CoalescingReport() = default;
+        explicit CoalescingReport(std::string label);
+
+        std::string const&               label() const;
+        std::vector<GlobalAccess> const& accesses() const;
+
+        void append(GlobalAccess access);
+        void append(CoalescingReport const& other);
+
+        uint64_t bytesRequested() const;
+        uint32_t linesTouched(uint32_t lineBytes) const;
+        uint32_t idealLines(uint32_t lineBytes) const;
+
+        // Requested bytes over the bytes of the cache lines touched
+        double efficiency(uint32_t lineBytes) const;
+
+        // Access counts of every byte in [0, bytes). Bytes addressed beyond
+        // that are counted in the last entry.
+        std::vector<uint32_t> byteCoverage(uint64_t bytes) const;
+
+        // One summary line, with lines touched for 64B and 128B cache lines,
+        // followed by a line per instruction if detailed
+        void print(std::ostream& stream, bool detailed = false) const;
+
+    private:
+        std::string               mLabel;
+        std::vector<GlobalAccess> mAccesses;
+    };
+
+    std::ostream& operator<<(std::ostream& stream, CoalescingReport const& report);
+
+    // Instructions of one wave in the IOConfig of fragment load / store of
+    // DataT, for the given leading dimension.
+    template <typename IOConfig, typename DataT>
+    CoalescingReport analyzeIOConfig(uint32_t ldm);
+
+    template <typename FragT>
+    CoalescingReport analyzeGlobalIO(uint32_t ldm);
+
+    // As above, for the given wave's share of cooperative IO. Waves beyond
+    // the maximum participating in the IO have no instructions.
+    template <typename FragT, uint32_t WaveCount = 1u>
+    CoalescingReport analyzeGlobalCoopIO(uint32_t ldm, uint32_t waveIndex, uint32_t waveCount);
+
+} // namespace rocwmma
+
+#include "coalescing_analyzer_impl.hpp"
+
+#endif // ROCWMMA_TEST_COALESCING_ANALYZER_HPP
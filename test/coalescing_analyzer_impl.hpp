@@ -0,0 +1,250 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_TEST_COALESCING_ANALYZER_IMPL_HPP
+#define ROCWMMA_TEST_COALESCING_ANALYZER_IMPL_HPP
+
+#include <algorithm>
+#include <iomanip>
+#include <map>
+#include <set>
+#include <utility>
+
+#include "coalescing_analyzer.hpp"
+
+namespace rocwmma
+{
+    inline uint64_t GlobalAccess::bytesRequested() const
+    {
+        return static_cast<uint64_t>(ioBytes) * laneOffsets.size();
+    }
+
+    inline uint32_t GlobalAccess::linesTouched(uint32_t lineBytes) const
+    {
+        std::set<uint64_t> lines;
+        for(auto offset : laneOffsets)
+        {
+            for(auto line = offset / lineBytes; line <= (offset + ioBytes - 1u) / lineBytes;
+                line++)
+            {
+                lines.insert(line);
+            }
+        }
+        return static_cast<uint32_t>(lines.size());
+    }
+
+    inline uint32_t GlobalAccess::idealLines(uint32_t lineBytes) const
+    {
+        return static_cast<uint32_t>((bytesRequested() + lineBytes - 1u) / lineBytes);
+    }
+
+    inline uint32_t GlobalAccess::splitVectors(uint32_t lineBytes) const
+    {
+        return static_cast<uint32_t>(
+            std::count_if(laneOffsets.begin(), laneOffsets.end(), [=](uint64_t offset) {
+                return offset / lineBytes != (offset + ioBytes - 1u) / lineBytes;
+            }));
+    }
+
+    inline CoalescingReport::CoalescingReport(std::string label)
+        : mLabel(std::move(label))
+    {
+    }
+
+    inline std::string const& CoalescingReport::label() const
+    {
+        return mLabel;
+    }
+
+    inline std::vector<GlobalAccess> const& CoalescingReport::accesses() const
+    {
+        return mAccesses;
+    }
+
+    inline void CoalescingReport::append(GlobalAccess access)
+    {
+        mAccesses.push_back(std::move(access));
+    }
+
+    inline void CoalescingReport::append(CoalescingReport const& other)
+    {
+        mAccesses.insert(mAccesses.end(), other.mAccesses.begin(), other.mAccesses.end());
+    }
+
+    inline uint64_t CoalescingReport::bytesRequested() const
+    {
+        uint64_t result = 0u;
+        for(auto const& access : mAccesses)
+        {
+            result += access.bytesRequested();
+        }
+        return result;
+    }
+
+    inline uint32_t CoalescingReport::linesTouched(uint32_t lineBytes) const
+    {
+        uint32_t result = 0u;
+        for(auto const& access : mAccesses)
+        {
+            result += access.linesTouched(lineBytes);
+        }
+        return result;
+    }
+
+    inline uint32_t CoalescingReport::idealLines(uint32_t lineBytes) const
+    {
+        uint32_t result = 0u;
+        for(auto const& access : mAccesses)
+        {
+            result += access.idealLines(lineBytes);
+        }
+        return result;
+    }
+
+    inline double CoalescingReport::efficiency(uint32_t lineBytes) const
+    {
+        auto lines = linesTouched(lineBytes);
+        return lines == 0u ? 1.0
+                           : static_cast<double>(bytesRequested())
+                                 / (static_cast<double>(lines) * lineBytes);
+    }
+
+    inline std::vector<uint32_t> CoalescingReport::byteCoverage(uint64_t bytes) const
+    {
+        std::vector<uint32_t> result(bytes + 1u, 0u);
+        for(auto const& access : mAccesses)
+        {
+            for(auto offset : access.laneOffsets)
+            {
+                for(uint64_t i = offset; i < offset + access.ioBytes; i++)
+                {
+                    result[std::min(i, bytes)]++;
+                }
+            }
+        }
+        return result;
+    }
+
+    inline void CoalescingReport::print(std::ostream& stream, bool detailed) const
+    {
+        stream << mLabel << ": " << mAccesses.size() << " instructions, " << bytesRequested()
+               << " bytes, " << linesTouched(64u) << " x 64B lines (ideal " << idealLines(64u)
+               << "), " << linesTouched(128u) << " x 128B lines (ideal " << idealLines(128u)
+               << "), efficiency " << std::fixed << std::setprecision(2) << efficiency(128u)
+               << std::defaultfloat << "\n";
+
+        if(detailed)
+        {
+            for(auto const& access : mAccesses)
+            {
+                stream << "    b" << access.ioBytes * 8u << " #" << access.instruction << ": "
+                       << access.bytesRequested() << " bytes, " << access.linesTouched(128u)
+                       << " x 128B lines (ideal " << access.idealLines(128u) << ")\n";
+            }
+        }
+    }
+
+    inline std::ostream& operator<<(std::ostream& stream, CoalescingReport const& report)
+    {
+        report.print(stream);
+        return stream;
+    }
+
+    template <typename IOConfig, typename DataT>
+    CoalescingReport analyzeIOConfig(uint32_t ldm)
+    {
+        using IOLayout     = typename IOConfig::IOLayout;
+        using MatrixLayout = typename IOLayout::MatrixLayout;
+        using DataLayoutT  = typename IOLayout::DataLayout;
+
+        constexpr uint32_t IOBytes = IOLayout::VW * sizeof(DataT);
+
+        constexpr auto strideCounts = MatrixLayout::strideCounts();
+        constexpr auto strides      = MatrixLayout::strides();
+
+        constexpr auto sum     = [](auto... items) { return (items + ...); };
+        constexpr auto product = [](auto... items) { return (items * ...); };
+
+        constexpr uint32_t IOCount = apply(product, strideCounts);
+        static_assert(IOCount == IOConfig::IOTraits::IOCount,
+                      "IOCount inconsistent with total strides");
+
+        CoalescingReport result;
+        for(uint32_t i = 0u; i < IOCount; i++)
+        {
+            // Instructions in the order of the unrolled IO, with the innermost stride fastest
+            auto strideCoord  = inflate_coord_left(i, strideCounts);
+            auto strideOffset = apply(sum, strideCoord * strides);
+
+            std::vector<uint64_t> laneOffsets;
+            for(uint32_t lane = 0u; lane < Constants::AMDGCN_WAVE_SIZE; lane++)
+            {
+                auto coord  = MatrixLayout::baseOffset(lane) + strideOffset;
+                auto offset = DataLayoutT::fromMatrixCoord(coord, ldm);
+                laneOffsets.push_back(static_cast<uint64_t>(offset) * sizeof(DataT));
+            }
+            result.append(GlobalAccess{i, IOBytes, std::move(laneOffsets)});
+        }
+        return result;
+    }
+
+    template <typename FragT>
+    CoalescingReport analyzeGlobalIO(uint32_t ldm)
+    {
+        return analyzeIOConfig<GetIOConfig_t<FragT>, GetDataType_t<FragT>>(ldm);
+    }
+
+    template <typename FragT, uint32_t WaveCount>
+    CoalescingReport analyzeGlobalCoopIO(uint32_t ldm, uint32_t waveIndex, uint32_t waveCount)
+    {
+        using IOLayout    = typename GetCoopIOConfig_t<FragT, WaveCount>::IOLayout;
+        using DataLayoutT = DataLayout::Array1d<GetDataLayout_t<FragT>>;
+        using DataT       = GetDataType_t<FragT>;
+
+        // Offsets of the first element of each IO vector, by instruction
+        std::map<uint32_t, std::vector<uint64_t>> vectors;
+        forEachCoopElement<FragT, WaveCount>(
+            waveIndex, waveCount, [&](uint32_t, uint32_t i, Coord2d const& coord) {
+                if(i % IOLayout::VW == 0u)
+                {
+                    vectors[i / IOLayout::VW].push_back(
+                        static_cast<uint64_t>(DataLayoutT::fromMatrixCoord(coord, ldm))
+                        * sizeof(DataT));
+                }
+            });
+
+        CoalescingReport result;
+        for(auto& vector : vectors)
+        {
+            result.append(GlobalAccess{
+                vector.first, IOLayout::VW * (uint32_t)sizeof(DataT), std::move(vector.second)});
+        }
+        return result;
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_TEST_COALESCING_ANALYZER_IMPL_HPP
@@ -31,6 +31,10 @@
 #warning("Building tests with hfloat16_t requires !HIP_NO_HALF && !__HIP_NO_HALF_CONVERSIONS__. Proceeding without hfloat16_t")
 #endif // !ROCWMMA_NO_HALF && __HIP_NO_HALF_CONVERSIONS__
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
 #include <iostream>
 #include <mutex>
 #include <tuple>
@@ -293,6 +297,61 @@ namespace rocwmma
             fillVal(mat.data(), m, n, value);
         }
 
+        // Counter-based random fill, keyed by seed and the (row, col) element index.
+        // Gives identical values to fillRandomLaunchKernel with the same seed and stream.
+        template <typename DataT>
+        __host__ static inline void
+            fillRandom(DataT* mat, uint32_t m, uint32_t n, uint64_t seed, uint32_t stream = 0u)
+        {
+            constexpr bool IsRowMajor = std::is_same<Layout, row_major>::value;
+
+            uint64_t ld = IsRowMajor ? n : m;
+
+#pragma omp parallel for
+            for(int64_t i = 0; i < m; ++i) // row
+            {
+#pragma omp simd
+                for(uint32_t j = 0; j < n; ++j) // col
+                {
+                    auto idx = IsRowMajor ? i * ld + j : j * ld + i;
+                    mat[idx] = randomFillValue<DataT>(seed, stream, i * n + j);
+                }
+            }
+        }
+
+        template <typename DataT>
+        __host__ static inline void fillRandom(
+            std::vector<DataT>& mat, uint32_t m, uint32_t n, uint64_t seed, uint32_t stream = 0u)
+        {
+            assert(mat.size() == n * m);
+            fillRandom(mat.data(), m, n, seed, stream);
+        }
+
+        // Batched M x K matrices, with element indices continuing across batches
+        template <typename DataT>
+        __host__ static inline void fillRandom(
+            DataT* mat, uint32_t m, uint32_t k, uint32_t b, uint64_t seed, uint32_t stream = 0u)
+        {
+            constexpr bool IsRowMajor = std::is_same<Layout, row_major>::value;
+
+            uint64_t ld = IsRowMajor ? k : m;
+
+#pragma omp parallel for collapse(2)
+            for(int64_t batch = 0; batch < b; ++batch)
+            {
+                for(int64_t i = 0; i < m; ++i) // row
+                {
+                    uint64_t batchOffset = batch * m * k;
+#pragma omp simd
+                    for(uint32_t j = 0; j < k; ++j) // col
+                    {
+                        auto idx = batchOffset + (IsRowMajor ? i * ld + j : j * ld + i);
+                        mat[idx] = randomFillValue<DataT>(seed, stream, batchOffset + i * k + j);
+                    }
+                }
+            }
+        }
+
         // fill kernel wrapper for M x N matrix
         template <typename DataT>
         __host__ static inline void fillLaunchKernel(DataT* d_mat, uint32_t m, uint32_t n)
@@ -324,6 +383,45 @@ namespace rocwmma
                 (fillValKernel<DataT, Layout>), gridDim, blockDim, 0, 0, d_mat, m, n, value);
         }
 
+        // random fill kernel wrapper for M x N matrix
+        template <typename DataT>
+        __host__ static inline void fillRandomLaunchKernel(
+            DataT* d_mat, uint32_t m, uint32_t n, uint64_t seed, uint32_t stream = 0u)
+        {
+            auto blockDim = dim3(1024, 1, 1);
+            auto gridDim  = dim3(ceilDiv(m * n, blockDim.x), 1, 1);
+            hipLaunchKernelGGL((fillRandomKernel<DataT, Layout>),
+                               gridDim,
+                               blockDim,
+                               0,
+                               0,
+                               d_mat,
+                               m,
+                               n,
+                               seed,
+                               stream);
+        }
+
+        // random fill kernel wrapper for batched M x K matrices
+        template <typename DataT>
+        __host__ static inline void fillRandomLaunchKernel(
+            DataT* d_mat, uint32_t m, uint32_t k, uint32_t b, uint64_t seed, uint32_t stream = 0u)
+        {
+            auto blockDim = dim3(1024, 1, 1);
+            auto gridDim  = dim3(ceilDiv(m * k, blockDim.x), 1, b);
+            hipLaunchKernelGGL((fillRandomKernel<DataT, Layout>),
+                               gridDim,
+                               blockDim,
+                               0,
+                               0,
+                               d_mat,
+                               m,
+                               k,
+                               b,
+                               seed,
+                               stream);
+        }
+
         // fill kernel wrapper for M x N matrix for mat[i] = i
         template <typename DataT>
         __host__ static inline void fillIdxLaunchKernel(DataT* d_mat, uint32_t m, uint32_t n)
@@ -335,122 +433,137 @@ namespace rocwmma
         }
     };
 
-    // compareEqual on two different layouts: must calculate index offsets
-    template <typename TypeA,
-              typename TypeB,
-              typename LayoutA,
-              typename LayoutB,
-              typename std::enable_if_t<!std::is_same<LayoutA, LayoutB>::value, int> = 0>
-    std::pair<bool, double> compareEqual(TypeA const* matrixA,
-                                         TypeB const* matrixB,
-                                         uint32_t     m,
-                                         uint32_t     n,
-                                         uint32_t     lda,
-                                         uint32_t     ldb,
-                                         double       tolerance = 10.0)
+    namespace detail
     {
-        bool   retval             = true;
-        double max_relative_error = 0.0;
+        // Least exponent of normalized values, used as the floor of the ULP
+        // spacing. Some limits of the narrow types report denormal minimums.
+        template <typename DataT>
+        inline int minNormalExponent()
+        {
+            return std::ilogb(static_cast<double>(
+                static_cast<float>(std::numeric_limits<DataT>::min())));
+        }
 
-        // Some types don't have direct conversion to double.
-        // Convert to float first then to double.
-        auto toDoubleA
-            = [](TypeA const& val) { return static_cast<double>(static_cast<float>(val)); };
-        auto toDoubleB
-            = [](TypeB const& val) { return static_cast<double>(static_cast<float>(val)); };
+        template <>
+        inline int minNormalExponent<float8_t>()
+        {
+            return -7;
+        }
 
-        auto rowMjr = [](uint32_t row, uint32_t col, uint32_t ld) { return row * ld + col; };
-        auto colMjr = [](uint32_t row, uint32_t col, uint32_t ld) { return col * ld + row; };
+        template <>
+        inline int minNormalExponent<bfloat8_t>()
+        {
+            return -15;
+        }
 
-        auto indexA = std::is_same<LayoutA, row_major>::value ? rowMjr : colMjr;
-        auto indexB = std::is_same<LayoutB, row_major>::value ? rowMjr : colMjr;
+        template <>
+        inline int minNormalExponent<bfloat16_t>()
+        {
+            return -126;
+        }
 
-        bool       isInf = false;
-        bool       isNaN = false;
-        std::mutex writeMutex;
+    } // namespace detail
 
-#pragma omp parallel for
-        for(int i = 0; i < m; ++i) // Row
-        {
-#pragma omp parallel for
-            for(int j = 0; j < n; ++j) // Col
-            {
-                auto valA = matrixA[indexA(i, j, lda)];
-                auto valB = matrixB[indexB(i, j, ldb)];
+    // Error statistics of a comparison of result A against reference B.
+    // The relative error of each element is |a - b| / (|a| + |b| + 1), and the
+    // ULP distance is measured in the precision of TypeA at the magnitude of b.
+    struct CompareStats
+    {
+        // Bin 0 holds exact matches, and bin i > 0 holds ULP distances in
+        // [2^(i - 1), 2^i). The last bin is unbounded.
+        constexpr static uint32_t HistogramBins = 16u;
 
-                auto numerator = fabs(toDoubleA(valA) - toDoubleB(valB));
-                auto divisor   = fabs(toDoubleA(valA)) + fabs(toDoubleB(valB)) + 1.0;
+        uint64_t count    = 0u;
+        uint64_t infCount = 0u;
+        uint64_t nanCount = 0u;
 
-                if(std::isinf(numerator) || std::isinf(divisor))
-                {
-#pragma omp atomic
-                    isInf |= true;
-                }
-                else
-                {
-                    auto relative_error = numerator / divisor;
-                    if(std::isnan(relative_error))
-                    {
-#pragma omp atomic
-                        isNaN |= true;
-                    }
-                    else if(relative_error > max_relative_error)
-                    {
-                        const std::lock_guard<std::mutex> guard(writeMutex);
-                        // Double check in case of stall
-                        if(relative_error > max_relative_error)
-                        {
-                            max_relative_error = relative_error;
-                        }
-                    }
-                }
+        double maxRelativeError = 0.0;
+        double sumRelativeError = 0.0;
 
-                if(isInf || isNaN)
-                {
-                    i = m;
-                    j = n;
-                }
-            }
-        }
+        uint64_t                            maxUlp = 0u;
+        std::array<uint64_t, HistogramBins> ulpHistogram{};
 
-        auto eps = toDoubleA(std::numeric_limits<TypeA>::epsilon());
-        if(isInf)
+        bool passed = true;
+
+        double meanRelativeError() const
         {
-            retval             = false;
-            max_relative_error = std::numeric_limits<TypeA>::infinity();
+            auto finite = count - infCount - nanCount;
+            return finite > 0u ? sumRelativeError / static_cast<double>(finite) : 0.0;
         }
-        else if(isNaN)
+
+        // Bin of a distance biased by 0.5 for rounding, given by its binade
+        static uint32_t ulpBin(double ulp)
         {
-            retval             = false;
-            max_relative_error = double(std::numeric_limits<TypeA>::signaling_NaN());
+            return detail::ulpBin(ulp, HistogramBins);
         }
-        else if(max_relative_error > (eps * tolerance))
+
+        void merge(CompareStats const& other)
         {
-            retval = false;
+            count += other.count;
+            infCount += other.infCount;
+            nanCount += other.nanCount;
+            maxRelativeError = std::max(maxRelativeError, other.maxRelativeError);
+            sumRelativeError += other.sumRelativeError;
+            maxUlp = std::max(maxUlp, other.maxUlp);
+            for(uint32_t i = 0; i < HistogramBins; i++)
+            {
+                ulpHistogram[i] += other.ulpHistogram[i];
+            }
         }
+    };
 
-        return std::make_pair(retval, max_relative_error);
-    }
+    static_assert(CompareStats::HistogramBins == DeviceCompareStats::HistogramBins,
+                  "Host and device comparisons must have the same histogram");
 
-    // compareEqual on two equal layouts: index offsets are identical
-    // can use slightly faster 1D compare
-    template <typename TypeA,
-              typename TypeB,
-              typename LayoutA,
-              typename LayoutB,
-              typename std::enable_if_t<std::is_same<LayoutA, LayoutB>::value, int> = 0>
-    std::pair<bool, double> compareEqual(TypeA const* matrixA,
-                                         TypeB const* matrixB,
-                                         uint32_t     m,
-                                         uint32_t     n,
-                                         uint32_t     lda,
-                                         uint32_t     ldb,
-                                         double       tolerance = 10.0)
+    inline std::ostream& operator<<(std::ostream& stream, CompareStats const& stats)
     {
-        assert(lda == ldb && "Leading dims must match");
+        stream << "elements: " << stats.count << ", max relative error: " << stats.maxRelativeError
+               << ", mean relative error: " << stats.meanRelativeError()
+               << ", max ULP: " << stats.maxUlp << ", inf: " << stats.infCount
+               << ", NaN: " << stats.nanCount << "\nULP histogram:";
+        for(uint32_t i = 0; i < CompareStats::HistogramBins; i++)
+        {
+            if(stats.ulpHistogram[i] == 0u)
+            {
+                continue;
+            }
 
-        bool   retval             = true;
-        double max_relative_error = 0.0;
+            stream << " [";
+            if(i == 0u)
+            {
+                stream << "0";
+            }
+            else if(i == CompareStats::HistogramBins - 1u)
+            {
+                stream << (1ull << (i - 1u)) << "+";
+            }
+            else if(i == 1u)
+            {
+                stream << "1";
+            }
+            else
+            {
+                stream << (1ull << (i - 1u)) << "-" << (1ull << i) - 1u;
+            }
+            stream << "]: " << stats.ulpHistogram[i];
+        }
+        return stream;
+    }
+
+    // Chunked parallel comparison. Each thread reduces whole lines into private
+    // statistics, which are merged once per thread. Lines are converted a
+    // segment at a time, so that the error loop vectorizes over contiguous
+    // doubles. Segments holding non-finite values take a scalar path.
+    template <typename TypeA, typename TypeB, typename LayoutA, typename LayoutB>
+    CompareStats compareStats(TypeA const* matrixA,
+                              TypeB const* matrixB,
+                              uint32_t     m,
+                              uint32_t     n,
+                              uint32_t     lda,
+                              uint32_t     ldb,
+                              double       tolerance = 10.0)
+    {
+        constexpr uint32_t SegmentSize = 256u;
 
         // Some types don't have direct conversion to double.
         // Convert to float first then to double.
@@ -459,66 +572,154 @@ namespace rocwmma
         auto toDoubleB
             = [](TypeB const& val) { return static_cast<double>(static_cast<float>(val)); };
 
-        bool       isInf = false;
-        bool       isNaN = false;
-        std::mutex writeMutex;
+        // Lines are contiguous in A. In B they are too, or strided by ldb.
+        constexpr bool RowLines   = std::is_same<LayoutA, row_major>::value;
+        constexpr bool SameLayout = std::is_same<LayoutA, LayoutB>::value;
 
-#pragma omp parallel for
-        for(int i = 0; i < m * n; ++i) // Row
-        {
-            auto valA = matrixA[i];
-            auto valB = matrixB[i];
+        int64_t  lines    = RowLines ? m : n;
+        uint32_t lineSize = RowLines ? n : m;
+        uint64_t strideB  = SameLayout ? 1u : ldb;
 
-            auto numerator = fabs(toDoubleA(valA) - toDoubleB(valB));
-            auto divisor   = fabs(toDoubleA(valA)) + fabs(toDoubleB(valB)) + 1.0;
+        auto eps = toDoubleA(std::numeric_limits<TypeA>::epsilon());
 
-            if(std::isinf(numerator) || std::isinf(divisor))
+        // Distance in units of the TypeA spacing at the magnitude of the reference
+        auto minExponent = static_cast<int64_t>(detail::minNormalExponent<TypeA>());
+        auto invEps      = std::is_integral<TypeA>::value ? 1.0 : 1.0 / eps;
+        auto ulpDistance = [minExponent, invEps](double a, double b) {
+            if constexpr(std::is_integral<TypeA>::value)
             {
-#pragma omp atomic
-                isInf |= true;
+                return std::fabs(a - b);
             }
             else
             {
-                auto relative_error = numerator / divisor;
-                if(std::isnan(relative_error))
-                {
-#pragma omp atomic
-                    isNaN |= true;
-                }
-                else if(relative_error > max_relative_error)
+                return detail::ulpDistance(a, b, minExponent, invEps);
+            }
+        };
+
+        CompareStats stats;
+
+#pragma omp parallel
+        {
+            CompareStats local;
+
+            double valA[SegmentSize];
+            double valB[SegmentSize];
+            double ulp[SegmentSize];
+
+#pragma omp for schedule(static) nowait
+            for(int64_t line = 0; line < lines; line++)
+            {
+                auto lineA = matrixA + line * lda;
+                auto lineB = matrixB + line * (SameLayout ? ldb : 1u);
+
+                for(uint32_t start = 0; start < lineSize; start += SegmentSize)
                 {
-                    const std::lock_guard<std::mutex> guard(writeMutex);
-                    // Double check in case of stall
-                    if(relative_error > max_relative_error)
+                    auto segment = std::min(SegmentSize, lineSize - start);
+
+                    for(uint32_t e = 0; e < segment; e++)
                     {
-                        max_relative_error = relative_error;
+                        valA[e] = toDoubleA(lineA[start + e]);
+                        valB[e] = toDoubleB(lineB[(start + e) * strideB]);
                     }
+
+                    uint64_t nonFinite = 0u;
+                    double   maxError  = 0.0;
+                    double   sumError  = 0.0;
+                    double   maxUlp    = 0.0;
+#pragma omp simd reduction(+ : nonFinite, sumError) reduction(max : maxError, maxUlp)
+                    for(uint32_t e = 0; e < segment; e++)
+                    {
+                        auto numerator = std::fabs(valA[e] - valB[e]);
+                        auto divisor   = std::fabs(valA[e]) + std::fabs(valB[e]) + 1.0;
+                        auto relative  = numerator / divisor;
+                        nonFinite += !std::isfinite(numerator) || !std::isfinite(divisor);
+
+                        maxError = std::max(maxError, relative);
+                        sumError += relative;
+
+                        // Saturate, e.g. for large values against a small reference
+                        ulp[e] = std::min(ulpDistance(valA[e], valB[e]) + 0.5, 0x1p62);
+                        maxUlp = std::max(maxUlp, ulp[e]);
+                    }
+
+                    if(nonFinite > 0u)
+                    {
+                        maxError = sumError = maxUlp = 0.0;
+                        for(uint32_t e = 0; e < segment; e++)
+                        {
+                            auto numerator = std::fabs(valA[e] - valB[e]);
+                            auto divisor   = std::fabs(valA[e]) + std::fabs(valB[e]) + 1.0;
+                            auto relative  = numerator / divisor;
+                            if(std::isinf(numerator) || std::isinf(divisor))
+                            {
+                                local.infCount++;
+                            }
+                            else if(std::isnan(relative))
+                            {
+                                local.nanCount++;
+                            }
+                            else
+                            {
+                                maxError = std::max(maxError, relative);
+                                sumError += relative;
+                                maxUlp = std::max(maxUlp, ulp[e]);
+                                local.ulpHistogram[CompareStats::ulpBin(ulp[e])]++;
+                            }
+                        }
+                    }
+                    else
+                    {
+                        for(uint32_t e = 0; e < segment; e++)
+                        {
+                            local.ulpHistogram[CompareStats::ulpBin(ulp[e])]++;
+                        }
+                    }
+
+                    local.count += segment;
+                    local.maxRelativeError = std::max(local.maxRelativeError, maxError);
+                    local.sumRelativeError += sumError;
+                    local.maxUlp = std::max(local.maxUlp, static_cast<uint64_t>(maxUlp));
                 }
             }
 
-            if(isInf || isNaN)
-            {
-                i = m * n;
-            }
+#pragma omp critical
+            stats.merge(local);
         }
 
-        auto eps = toDoubleA(std::numeric_limits<TypeA>::epsilon());
-        if(isInf)
-        {
-            retval             = false;
-            max_relative_error = std::numeric_limits<TypeA>::infinity();
-        }
-        else if(isNaN)
+        stats.passed = stats.infCount == 0u && stats.nanCount == 0u
+                       && stats.maxRelativeError <= eps * tolerance;
+        return stats;
+    }
+
+    // Pass / fail and max relative error of a comparison. Infinite and NaN
+    // differences fail, and are reported as the max relative error.
+    template <typename TypeA>
+    std::pair<bool, double> compareResult(CompareStats const& stats)
+    {
+        auto maxRelativeError = stats.maxRelativeError;
+        if(stats.infCount > 0u)
         {
-            retval             = false;
-            max_relative_error = double(std::numeric_limits<TypeA>::signaling_NaN());
+            maxRelativeError = std::numeric_limits<TypeA>::infinity();
         }
-        else if(max_relative_error > (eps * tolerance))
+        else if(stats.nanCount > 0u)
         {
-            retval = false;
+            maxRelativeError = double(std::numeric_limits<TypeA>::signaling_NaN());
         }
 
-        return std::make_pair(retval, max_relative_error);
+        return std::make_pair(stats.passed, maxRelativeError);
+    }
+
+    template <typename TypeA, typename TypeB, typename LayoutA, typename LayoutB>
+    std::pair<bool, double> compareEqual(TypeA const* matrixA,
+                                         TypeB const* matrixB,
+                                         uint32_t     m,
+                                         uint32_t     n,
+                                         uint32_t     lda,
+                                         uint32_t     ldb,
+                                         double       tolerance = 10.0)
+    {
+        return compareResult<TypeA>(compareStats<TypeA, TypeB, LayoutA, LayoutB>(
+            matrixA, matrixB, m, n, lda, ldb, tolerance));
     }
 
     template <typename TypeA, typename TypeB, typename LayoutA, typename LayoutB>
@@ -559,89 +760,80 @@ namespace rocwmma
             a.data(), b.data(), m, n, lda, ldb, tolerance);
     }
 
-    // compareEqual kernel wrapper for gemm tests
+    // Device comparison of result A against reference B, over a batch of b
+    // packed M x N matrices. The statistics and pass / fail criteria are those
+    // of compareStats, so that validation on the device reports the same.
     template <typename TypeA, typename TypeB, typename LayoutA, typename LayoutB>
-    std::pair<bool, double> compareEqualLaunchKernel(
-        TypeA* matrixA, TypeB* matrixB, uint32_t m, uint32_t n, double tolerance = 10.0)
+    CompareStats compareStatsLaunchKernel(TypeA const* matrixA,
+                                          TypeB const* matrixB,
+                                          uint32_t     m,
+                                          uint32_t     n,
+                                          uint32_t     b         = 1u,
+                                          double       tolerance = 10.0)
     {
         uint32_t lda = std::is_same<LayoutA, row_major>::value ? n : m;
         uint32_t ldb = std::is_same<LayoutB, row_major>::value ? n : m;
 
-        auto blockDim = dim3(1024, 1, 1);
-        auto gridDim  = dim3(ceilDiv(m * n, blockDim.x), 1, 1);
+        auto eps = static_cast<double>(static_cast<float>(std::numeric_limits<TypeA>::epsilon()));
+        auto minExponent = static_cast<int64_t>(detail::minNormalExponent<TypeA>());
+        auto invEps      = std::is_integral<TypeA>::value ? 1.0 : 1.0 / eps;
 
-        double* d_relativeError;
-        double  maxRelativeError;
-        CHECK_HIP_ERROR(hipMalloc(&d_relativeError, m * n * sizeof(double)));
+        DeviceCompareStats* d_stats;
+        CHECK_HIP_ERROR(hipMalloc(&d_stats, sizeof(DeviceCompareStats)));
+        CHECK_HIP_ERROR(hipMemset(d_stats, 0, sizeof(DeviceCompareStats)));
 
-        hipEvent_t syncEvent;
-        CHECK_HIP_ERROR(hipEventCreate(&syncEvent));
+        // Enough workgroups to fill the device, each thread striding over the rest
+        uint64_t elements = static_cast<uint64_t>(m) * n * b;
+        uint32_t blocks   = std::min(ceilDiv(elements, uint64_t(256u)), uint64_t(1024u));
+        auto     blockDim = dim3(256, 1, 1);
+        auto     gridDim  = dim3(blocks, 1, 1);
 
-        // Calculate the relative error for each element of matrix A/B
-        hipLaunchKernelGGL((compareEqualKernel<TypeA, TypeB, LayoutA, LayoutB>),
+        hipLaunchKernelGGL((compareStatsKernel<TypeA, TypeB, LayoutA, LayoutB>),
                            gridDim,
                            blockDim,
                            0,
                            0,
                            matrixA,
                            matrixB,
-                           d_relativeError,
+                           d_stats,
                            m,
                            n,
                            lda,
-                           ldb);
-        CHECK_HIP_ERROR(hipEventRecord(syncEvent));
-        CHECK_HIP_ERROR(hipEventSynchronize(syncEvent));
-
-        // Determine the maximum relative error
-        blockDim             = dim3(512, 1, 1);
-        uint32_t maxElements = 1024;
-        uint32_t offset      = 1;
-
-        for(uint32_t i = m * n; i > 1; i = ceilDiv(i, maxElements))
-        {
-            gridDim       = dim3(ceilDiv(i, maxElements), 1, 1);
-            auto elements = i > maxElements ? maxElements : i;
-
-            hipLaunchKernelGGL((maxReduceKernel),
-                               gridDim,
-                               blockDim,
-                               0,
-                               0,
-                               d_relativeError,
-                               elements,
-                               offset,
-                               m * n);
-
-            CHECK_HIP_ERROR(hipEventRecord(syncEvent));
-            CHECK_HIP_ERROR(hipEventSynchronize(syncEvent));
-            offset = offset * maxElements;
-        }
+                           ldb,
+                           b,
+                           minExponent,
+                           invEps);
 
+        DeviceCompareStats result;
         CHECK_HIP_ERROR(
-            hipMemcpy(&maxRelativeError, d_relativeError, sizeof(double), hipMemcpyDeviceToHost));
+            hipMemcpy(&result, d_stats, sizeof(DeviceCompareStats), hipMemcpyDeviceToHost));
 
         // Free allocated device memory
-        CHECK_HIP_ERROR(hipFree(d_relativeError));
-
-        bool retval = true;
-        bool isNaN  = std::isnan(maxRelativeError);
-
-        auto toDoubleA
-            = [](TypeA const& val) { return static_cast<double>(static_cast<float>(val)); };
-
-        auto eps = toDoubleA(std::numeric_limits<TypeA>::epsilon());
-        if(isNaN)
-        {
-            retval           = false;
-            maxRelativeError = double(std::numeric_limits<TypeA>::signaling_NaN());
-        }
-        else if(maxRelativeError > (eps * tolerance))
-        {
-            retval = false;
-        }
+        CHECK_HIP_ERROR(hipFree(d_stats));
+
+        CompareStats stats;
+        stats.count    = result.count;
+        stats.infCount = result.infCount;
+        stats.nanCount = result.nanCount;
+        std::memcpy(&stats.maxRelativeError, &result.maxRelativeErrorBits, sizeof(double));
+        stats.sumRelativeError = result.sumRelativeError;
+        stats.maxUlp           = result.maxUlp;
+        std::copy(std::begin(result.ulpHistogram),
+                  std::end(result.ulpHistogram),
+                  stats.ulpHistogram.begin());
+
+        stats.passed = stats.infCount == 0u && stats.nanCount == 0u
+                       && stats.maxRelativeError <= eps * tolerance;
+        return stats;
+    }
 
-        return std::make_pair(retval, maxRelativeError);
+    // compareEqual kernel wrapper for gemm tests
+    template <typename TypeA, typename TypeB, typename LayoutA, typename LayoutB>
+    std::pair<bool, double> compareEqualLaunchKernel(
+        TypeA* matrixA, TypeB* matrixB, uint32_t m, uint32_t n, double tolerance = 10.0)
+    {
+        return compareResult<TypeA>(compareStatsLaunchKernel<TypeA, TypeB, LayoutA, LayoutB>(
+            matrixA, matrixB, m, n, 1u, tolerance));
     }
 
     // compareEqual kernel wrapper for batched matrices
@@ -649,80 +841,8 @@ namespace rocwmma
     std::pair<bool, double> compareEqualLaunchKernel(
         TypeA* matrixA, TypeB* matrixB, uint32_t m, uint32_t k, uint32_t b, double tolerance = 10.0)
     {
-        auto blockDim = dim3(1024, 1, 1);
-        auto gridDim  = dim3(ceilDiv(m * k, blockDim.x), 1, b);
-
-        double* d_relativeError;
-        double  maxRelativeError;
-        CHECK_HIP_ERROR(hipMalloc(&d_relativeError, m * k * b * sizeof(double)));
-
-        hipEvent_t syncEvent;
-        CHECK_HIP_ERROR(hipEventCreate(&syncEvent));
-
-        // Calculate the relative error for each element of matrix A/B
-        hipLaunchKernelGGL((compareEqualKernel<TypeA, TypeB>),
-                           gridDim,
-                           blockDim,
-                           0,
-                           0,
-                           matrixA,
-                           matrixB,
-                           d_relativeError,
-                           m,
-                           k,
-                           b);
-        CHECK_HIP_ERROR(hipEventRecord(syncEvent));
-        CHECK_HIP_ERROR(hipEventSynchronize(syncEvent));
-
-        // Determine the maximum relative error
-        blockDim             = dim3(512, 1, 1);
-        uint32_t maxElements = 1024;
-        uint32_t offset      = 1;
-
-        for(uint32_t i = m * k * b; i > 1; i = ceilDiv(i, maxElements))
-        {
-            gridDim       = dim3(ceilDiv(i, maxElements), 1, 1);
-            auto elements = i > maxElements ? maxElements : i;
-
-            hipLaunchKernelGGL((maxReduceKernel),
-                               gridDim,
-                               blockDim,
-                               0,
-                               0,
-                               d_relativeError,
-                               elements,
-                               offset,
-                               m * k * b);
-
-            CHECK_HIP_ERROR(hipEventRecord(syncEvent));
-            CHECK_HIP_ERROR(hipEventSynchronize(syncEvent));
-            offset = offset * maxElements;
-        }
-
-        CHECK_HIP_ERROR(
-            hipMemcpy(&maxRelativeError, d_relativeError, sizeof(double), hipMemcpyDeviceToHost));
-
-        // Free allocated device memory
-        CHECK_HIP_ERROR(hipFree(d_relativeError));
-
-        bool retval = true;
-        bool isNaN  = std::isnan(maxRelativeError);
-
-        auto toDoubleA
-            = [](TypeA const& val) { return static_cast<double>(static_cast<float>(val)); };
-
-        auto eps = toDoubleA(std::numeric_limits<TypeA>::epsilon());
-        if(isNaN)
-        {
-            retval           = false;
-            maxRelativeError = double(std::numeric_limits<TypeA>::signaling_NaN());
-        }
-        else if(maxRelativeError > (eps * tolerance))
-        {
-            retval = false;
-        }
-
-        return std::make_pair(retval, maxRelativeError);
+        return compareResult<TypeA>(compareStatsLaunchKernel<TypeA, TypeB, row_major, row_major>(
+            matrixA, matrixB, m, k, b, tolerance));
     }
 
     // Count occurrences of val in the input array
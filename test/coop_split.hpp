@@ -0,0 +1,97 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_TEST_COOP_SPLIT_HPP
+#define ROCWMMA_TEST_COOP_SPLIT_HPP
+
+#include <algorithm>
+
+#include <rocwmma/rocwmma.hpp>
+#include <rocwmma/rocwmma_coop.hpp>
+
+namespace rocwmma
+{
+    // Host expansion of the cooperative IO work split. Runs
+    // func(lane, index, matrixCoord) for each fragment element that the given
+    // wave handles in cooperative IO, with the same split as the cooperative
+    // loader and storer. Waves beyond the maximum participating in the IO have
+    // no elements.
+    template <typename FragT, uint32_t WaveCount, typename Func>
+    void forEachCoopElement(uint32_t waveIndex, uint32_t waveCount, Func&& func)
+    {
+        static_assert(!is_same<GetDataLayout_t<FragT>, void>::value,
+                      "Cooperative IO requires a fragment data layout");
+
+        using Config       = GetCoopIOConfig_t<FragT, WaveCount>;
+        using IOLayout     = typename Config::IOLayout;
+        using MatrixLayout = typename IOLayout::MatrixLayout;
+        using Bounds       = detail::IOBounds<GetDataLayout_t<FragT>, IOLayout::VW>;
+
+        // Full fragment work
+        constexpr auto strideSpace = MatrixLayout::strideCounts();
+        constexpr auto strides     = MatrixLayout::strides();
+
+        // Drop the VW strides for splitting (reduced stride space).
+        constexpr auto strideSpaceR   = pop_right(strideSpace);
+        constexpr auto stridesR       = pop_right(strides);
+        constexpr auto totalWorkItems = flatten_coord_left((strideSpaceR - 1u), strideSpaceR) + 1u;
+
+        auto maxWaves = Config::Loader::calcMaxWaves((uint32_t)totalWorkItems, waveCount);
+        if(waveIndex >= maxWaves)
+        {
+            return;
+        }
+
+        // Split the reduced stride space, then add back in the VW dimension
+        auto workItemsPerWave = std::max((uint32_t)totalWorkItems / maxWaves, 1u);
+        auto strideSpaceS     = inflate_coord_left(workItemsPerWave - 1u, strideSpaceR) + 1u;
+        auto strideSpaceW     = vector_cat(strideSpaceS, make_vector(get_last(strideSpace)));
+
+        constexpr auto sum        = [](auto... items) { return (items + ...); };
+        constexpr auto product    = [](auto... items) { return (items * ...); };
+        auto           waveOffset = apply(
+            sum, inflate_coord_left(waveIndex * workItemsPerWave, strideSpaceR) * stridesR);
+
+        // Vectors are held in the same order as they are unrolled
+        uint32_t vectorCount = apply(product, strideSpaceW);
+        for(uint32_t lane = 0u; lane < Constants::AMDGCN_WAVE_SIZE; lane++)
+        {
+            auto baseOffset = MatrixLayout::baseOffset(lane) + waveOffset;
+            for(uint32_t v = 0u; v < vectorCount; v++)
+            {
+                auto strideCoord = inflate_coord_left(v, strideSpaceW);
+                auto vectorCoord = baseOffset + apply(sum, strideCoord * strides);
+                for(uint32_t i = 0u; i < IOLayout::VW; i++)
+                {
+                    func(lane, v * IOLayout::VW + i, Bounds::elementCoord(vectorCoord, i));
+                }
+            }
+        }
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_TEST_COOP_SPLIT_HPP
@@ -30,6 +30,8 @@
 #include <rocwmma/internal/types.hpp>
 #include <rocwmma/rocwmma.hpp>
 
+#include "random.hpp"
+
 namespace rocwmma
 {
     template <typename T>
@@ -49,118 +51,149 @@ namespace rocwmma
         return col * ld + row;
     }
 
-    __device__ inline float64_t maxDouble(float64_t a, float64_t b)
+    // Error statistics of a comparison, as reduced on the device. The fields
+    // are those of CompareStats. Relative errors are non-negative, so their
+    // max is reduced over their bit patterns, which order the same way.
+    struct DeviceCompareStats
     {
-        if(std::isinf(a) || std::isinf(b))
-        {
-            return std::numeric_limits<float64_t>::infinity();
-        }
-        // Check for NaN
-        else if(std::isnan(a) || std::isnan(b))
+        constexpr static uint32_t HistogramBins = 16u;
+
+        unsigned long long count;
+        unsigned long long infCount;
+        unsigned long long nanCount;
+        unsigned long long maxRelativeErrorBits;
+        float64_t          sumRelativeError;
+        unsigned long long maxUlp;
+        unsigned long long ulpHistogram[HistogramBins];
+    };
+
+    namespace detail
+    {
+        // Distance of a from the reference b in units of the spacing eps * 2^e
+        // of the compared type at the binade e of b, with e clamped to normal
+        // values. Spacings are powers of 2, so the distance is exactly
+        // |a - b| * 2^-e / eps, where 2^-e is built from the exponent bits of b.
+        ROCWMMA_HOST_DEVICE inline float64_t
+            ulpDistance(float64_t a, float64_t b, int64_t minExponent, float64_t invEps)
         {
-            return std::numeric_limits<float64_t>::signaling_NaN();
-        }
-        return a > b ? a : b;
-    }
+            uint64_t bits;
+            __builtin_memcpy(&bits, &b, sizeof(float64_t));
+            auto exponent = static_cast<int64_t>((bits >> 52) & 0x7FFu) - 1023;
+            exponent      = std::min(std::max(exponent, minExponent), int64_t(1022));
 
-    __global__ static void maxReduceKernel(float64_t* relativeError,
-                                           uint32_t   elements,
-                                           uint32_t   offset,
-                                           uint32_t   maxIdx)
-    {
-        float64_t* localRelativeError = relativeError + (offset * elements * blockIdx.x);
+            float64_t invSpacing;
+            uint64_t  invBits = static_cast<uint64_t>(1023 - exponent) << 52;
+            __builtin_memcpy(&invSpacing, &invBits, sizeof(float64_t));
 
-        for(int i = elements >> 1; i > 0; i = i >> 1)
+            return std::fabs(a - b) * invSpacing * invEps;
+        }
+
+        // Histogram bin of a distance biased by 0.5 for rounding, given by its
+        // binade. Bin 0 holds exact matches and the last bin is unbounded.
+        ROCWMMA_HOST_DEVICE inline uint32_t ulpBin(float64_t ulp, uint32_t bins)
         {
-            if(threadIdx.x < i && offset * (elements * blockIdx.x + threadIdx.x + i) < maxIdx)
-            {
-                localRelativeError[offset * threadIdx.x]
-                    = maxDouble(localRelativeError[offset * threadIdx.x],
-                                localRelativeError[offset * (threadIdx.x + i)]);
-            }
-            synchronize_workgroup();
+            uint64_t bits;
+            __builtin_memcpy(&bits, &ulp, sizeof(float64_t));
+            auto exponent = static_cast<int32_t>((bits >> 52) & 0x7FFu) - 1022;
+            return ulp < 1.0 ? 0u : std::min(static_cast<uint32_t>(exponent), bins - 1u);
         }
-    }
 
-    // Comparitive kernel for batched matrix outputs as used in gemm tests
-    // Compares all values of two M x N matrices
+    } // namespace detail
+
+    // Comparison of result A against reference B for gemm and DLRM tests, over
+    // a batch of packed M x N matrices. Each thread reduces a grid stride of
+    // elements, and each workgroup merges its threads in LDS before merging
+    // into the result.
     template <typename TypeA, typename TypeB, typename LayoutA, typename LayoutB>
-    __global__ void compareEqualKernel(TypeA*     matrixA,
-                                       TypeB*     matrixB,
-                                       float64_t* relativeError,
-                                       uint32_t   m,
-                                       uint32_t   n,
-                                       uint32_t   lda,
-                                       uint32_t   ldb)
+    __global__ void compareStatsKernel(TypeA const*        matrixA,
+                                       TypeB const*        matrixB,
+                                       DeviceCompareStats* stats,
+                                       uint32_t            m,
+                                       uint32_t            n,
+                                       uint32_t            lda,
+                                       uint32_t            ldb,
+                                       uint32_t            b,
+                                       int64_t             minExponent,
+                                       float64_t           invEps)
     {
-        uint32_t errorIdx = blockIdx.x * blockDim.x + threadIdx.x;
-        uint32_t colIdx   = errorIdx % n;
-        uint32_t rowIdx   = errorIdx / n;
+        __shared__ DeviceCompareStats blockStats;
+        if(threadIdx.x == 0u)
+        {
+            blockStats = DeviceCompareStats{};
+        }
+        synchronize_workgroup();
 
-        uint32_t indexA = std::is_same<LayoutA, row_major>::value ? rowMjr(rowIdx, colIdx, lda)
-                                                                  : colMjr(rowIdx, colIdx, lda);
-        uint32_t indexB = std::is_same<LayoutB, row_major>::value ? rowMjr(rowIdx, colIdx, ldb)
-                                                                  : colMjr(rowIdx, colIdx, ldb);
+        unsigned long long count = 0u, infCount = 0u, nanCount = 0u;
+        float64_t          maxRelativeError = 0.0, sumRelativeError = 0.0, maxUlp = 0.0;
 
-        if(rowIdx < m && colIdx < n)
+        uint64_t matrixSize = static_cast<uint64_t>(m) * n;
+        for(uint64_t i = blockIdx.x * blockDim.x + threadIdx.x; i < matrixSize * b;
+            i += gridDim.x * blockDim.x)
         {
-            TypeA valA = matrixA[indexA];
-            TypeB valB = matrixB[indexB];
+            uint64_t batchOffset = i / matrixSize * matrixSize;
+            uint32_t rowIdx      = (i - batchOffset) / n;
+            uint32_t colIdx      = (i - batchOffset) % n;
+
+            uint32_t indexA = std::is_same<LayoutA, row_major>::value ? rowMjr(rowIdx, colIdx, lda)
+                                                                      : colMjr(rowIdx, colIdx, lda);
+            uint32_t indexB = std::is_same<LayoutB, row_major>::value ? rowMjr(rowIdx, colIdx, ldb)
+                                                                      : colMjr(rowIdx, colIdx, ldb);
+
+            auto valA = toDouble(matrixA[batchOffset + indexA]);
+            auto valB = toDouble(matrixB[batchOffset + indexB]);
 
             // Determine relative error for each element of matrix A/B
-            auto numerator = fabs(toDouble(valA) - toDouble(valB));
-            auto divisor   = fabs(toDouble(valA)) + fabs(toDouble(valB)) + 1.0;
+            auto numerator = fabs(valA - valB);
+            auto divisor   = fabs(valA) + fabs(valB) + 1.0;
+            count++;
             if(std::isinf(numerator) || std::isinf(divisor))
             {
-                relativeError[errorIdx] = std::numeric_limits<float64_t>::infinity();
+                infCount++;
             }
             else if(std::isnan(numerator) || std::isnan(divisor))
             {
-                relativeError[errorIdx] = std::numeric_limits<float64_t>::signaling_NaN();
+                nanCount++;
             }
             else
             {
-                relativeError[errorIdx] = numerator / divisor;
+                auto relative    = numerator / divisor;
+                maxRelativeError = std::max(maxRelativeError, relative);
+                sumRelativeError += relative;
+
+                // Saturate, e.g. for large values against a small reference
+                auto ulp = std::is_integral<TypeA>::value
+                               ? numerator
+                               : detail::ulpDistance(valA, valB, minExponent, invEps);
+                ulp      = std::min(ulp + 0.5, 0x1p62);
+                maxUlp   = std::max(maxUlp, ulp);
+                atomicAdd(&blockStats.ulpHistogram[detail::ulpBin(
+                              ulp, DeviceCompareStats::HistogramBins)],
+                          1ull);
             }
         }
-    }
 
-    // Comparitive kernel for batched matrix outputs as used in DLRM tests
-    // Compares all values of two M x N matrices over B batches
-    template <typename TypeA, typename TypeB>
-    __global__ void compareEqualKernel(TypeA*     matrixA,
-                                       TypeB*     matrixB,
-                                       float64_t* relativeError,
-                                       uint32_t   m,
-                                       uint32_t   n,
-                                       uint32_t   b)
-    {
-        uint32_t errorIdx    = blockIdx.x * blockDim.x + threadIdx.x;
-        uint32_t colIdx      = errorIdx % n;
-        uint32_t rowIdx      = errorIdx / n;
-        uint32_t matrixIdx   = rowMjr(rowIdx, colIdx, n);
-        uint32_t batchOffset = blockIdx.z * m * n;
+        unsigned long long maxRelativeErrorBits;
+        __builtin_memcpy(&maxRelativeErrorBits, &maxRelativeError, sizeof(float64_t));
 
-        if(rowIdx < m && colIdx < n && blockIdx.z < b)
-        {
-            TypeA valA = matrixA[batchOffset + matrixIdx];
-            TypeB valB = matrixB[batchOffset + matrixIdx];
+        atomicAdd(&blockStats.count, count);
+        atomicAdd(&blockStats.infCount, infCount);
+        atomicAdd(&blockStats.nanCount, nanCount);
+        atomicMax(&blockStats.maxRelativeErrorBits, maxRelativeErrorBits);
+        atomicAdd(&blockStats.sumRelativeError, sumRelativeError);
+        atomicMax(&blockStats.maxUlp, static_cast<unsigned long long>(maxUlp));
+        synchronize_workgroup();
 
-            // Determine relative error for each element of matrix A/B
-            auto numerator = fabs(toDouble(valA) - toDouble(valB));
-            auto divisor   = fabs(toDouble(valA)) + fabs(toDouble(valB)) + 1.0;
-            if(std::isinf(numerator) || std::isinf(divisor))
-            {
-                relativeError[batchOffset + errorIdx] = std::numeric_limits<float64_t>::infinity();
-            }
-            else if(std::isnan(numerator) || std::isnan(divisor))
-            {
-                relativeError[batchOffset + errorIdx]
-                    = std::numeric_limits<float64_t>::signaling_NaN();
-            }
-            else
+        if(threadIdx.x == 0u)
+        {
+            atomicAdd(&stats->count, blockStats.count);
+            atomicAdd(&stats->infCount, blockStats.infCount);
+            atomicAdd(&stats->nanCount, blockStats.nanCount);
+            atomicMax(&stats->maxRelativeErrorBits, blockStats.maxRelativeErrorBits);
+            atomicAdd(&stats->sumRelativeError, blockStats.sumRelativeError);
+            atomicMax(&stats->maxUlp, blockStats.maxUlp);
+            for(uint32_t i = 0u; i < DeviceCompareStats::HistogramBins; i++)
             {
-                relativeError[batchOffset + errorIdx] = numerator / divisor;
+                atomicAdd(&stats->ulpHistogram[i], blockStats.ulpHistogram[i]);
             }
         }
     }
@@ -239,6 +272,45 @@ namespace rocwmma
         }
     }
 
+    // counter-based random fill kernel for M x N matrix
+    template <typename DataT, typename Layout>
+    __global__ void
+        fillRandomKernel(DataT* mat, uint32_t m, uint32_t n, uint64_t seed, uint32_t stream)
+    {
+        uint32_t rowIdx = (blockIdx.x * blockDim.x + threadIdx.x) / n;
+        uint32_t colIdx = (blockIdx.x * blockDim.x + threadIdx.x) % n;
+
+        auto ld    = std::is_same<Layout, row_major>::value ? n : m;
+        auto index = std::is_same<Layout, row_major>::value ? rowMjr(rowIdx, colIdx, ld)
+                                                            : colMjr(rowIdx, colIdx, ld);
+
+        if(rowIdx < m && colIdx < n)
+        {
+            mat[index] = randomFillValue<DataT>(
+                seed, stream, static_cast<uint64_t>(rowIdx) * n + colIdx);
+        }
+    }
+
+    // counter-based random fill kernel for batched M x K matrices
+    template <typename DataT, typename Layout>
+    __global__ void fillRandomKernel(
+        DataT* mat, uint32_t m, uint32_t k, uint32_t b, uint64_t seed, uint32_t stream)
+    {
+        uint32_t rowIdx      = (blockIdx.x * blockDim.x + threadIdx.x) / k;
+        uint32_t colIdx      = (blockIdx.x * blockDim.x + threadIdx.x) % k;
+        uint64_t batchOffset = static_cast<uint64_t>(m) * k * blockIdx.z;
+
+        auto ld    = std::is_same<Layout, row_major>::value ? k : m;
+        auto index = std::is_same<Layout, row_major>::value ? rowMjr(rowIdx, colIdx, ld)
+                                                            : colMjr(rowIdx, colIdx, ld);
+
+        if(rowIdx < m && colIdx < k)
+        {
+            mat[batchOffset + index] = randomFillValue<DataT>(
+                seed, stream, batchOffset + static_cast<uint64_t>(rowIdx) * k + colIdx);
+        }
+    }
+
     // fill kernel for batched M x K matrices for a specific value
     template <typename DataT, typename Layout>
     __global__ void fillKernel(DataT* mat, uint32_t m, uint32_t k, uint32_t b, DataT value)
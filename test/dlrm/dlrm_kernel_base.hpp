@@ -54,6 +54,7 @@ namespace rocwmma
         std::pair<int64_t, int64_t>           threadBlockSize;
         std::tuple<int64_t, int64_t, int64_t> problemSize;
         DlrmDirection_t                       passDirection;
+        uint64_t                              fillSeed = 0u; // Seed of the random input fills
     };
 
     // Typeless Kernel interface to use with testing harness.
@@ -124,6 +125,13 @@ namespace rocwmma
                                         uint32_t, // upstreamBatchOffset
                                         uint32_t); // accBatchOffset
 
+        // Random fill streams of the input matrices
+        enum : uint32_t
+        {
+            FillStreamInput        = 0u,
+            FillStreamUpstreamGrad = 1u
+        };
+
     protected:
         DlrmKernelBase();
         virtual ~DlrmKernelBase();
@@ -167,12 +175,18 @@ namespace rocwmma
         // Padded problem params
         uint32_t mMPadded, mKPadded;
 
+        // Seed of the random input fills
+        uint64_t mFillSeed;
+
         // Execution flow control
         uint32_t mRepeats;
         bool     mRunFlag          = true;
         bool     mValidationResult = false;
         double   mMaxRelativeError;
 
+        // Error statistics of the validation
+        CompareStats mCompareStats;
+
         DlrmDirection_t passDirection = DlrmDirection_t::Forward;
 
         // Performance
@@ -53,6 +53,7 @@
 
 #if ROCWMMA_VALIDATION_TESTS
 #include "reference.hpp" // Vanilla CPU kernel
+#include "reference_cache.hpp"
 #endif // ROCWMMA_VALIDATION_TESTS
 
 namespace rocwmma
@@ -155,6 +156,7 @@ namespace rocwmma
     {
         mM = mK = mB = 0;
         mMPadded = mKPadded = 0;
+        mFillSeed = 0u;
         mRepeats =
 #if ROCWMMA_VALIDATION_TESTS
             1;
@@ -172,6 +174,7 @@ namespace rocwmma
 
         mValidationResult = false;
         mMaxRelativeError = 0.0;
+        mCompareStats     = CompareStats{};
     }
 
     template <uint32_t TileSize, typename DataT>
@@ -189,6 +192,8 @@ namespace rocwmma
                       << "MatM, MatK, MatB, "
 #if ROCWMMA_VALIDATION_TESTS
                       << "maxRelativeDiff, "
+                      << "meanRelativeDiff, "
+                      << "maxULP, "
                       << "tolerance, "
 #endif // ROCWMMA_VALIDATION_TESTS
                       << "elapsedMs, "
@@ -207,7 +212,7 @@ namespace rocwmma
                           << ", " << mM << ", " << mK << ", " << mB << ", "
 
 #if ROCWMMA_VALIDATION_TESTS
-                          << "n/a, "
+                          << "n/a, n/a, n/a, "
 #endif // ROCWMMA_VALIDATION_TESTS
                           << "n/a, n/a, n/a, n/a, SKIPPED" << std::endl;
         }
@@ -218,7 +223,8 @@ namespace rocwmma
                           << ", " << mM << ", " << mK << ", " << mB << ", "
 
 #if ROCWMMA_VALIDATION_TESTS
-                          << mMaxRelativeError << ", "
+                          << mMaxRelativeError << ", " << mCompareStats.meanRelativeError() << ", "
+                          << mCompareStats.maxUlp << ", "
 #endif // ROCWMMA_VALIDATION_TESTS
                           << mElapsedTimeMs << ", " << mTotalGFlops << ", " << mMeasuredTFlopsPerSec
                           << ", " << mEfficiency << ", "
@@ -251,6 +257,7 @@ namespace rocwmma
 
         // Determine whether to run forward or backward pass
         passDirection = problem.passDirection;
+        mFillSeed     = problem.fillSeed;
 
         mRunFlag &= checkDevice();
         mRunFlag &= checkSizes();
@@ -270,25 +277,21 @@ namespace rocwmma
                 dataInstance->resizeBwdStorage(problem.problemSize);
             }
 
-            // Initialize matrix data on device and transfer to host for validation
-            if(passDirection == DlrmDirection_t::Forward)
-            {
-                MatrixUtil<row_major>::fillLaunchKernel(
-                    dataInstance->deviceInput().get(), mM, mK, mB);
-#if ROCWMMA_VALIDATION_TESTS
-                dataInstance->copyDeviceToHostFwdInput();
-#endif // ROCWMMA_VALIDATION_TESTS
-            }
-            else
+            // Initialize matrix data on device. The host copy for validation
+            // is generated on demand by the reference run.
+            MatrixUtil<row_major>::fillRandomLaunchKernel(
+                dataInstance->deviceInput().get(), mM, mK, mB, mFillSeed, FillStreamInput);
+
+            if(passDirection == DlrmDirection_t::Backward)
             {
                 uint gradSize = ((mM * (mM - 1)) / 2) + mK;
-                MatrixUtil<row_major>::fillLaunchKernel(
-                    dataInstance->deviceInput().get(), mM, mK, mB);
-                MatrixUtil<row_major>::fillLaunchKernel(
-                    dataInstance->deviceUpstreamGrad().get(), 1, gradSize, mB);
-#if ROCWMMA_VALIDATION_TESTS
-                dataInstance->copyDeviceToHostBwdInput();
-#endif // ROCWMMA_VALIDATION_TESTS
+                MatrixUtil<row_major>::fillRandomLaunchKernel(
+                    dataInstance->deviceUpstreamGrad().get(),
+                    1,
+                    gradSize,
+                    mB,
+                    mFillSeed,
+                    FillStreamUpstreamGrad);
             }
         }
     }
@@ -420,12 +423,26 @@ namespace rocwmma
 
 #if ROCWMMA_VALIDATION_TESTS
 
-            // Run reference CPU kernel
+            // Run reference CPU kernel. The result only depends on the problem,
+            // so it is shared with all other kernel variants through the cache.
             std::function<void()> cpuKernel;
+            auto&                 dataInstance = DataStorage::instance();
+
+            auto key = ReferenceKey(passDirection == DlrmDirection_t::Forward ? "dlrm_fwd_CPU"
+                                                                               : "dlrm_bwd_CPU",
+                                    mFillSeed);
+            key.field("m", mM).field("k", mK).field("b", mB).type<DataT>("DataT");
+
+            std::vector<ReferenceBuffer> outputs;
             if(passDirection == DlrmDirection_t::Forward)
             {
-                cpuKernel = [this]() {
-                    auto& dataInstance = DataStorage::instance();
+                uint64_t batchSize = ((mM * (mM - 1)) / 2) + mK;
+                outputs            = {{dataInstance->hostOutputRef().get(),
+                                       batchSize * mB * sizeof(DataT)}};
+
+                cpuKernel = [this, &dataInstance]() {
+                    MatrixUtil<row_major>::fillRandom(
+                        dataInstance->hostInput().get(), mM, mK, mB, mFillSeed, FillStreamInput);
                     dlrm_fwd_CPU<DataT>(dataInstance->hostInput().get(),
                                         dataInstance->hostOutputRef().get(),
                                         mM,
@@ -435,8 +452,21 @@ namespace rocwmma
             }
             else
             {
-                cpuKernel = [this]() {
-                    auto& dataInstance = DataStorage::instance();
+                outputs = {{dataInstance->hostGradRef().get(),
+                            static_cast<uint64_t>(mM) * mK * mB * sizeof(DataT)},
+                           {dataInstance->hostBottomMlpGradRef().get(),
+                            static_cast<uint64_t>(mK) * mB * sizeof(DataT)}};
+
+                cpuKernel = [this, &dataInstance]() {
+                    uint gradSize = ((mM * (mM - 1)) / 2) + mK;
+                    MatrixUtil<row_major>::fillRandom(
+                        dataInstance->hostInput().get(), mM, mK, mB, mFillSeed, FillStreamInput);
+                    MatrixUtil<row_major>::fillRandom(dataInstance->hostUpstreamGrad().get(),
+                                                      1,
+                                                      gradSize,
+                                                      mB,
+                                                      mFillSeed,
+                                                      FillStreamUpstreamGrad);
                     dlrm_bwd_CPU<DataT>(dataInstance->hostInput().get(),
                                         dataInstance->hostUpstreamGrad().get(),
                                         dataInstance->hostBottomMlpGradRef().get(),
@@ -446,7 +476,7 @@ namespace rocwmma
                                         mB);
                 };
             }
-            cpuKernel();
+            ReferenceCache::instance()->run(key, outputs, cpuKernel);
 #endif // ROCWMMA_VALIDATION_TESTS
         }
     }
@@ -464,15 +494,10 @@ namespace rocwmma
                 auto reference = dataInstance->template allocDevice<DataT>(batchSize * mB);
                 dataInstance->copyData(reference, dataInstance->hostOutputRef(), batchSize * mB);
 
-                std::tie(mValidationResult, mMaxRelativeError)
-                    = compareEqualLaunchKernel<DataT, DataT>(dataInstance->deviceOutput().get(),
-                                                             reference.get(),
-                                                             1,
-                                                             batchSize,
-                                                             mB,
-                                                             10.0);
+                mCompareStats = compareStatsLaunchKernel<DataT, DataT, row_major, row_major>(
+                    dataInstance->deviceOutput().get(), reference.get(), 1, batchSize, mB, 10.0);
 
-                EXPECT_TRUE(mValidationResult) << "Max relative error: " << mMaxRelativeError;
+                EXPECT_TRUE(mCompareStats.passed) << mCompareStats;
             }
             else
             {
@@ -480,27 +505,26 @@ namespace rocwmma
                 auto reference0 = dataInstance->template allocDevice<DataT>(mM * mK * mB);
                 dataInstance->copyData(reference0, dataInstance->hostGradRef(), mM * mK * mB);
 
-                std::tie(mValidationResult, mMaxRelativeError)
-                    = compareEqualLaunchKernel<DataT, DataT>(
-                        dataInstance->deviceGrad().get(), reference0.get(), mM, mK, mB);
+                mCompareStats = compareStatsLaunchKernel<DataT, DataT, row_major, row_major>(
+                    dataInstance->deviceGrad().get(), reference0.get(), mM, mK, mB);
 
-                EXPECT_TRUE(mValidationResult) << "Max relative error: " << mMaxRelativeError;
-
-                double maxRelativeError = mMaxRelativeError;
+                EXPECT_TRUE(mCompareStats.passed) << mCompareStats;
 
                 // Copy reference bottom mlp gradient to device
                 auto reference1 = dataInstance->template allocDevice<DataT>(mK * mB);
                 dataInstance->copyData(reference1, dataInstance->hostBottomMlpGradRef(), mK * mB);
 
-                std::tie(mValidationResult, mMaxRelativeError)
-                    = compareEqualLaunchKernel<DataT, DataT>(
-                        dataInstance->deviceBottomMlpGrad().get(), reference1.get(), 1, mK, mB);
+                auto bottomMlpStats = compareStatsLaunchKernel<DataT, DataT, row_major, row_major>(
+                    dataInstance->deviceBottomMlpGrad().get(), reference1.get(), 1, mK, mB);
 
-                EXPECT_TRUE(mValidationResult) << "Max relative error: " << mMaxRelativeError;
+                EXPECT_TRUE(bottomMlpStats.passed) << bottomMlpStats;
 
-                mMaxRelativeError
-                    = (maxRelativeError > mMaxRelativeError) ? maxRelativeError : mMaxRelativeError;
+                // Both gradients are reported together
+                mCompareStats.merge(bottomMlpStats);
+                mCompareStats.passed = mCompareStats.passed && bottomMlpStats.passed;
             }
+
+            std::tie(mValidationResult, mMaxRelativeError) = compareResult<DataT>(mCompareStats);
         }
 #endif
     }
@@ -31,6 +31,7 @@
 
 #include "dlrm_kernel_base.hpp"
 #include "dlrm_test_params.hpp"
+#include "rocwmma_logging.hpp"
 
 namespace rocwmma
 {
@@ -63,7 +64,8 @@ namespace rocwmma
             }
             sLastKernelRun = kernel.get();
 
-            ProblemParams params = {threadBlock, problemSize, passDirection};
+            ProblemParams params
+                = {threadBlock, problemSize, passDirection, RocwmmaLogging::instance()->fillSeed()};
 
             // Walk through kernel workflow
             kernel->setup(params);
@@ -78,7 +78,8 @@ namespace rocwmma
                                                                    uint32_t       ldc,
                                                                    uint32_t       ldd,
                                                                    ComputeT       alpha,
-                                                                   ComputeT       beta)
+                                                                   ComputeT       beta,
+                                                                   void*          workspace)
     {
         if constexpr(gemm_PGR0_LB0_MP0_MB_NC_guard<BlockM,
                                                    BlockN,
@@ -79,8 +79,12 @@ namespace rocwmma
                                                         WaveSize,
                                                         ArchId>;
 
-        template <uint32_t TBlockX, uint32_t TBlockY, uint32_t WaveSize, uint32_t ArchId>
-        struct TestKernelFunc
+        template <uint32_t TBlockX,
+                  uint32_t TBlockY,
+                  uint32_t WaveSize,
+                  uint32_t ArchId,
+                  typename EpilogueCachePolicy>
+        struct EpilogueKernelFunc
         {
             static constexpr auto generate()
             {
@@ -101,7 +105,8 @@ namespace rocwmma
                                                                              TBlockX,
                                                                              TBlockY,
                                                                              WaveSize,
-                                                                             ArchId>);
+                                                                             ArchId,
+                                                                             EpilogueCachePolicy>);
                 }
                 else
                 {
@@ -110,6 +115,14 @@ namespace rocwmma
             }
         };
 
+        template <uint32_t TBlockX, uint32_t TBlockY, uint32_t WaveSize, uint32_t ArchId>
+        using TestKernelFunc
+            = EpilogueKernelFunc<TBlockX, TBlockY, WaveSize, ArchId, cache_default>;
+
+        template <uint32_t TBlockX, uint32_t TBlockY, uint32_t WaveSize, uint32_t ArchId>
+        using StreamingKernelFunc
+            = EpilogueKernelFunc<TBlockX, TBlockY, WaveSize, ArchId, cache_streaming>;
+
     public:
         Kernel_PGR0_LB0_MP0_SB_NC() {}
         ~Kernel_PGR0_LB0_MP0_SB_NC() final {}
@@ -123,6 +136,11 @@ namespace rocwmma
         {
             return Base::template dispatchKernelFunc<TestKernelFunc>();
         }
+
+        typename Base::KernelFunc streamingKernelImpl() const final
+        {
+            return Base::template dispatchKernelFunc<StreamingKernelFunc>();
+        }
     };
 
 } // namespace rocwmma
@@ -64,7 +64,8 @@ namespace rocwmma
               uint32_t TBlockX,
               uint32_t TBlockY,
               uint32_t WaveSize,
-              uint32_t ArchId>
+              uint32_t ArchId,
+              typename EpilogueCachePolicy = cache_default>
     __global__ void __launch_bounds__(256) gemm_PGR0_LB0_MP0_SB_NC(uint32_t       m,
                                                                    uint32_t       n,
                                                                    uint32_t       k,
@@ -77,7 +78,8 @@ namespace rocwmma
                                                                    uint32_t       ldc,
                                                                    uint32_t       ldd,
                                                                    ComputeT       alpha,
-                                                                   ComputeT       beta)
+                                                                   ComputeT       beta,
+                                                                   void*          workspace)
     {
         if constexpr(gemm_PGR0_LB0_MP0_SB_NC_guard<BlockM,
                                                    BlockN,
@@ -167,7 +169,7 @@ namespace rocwmma
             auto* addrD = MappingD::dataCoord(d, matrixCoordC, ldd);
 
             // Store the output
-            store_matrix_sync(addrD, fragC, ldd);
+            store_matrix_sync<EpilogueCachePolicy>(addrD, fragC, ldd);
         }
     }
 } // namespace rocwmma
@@ -166,8 +166,9 @@ namespace rocwmma
 
             // Cooperative wave kernels quirks
             auto waveQuirksCheck = true;
-            if(std::is_same<GemmConfig, CooperativeGemm::WaveLevel::LdsNT>::value
-               || std::is_same<GemmConfig, CooperativeGemm::WaveLevel::LdsTN>::value)
+            // Includes rasterized configs that inherit wave level data movement
+            if(std::is_base_of<CooperativeGemm::WaveLevel::LdsNT, GemmConfig>::value
+               || std::is_base_of<CooperativeGemm::WaveLevel::LdsTN, GemmConfig>::value)
             {
                 // TODO: On gfx90a, TN config with 4x4 blocks of 32 x 32 x 8
                 // Produces compile time issues
@@ -186,8 +187,8 @@ namespace rocwmma
         // Lds memory usage in bytes
         uint32_t ldsUsage() const final
         {
-            // Uses 2 lds blocks for prefetch loop
-            return 2 * sizeof(InputT)
+            // Uses a ring of Stages lds blocks for prefetch loop
+            return GemmConfig::Stages * sizeof(InputT)
                    * (Base::mTBlockX / Base::DeviceInfo::instance()->warpSize() * BlocksX * BlockM
                       + Base::mTBlockY * BlocksY * BlockN)
                    * BlockK;
@@ -200,14 +201,15 @@ namespace rocwmma
 
         std::ostream& printHeader(std::ostream& stream = std::cout) const final
         {
-            return Base::printHeader(stream << "GemmConfig, LytLds, BlocksX, BlocksY, ");
+            return Base::printHeader(stream << "GemmConfig, LytLds, LdsStages, BlocksX, BlocksY, ");
         }
 
         std::ostream& printKernel(std::ostream& stream = std::cout) const final
         {
             return Base::printKernel(stream << dataTypeToString<GemmConfig>() << ", "
-                                            << dataTypeToString<LayoutLds>() << ", " << BlocksX
-                                            << ", " << BlocksY << ", ");
+                                            << dataTypeToString<LayoutLds>() << ", "
+                                            << GemmConfig::Stages << ", " << BlocksX << ", "
+                                            << BlocksY << ", ");
         }
     };
 
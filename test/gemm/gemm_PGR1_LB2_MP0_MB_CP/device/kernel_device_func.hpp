@@ -79,7 +79,8 @@ namespace rocwmma
                                                                    uint32_t       ldc,
                                                                    uint32_t       ldd,
                                                                    ComputeT       alpha,
-                                                                   ComputeT       beta)
+                                                                   ComputeT       beta,
+                                                                   void*          workspace)
     {
         if constexpr(gemm_PGR1_LB2_MP0_MB_CP_guard<BlockM,
                                                    BlockN,
@@ -175,25 +176,36 @@ namespace rocwmma
             auto kStepOffsetA = DataMappingA::fromMatrixCoord(GlobalMapping::kStepOffsetA(), lda);
             auto kStepOffsetB = DataMappingB::fromMatrixCoord(GlobalMapping::kStepOffsetB(), ldb);
 
+            ///
+            /// Pipeline depth: a ring of Stages LDS buffers holds the
+            /// upcoming k steps of A and B for the accumulation loop.
+            /// With more than 2 stages, the global reads of (Stages - 2)
+            /// k steps are in flight in a ring of register buffers.
+            ///
+            constexpr uint32_t Stages    = GemmConfig::Stages;
+            constexpr uint32_t RegStages = (Stages > 2u) ? (Stages - 2u) : 1u;
+            auto               kSteps    = (k + BlockK - 1u) / BlockK;
+
             ///
             /// Start global prefetch
+            /// Register buffer j holds k steps s where (s - 1) % RegStages == j.
             ///
-            typename GlobalMapping::GRBuffA grBuffA;
-            typename GlobalMapping::GRBuffB grBuffB;
-            GemmDriver::globalReadCoopA(grBuffA, a + globalReadOffsetA, lda);
-            GemmDriver::globalReadCoopB(grBuffB, b + globalReadOffsetB, ldb);
+            typename GlobalMapping::GRBuffA grBuffA[RegStages];
+            typename GlobalMapping::GRBuffB grBuffB[RegStages];
+            GemmDriver::globalReadCoopA(grBuffA[0], a + globalReadOffsetA, lda);
+            GemmDriver::globalReadCoopB(grBuffB[0], b + globalReadOffsetB, ldb);
             globalReadOffsetA += kStepOffsetA;
             globalReadOffsetB += kStepOffsetB;
 
             ///
             /// Setup LDS addressing
-            /// This kernel will use 2 separate LDS blocks
+            /// This kernel will use Stages separate LDS blocks
             /// for pipelining in the accumulation loop
             ///
             HIP_DYNAMIC_SHARED(void*, localMemPtr);
-            auto  sizeLds  = LdsMapping::sizeLds();
-            auto* ldsPtrLo = reinterpret_cast<InputT*>(localMemPtr);
-            auto* ldsPtrHi = ldsPtrLo + get<0>(sizeLds) * get<1>(sizeLds);
+            auto  sizeLds   = LdsMapping::sizeLds();
+            auto  stageSize = get<0>(sizeLds) * get<1>(sizeLds);
+            auto* ldsBase   = reinterpret_cast<InputT*>(localMemPtr);
 
             auto ldlds = LdsMapping::ldLds();
             auto ldsWriteOffsetA
@@ -206,8 +218,25 @@ namespace rocwmma
             ///
             /// Write prefetch to local
             ///
-            GemmDriver::localWriteCoopA(ldsPtrLo + ldsWriteOffsetA, grBuffA, ldlds);
-            GemmDriver::localWriteCoopB(ldsPtrLo + ldsWriteOffsetB, grBuffB, ldlds);
+            auto* ldsPtr = GemmDriver::template ldsStagePtr<Stages>(ldsBase, stageSize, 0u);
+            GemmDriver::localWriteCoopA(ldsPtr + ldsWriteOffsetA, grBuffA[0], ldlds);
+            GemmDriver::localWriteCoopB(ldsPtr + ldsWriteOffsetB, grBuffB[0], ldlds);
+
+            ///
+            /// Deeper pipelines issue the global reads of k steps 1 to
+            /// (Stages - 2) into the register ring up front.
+            ///
+#pragma unroll
+            for(uint32_t kStep = 1u; kStep + 1u < Stages; kStep++)
+            {
+                if(kStep < kSteps)
+                {
+                    GemmDriver::globalReadCoopA(grBuffA[kStep - 1u], a + globalReadOffsetA, lda);
+                    GemmDriver::globalReadCoopB(grBuffB[kStep - 1u], b + globalReadOffsetB, ldb);
+                    globalReadOffsetA += kStepOffsetA;
+                    globalReadOffsetB += kStepOffsetB;
+                }
+            }
 
             ///
             /// Initialize accumulation frags
@@ -222,37 +251,66 @@ namespace rocwmma
 
             ///
             /// Accumulate A * B
+            /// The loop is unrolled by RegStages, so that every iteration
+            /// addresses its register buffer with a compile-time index.
             ///
-            for(auto currentK = BlockK; currentK < k; currentK += BlockK)
+            for(uint32_t kBase = 0u; kBase + 1u < kSteps; kBase += RegStages)
             {
-                typename GlobalMapping::MfmaBuffA fragsA;
-                typename GlobalMapping::MfmaBuffB fragsB;
-
-                // Local read mfma frags
-                GemmDriver::localReadA(fragsA, ldsPtrLo + ldsReadOffsetA, ldlds);
-                GemmDriver::localReadB(fragsB, ldsPtrLo + ldsReadOffsetB, ldlds);
-
-                // Start fetching next round of frags
-                GemmDriver::globalReadCoopA(grBuffA, a + globalReadOffsetA, lda);
-                GemmDriver::globalReadCoopB(grBuffB, b + globalReadOffsetB, ldb);
-
-                // Advance offsets to next k step
-                globalReadOffsetA += kStepOffsetA;
-                globalReadOffsetB += kStepOffsetB;
-
-                // accum(A * B)
-                GemmDriver::mfma(fragsAcc, fragsA, fragsB, fragsAcc);
-
-                GemmDriver::localWriteCoopA(ldsPtrHi + ldsWriteOffsetA, grBuffA, ldlds);
-                GemmDriver::localWriteCoopB(ldsPtrHi + ldsWriteOffsetB, grBuffB, ldlds);
-
-                // Make sure that all waves have finished reading / writing to lds.
-                GemmDriver::syncWorkgroup();
-
-                // Swap Lds buffers
-                auto* tmp = ldsPtrLo;
-                ldsPtrLo  = ldsPtrHi;
-                ldsPtrHi  = tmp;
+#pragma unroll
+                for(uint32_t j = 0u; j < RegStages; j++)
+                {
+                    auto kStep = kBase + j;
+                    if(kStep + 1u >= kSteps)
+                    {
+                        break;
+                    }
+
+                    typename GlobalMapping::MfmaBuffA fragsA;
+                    typename GlobalMapping::MfmaBuffB fragsB;
+
+                    // With more than 2 stages, k step (kStep + 1) was read
+                    // (Stages - 2) iterations ago, and is written to local
+                    // before its register buffer is refilled. The target stage
+                    // was last read (Stages - 1) iterations ago.
+                    if constexpr(Stages > 2u)
+                    {
+                        ldsPtr = GemmDriver::template ldsStagePtr<Stages>(
+                            ldsBase, stageSize, kStep + 1u);
+                        GemmDriver::localWriteCoopA(ldsPtr + ldsWriteOffsetA, grBuffA[j], ldlds);
+                        GemmDriver::localWriteCoopB(ldsPtr + ldsWriteOffsetB, grBuffB[j], ldlds);
+                    }
+
+                    // Local read mfma frags
+                    ldsPtr = GemmDriver::template ldsStagePtr<Stages>(ldsBase, stageSize, kStep);
+                    GemmDriver::localReadA(fragsA, ldsPtr + ldsReadOffsetA, ldlds);
+                    GemmDriver::localReadB(fragsB, ldsPtr + ldsReadOffsetB, ldlds);
+
+                    // Start fetching k step (kStep + Stages - 1)
+                    if(kStep + Stages - 1u < kSteps)
+                    {
+                        GemmDriver::globalReadCoopA(grBuffA[j], a + globalReadOffsetA, lda);
+                        GemmDriver::globalReadCoopB(grBuffB[j], b + globalReadOffsetB, ldb);
+
+                        // Advance offsets to next k step
+                        globalReadOffsetA += kStepOffsetA;
+                        globalReadOffsetB += kStepOffsetB;
+                    }
+
+                    // accum(A * B)
+                    GemmDriver::mfma(fragsAcc, fragsA, fragsB, fragsAcc);
+
+                    // With 2 stages, the next k step is written to the other buffer
+                    if constexpr(Stages == 2u)
+                    {
+                        ldsPtr = GemmDriver::template ldsStagePtr<Stages>(
+                            ldsBase, stageSize, kStep + 1u);
+                        GemmDriver::localWriteCoopA(ldsPtr + ldsWriteOffsetA, grBuffA[j], ldlds);
+                        GemmDriver::localWriteCoopB(ldsPtr + ldsWriteOffsetB, grBuffB[j], ldlds);
+                    }
+
+                    // Make sure that all waves have finished reading / writing to lds.
+                    GemmDriver::syncWorkgroup();
+                }
             }
 
             ///
@@ -269,8 +327,9 @@ namespace rocwmma
             typename GlobalMapping::MfmaBuffA fragsA;
             typename GlobalMapping::MfmaBuffB fragsB;
 
-            GemmDriver::localReadA(fragsA, ldsPtrLo + ldsReadOffsetA, ldlds);
-            GemmDriver::localReadB(fragsB, ldsPtrLo + ldsReadOffsetB, ldlds);
+            ldsPtr = GemmDriver::template ldsStagePtr<Stages>(ldsBase, stageSize, kSteps - 1u);
+            GemmDriver::localReadA(fragsA, ldsPtr + ldsReadOffsetA, ldlds);
+            GemmDriver::localReadB(fragsB, ldsPtr + ldsReadOffsetB, ldlds);
             GemmDriver::mfma(fragsAcc, fragsA, fragsB, fragsAcc);
 
             ///
@@ -61,6 +61,32 @@ namespace rocwmma
 
         } // namespace WaveLevel
 
+        namespace Rasterized
+        {
+            class GroupedM8WaveLdsNT;
+            class Morton8x8WaveLdsNT;
+            class Hilbert8x8WaveLdsNT;
+
+        } // namespace Rasterized
+
+        namespace Pipelined
+        {
+            class Stages3WaveLdsNT;
+            class Stages3WaveLdsTN;
+            class Stages4WaveLdsNT;
+            class Stages4WaveLdsTN;
+
+        } // namespace Pipelined
+
+        namespace Swizzled
+        {
+            class BlockLdsNT;
+            class BlockLdsTN;
+            class WaveLdsNT;
+            class WaveLdsTN;
+
+        } // namespace Swizzled
+
     } // namespace CooperativeGemm
 
     ///
@@ -90,6 +116,38 @@ namespace rocwmma
             = std::tuple<std::tuple<typename CooperativeGemm::WorkgroupLevel::LdsNT>,
                          std::tuple<typename CooperativeGemm::WorkgroupLevel::LdsTN>>;
 
+        ///
+        /// Rasterized cooperative GEMM configurations
+        /// Wave level with grouped, Morton and Hilbert tile orders
+        ///
+
+        using TestGemmConfigsRasterized
+            = std::tuple<std::tuple<typename CooperativeGemm::Rasterized::GroupedM8WaveLdsNT>,
+                         std::tuple<typename CooperativeGemm::Rasterized::Morton8x8WaveLdsNT>,
+                         std::tuple<typename CooperativeGemm::Rasterized::Hilbert8x8WaveLdsNT>>;
+
+        ///
+        /// Pipelined cooperative GEMM configurations
+        /// Wave level with 3 and 4 LDS stages
+        ///
+
+        using TestGemmConfigsPipelined
+            = std::tuple<std::tuple<typename CooperativeGemm::Pipelined::Stages3WaveLdsNT>,
+                         std::tuple<typename CooperativeGemm::Pipelined::Stages3WaveLdsTN>,
+                         std::tuple<typename CooperativeGemm::Pipelined::Stages4WaveLdsNT>,
+                         std::tuple<typename CooperativeGemm::Pipelined::Stages4WaveLdsTN>>;
+
+        ///
+        /// Swizzled cooperative GEMM configurations
+        /// Block and wave levels with xor swizzled K-contiguous LDS layouts
+        ///
+
+        using TestGemmConfigsSwizzled
+            = std::tuple<std::tuple<typename CooperativeGemm::Swizzled::BlockLdsNT>,
+                         std::tuple<typename CooperativeGemm::Swizzled::BlockLdsTN>,
+                         std::tuple<typename CooperativeGemm::Swizzled::WaveLdsNT>,
+                         std::tuple<typename CooperativeGemm::Swizzled::WaveLdsTN>>;
+
         ///
         /// Kernel generator impl objects
         ///
@@ -0,0 +1,296 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_TEST_DEVICE_FUNC
+#define ROCWMMA_GEMM_TEST_DEVICE_FUNC
+
+// Silence warnings for calls on unsupported architectures.
+// Unsupported architectures will generate no-ops and test
+// will be avoided at runtime anyway.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include "gemm_config.hpp"
+#include "kernel_predicates.hpp"
+#include <rocwmma/rocwmma.hpp>
+#include <rocwmma/rocwmma_coop.hpp>
+#pragma GCC diagnostic pop
+
+namespace rocwmma
+{
+    ///
+    /// Device function GEMM kernel:
+    ///
+    /// PGR1 = Prefetch Global Read, x1 step prefetch
+    /// LB2 = Lds Buffer, x2 buffers
+    /// MP0 = Mfma Priority, 0
+    /// MB = Multi-block output
+    /// PC = Producer / consumer specialized waves
+    ///
+    /// Launched with blockDim = (TBlockX, TBlockY + GemmConfig::ProducerRows).
+    /// Consumer waves occupy threadIdx.y < TBlockY, and producer waves the rows after.
+    ///
+    /// Lds layout:
+    /// [Stages A/B buffers (InputT)][Stages full counters][Stages empty counters]
+    ///
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD,
+              typename LayoutLds,
+              typename GemmConfig,
+              uint32_t BlocksX = 1,
+              uint32_t BlocksY = 1,
+              uint32_t TBlockX = 0,
+              uint32_t TBlockY = 0,
+              uint32_t WaveSize,
+              uint32_t ArchId>
+    __global__ void __launch_bounds__(512) gemm_PGR1_LB2_MP0_MB_PC(uint32_t       m,
+                                                                   uint32_t       n,
+                                                                   uint32_t       k,
+                                                                   InputT const*  a,
+                                                                   InputT const*  b,
+                                                                   OutputT const* c,
+                                                                   OutputT*       d,
+                                                                   uint32_t       lda,
+                                                                   uint32_t       ldb,
+                                                                   uint32_t       ldc,
+                                                                   uint32_t       ldd,
+                                                                   ComputeT       alpha,
+                                                                   ComputeT       beta,
+                                                                   void*          workspace)
+    {
+        if constexpr(gemm_PGR1_LB2_MP0_MB_PC_guard<BlockM,
+                                                   BlockN,
+                                                   BlockK,
+                                                   InputT,
+                                                   OutputT,
+                                                   ComputeT,
+                                                   LayoutA,
+                                                   LayoutB,
+                                                   LayoutC,
+                                                   LayoutD,
+                                                   LayoutLds,
+                                                   GemmConfig,
+                                                   BlocksX,
+                                                   BlocksY,
+                                                   TBlockX,
+                                                   TBlockY,
+                                                   WaveSize,
+                                                   ArchId>::enableBuild())
+        {
+            ///
+            /// Assemble the gemm driver from the incoming gemm configuration
+            ///
+            using GlobalMapping = typename GemmConfig::template GlobalMapping<BlockM,
+                                                                              BlockN,
+                                                                              BlockK,
+                                                                              InputT,
+                                                                              OutputT,
+                                                                              ComputeT,
+                                                                              LayoutA,
+                                                                              LayoutB,
+                                                                              LayoutC,
+                                                                              LayoutD,
+                                                                              BlocksX,
+                                                                              BlocksY,
+                                                                              TBlockX,
+                                                                              TBlockY>;
+
+            using LdsMapping = typename GemmConfig::template LdsMapping<GlobalMapping, LayoutLds>;
+            using CoopSchedulerA = typename GemmConfig::template CoopSchedulerA<TBlockX, TBlockY>;
+            using CoopSchedulerB = typename GemmConfig::template CoopSchedulerB<TBlockX, TBlockY>;
+            using GemmDriver     = typename GemmConfig::
+                template GemmDriver<GlobalMapping, LdsMapping, CoopSchedulerA, CoopSchedulerB>;
+
+            // Fragments for mfma
+            using MfmaFragA = typename GlobalMapping::MfmaFragA;
+            using MfmaFragB = typename GlobalMapping::MfmaFragB;
+            using MfmaFragC = typename GlobalMapping::MfmaFragC;
+            using MfmaFragD = typename GlobalMapping::MfmaFragD;
+
+            // Mapping utils for each fragment type
+            using DataMappingA   = GetDataLayout_t<MfmaFragA>;
+            using DataMappingB   = GetDataLayout_t<MfmaFragB>;
+            using DataMappingC   = GetDataLayout_t<MfmaFragC>;
+            using DataMappingD   = GetDataLayout_t<MfmaFragD>;
+            using DataMappingLds = typename LdsMapping::DataLayout;
+
+            ///
+            /// Wave roles
+            ///
+            constexpr uint32_t Stages        = GemmConfig::Stages;
+            constexpr uint32_t ConsumerWaves = TBlockX / WaveSize * TBlockY;
+            constexpr uint32_t ProducerWaves = CoopSchedulerA::waveCount();
+            static_assert(ProducerWaves == CoopSchedulerB::waveCount(),
+                          "A and B must be produced by the same waves");
+
+            auto isProducer = CoopSchedulerA::isProducer();
+
+            ///
+            /// Macro tile bounds check, uniform across all waves
+            ///
+            auto macroTileBound
+                = GlobalMapping::macroTileCoordC() + GlobalMapping::macroTileSizeC();
+            if((get<0>(macroTileBound) > m) || (get<1>(macroTileBound) > n) || (BlockK > k))
+            {
+                return;
+            }
+
+            auto kSteps = k / BlockK;
+
+            ///
+            /// Setup LDS addressing
+            /// A/B stages are followed by the full and empty wave counters
+            ///
+            HIP_DYNAMIC_SHARED(void*, localMemPtr);
+            auto  sizeLds   = LdsMapping::sizeLds();
+            auto  stageSize = get<0>(sizeLds) * get<1>(sizeLds);
+            auto* ldsBase   = reinterpret_cast<InputT*>(localMemPtr);
+            auto* ldsFull   = reinterpret_cast<uint32_t*>(ldsBase + Stages * stageSize);
+            auto* ldsEmpty  = ldsFull + Stages;
+
+            auto ldlds = LdsMapping::ldLds();
+
+            ///
+            /// Reset the counters before any wave can signal
+            ///
+            auto threadId = threadIdx.y * blockDim.x + threadIdx.x;
+            if(threadId < 2u * Stages)
+            {
+                ldsFull[threadId] = 0u;
+            }
+            GemmDriver::syncWorkgroup();
+
+            ///
+            /// From here on, waves only synchronize through the counters.
+            /// For k step kStep in stage (kStep % Stages) on round (kStep / Stages):
+            /// - Producers wait for all consumers to release the previous round,
+            ///   then write the stage and signal full.
+            /// - Consumers wait for all producers to fill the current round,
+            ///   then read the stage and signal empty.
+            ///
+            if(isProducer)
+            {
+                auto globalReadOffsetA
+                    = DataMappingA::fromMatrixCoord(GlobalMapping::readCoordA(), lda);
+                auto globalReadOffsetB
+                    = DataMappingB::fromMatrixCoord(GlobalMapping::readCoordB(), ldb);
+
+                auto kStepOffsetA
+                    = DataMappingA::fromMatrixCoord(GlobalMapping::kStepOffsetA(), lda);
+                auto kStepOffsetB
+                    = DataMappingB::fromMatrixCoord(GlobalMapping::kStepOffsetB(), ldb);
+
+                auto ldsWriteOffsetA
+                    = DataMappingLds::fromMatrixCoord(LdsMapping::writeCoordA(), ldlds);
+                auto ldsWriteOffsetB
+                    = DataMappingLds::fromMatrixCoord(LdsMapping::writeCoordB(), ldlds);
+
+                typename GlobalMapping::GRBuffA grBuffA;
+                typename GlobalMapping::GRBuffB grBuffB;
+
+                for(uint32_t kStep = 0u; kStep < kSteps; kStep++)
+                {
+                    // Global read is in flight while waiting for the stage
+                    GemmDriver::globalReadCoopA(grBuffA, a + globalReadOffsetA, lda);
+                    GemmDriver::globalReadCoopB(grBuffB, b + globalReadOffsetB, ldb);
+                    globalReadOffsetA += kStepOffsetA;
+                    globalReadOffsetB += kStepOffsetB;
+
+                    auto stage = kStep % Stages;
+                    GemmDriver::waitWave(ldsEmpty + stage, kStep / Stages * ConsumerWaves);
+
+                    auto* ldsPtr
+                        = GemmDriver::template ldsStagePtr<Stages>(ldsBase, stageSize, kStep);
+                    GemmDriver::localWriteCoopA(ldsPtr + ldsWriteOffsetA, grBuffA, ldlds);
+                    GemmDriver::localWriteCoopB(ldsPtr + ldsWriteOffsetB, grBuffB, ldlds);
+
+                    GemmDriver::arriveWave(ldsFull + stage);
+                }
+
+                // Producers have no output
+                return;
+            }
+
+            ///
+            /// Consumers: accumulate A * B from LDS
+            ///
+            auto globalReadOffsetC
+                = DataMappingC::fromMatrixCoord(GlobalMapping::readCoordC(), ldc);
+            auto globalWriteOffsetD
+                = DataMappingD::fromMatrixCoord(GlobalMapping::writeCoordD(), ldd);
+
+            auto ldsReadOffsetA = DataMappingLds::fromMatrixCoord(LdsMapping::readCoordA(), ldlds);
+            auto ldsReadOffsetB = DataMappingLds::fromMatrixCoord(LdsMapping::readCoordB(), ldlds);
+
+            typename GlobalMapping::MfmaBuffAcc fragsAcc;
+            GemmDriver::fill(fragsAcc, static_cast<ComputeT>(0));
+
+            typename GlobalMapping::MfmaBuffC fragsC;
+
+            for(uint32_t kStep = 0u; kStep < kSteps; kStep++)
+            {
+                typename GlobalMapping::MfmaBuffA fragsA;
+                typename GlobalMapping::MfmaBuffB fragsB;
+
+                // Start loading C ahead of the tail A * B
+                if(kStep + 1u == kSteps)
+                {
+                    GemmDriver::globalReadC(fragsC, c + globalReadOffsetC, ldc);
+                }
+
+                auto stage = kStep % Stages;
+                GemmDriver::waitWave(ldsFull + stage, (kStep / Stages + 1u) * ProducerWaves);
+
+                // Local read mfma frags
+                auto* ldsPtr = GemmDriver::template ldsStagePtr<Stages>(ldsBase, stageSize, kStep);
+                GemmDriver::localReadA(fragsA, ldsPtr + ldsReadOffsetA, ldlds);
+                GemmDriver::localReadB(fragsB, ldsPtr + ldsReadOffsetB, ldlds);
+
+                // Release the stage to producers as soon as frags are in registers
+                GemmDriver::arriveWave(ldsEmpty + stage);
+
+                // accum(A * B)
+                GemmDriver::mfma(fragsAcc, fragsA, fragsB, fragsAcc);
+            }
+
+            ///
+            /// D = alpha * accum + beta * C
+            ///
+            typename GlobalMapping::MfmaBuffD fragsD;
+            GemmDriver::uniformFma(fragsD, alpha, fragsAcc, beta, fragsC);
+            GemmDriver::globalWriteD(d + globalWriteOffsetD, fragsD, ldd);
+        }
+    }
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_TEST_DEVICE_FUNC
@@ -0,0 +1,78 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_COMMON_TEST_PARAMS
+#define ROCWMMA_GEMM_COMMON_TEST_PARAMS
+
+#include "gemm_common_test_params.hpp"
+
+namespace rocwmma
+{
+    ///
+    /// FWD declarations
+    ///
+
+    class KernelGenerator_PGR1_LB2_MP0_MB_PC;
+
+    namespace CooperativeGemm
+    {
+        namespace ProducerConsumer
+        {
+            class LdsNT;
+            class LdsTN;
+            class Stages4LdsNT;
+            class Stages4LdsTN;
+
+        } // namespace ProducerConsumer
+
+    } // namespace CooperativeGemm
+
+    ///
+    /// Generalized kernel params for producer / consumer tests
+    ///
+    struct CommonTestParams : public GemmCommonTestParams
+    {
+        ///
+        /// Producer / consumer GEMM configurations
+        ///
+        using TestGemmConfigsProducerConsumer
+            = std::tuple<std::tuple<typename CooperativeGemm::ProducerConsumer::LdsNT>,
+                         std::tuple<typename CooperativeGemm::ProducerConsumer::LdsTN>,
+                         std::tuple<typename CooperativeGemm::ProducerConsumer::Stages4LdsNT>,
+                         std::tuple<typename CooperativeGemm::ProducerConsumer::Stages4LdsTN>>;
+
+        using TestBlocksProducerConsumer
+            = std::tuple<std::tuple<I<2>, I<2>>, std::tuple<I<4>, I<4>>>;
+
+        ///
+        /// Kernel generator impl objects
+        ///
+        using KernelGeneratorImpl = KernelGenerator_PGR1_LB2_MP0_MB_PC;
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_COMMON_TEST_PARAMS
@@ -0,0 +1,207 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_TEST_DETAIL_KERNEL
+#define ROCWMMA_GEMM_TEST_DETAIL_KERNEL
+
+#include "device/kernel_device_func.hpp"
+#include "gemm_kernel_base.hpp"
+#include "helper_macros.hpp"
+
+namespace rocwmma
+{
+
+    // Wrapper into the actual device function
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD,
+              typename LayoutLds,
+              typename GemmConfig,
+              uint32_t BlocksX = 1,
+              uint32_t BlocksY = 1>
+    struct Kernel_PGR1_LB2_MP0_MB_SK final : public GemmKernelBase<BlockM,
+                                                                   BlockN,
+                                                                   BlockK,
+                                                                   InputT,
+                                                                   OutputT,
+                                                                   ComputeT,
+                                                                   LayoutA,
+                                                                   LayoutB,
+                                                                   LayoutC,
+                                                                   LayoutD>
+    {
+    private:
+        using Base = GemmKernelBase<BlockM,
+                                    BlockN,
+                                    BlockK,
+                                    InputT,
+                                    OutputT,
+                                    ComputeT,
+                                    LayoutA,
+                                    LayoutB,
+                                    LayoutC,
+                                    LayoutD>;
+
+        template <uint32_t TBlockX, uint32_t TBlockY, uint32_t WaveSize, uint32_t ArchId>
+        using TestGuard = gemm_PGR1_LB2_MP0_MB_SK_guard<BlockM,
+                                                        BlockN,
+                                                        BlockK,
+                                                        InputT,
+                                                        OutputT,
+                                                        ComputeT,
+                                                        LayoutA,
+                                                        LayoutB,
+                                                        LayoutC,
+                                                        LayoutD,
+                                                        LayoutLds,
+                                                        GemmConfig,
+                                                        BlocksX,
+                                                        BlocksY,
+                                                        TBlockX,
+                                                        TBlockY,
+                                                        WaveSize,
+                                                        ArchId>;
+
+        template <uint32_t TBlockX, uint32_t TBlockY, uint32_t WaveSize, uint32_t ArchId>
+        struct TestKernelFunc
+        {
+            static constexpr auto generate()
+            {
+                // Avoid attempting to reference kernel functions that haven't passed
+                // predicate tests, as they won't be built!
+                if constexpr(TestGuard<TBlockX, TBlockY, WaveSize, ArchId>::enableRun())
+                {
+                    return typename Base::KernelFunc(gemm_PGR1_LB2_MP0_MB_SK<BlockM,
+                                                                             BlockN,
+                                                                             BlockK,
+                                                                             InputT,
+                                                                             OutputT,
+                                                                             ComputeT,
+                                                                             LayoutA,
+                                                                             LayoutB,
+                                                                             LayoutC,
+                                                                             LayoutD,
+                                                                             LayoutLds,
+                                                                             GemmConfig,
+                                                                             BlocksX,
+                                                                             BlocksY,
+                                                                             TBlockX,
+                                                                             TBlockY,
+                                                                             WaveSize,
+                                                                             ArchId>);
+                }
+                else
+                {
+                    return typename Base::KernelFunc(nullptr);
+                }
+            }
+        };
+
+    public:
+        Kernel_PGR1_LB2_MP0_MB_SK() {}
+        ~Kernel_PGR1_LB2_MP0_MB_SK() final {}
+
+        // Macro tile size (M x N) of the workgroup
+        std::pair<uint32_t, uint32_t> macroTileSize() const
+        {
+            return std::make_pair(BlockM * BlocksX * Base::mTBlockX
+                                      / Base::DeviceInfo::instance()->warpSize(),
+                                  BlockN * BlocksY * Base::mTBlockY);
+        }
+
+        // Persistent grid of one workgroup per CU
+        dim3 gridDim() const final
+        {
+            return dim3(Base::DeviceInfo::instance()->cuCount());
+        }
+
+        // Stream-K tiles the problem exactly, such that MAC-loop
+        // iterations are of uniform cost.
+        bool checkSizes() const final
+        {
+            auto macroTile = macroTileSize();
+            return (std::get<0>(macroTile) <= Base::mM) && (std::get<1>(macroTile) <= Base::mN)
+                   && (BlockK <= Base::mK) && (Base::mM % std::get<0>(macroTile) == 0u)
+                   && (Base::mN % std::get<1>(macroTile) == 0u) && (Base::mK % BlockK == 0u);
+        }
+
+        bool checkQuirks() const final
+        {
+            // Don't run the kernel if the threadblock size is not supported
+            auto kernelImplCheck = (kernelImpl() != nullptr);
+
+            return Base::checkQuirks() && Base::template dispatchGuard<TestGuard>()
+                   && kernelImplCheck;
+        }
+
+        // One partial macro tile of ComputeT and one fix-up flag per workgroup
+        uint64_t workspaceSize() const final
+        {
+            auto macroTile = macroTileSize();
+            return static_cast<uint64_t>(gridDim().x)
+                   * (static_cast<uint64_t>(std::get<0>(macroTile)) * std::get<1>(macroTile)
+                          * sizeof(ComputeT)
+                      + sizeof(uint32_t));
+        }
+
+        // Lds memory usage in bytes
+        uint32_t ldsUsage() const final
+        {
+            // Uses 2 lds blocks for prefetch loop
+            return 2 * sizeof(InputT)
+                   * (Base::mTBlockX / Base::DeviceInfo::instance()->warpSize() * BlocksX * BlockM
+                      + Base::mTBlockY * BlocksY * BlockN)
+                   * BlockK;
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return Base::template dispatchKernelFunc<TestKernelFunc>();
+        }
+
+        std::ostream& printHeader(std::ostream& stream = std::cout) const final
+        {
+            return Base::printHeader(stream << "GemmConfig, LytLds, BlocksX, BlocksY, ");
+        }
+
+        std::ostream& printKernel(std::ostream& stream = std::cout) const final
+        {
+            return Base::printKernel(stream << dataTypeToString<GemmConfig>() << ", "
+                                            << dataTypeToString<LayoutLds>() << ", " << BlocksX
+                                            << ", " << BlocksY << ", ");
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_TEST_DETAIL_KERNEL
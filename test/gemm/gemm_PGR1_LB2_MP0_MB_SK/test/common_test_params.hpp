@@ -0,0 +1,96 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_COMMON_TEST_PARAMS
+#define ROCWMMA_GEMM_COMMON_TEST_PARAMS
+
+#include "gemm_common_test_params.hpp"
+
+namespace rocwmma
+{
+    ///
+    /// FWD declarations
+    ///
+
+    class KernelGenerator_PGR1_LB2_MP0_MB_SK;
+
+    namespace CooperativeGemm
+    {
+        namespace StreamK
+        {
+            class LdsNT;
+            class LdsTN;
+
+        } // namespace StreamK
+
+    } // namespace CooperativeGemm
+
+    ///
+    /// Generalized kernel params for Stream-K tests
+    ///
+    struct CommonTestParams : public GemmCommonTestParams
+    {
+        ///
+        /// Stream-K GEMM configurations
+        ///
+        using TestGemmConfigsStreamK
+            = std::tuple<std::tuple<typename CooperativeGemm::StreamK::LdsNT>,
+                         std::tuple<typename CooperativeGemm::StreamK::LdsTN>>;
+
+        using TestBlocksStreamK = std::tuple<std::tuple<I<1>, I<1>>, std::tuple<I<2>, I<2>>>;
+
+        ///
+        /// Kernel generator impl objects
+        ///
+        using KernelGeneratorImpl = KernelGenerator_PGR1_LB2_MP0_MB_SK;
+
+        // In addition to the common problem sizes, Stream-K is benchmarked
+        // on problems whose output tile counts don't fill the device evenly,
+        // such as skinny outputs with deep K.
+        static inline std::vector<ProblemSizeT> problemSizes()
+        {
+            auto problems = GemmCommonTestParams::problemSizes();
+            problems.insert(problems.end(),
+                            {
+                                // clang-format off
+                                {64, 64, 8192},
+                                {128, 256, 4096},
+                                {512, 256, 2048},
+                                {768, 768, 1024},
+#if !ROCWMMA_VALIDATION_TESTS
+                                {256, 256, 16384},
+                                {1536, 1280, 4096},
+                                {3840, 1280, 2048},
+#endif // !ROCWMMA_VALIDATION_TESTS
+                                // clang-format on
+                            });
+            return problems;
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_COMMON_TEST_PARAMS
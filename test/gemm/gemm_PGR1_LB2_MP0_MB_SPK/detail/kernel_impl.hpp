@@ -0,0 +1,265 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_TEST_DETAIL_KERNEL
+#define ROCWMMA_GEMM_TEST_DETAIL_KERNEL
+
+#include "device/kernel_device_func.hpp"
+#include "gemm_kernel_base.hpp"
+#include "helper_macros.hpp"
+
+namespace rocwmma
+{
+
+    // Wrapper into the actual device function
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD,
+              typename LayoutLds,
+              typename GemmConfig,
+              uint32_t BlocksX = 1,
+              uint32_t BlocksY = 1>
+    struct Kernel_PGR1_LB2_MP0_MB_SPK final : public GemmKernelBase<BlockM,
+                                                                   BlockN,
+                                                                   BlockK,
+                                                                   InputT,
+                                                                   OutputT,
+                                                                   ComputeT,
+                                                                   LayoutA,
+                                                                   LayoutB,
+                                                                   LayoutC,
+                                                                   LayoutD>
+    {
+    private:
+        using Base = GemmKernelBase<BlockM,
+                                    BlockN,
+                                    BlockK,
+                                    InputT,
+                                    OutputT,
+                                    ComputeT,
+                                    LayoutA,
+                                    LayoutB,
+                                    LayoutC,
+                                    LayoutD>;
+
+        template <uint32_t TBlockX, uint32_t TBlockY, uint32_t WaveSize, uint32_t ArchId>
+        using TestGuard = gemm_PGR1_LB2_MP0_MB_SPK_guard<BlockM,
+                                                        BlockN,
+                                                        BlockK,
+                                                        InputT,
+                                                        OutputT,
+                                                        ComputeT,
+                                                        LayoutA,
+                                                        LayoutB,
+                                                        LayoutC,
+                                                        LayoutD,
+                                                        LayoutLds,
+                                                        GemmConfig,
+                                                        BlocksX,
+                                                        BlocksY,
+                                                        TBlockX,
+                                                        TBlockY,
+                                                        WaveSize,
+                                                        ArchId>;
+
+        template <uint32_t TBlockX, uint32_t TBlockY, uint32_t WaveSize, uint32_t ArchId>
+        struct TestKernelFunc
+        {
+            static constexpr auto generate()
+            {
+                // Avoid attempting to reference kernel functions that haven't passed
+                // predicate tests, as they won't be built!
+                if constexpr(TestGuard<TBlockX, TBlockY, WaveSize, ArchId>::enableRun())
+                {
+                    return typename Base::KernelFunc(gemm_PGR1_LB2_MP0_MB_SPK<BlockM,
+                                                                             BlockN,
+                                                                             BlockK,
+                                                                             InputT,
+                                                                             OutputT,
+                                                                             ComputeT,
+                                                                             LayoutA,
+                                                                             LayoutB,
+                                                                             LayoutC,
+                                                                             LayoutD,
+                                                                             LayoutLds,
+                                                                             GemmConfig,
+                                                                             BlocksX,
+                                                                             BlocksY,
+                                                                             TBlockX,
+                                                                             TBlockY,
+                                                                             WaveSize,
+                                                                             ArchId>);
+                }
+                else
+                {
+                    return typename Base::KernelFunc(nullptr);
+                }
+            }
+        };
+
+    public:
+        Kernel_PGR1_LB2_MP0_MB_SPK() {}
+        ~Kernel_PGR1_LB2_MP0_MB_SPK() final {}
+
+        // Macro tile size (M x N) of the workgroup
+        std::pair<uint32_t, uint32_t> macroTileSize() const
+        {
+            return std::make_pair(BlockM * BlocksX * Base::mTBlockX
+                                      / Base::DeviceInfo::instance()->warpSize(),
+                                  BlockN * BlocksY * Base::mTBlockY);
+        }
+
+        // Count of K partitions. Unless requested by the harness, split the
+        // K dimension until there are enough workgroups to fill the device.
+        // Each split owns at least one MAC-loop iteration.
+        uint32_t splitCount() const
+        {
+            auto     macroTile = macroTileSize();
+            uint32_t tiles
+                = (Base::mM / std::get<0>(macroTile)) * (Base::mN / std::get<1>(macroTile));
+            uint32_t kIters  = Base::mK / BlockK;
+            uint32_t cuCount = Base::DeviceInfo::instance()->cuCount();
+
+            uint32_t splits = (Base::mSplitK > 0u) ? Base::mSplitK
+                                                   : ceilDiv(cuCount, std::max(tiles, 1u));
+            return std::max(std::min(splits, kIters), 1u);
+        }
+
+        // One workgroup per macro tile per K partition
+        dim3 gridDim() const final
+        {
+            auto macroTile = macroTileSize();
+            return dim3(Base::mM / std::get<0>(macroTile),
+                        Base::mN / std::get<1>(macroTile),
+                        splitCount());
+        }
+
+        // Split-K tiles the problem exactly
+        bool checkSizes() const final
+        {
+            auto macroTile = macroTileSize();
+            return (std::get<0>(macroTile) <= Base::mM) && (std::get<1>(macroTile) <= Base::mN)
+                   && (BlockK <= Base::mK) && (Base::mM % std::get<0>(macroTile) == 0u)
+                   && (Base::mN % std::get<1>(macroTile) == 0u) && (Base::mK % BlockK == 0u);
+        }
+
+        bool checkQuirks() const final
+        {
+            // Don't run the kernel if the threadblock size is not supported
+            auto kernelImplCheck = (kernelImpl() != nullptr);
+
+            return Base::checkQuirks() && Base::template dispatchGuard<TestGuard>()
+                   && kernelImplCheck;
+        }
+
+        // Workspace mode stores one (m x n) partial of ComputeT per split
+        uint64_t workspaceSize() const final
+        {
+            return GemmConfig::AtomicAdd ? 0u
+                                         : static_cast<uint64_t>(splitCount()) * Base::mM
+                                               * Base::mN * sizeof(ComputeT);
+        }
+
+        void launchKernel(typename Base::KernelFunc kernelFunc) const final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            if constexpr(GemmConfig::AtomicAdd)
+            {
+                // Splits accumulate into D, which is cleared with every launch
+                CHECK_HIP_ERROR(
+                    hipMemsetAsync(dataInstance->deviceD().get(),
+                                   0,
+                                   static_cast<uint64_t>(Base::mM) * Base::mN * sizeof(OutputT)));
+                Base::launchKernel(kernelFunc);
+            }
+            else
+            {
+                // Splits write partials to the workspace, which are then reduced into D
+                constexpr uint32_t ReduceBlockSize = 256u;
+                auto               elements = static_cast<uint64_t>(Base::mM) * Base::mN;
+
+                Base::launchKernel(kernelFunc);
+                hipExtLaunchKernelGGL(
+                    (gemm_PGR1_LB2_MP0_MB_SPK_reduce<ComputeT, OutputT, LayoutC, LayoutD>),
+                    dim3(ceilDiv(elements, static_cast<uint64_t>(ReduceBlockSize))),
+                    dim3(ReduceBlockSize),
+                    0, // sharedMemBytes
+                    0, // stream
+                    nullptr, // Event start
+                    nullptr, // event stop
+                    0, // flags
+                    Base::mM,
+                    Base::mN,
+                    splitCount(),
+                    dataInstance->deviceC().get(),
+                    dataInstance->deviceD().get(),
+                    Base::mLdc,
+                    Base::mLdd,
+                    Base::mAlpha,
+                    Base::mBeta,
+                    reinterpret_cast<ComputeT const*>(dataInstance->deviceWorkspace().get()));
+            }
+        }
+
+        // Lds memory usage in bytes
+        uint32_t ldsUsage() const final
+        {
+            // Uses 2 lds blocks for prefetch loop
+            return 2 * sizeof(InputT)
+                   * (Base::mTBlockX / Base::DeviceInfo::instance()->warpSize() * BlocksX * BlockM
+                      + Base::mTBlockY * BlocksY * BlockN)
+                   * BlockK;
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return Base::template dispatchKernelFunc<TestKernelFunc>();
+        }
+
+        std::ostream& printHeader(std::ostream& stream = std::cout) const final
+        {
+            return Base::printHeader(stream << "GemmConfig, LytLds, BlocksX, BlocksY, SplitK, ");
+        }
+
+        std::ostream& printKernel(std::ostream& stream = std::cout) const final
+        {
+            return Base::printKernel(stream << dataTypeToString<GemmConfig>() << ", "
+                                            << dataTypeToString<LayoutLds>() << ", " << BlocksX
+                                            << ", " << BlocksY << ", " << splitCount() << ", ");
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_TEST_DETAIL_KERNEL
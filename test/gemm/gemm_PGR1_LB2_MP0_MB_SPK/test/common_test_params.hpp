@@ -0,0 +1,98 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_COMMON_TEST_PARAMS
+#define ROCWMMA_GEMM_COMMON_TEST_PARAMS
+
+#include "gemm_common_test_params.hpp"
+
+namespace rocwmma
+{
+    ///
+    /// FWD declarations
+    ///
+
+    class KernelGenerator_PGR1_LB2_MP0_MB_SPK;
+
+    namespace CooperativeGemm
+    {
+        namespace SplitK
+        {
+            class LdsNT;
+            class LdsTN;
+            class AtomicLdsNT;
+            class AtomicLdsTN;
+
+        } // namespace SplitK
+
+    } // namespace CooperativeGemm
+
+    ///
+    /// Generalized kernel params for Split-K tests
+    ///
+    struct CommonTestParams : public GemmCommonTestParams
+    {
+        ///
+        /// Split-K GEMM configurations, in both store modes
+        ///
+        using TestGemmConfigsSplitK
+            = std::tuple<std::tuple<typename CooperativeGemm::SplitK::LdsNT>,
+                         std::tuple<typename CooperativeGemm::SplitK::LdsTN>,
+                         std::tuple<typename CooperativeGemm::SplitK::AtomicLdsNT>,
+                         std::tuple<typename CooperativeGemm::SplitK::AtomicLdsTN>>;
+
+        using TestBlocksSplitK = std::tuple<std::tuple<I<1>, I<1>>, std::tuple<I<2>, I<2>>>;
+
+        ///
+        /// Kernel generator impl objects
+        ///
+        using KernelGeneratorImpl = KernelGenerator_PGR1_LB2_MP0_MB_SPK;
+
+        // In addition to the common problem sizes, Split-K is benchmarked
+        // on tall-K problems with too few output tiles to fill the device.
+        static inline std::vector<ProblemSizeT> problemSizes()
+        {
+            auto problems = GemmCommonTestParams::problemSizes();
+            problems.insert(problems.end(),
+                            {
+                                // clang-format off
+                                {64, 64, 8192},
+                                {128, 128, 4096},
+                                {256, 128, 8192},
+#if !ROCWMMA_VALIDATION_TESTS
+                                {128, 128, 65536},
+                                {256, 256, 32768},
+                                {512, 512, 16384},
+#endif // !ROCWMMA_VALIDATION_TESTS
+                                // clang-format on
+                            });
+            return problems;
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_COMMON_TEST_PARAMS
@@ -63,6 +63,9 @@ namespace rocwmma
             */
             struct LdsNT
             {
+                // LDS buffers in the prefetch pipeline
+                static constexpr uint32_t Stages = 2u;
+
                 template <uint32_t BlockM,
                           uint32_t BlockN,
                           uint32_t BlockK,
@@ -111,6 +114,9 @@ namespace rocwmma
 
             struct LdsTN
             {
+                // LDS buffers in the prefetch pipeline
+                static constexpr uint32_t Stages = 2u;
+
                 template <uint32_t BlockM,
                           uint32_t BlockN,
                           uint32_t BlockK,
@@ -159,6 +165,9 @@ namespace rocwmma
 
             struct LdsRF
             {
+                // LDS buffers in the prefetch pipeline
+                static constexpr uint32_t Stages = 2u;
+
                 template <uint32_t BlockM,
                           uint32_t BlockN,
                           uint32_t BlockK,
@@ -222,6 +231,9 @@ namespace rocwmma
             */
             struct LdsNT
             {
+                // LDS buffers in the prefetch pipeline
+                static constexpr uint32_t Stages = 2u;
+
                 template <uint32_t BlockM,
                           uint32_t BlockN,
                           uint32_t BlockK,
@@ -270,6 +282,9 @@ namespace rocwmma
 
             struct LdsTN
             {
+                // LDS buffers in the prefetch pipeline
+                static constexpr uint32_t Stages = 2u;
+
                 template <uint32_t BlockM,
                           uint32_t BlockN,
                           uint32_t BlockK,
@@ -334,6 +349,9 @@ namespace rocwmma
 
             struct LdsNT
             {
+                // LDS buffers in the prefetch pipeline
+                static constexpr uint32_t Stages = 2u;
+
                 template <uint32_t BlockM,
                           uint32_t BlockN,
                           uint32_t BlockK,
@@ -382,6 +400,9 @@ namespace rocwmma
 
             struct LdsTN
             {
+                // LDS buffers in the prefetch pipeline
+                static constexpr uint32_t Stages = 2u;
+
                 template <uint32_t BlockM,
                           uint32_t BlockN,
                           uint32_t BlockK,
@@ -430,6 +451,461 @@ namespace rocwmma
 
         } // namespace WorkgroupLevel
 
+        namespace StreamK
+        {
+            /* Stream-K cooperative GEMMs:
+            *  This GEMM configuration is intended for persistent kernels, where
+            *  each workgroup iterates over a balanced share of the total MAC-loop
+            *  iterations of all output tiles, rather than computing exactly one
+            *  output tile. Partial tiles are combined by a fix-up step.
+            *
+            *  Data movement within each tile is collaborative on wave tiles,
+            *  as in the Wave-Level GEMMs.
+            *
+            *  Class name LDSXY indicates whether X = matrix_a or Y = matrix_b is
+            *  transposed (T) or non-transposed (N) upon writing to LDS memory.
+            */
+            struct LdsNT
+            {
+                template <uint32_t BlockM,
+                          uint32_t BlockN,
+                          uint32_t BlockK,
+                          typename InputT,
+                          typename OutputT,
+                          typename ComputeT,
+                          typename LayoutA,
+                          typename LayoutB,
+                          typename LayoutC,
+                          typename LayoutD,
+                          uint32_t BlocksX,
+                          uint32_t BlocksY,
+                          uint32_t TBlockX = 0,
+                          uint32_t TBlockY = 0>
+                using GlobalMapping
+                    = GlobalMapping::StreamKMapping<GlobalMapping::WaveLevelMapping<BlockM,
+                                                                                    BlockN,
+                                                                                    BlockK,
+                                                                                    InputT,
+                                                                                    OutputT,
+                                                                                    ComputeT,
+                                                                                    LayoutA,
+                                                                                    LayoutB,
+                                                                                    LayoutC,
+                                                                                    LayoutD,
+                                                                                    BlocksX,
+                                                                                    BlocksY,
+                                                                                    TBlockX,
+                                                                                    TBlockY>>;
+
+                template <typename GlobalMapping, typename LayoutLds>
+                using LdsMapping = LocalMapping::LdsMappingNT<GlobalMapping, LayoutLds>;
+
+                template <uint32_t TBlockX = 0, uint32_t TBlockY = 0>
+                using CoopSchedulerA = typename Schedule::SameRowFwd<TBlockX, TBlockY>;
+
+                template <uint32_t TBlockX = 0, uint32_t TBlockY = 0>
+                using CoopSchedulerB = typename Schedule::SameColFwd<TBlockX, TBlockY>;
+
+                template <typename GlobalMapping,
+                          typename LdsMapping,
+                          typename CoopSchedulerA,
+                          typename CoopSchedulerB>
+                using GemmDriver
+                    = GemmDriver<GlobalMapping, LdsMapping, CoopSchedulerA, CoopSchedulerB>;
+            };
+
+            struct LdsTN
+            {
+                template <uint32_t BlockM,
+                          uint32_t BlockN,
+                          uint32_t BlockK,
+                          typename InputT,
+                          typename OutputT,
+                          typename ComputeT,
+                          typename LayoutA,
+                          typename LayoutB,
+                          typename LayoutC,
+                          typename LayoutD,
+                          uint32_t BlocksX,
+                          uint32_t BlocksY,
+                          uint32_t TBlockX = 0,
+                          uint32_t TBlockY = 0>
+                using GlobalMapping
+                    = GlobalMapping::StreamKMapping<GlobalMapping::WaveLevelMapping<BlockM,
+                                                                                    BlockN,
+                                                                                    BlockK,
+                                                                                    InputT,
+                                                                                    OutputT,
+                                                                                    ComputeT,
+                                                                                    LayoutA,
+                                                                                    LayoutB,
+                                                                                    LayoutC,
+                                                                                    LayoutD,
+                                                                                    BlocksX,
+                                                                                    BlocksY,
+                                                                                    TBlockX,
+                                                                                    TBlockY>>;
+
+                template <typename GlobalMapping, typename LayoutLds>
+                using LdsMapping = LocalMapping::LdsMappingTN<GlobalMapping, LayoutLds>;
+
+                template <uint32_t TBlockX = 0, uint32_t TBlockY = 0>
+                using CoopSchedulerA = typename Schedule::SameRowFwd<TBlockX, TBlockY>;
+
+                template <uint32_t TBlockX = 0, uint32_t TBlockY = 0>
+                using CoopSchedulerB = typename Schedule::SameColFwd<TBlockX, TBlockY>;
+
+                template <typename GlobalMapping,
+                          typename LdsMapping,
+                          typename CoopSchedulerA,
+                          typename CoopSchedulerB>
+                using GemmDriver
+                    = GemmDriver<GlobalMapping, LdsMapping, CoopSchedulerA, CoopSchedulerB>;
+            };
+
+        } // namespace StreamK
+
+        namespace SplitK
+        {
+            /* Split-K cooperative GEMMs:
+            *  This GEMM configuration is intended for problems with deep K and
+            *  few output tiles, which would otherwise leave most of the device
+            *  idle. The K dimension of each output tile is partitioned across
+            *  several workgroups, each producing a partial sum of the tile.
+            *
+            *  Partial sums are reduced by one of two store modes:
+            *  - LdsXY: each split writes its partial sum to a workspace, then a
+            *    separate reduction pass sums the splits in a fixed order. The
+            *    result is deterministic.
+            *  - AtomicLdsXY: each split atomically accumulates its partial sum
+            *    into D. No workspace or extra pass is required, however the
+            *    order of accumulation is not deterministic.
+            *
+            *  Data movement within each tile is collaborative on wave tiles,
+            *  as in the Wave-Level GEMMs.
+            *
+            *  Class name LDSXY indicates whether X = matrix_a or Y = matrix_b is
+            *  transposed (T) or non-transposed (N) upon writing to LDS memory.
+            */
+            struct LdsNT
+            {
+                // Partial sums of each split are reduced through the workspace
+                static constexpr bool AtomicAdd = false;
+
+                template <uint32_t BlockM,
+                          uint32_t BlockN,
+                          uint32_t BlockK,
+                          typename InputT,
+                          typename OutputT,
+                          typename ComputeT,
+                          typename LayoutA,
+                          typename LayoutB,
+                          typename LayoutC,
+                          typename LayoutD,
+                          uint32_t BlocksX,
+                          uint32_t BlocksY,
+                          uint32_t TBlockX = 0,
+                          uint32_t TBlockY = 0>
+                using GlobalMapping
+                    = GlobalMapping::SplitKMapping<GlobalMapping::WaveLevelMapping<BlockM,
+                                                                                   BlockN,
+                                                                                   BlockK,
+                                                                                   InputT,
+                                                                                   OutputT,
+                                                                                   ComputeT,
+                                                                                   LayoutA,
+                                                                                   LayoutB,
+                                                                                   LayoutC,
+                                                                                   LayoutD,
+                                                                                   BlocksX,
+                                                                                   BlocksY,
+                                                                                   TBlockX,
+                                                                                   TBlockY>>;
+
+                template <typename GlobalMapping, typename LayoutLds>
+                using LdsMapping = LocalMapping::LdsMappingNT<GlobalMapping, LayoutLds>;
+
+                template <uint32_t TBlockX = 0, uint32_t TBlockY = 0>
+                using CoopSchedulerA = typename Schedule::SameRowFwd<TBlockX, TBlockY>;
+
+                template <uint32_t TBlockX = 0, uint32_t TBlockY = 0>
+                using CoopSchedulerB = typename Schedule::SameColFwd<TBlockX, TBlockY>;
+
+                template <typename GlobalMapping,
+                          typename LdsMapping,
+                          typename CoopSchedulerA,
+                          typename CoopSchedulerB>
+                using GemmDriver
+                    = GemmDriver<GlobalMapping, LdsMapping, CoopSchedulerA, CoopSchedulerB>;
+            };
+
+            struct LdsTN
+            {
+                // Partial sums of each split are reduced through the workspace
+                static constexpr bool AtomicAdd = false;
+
+                template <uint32_t BlockM,
+                          uint32_t BlockN,
+                          uint32_t BlockK,
+                          typename InputT,
+                          typename OutputT,
+                          typename ComputeT,
+                          typename LayoutA,
+                          typename LayoutB,
+                          typename LayoutC,
+                          typename LayoutD,
+                          uint32_t BlocksX,
+                          uint32_t BlocksY,
+                          uint32_t TBlockX = 0,
+                          uint32_t TBlockY = 0>
+                using GlobalMapping
+                    = GlobalMapping::SplitKMapping<GlobalMapping::WaveLevelMapping<BlockM,
+                                                                                   BlockN,
+                                                                                   BlockK,
+                                                                                   InputT,
+                                                                                   OutputT,
+                                                                                   ComputeT,
+                                                                                   LayoutA,
+                                                                                   LayoutB,
+                                                                                   LayoutC,
+                                                                                   LayoutD,
+                                                                                   BlocksX,
+                                                                                   BlocksY,
+                                                                                   TBlockX,
+                                                                                   TBlockY>>;
+
+                template <typename GlobalMapping, typename LayoutLds>
+                using LdsMapping = LocalMapping::LdsMappingTN<GlobalMapping, LayoutLds>;
+
+                template <uint32_t TBlockX = 0, uint32_t TBlockY = 0>
+                using CoopSchedulerA = typename Schedule::SameRowFwd<TBlockX, TBlockY>;
+
+                template <uint32_t TBlockX = 0, uint32_t TBlockY = 0>
+                using CoopSchedulerB = typename Schedule::SameColFwd<TBlockX, TBlockY>;
+
+                template <typename GlobalMapping,
+                          typename LdsMapping,
+                          typename CoopSchedulerA,
+                          typename CoopSchedulerB>
+                using GemmDriver
+                    = GemmDriver<GlobalMapping, LdsMapping, CoopSchedulerA, CoopSchedulerB>;
+            };
+
+            struct AtomicLdsNT : public LdsNT
+            {
+                // Partial sums of each split are accumulated atomically into D
+                static constexpr bool AtomicAdd = true;
+            };
+
+            struct AtomicLdsTN : public LdsTN
+            {
+                // Partial sums of each split are accumulated atomically into D
+                static constexpr bool AtomicAdd = true;
+            };
+
+        } // namespace SplitK
+
+        namespace Rasterized
+        {
+            /* Rasterized cooperative GEMMs:
+            *  This GEMM configuration re-maps the output macro tile computed by
+            *  each workgroup with a Rasterization order, in place of the default
+            *  dispatch order of the underlying GemmConfig. The order in which
+            *  concurrently resident workgroups visit C tiles determines how many
+            *  A and B tiles they share through L2:
+            *
+            *  - GroupedM: bands of GroupM tile rows, walked column by column
+            *  - Morton: Z-order curve within square windows of tiles
+            *  - Hilbert: Hilbert curve within square windows of tiles
+            *
+            *  All other data movement is inherited from the GemmConfig.
+            */
+            template <typename GemmConfig, typename RasterOrder>
+            struct RasterizedConfig : public GemmConfig
+            {
+                template <uint32_t BlockM,
+                          uint32_t BlockN,
+                          uint32_t BlockK,
+                          typename InputT,
+                          typename OutputT,
+                          typename ComputeT,
+                          typename LayoutA,
+                          typename LayoutB,
+                          typename LayoutC,
+                          typename LayoutD,
+                          uint32_t BlocksX,
+                          uint32_t BlocksY,
+                          uint32_t TBlockX = 0,
+                          uint32_t TBlockY = 0>
+                using GlobalMapping = GlobalMapping::RasterizedMapping<
+                    typename GemmConfig::template GlobalMapping<BlockM,
+                                                                BlockN,
+                                                                BlockK,
+                                                                InputT,
+                                                                OutputT,
+                                                                ComputeT,
+                                                                LayoutA,
+                                                                LayoutB,
+                                                                LayoutC,
+                                                                LayoutD,
+                                                                BlocksX,
+                                                                BlocksY,
+                                                                TBlockX,
+                                                                TBlockY>,
+                    RasterOrder>;
+            };
+
+            struct GroupedM8WaveLdsNT
+                : public RasterizedConfig<WaveLevel::LdsNT, Rasterization::GroupedM<8u>>
+            {
+            };
+
+            struct Morton8x8WaveLdsNT
+                : public RasterizedConfig<WaveLevel::LdsNT, Rasterization::Morton<3u>>
+            {
+            };
+
+            struct Hilbert8x8WaveLdsNT
+                : public RasterizedConfig<WaveLevel::LdsNT, Rasterization::Hilbert<3u>>
+            {
+            };
+
+        } // namespace Rasterized
+
+        namespace Pipelined
+        {
+            /* Pipelined cooperative GEMMs:
+            *  This GEMM configuration deepens the LDS prefetch pipeline of the
+            *  underlying GemmConfig from 2 to Stages buffers. The global read of
+            *  each k step is issued (Stages - 1) iterations before it is consumed,
+            *  into a ring of (Stages - 2) register buffers, and is written to LDS
+            *  in the iteration before it is read. Up to (Stages - 2) global reads
+            *  are then in flight, trading LDS and VGPRs for latency hiding.
+            *
+            *  All other data movement is inherited from the GemmConfig.
+            */
+            template <typename GemmConfig, uint32_t PipelineStages>
+            struct PipelinedConfig : public GemmConfig
+            {
+                static_assert(PipelineStages >= 2u, "Pipelining requires at least 2 stages");
+
+                // LDS buffers in the prefetch pipeline
+                static constexpr uint32_t Stages = PipelineStages;
+            };
+
+            struct Stages3WaveLdsNT : public PipelinedConfig<WaveLevel::LdsNT, 3u>
+            {
+            };
+
+            struct Stages3WaveLdsTN : public PipelinedConfig<WaveLevel::LdsTN, 3u>
+            {
+            };
+
+            struct Stages4WaveLdsNT : public PipelinedConfig<WaveLevel::LdsNT, 4u>
+            {
+            };
+
+            struct Stages4WaveLdsTN : public PipelinedConfig<WaveLevel::LdsTN, 4u>
+            {
+            };
+
+        } // namespace Pipelined
+
+        namespace ProducerConsumer
+        {
+            /* Producer / consumer cooperative GEMMs:
+            *  This GEMM configuration specializes waves by role. The workgroup is
+            *  launched with ProducerRows extra threadIdx.y rows of producer waves
+            *  on top of the TBlockX x TBlockY consumer waves:
+            *
+            *  - Producers collaborate to stream the A/B macro tiles into a ring
+            *    of Stages LDS buffers, and never compute.
+            *  - Consumers read MFMA fragments from LDS, compute and write D, and
+            *    never read A/B from global memory.
+            *
+            *  Instead of workgroup barriers, each LDS stage has a pair of 'full'
+            *  and 'empty' wave counters in LDS, so that producers may run ahead of
+            *  consumers by up to Stages k steps.
+            *
+            *  Macro tile data movement is inherited from the Workgroup-Level GEMMs.
+            */
+            template <typename GemmConfig, uint32_t ProducerWaveRows, uint32_t PipelineStages>
+            struct ProducerConsumerConfig : public GemmConfig
+            {
+                static_assert(PipelineStages >= 2u, "Pipelining requires at least 2 stages");
+
+                // LDS buffers in the prefetch pipeline
+                static constexpr uint32_t Stages = PipelineStages;
+
+                // Extra threadIdx.y rows of producer waves
+                static constexpr uint32_t ProducerRows = ProducerWaveRows;
+
+                template <uint32_t TBlockX, uint32_t TBlockY>
+                using CoopSchedulerA =
+                    typename Schedule::ProducerRowMajor<TBlockX, TBlockY, ProducerRows>;
+
+                template <uint32_t TBlockX, uint32_t TBlockY>
+                using CoopSchedulerB =
+                    typename Schedule::ProducerRowMajor<TBlockX, TBlockY, ProducerRows>;
+            };
+
+            struct LdsNT : public ProducerConsumerConfig<WorkgroupLevel::LdsNT, 1u, 2u>
+            {
+            };
+
+            struct LdsTN : public ProducerConsumerConfig<WorkgroupLevel::LdsTN, 1u, 2u>
+            {
+            };
+
+            struct Stages4LdsNT : public ProducerConsumerConfig<WorkgroupLevel::LdsNT, 1u, 4u>
+            {
+            };
+
+            struct Stages4LdsTN : public ProducerConsumerConfig<WorkgroupLevel::LdsTN, 1u, 4u>
+            {
+            };
+
+        } // namespace ProducerConsumer
+
+        namespace Swizzled
+        {
+            /* Swizzled cooperative GEMMs:
+            *  This GEMM configuration xor swizzles the K-contiguous LDS layouts of
+            *  the underlying GemmConfig, which otherwise have bank conflicts on
+            *  local reads (and writes):
+            *
+            *  - LdsNT with row_major LDS
+            *  - LdsTN with col_major LDS
+            *
+            *  LDS layouts which are lane-contiguous are already conflict free, and
+            *  are left unchanged. All other data movement is inherited from the
+            *  GemmConfig.
+            */
+            template <typename GemmConfig, template <typename, typename, bool> class LdsMappingT>
+            struct SwizzledConfig : public GemmConfig
+            {
+                template <typename GlobalMapping, typename LayoutLds>
+                using LdsMapping = LdsMappingT<GlobalMapping, LayoutLds, true>;
+            };
+
+            struct BlockLdsNT : public SwizzledConfig<BlockLevel::LdsNT, LocalMapping::LdsMappingNT>
+            {
+            };
+
+            struct BlockLdsTN : public SwizzledConfig<BlockLevel::LdsTN, LocalMapping::LdsMappingTN>
+            {
+            };
+
+            struct WaveLdsNT : public SwizzledConfig<WaveLevel::LdsNT, LocalMapping::LdsMappingNT>
+            {
+            };
+
+            struct WaveLdsTN : public SwizzledConfig<WaveLevel::LdsTN, LocalMapping::LdsMappingTN>
+            {
+            };
+
+        } // namespace Swizzled
+
     } // namespace CooperativeGemm
 
     template <>
@@ -474,6 +950,143 @@ namespace rocwmma
         return "Workgroup_LdsTN";
     }
 
+    template <>
+    constexpr const char* dataTypeToString<typename CooperativeGemm::StreamK::LdsNT>()
+    {
+        return "StreamK_LdsNT";
+    }
+
+    template <>
+    constexpr const char* dataTypeToString<typename CooperativeGemm::StreamK::LdsTN>()
+    {
+        return "StreamK_LdsTN";
+    }
+
+    template <>
+    constexpr const char* dataTypeToString<typename CooperativeGemm::SplitK::LdsNT>()
+    {
+        return "SplitK_LdsNT";
+    }
+
+    template <>
+    constexpr const char* dataTypeToString<typename CooperativeGemm::SplitK::LdsTN>()
+    {
+        return "SplitK_LdsTN";
+    }
+
+    template <>
+    constexpr const char* dataTypeToString<typename CooperativeGemm::SplitK::AtomicLdsNT>()
+    {
+        return "SplitK_AtomicLdsNT";
+    }
+
+    template <>
+    constexpr const char* dataTypeToString<typename CooperativeGemm::SplitK::AtomicLdsTN>()
+    {
+        return "SplitK_AtomicLdsTN";
+    }
+
+    template <>
+    constexpr const char*
+        dataTypeToString<typename CooperativeGemm::Rasterized::GroupedM8WaveLdsNT>()
+    {
+        return "GroupedM8_Wave_LdsNT";
+    }
+
+    template <>
+    constexpr const char*
+        dataTypeToString<typename CooperativeGemm::Rasterized::Morton8x8WaveLdsNT>()
+    {
+        return "Morton8x8_Wave_LdsNT";
+    }
+
+    template <>
+    constexpr const char*
+        dataTypeToString<typename CooperativeGemm::Rasterized::Hilbert8x8WaveLdsNT>()
+    {
+        return "Hilbert8x8_Wave_LdsNT";
+    }
+
+    template <>
+    constexpr const char*
+        dataTypeToString<typename CooperativeGemm::Pipelined::Stages3WaveLdsNT>()
+    {
+        return "Stages3_Wave_LdsNT";
+    }
+
+    template <>
+    constexpr const char*
+        dataTypeToString<typename CooperativeGemm::Pipelined::Stages3WaveLdsTN>()
+    {
+        return "Stages3_Wave_LdsTN";
+    }
+
+    template <>
+    constexpr const char*
+        dataTypeToString<typename CooperativeGemm::Pipelined::Stages4WaveLdsNT>()
+    {
+        return "Stages4_Wave_LdsNT";
+    }
+
+    template <>
+    constexpr const char*
+        dataTypeToString<typename CooperativeGemm::Pipelined::Stages4WaveLdsTN>()
+    {
+        return "Stages4_Wave_LdsTN";
+    }
+
+    template <>
+    constexpr const char*
+        dataTypeToString<typename CooperativeGemm::ProducerConsumer::LdsNT>()
+    {
+        return "ProducerConsumer_LdsNT";
+    }
+
+    template <>
+    constexpr const char*
+        dataTypeToString<typename CooperativeGemm::ProducerConsumer::LdsTN>()
+    {
+        return "ProducerConsumer_LdsTN";
+    }
+
+    template <>
+    constexpr const char*
+        dataTypeToString<typename CooperativeGemm::ProducerConsumer::Stages4LdsNT>()
+    {
+        return "ProducerConsumer_Stages4_LdsNT";
+    }
+
+    template <>
+    constexpr const char*
+        dataTypeToString<typename CooperativeGemm::ProducerConsumer::Stages4LdsTN>()
+    {
+        return "ProducerConsumer_Stages4_LdsTN";
+    }
+
+    template <>
+    constexpr const char* dataTypeToString<typename CooperativeGemm::Swizzled::BlockLdsNT>()
+    {
+        return "Swizzled_Block_LdsNT";
+    }
+
+    template <>
+    constexpr const char* dataTypeToString<typename CooperativeGemm::Swizzled::BlockLdsTN>()
+    {
+        return "Swizzled_Block_LdsTN";
+    }
+
+    template <>
+    constexpr const char* dataTypeToString<typename CooperativeGemm::Swizzled::WaveLdsNT>()
+    {
+        return "Swizzled_Wave_LdsNT";
+    }
+
+    template <>
+    constexpr const char* dataTypeToString<typename CooperativeGemm::Swizzled::WaveLdsTN>()
+    {
+        return "Swizzled_Wave_LdsTN";
+    }
+
 } // namespace rocwmma
 
 #endif // GEMM_CONFIG_HPP
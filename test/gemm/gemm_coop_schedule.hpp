@@ -50,11 +50,22 @@ namespace rocwmma
 
                 constexpr static inline auto waveIndex()
                 {
-                    return get<1>(WaveSpace::localWaveCoord());
+                    return waveIndex(WaveSpace::localWaveCoord(), WaveSpace::workgroupDim());
                 }
                 constexpr static inline uint32_t waveCount()
                 {
-                    return get<1>(WaveSpace::workgroupDim());
+                    return waveCount(WaveSpace::workgroupDim());
+                }
+
+                ROCWMMA_HOST_DEVICE constexpr static inline auto
+                    waveIndex(Coord2d const& localWaveCoord, Coord2d const& workgroupDim)
+                {
+                    return get<1>(localWaveCoord);
+                }
+                ROCWMMA_HOST_DEVICE constexpr static inline uint32_t
+                    waveCount(Coord2d const& workgroupDim)
+                {
+                    return get<1>(workgroupDim);
                 }
             };
 
@@ -73,11 +84,22 @@ namespace rocwmma
 
                 constexpr static inline auto waveIndex()
                 {
-                    return get<0>(WaveSpace::localWaveCoord());
+                    return waveIndex(WaveSpace::localWaveCoord(), WaveSpace::workgroupDim());
                 }
                 constexpr static inline uint32_t waveCount()
                 {
-                    return get<0>(WaveSpace::workgroupDim());
+                    return waveCount(WaveSpace::workgroupDim());
+                }
+
+                ROCWMMA_HOST_DEVICE constexpr static inline auto
+                    waveIndex(Coord2d const& localWaveCoord, Coord2d const& workgroupDim)
+                {
+                    return get<0>(localWaveCoord);
+                }
+                ROCWMMA_HOST_DEVICE constexpr static inline uint32_t
+                    waveCount(Coord2d const& workgroupDim)
+                {
+                    return get<0>(workgroupDim);
                 }
             };
 
@@ -92,14 +114,22 @@ namespace rocwmma
                 using WaveSpace = detail::WaveSpace<TBlockX, TBlockY>;
                 constexpr static inline auto waveIndex()
                 {
-                    auto localWaveCoord = WaveSpace::localWaveCoord();
-                    return get<0>(localWaveCoord) * get<1>(WaveSpace::workgroupDim())
-                           + get<1>(localWaveCoord);
+                    return waveIndex(WaveSpace::localWaveCoord(), WaveSpace::workgroupDim());
                 }
                 constexpr static inline uint32_t waveCount()
                 {
-                    auto wgDim = WaveSpace::workgroupDim();
-                    return get<0>(wgDim) * get<1>(wgDim);
+                    return waveCount(WaveSpace::workgroupDim());
+                }
+
+                ROCWMMA_HOST_DEVICE constexpr static inline auto
+                    waveIndex(Coord2d const& localWaveCoord, Coord2d const& workgroupDim)
+                {
+                    return get<0>(localWaveCoord) * get<1>(workgroupDim) + get<1>(localWaveCoord);
+                }
+                ROCWMMA_HOST_DEVICE constexpr static inline uint32_t
+                    waveCount(Coord2d const& workgroupDim)
+                {
+                    return get<0>(workgroupDim) * get<1>(workgroupDim);
                 }
             };
 
@@ -115,14 +145,71 @@ namespace rocwmma
 
                 constexpr static inline auto waveIndex()
                 {
-                    auto localWaveCoord = WaveSpace::localWaveCoord();
-                    return get<1>(localWaveCoord) * get<0>(WaveSpace::workgroupDim())
-                           + get<0>(localWaveCoord);
+                    return waveIndex(WaveSpace::localWaveCoord(), WaveSpace::workgroupDim());
                 }
                 constexpr static inline uint32_t waveCount()
                 {
-                    auto wgDim = WaveSpace::workgroupDim();
-                    return get<0>(wgDim) * get<1>(wgDim);
+                    return waveCount(WaveSpace::workgroupDim());
+                }
+
+                ROCWMMA_HOST_DEVICE constexpr static inline auto
+                    waveIndex(Coord2d const& localWaveCoord, Coord2d const& workgroupDim)
+                {
+                    return get<1>(localWaveCoord) * get<0>(workgroupDim) + get<0>(localWaveCoord);
+                }
+                ROCWMMA_HOST_DEVICE constexpr static inline uint32_t
+                    waveCount(Coord2d const& workgroupDim)
+                {
+                    return get<0>(workgroupDim) * get<1>(workgroupDim);
+                }
+            };
+
+            // Only producer waves are collaborative.
+            // Producers are launched as ProducerRows extra threadIdx.y rows, after
+            // the TBlockY rows of consumer waves which are not scheduled.
+            // E.g. Wg = (128, 2 + 1) = 2x2 consumer waves + 2x1 producer waves
+            // (0, 0)   (0, 1)   (0, 2)
+            // (1, 0)   (1, 1)   (1, 2)
+            //                     ||
+            //                     \/
+            //   Share Schedule: i0 = (0, 2), i1 = (1, 2), count = 2
+            template <uint32_t TBlockX, uint32_t TBlockY, uint32_t ProducerRows>
+            struct ProducerRowMajor
+            {
+                static_assert((TBlockX > 0u) && (TBlockY > 0u),
+                              "Producer schedule requires compile-time TBlockX/Y");
+                static_assert(ProducerRows > 0u, "Must have at least one row of producers");
+
+                using WaveSpace = detail::WaveSpace<TBlockX, TBlockY>;
+
+                constexpr static inline bool isProducer()
+                {
+                    return isProducer(WaveSpace::localWaveCoord());
+                }
+                constexpr static inline auto waveIndex()
+                {
+                    return waveIndex(WaveSpace::localWaveCoord(), WaveSpace::workgroupDim());
+                }
+                constexpr static inline uint32_t waveCount()
+                {
+                    return waveCount(WaveSpace::workgroupDim());
+                }
+
+                ROCWMMA_HOST_DEVICE constexpr static inline bool
+                    isProducer(Coord2d const& localWaveCoord)
+                {
+                    return get<1>(localWaveCoord) >= TBlockY;
+                }
+                ROCWMMA_HOST_DEVICE constexpr static inline auto
+                    waveIndex(Coord2d const& localWaveCoord, Coord2d const& workgroupDim)
+                {
+                    return (get<1>(localWaveCoord) - TBlockY) * get<0>(workgroupDim)
+                           + get<0>(localWaveCoord);
+                }
+                ROCWMMA_HOST_DEVICE constexpr static inline uint32_t
+                    waveCount(Coord2d const& workgroupDim)
+                {
+                    return ProducerRows * get<0>(workgroupDim);
                 }
             };
 
@@ -137,12 +224,31 @@ namespace rocwmma
             {
             };
 
+            // Producer schedules always have constexpr waveCount();
+            template <uint32_t TBlockX, uint32_t TBlockY, uint32_t ProducerRows>
+            struct WaveCountIsConstexpr<ProducerRowMajor<TBlockX, TBlockY, ProducerRows>>
+                : public std::true_type
+            {
+            };
+
             // Schedule with TBlockX/Y = (0,0) values does not have constexpr waveCount();
             template <template <uint32_t, uint32_t> class Schedule>
             struct WaveCountIsConstexpr<Schedule<0u, 0u>> : public std::false_type
             {
             };
 
+            // Rows of waves launched after the TBlockY rows of consumer waves
+            template <class Schedule>
+            struct ProducerRowCount : public std::integral_constant<uint32_t, 0u>
+            {
+            };
+
+            template <uint32_t TBlockX, uint32_t TBlockY, uint32_t ProducerRows>
+            struct ProducerRowCount<ProducerRowMajor<TBlockX, TBlockY, ProducerRows>>
+                : public std::integral_constant<uint32_t, ProducerRows>
+            {
+            };
+
         } // namespace Schedule
 
     } // namespace CooperativeGemm
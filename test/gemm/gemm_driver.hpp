@@ -144,6 +144,28 @@ namespace rocwmma
                                                        MfmaFragD const&          fragD,
                                                        uint32_t                  ldd);
 
+            // Global D atomic accumulation (D += frag) non-cooperative
+            // Single or BlocksX * BlocksY frags
+            template <uint32_t BlocksX, uint32_t BlocksY>
+            __device__ static inline void
+                globalAtomicAddD(GetDataType_t<MfmaFragD>* gAddrD,
+                                 MfmaFragD const (&fragsD)[BlocksX][BlocksY],
+                                 uint32_t                  ldd);
+            __device__ static inline void globalAtomicAddD(GetDataType_t<MfmaFragD>* gAddrD,
+                                                           MfmaFragD const&          fragD,
+                                                           uint32_t                  ldd);
+
+            // Global writes of unscaled accumulation frags, in the data layout of D
+            // Single or BlocksX * BlocksY frags
+            template <uint32_t BlocksX, uint32_t BlocksY>
+            __device__ static inline void
+                globalWriteAcc(GetDataType_t<MfmaFragAcc>* gAddrAcc,
+                               MfmaFragAcc const (&fragsAcc)[BlocksX][BlocksY],
+                               uint32_t                    ldd);
+            __device__ static inline void globalWriteAcc(GetDataType_t<MfmaFragAcc>* gAddrAcc,
+                                                         MfmaFragAcc const&          fragAcc,
+                                                         uint32_t                    ldd);
+
             ///
             /// Local R/W
             ///
@@ -219,6 +241,60 @@ namespace rocwmma
                                                      GetDataType_t<MfmaFragAcc> beta,
                                                      MfmaFragC const&           fragC);
 
+            ///
+            /// Workspace R/W
+            ///
+
+            // Accumulation frags are written to / read from a global workspace in
+            // register order, interleaved across all threads of the workgroup such
+            // that each access is coalesced. Workspace data is therefore only
+            // meaningful to workgroups of the same dimensions.
+            // Workspace footprint is the size of the macro tile, in ComputeT.
+            template <uint32_t BlocksX, uint32_t BlocksY>
+            __device__ static inline void
+                workspaceWriteAcc(GetDataType_t<MfmaFragAcc>* wsAddr,
+                                  MfmaFragAcc const (&fragsAcc)[BlocksX][BlocksY]);
+
+            // Performs acc += workspace
+            template <uint32_t BlocksX, uint32_t BlocksY>
+            __device__ static inline void
+                workspaceAccumAcc(MfmaFragAcc (&fragsAcc)[BlocksX][BlocksY],
+                                  GetDataType_t<MfmaFragAcc> const* wsAddr);
+
+            ///
+            /// Pipeline stages
+            ///
+
+            // Base address of the LDS buffer holding the given k step, within a ring
+            // of Stages buffers of stageSize elements each.
+            template <uint32_t Stages, typename DataT>
+            __device__ static inline DataT*
+                ldsStagePtr(DataT* ldsBase, uint32_t stageSize, uint32_t kStep);
+
+            ///
+            /// Inter-workgroup synchronization
+            ///
+
+            // Publishes all prior global writes of the workgroup, then raises the flag.
+            __device__ static inline void signalWorkgroup(uint32_t* flag);
+
+            // Waits for the flag to be raised by another workgroup, and resets it.
+            // All workgroups involved must be co-resident on the device.
+            __device__ static inline void waitWorkgroup(uint32_t* flag);
+
+            ///
+            /// Inter-wave synchronization
+            ///
+
+            // Waits for all prior LDS accesses of the wave to complete, then increments
+            // the LDS counter once on behalf of the wave.
+            __device__ static inline void arriveWave(uint32_t* ldsCounter);
+
+            // Waits until the LDS counter has reached at least the target count.
+            // Counters are monotonic, so that a single counter may be re-used for
+            // each round of a pipeline stage without being reset.
+            __device__ static inline void waitWave(uint32_t* ldsCounter, uint32_t target);
+
             ///
             /// Wave synchronization
             ///
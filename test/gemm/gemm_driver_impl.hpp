@@ -30,6 +30,7 @@
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 #include <rocwmma/rocwmma.hpp>
 #include <rocwmma/rocwmma_coop.hpp>
+#include <rocwmma/rocwmma_epilogue.hpp>
 #include <rocwmma/rocwmma_transforms.hpp>
 #pragma GCC diagnostic pop
 
@@ -95,6 +96,27 @@ namespace rocwmma
                                                              SplitCountB>(
                         ldsAddr, lwFragB, ldlds, CoopSchedulerB::waveIndex());
                 }
+
+                // Swizzled stores have no split count
+                template <typename LWFragA, typename Swizzle>
+                __device__ static inline void localWriteCoopA(GetDataType_t<LWFragA>* ldsAddr,
+                                                              LWFragA const&          lwFragA,
+                                                              uint32_t                ldlds,
+                                                              Swizzle                 swizzle)
+                {
+                    rocwmma::template store_matrix_coop_sync<CoopSchedulerA::waveCount()>(
+                        ldsAddr, lwFragA, ldlds, CoopSchedulerA::waveIndex(), swizzle);
+                }
+
+                template <typename LWFragB, typename Swizzle>
+                __device__ static inline void localWriteCoopB(GetDataType_t<LWFragB>* ldsAddr,
+                                                              LWFragB const&          lwFragB,
+                                                              uint32_t                ldlds,
+                                                              Swizzle                 swizzle)
+                {
+                    rocwmma::template store_matrix_coop_sync<CoopSchedulerB::waveCount()>(
+                        ldsAddr, lwFragB, ldlds, CoopSchedulerB::waveIndex(), swizzle);
+                }
             };
 
             template <typename CoopSchedulerA,
@@ -154,6 +176,35 @@ namespace rocwmma
                                                     CoopSchedulerB::waveCount(),
                                                     SplitCountB);
                 }
+
+                // Swizzled stores have no split count
+                template <typename LWFragA, typename Swizzle>
+                __device__ static inline void localWriteCoopA(GetDataType_t<LWFragA>* ldsAddr,
+                                                              LWFragA const&          lwFragA,
+                                                              uint32_t                ldlds,
+                                                              Swizzle                 swizzle)
+                {
+                    rocwmma::store_matrix_coop_sync(ldsAddr,
+                                                    lwFragA,
+                                                    ldlds,
+                                                    CoopSchedulerA::waveIndex(),
+                                                    CoopSchedulerA::waveCount(),
+                                                    swizzle);
+                }
+
+                template <typename LWFragB, typename Swizzle>
+                __device__ static inline void localWriteCoopB(GetDataType_t<LWFragB>* ldsAddr,
+                                                              LWFragB const&          lwFragB,
+                                                              uint32_t                ldlds,
+                                                              Swizzle                 swizzle)
+                {
+                    rocwmma::store_matrix_coop_sync(ldsAddr,
+                                                    lwFragB,
+                                                    ldlds,
+                                                    CoopSchedulerB::waveIndex(),
+                                                    CoopSchedulerB::waveCount(),
+                                                    swizzle);
+                }
             };
         }
 
@@ -225,10 +276,18 @@ namespace rocwmma
         {
             using CoopApiSelector
                 = detail::CoopApiSelector<CoopSchedulerA, CoopSchedulerB, splitCountA, splitCountB>;
-            CoopApiSelector::localWriteCoopA(
-                ldsAddr,
-                LdsMapping::template formatLWFragA<CoopSchedulerA::waveCount()>(grFragA),
-                ldlds);
+            auto lwFragA
+                = LdsMapping::template formatLWFragA<CoopSchedulerA::waveCount()>(grFragA);
+
+            if constexpr(LdsMapping::IsSwizzled)
+            {
+                CoopApiSelector::localWriteCoopA(
+                    ldsAddr, lwFragA, ldlds, typename LdsMapping::Swizzle{});
+            }
+            else
+            {
+                CoopApiSelector::localWriteCoopA(ldsAddr, lwFragA, ldlds);
+            }
         }
 
         template <GemmDriverT>
@@ -250,17 +309,35 @@ namespace rocwmma
         {
             using CoopApiSelector
                 = detail::CoopApiSelector<CoopSchedulerA, CoopSchedulerB, splitCountA, splitCountB>;
-            CoopApiSelector::localWriteCoopB(
-                ldsAddr,
-                LdsMapping::template formatLWFragB<CoopSchedulerB::waveCount()>(grFragB),
-                ldlds);
+            auto lwFragB
+                = LdsMapping::template formatLWFragB<CoopSchedulerB::waveCount()>(grFragB);
+
+            if constexpr(LdsMapping::IsSwizzled)
+            {
+                CoopApiSelector::localWriteCoopB(
+                    ldsAddr, lwFragB, ldlds, typename LdsMapping::Swizzle{});
+            }
+            else
+            {
+                CoopApiSelector::localWriteCoopB(ldsAddr, lwFragB, ldlds);
+            }
         }
 
         template <GemmDriverT>
         __device__ inline void GemmDriver<GemmDriverT_impl>::localReadA(
             MfmaFragA& fragsA, GetDataType_t<MfmaFragA> const* ldsAddrA, uint32_t ldlds)
         {
-            rocwmma::load_matrix_sync(reinterpret_cast<LRFragA&>(fragsA), ldsAddrA, ldlds);
+            if constexpr(LdsMapping::IsSwizzled)
+            {
+                rocwmma::load_matrix_sync(reinterpret_cast<LRFragA&>(fragsA),
+                                          ldsAddrA,
+                                          ldlds,
+                                          typename LdsMapping::Swizzle{});
+            }
+            else
+            {
+                rocwmma::load_matrix_sync(reinterpret_cast<LRFragA&>(fragsA), ldsAddrA, ldlds);
+            }
         }
 
         template <GemmDriverT>
@@ -281,7 +358,17 @@ namespace rocwmma
         __device__ inline void GemmDriver<GemmDriverT_impl>::localReadB(
             MfmaFragB& fragsB, GetDataType_t<MfmaFragB> const* ldsAddrB, uint32_t ldlds)
         {
-            rocwmma::load_matrix_sync(reinterpret_cast<LRFragB&>(fragsB), ldsAddrB, ldlds);
+            if constexpr(LdsMapping::IsSwizzled)
+            {
+                rocwmma::load_matrix_sync(reinterpret_cast<LRFragB&>(fragsB),
+                                          ldsAddrB,
+                                          ldlds,
+                                          typename LdsMapping::Swizzle{});
+            }
+            else
+            {
+                rocwmma::load_matrix_sync(reinterpret_cast<LRFragB&>(fragsB), ldsAddrB, ldlds);
+            }
         }
 
         template <GemmDriverT>
@@ -416,6 +503,79 @@ namespace rocwmma
             }
         }
 
+        template <GemmDriverT>
+        __device__ inline void GemmDriver<GemmDriverT_impl>::globalAtomicAddD(
+            GetDataType_t<MfmaFragD>* gAddrD, MfmaFragD const& fragD, uint32_t ldd)
+        {
+            rocwmma::store_matrix_atomic_add_sync(gAddrD, fragD, ldd);
+        }
+
+        template <GemmDriverT>
+        template <uint32_t BlocksX, uint32_t BlocksY>
+        __device__ inline void GemmDriver<GemmDriverT_impl>::globalAtomicAddD(
+            GetDataType_t<MfmaFragD>* gAddrD,
+            MfmaFragD const (&fragsD)[BlocksX][BlocksY],
+            uint32_t ldd)
+        {
+            // Block offsets are those of D
+            auto blockStepX
+                = MappingUtil<MfmaFragD>::dataOffset(GlobalMapping::blockOffsetA(), ldd);
+            auto blockStepY
+                = MappingUtil<MfmaFragD>::dataOffset(GlobalMapping::blockOffsetB(), ldd);
+#pragma unroll
+            for(int i = 0; i < BlocksX; i++)
+            {
+                auto offsetY = 0u;
+#pragma unroll
+                for(int j = 0; j < BlocksY; j++)
+                {
+                    globalAtomicAddD(gAddrD + offsetY, fragsD[i][j], ldd);
+
+                    offsetY += blockStepY;
+                }
+                gAddrD += blockStepX;
+            }
+        }
+
+        template <GemmDriverT>
+        __device__ inline void GemmDriver<GemmDriverT_impl>::globalWriteAcc(
+            GetDataType_t<MfmaFragAcc>* gAddrAcc, MfmaFragAcc const& fragAcc, uint32_t ldd)
+        {
+            rocwmma::store_matrix_sync(gAddrAcc,
+                                       fragAcc,
+                                       ldd,
+                                       std::is_same<GetDataLayout_t<MfmaFragD>, row_major>::value
+                                           ? layout_t::mem_row_major
+                                           : layout_t::mem_col_major);
+        }
+
+        template <GemmDriverT>
+        template <uint32_t BlocksX, uint32_t BlocksY>
+        __device__ inline void GemmDriver<GemmDriverT_impl>::globalWriteAcc(
+            GetDataType_t<MfmaFragAcc>* gAddrAcc,
+            MfmaFragAcc const (&fragsAcc)[BlocksX][BlocksY],
+            uint32_t ldd)
+        {
+            // Block offsets are those of D
+            auto blockStepX
+                = MappingUtil<MfmaFragD>::dataOffset(GlobalMapping::blockOffsetA(), ldd);
+            auto blockStepY
+                = MappingUtil<MfmaFragD>::dataOffset(GlobalMapping::blockOffsetB(), ldd);
+#pragma unroll
+            for(int i = 0; i < BlocksX; i++)
+            {
+                auto offsetY = 0u;
+#pragma unroll
+                for(int j = 0; j < BlocksY; j++)
+                {
+                    globalWriteAcc(gAddrAcc + offsetY, fragsAcc[i][j], ldd);
+
+                    offsetY += blockStepY;
+                }
+                gAddrAcc += blockStepX;
+            }
+        }
+
         template <GemmDriverT>
         __device__ inline void
             GemmDriver<GemmDriverT_impl>::uniformFma(MfmaFragD&                 fragD,
@@ -453,6 +613,120 @@ namespace rocwmma
             }
         }
 
+        template <GemmDriverT>
+        template <uint32_t BlocksX, uint32_t BlocksY>
+        __device__ inline void GemmDriver<GemmDriverT_impl>::workspaceWriteAcc(
+            GetDataType_t<MfmaFragAcc>* wsAddr, MfmaFragAcc const (&fragsAcc)[BlocksX][BlocksY])
+        {
+            auto threadCount = blockDim.x * blockDim.y;
+            auto threadId    = threadIdx.y * blockDim.x + threadIdx.x;
+
+            wsAddr += threadId;
+#pragma unroll
+            for(int i = 0; i < BlocksX; i++)
+            {
+#pragma unroll
+                for(int j = 0; j < BlocksY; j++)
+                {
+#pragma unroll
+                    for(int k = 0; k < MfmaFragAcc::num_elements; k++)
+                    {
+                        *wsAddr = fragsAcc[i][j].x[k];
+                        wsAddr += threadCount;
+                    }
+                }
+            }
+        }
+
+        template <GemmDriverT>
+        template <uint32_t BlocksX, uint32_t BlocksY>
+        __device__ inline void GemmDriver<GemmDriverT_impl>::workspaceAccumAcc(
+            MfmaFragAcc (&fragsAcc)[BlocksX][BlocksY], GetDataType_t<MfmaFragAcc> const* wsAddr)
+        {
+            auto threadCount = blockDim.x * blockDim.y;
+            auto threadId    = threadIdx.y * blockDim.x + threadIdx.x;
+
+            wsAddr += threadId;
+#pragma unroll
+            for(int i = 0; i < BlocksX; i++)
+            {
+#pragma unroll
+                for(int j = 0; j < BlocksY; j++)
+                {
+#pragma unroll
+                    for(int k = 0; k < MfmaFragAcc::num_elements; k++)
+                    {
+                        fragsAcc[i][j].x[k] += *wsAddr;
+                        wsAddr += threadCount;
+                    }
+                }
+            }
+        }
+
+        template <GemmDriverT>
+        template <uint32_t Stages, typename DataT>
+        __device__ inline DataT* GemmDriver<GemmDriverT_impl>::ldsStagePtr(DataT*   ldsBase,
+                                                                           uint32_t stageSize,
+                                                                           uint32_t kStep)
+        {
+            static_assert(Stages >= 2u, "Pipelining requires at least 2 LDS buffers");
+            return ldsBase + (kStep % Stages) * stageSize;
+        }
+
+        template <GemmDriverT>
+        __device__ inline void GemmDriver<GemmDriverT_impl>::signalWorkgroup(uint32_t* flag)
+        {
+            // Make sure all waves' writes are visible device-wide before the flag
+            __threadfence();
+            syncWorkgroup();
+
+            if(threadIdx.x == 0u && threadIdx.y == 0u)
+            {
+                atomicExch(flag, 1u);
+            }
+        }
+
+        template <GemmDriverT>
+        __device__ inline void GemmDriver<GemmDriverT_impl>::waitWorkgroup(uint32_t* flag)
+        {
+            // Consume the flag, leaving it reset for the next use
+            if(threadIdx.x == 0u && threadIdx.y == 0u)
+            {
+                while(atomicCAS(flag, 1u, 0u) != 1u)
+                {
+                    __builtin_amdgcn_s_sleep(1);
+                }
+            }
+
+            syncWorkgroup();
+            __threadfence();
+        }
+
+        template <GemmDriverT>
+        __device__ inline void GemmDriver<GemmDriverT_impl>::arriveWave(uint32_t* ldsCounter)
+        {
+            // LDS writes must have landed and LDS reads must have returned
+            // before the counter is visible to other waves.
+            lds_mem_barrier();
+
+            if(MappingUtil<MfmaFragA>::laneId() == 0u)
+            {
+                __hip_atomic_fetch_add(
+                    ldsCounter, 1u, __ATOMIC_RELEASE, __HIP_MEMORY_SCOPE_WORKGROUP);
+            }
+        }
+
+        template <GemmDriverT>
+        __device__ inline void GemmDriver<GemmDriverT_impl>::waitWave(uint32_t* ldsCounter,
+                                                                      uint32_t  target)
+        {
+            while(__hip_atomic_load(ldsCounter, __ATOMIC_ACQUIRE, __HIP_MEMORY_SCOPE_WORKGROUP)
+                  < target)
+            {
+                __builtin_amdgcn_s_sleep(1);
+            }
+        }
+
         template <GemmDriverT>
         __device__ inline void GemmDriver<GemmDriverT_impl>::syncWorkgroup()
         {
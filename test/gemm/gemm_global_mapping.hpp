@@ -33,6 +33,8 @@
 #include <rocwmma/rocwmma_transforms.hpp>
 #pragma GCC diagnostic pop
 
+#include "gemm_rasterization.hpp"
+
 namespace rocwmma
 {
     namespace GlobalMapping
@@ -126,11 +128,11 @@ namespace rocwmma
 
                 // Projection of C coordinate in direction of A
                 template <typename CoordC>
-                __device__ constexpr static inline auto projCoordA(CoordC const& coordC);
+                ROCWMMA_HOST_DEVICE constexpr static inline auto projCoordA(CoordC const& coordC);
 
                 // Projection of C coordinate in direction of B
                 template <typename CoordC>
-                __device__ constexpr static inline auto projCoordB(CoordC const& coordC);
+                ROCWMMA_HOST_DEVICE constexpr static inline auto projCoordB(CoordC const& coordC);
 
                 ///
                 /// Dimensions
@@ -140,9 +142,13 @@ namespace rocwmma
                 // Wave tile = tile processed by current wave
                 // Block size = mfma block size
                 __device__ constexpr static inline auto macroTileSizeC();
-                __device__ constexpr static inline auto waveTileSizeC();
-                __device__ constexpr static inline auto blockSizeC();
-                __device__ constexpr static inline auto kDim();
+                ROCWMMA_HOST_DEVICE constexpr static inline auto waveTileSizeC();
+                ROCWMMA_HOST_DEVICE constexpr static inline auto blockSizeC();
+                ROCWMMA_HOST_DEVICE constexpr static inline auto kDim();
+
+                // Macro tile of the given workgroup dimensions in waves
+                ROCWMMA_HOST_DEVICE constexpr static inline auto
+                    macroTileSizeC(Coord2d const& workgroupDim);
 
                 ///
                 /// Offsets
@@ -153,10 +159,18 @@ namespace rocwmma
                 __device__ constexpr static inline auto waveOffsetB();
                 __device__ constexpr static inline auto waveOffsetC();
 
+                // The offset from macro tile to the mfma tiles of the given wave
+                ROCWMMA_HOST_DEVICE constexpr static inline auto
+                    waveOffsetA(Coord2d const& localWaveCoord);
+                ROCWMMA_HOST_DEVICE constexpr static inline auto
+                    waveOffsetB(Coord2d const& localWaveCoord);
+                ROCWMMA_HOST_DEVICE constexpr static inline auto
+                    waveOffsetC(Coord2d const& localWaveCoord);
+
                 // The local offsets between mfma blocks
-                __device__ constexpr static inline auto blockOffsetA();
-                __device__ constexpr static inline auto blockOffsetB();
-                __device__ constexpr static inline auto blockOffsetC();
+                ROCWMMA_HOST_DEVICE constexpr static inline auto blockOffsetA();
+                ROCWMMA_HOST_DEVICE constexpr static inline auto blockOffsetB();
+                ROCWMMA_HOST_DEVICE constexpr static inline auto blockOffsetC();
 
                 // The matrix offset to the next step in the k dimension
                 __device__ constexpr static inline auto kStepOffsetA();
@@ -261,7 +275,7 @@ namespace rocwmma
             }
 
             // Indicate if global read for A and B are wave tiles
-            __device__ constexpr static inline auto readABWaveTile()
+            ROCWMMA_HOST_DEVICE constexpr static inline auto readABWaveTile()
             {
                 return true;
             }
@@ -360,7 +374,7 @@ namespace rocwmma
             }
 
             // Indicate if global read for A and B are wave tiles
-            __device__ constexpr static inline auto readABWaveTile()
+            ROCWMMA_HOST_DEVICE constexpr static inline auto readABWaveTile()
             {
                 return true;
             }
@@ -469,12 +483,147 @@ namespace rocwmma
             }
 
             // Indicate if global read for A and B are wave tiles
-            __device__ constexpr static inline auto readABWaveTile()
+            ROCWMMA_HOST_DEVICE constexpr static inline auto readABWaveTile()
             {
                 return false;
             }
         };
 
+        template <typename TileMapping>
+        struct StreamKMapping : public TileMapping
+        {
+            /*
+            * This flavour of Global Mapping decouples the workgroup from the output
+            * macro tile, for use in persistent (Stream-K) kernels. A fixed grid
+            * of workgroups (e.g. one per CU) evenly partitions the flattened
+            * MAC-loop iteration space of all macro tiles:
+            *
+            * Total iterations = macroTileCount(m, n) * itersPerTile(k)
+            *
+            * Each workgroup owns a contiguous range of iterations, which may
+            * begin or end part-way through the K dimension of a macro tile.
+            * Macro tiles are visited in column-major order across C, such that
+            * consecutive tiles share the same columns of B.
+            *
+            * A tile whose K loop is split across workgroups must be fixed up:
+            * the workgroup owning the first K iteration of the tile is
+            * responsible for accumulating the partial results of the others and
+            * writing D. Because a workgroup's range may only begin part-way
+            * through a tile once, each workgroup produces at most one partial tile.
+            *
+            * A/B/C/D fragment types, offsets and LDS layouts are inherited
+            * from the TileMapping (Block, Wave or Workgroup level). Global
+            * matrix coordinates are instead calculated from an explicit macro
+            * tile coordinate.
+            */
+            using Base = TileMapping;
+
+            ///
+            /// Iteration space
+            ///
+
+            // Count of macro tiles covering the (m x n) C / D matrices
+            __device__ static inline uint32_t macroTileCount(uint32_t m, uint32_t n);
+
+            // Count of MAC-loop iterations in each macro tile
+            __device__ constexpr static inline uint32_t itersPerTile(uint32_t k);
+
+            // The first MAC-loop iteration owned by the given workgroup.
+            // Ownership of workgroupId is [iterBegin(workgroupId), iterBegin(workgroupId + 1))
+            __device__ static inline uint32_t iterBegin(uint32_t workgroupId,
+                                                        uint32_t totalIters);
+
+            ///
+            /// Global matrix coords
+            ///
+
+            // Global matrix coordinate of the macro tile at tileIdx
+            __device__ static inline auto macroTileCoordC(uint32_t tileIdx, uint32_t m);
+
+            // Global matrix coordinate of the current wave within the given macro tile
+            template <typename CoordC>
+            __device__ constexpr static inline auto waveTileCoordC(CoordC const& macroTileCoord);
+
+            // The base global matrix coordinates of the current wave, within the
+            // given macro tile.
+            template <typename CoordC>
+            __device__ constexpr static inline auto readCoordA(CoordC const& macroTileCoord);
+            template <typename CoordC>
+            __device__ constexpr static inline auto readCoordB(CoordC const& macroTileCoord);
+            template <typename CoordC>
+            __device__ constexpr static inline auto readCoordC(CoordC const& macroTileCoord);
+            template <typename CoordC>
+            __device__ constexpr static inline auto writeCoordD(CoordC const& macroTileCoord);
+        };
+
+        template <typename TileMapping>
+        struct SplitKMapping : public TileMapping
+        {
+            /*
+            * This flavour of Global Mapping partitions the K dimension of each
+            * output macro tile across the z dimension of the grid, for use in
+            * split-K kernels:
+            *
+            * Grid = (TileMapping grid x, TileMapping grid y, splitCount)
+            *
+            * Workgroups (x, y, *) share the same macro tile of C / D, which is
+            * mapped as in the TileMapping (Block, Wave or Workgroup level).
+            * The workgroup at blockIdx.z owns a contiguous range of MAC-loop
+            * iterations of the macro tile:
+            *
+            * [kIterBegin(blockIdx.z, kIters), kIterBegin(blockIdx.z + 1, kIters))
+            *
+            * Each split produces a partial sum of the macro tile, which must be
+            * reduced either by atomic accumulation into D, or through a workspace
+            * and a separate reduction pass.
+            */
+            using Base = TileMapping;
+
+            // Count of MAC-loop iterations in each macro tile
+            __device__ constexpr static inline uint32_t kIters(uint32_t k);
+
+            // Count of K partitions, and the partition of the current workgroup
+            __device__ static inline uint32_t splitCount();
+            __device__ static inline uint32_t splitIdx();
+
+            // The first MAC-loop iteration owned by the given K partition.
+            __device__ static inline uint32_t kIterBegin(uint32_t splitIdx, uint32_t kIters);
+        };
+
+        template <typename TileMapping, typename RasterOrder>
+        struct RasterizedMapping : public TileMapping
+        {
+            /*
+            * This flavour of Global Mapping re-maps the workgroup to output macro
+            * tile assignment of the TileMapping (Block, Wave or Workgroup level)
+            * with a Rasterization order, to improve L2 reuse of A / B between
+            * concurrently resident workgroups:
+            *
+            * tileIdx = blockIdx.x + blockIdx.y * gridDim.x
+            * macro tile coord = RasterOrder::tileCoord(tileIdx, gridDim.x, gridDim.y)
+            *
+            * The grid, A/B/C/D fragment types, offsets and LDS layouts are
+            * unchanged, and only the global matrix coordinates are re-mapped.
+            */
+            using Base = TileMapping;
+
+            ///
+            /// Global matrix coords
+            ///
+
+            // Global matrix coordinate of macro tile for the current workgroup
+            __device__ static inline auto macroTileCoordC();
+
+            // Global matrix coordinate of wave tile for the current wave
+            __device__ static inline auto waveTileCoordC();
+
+            // The base global matrix coordinates of the current wave
+            __device__ static inline auto readCoordA();
+            __device__ static inline auto readCoordB();
+            __device__ static inline auto readCoordC();
+            __device__ static inline auto writeCoordD();
+        };
+
     } // namespace GlobalMapping
 
 } // namespace rocwmma
@@ -47,7 +47,7 @@ namespace rocwmma
 
             template <MappingBaseT>
             template <typename CoordC>
-            __device__ constexpr inline auto
+            ROCWMMA_HOST_DEVICE constexpr inline auto
                 MappingBase<MappingBaseT_impl>::projCoordA(CoordC const& coordC)
             {
                 return make_coord2d(get<0>(coordC), 0u);
@@ -55,7 +55,7 @@ namespace rocwmma
 
             template <MappingBaseT>
             template <typename CoordC>
-            __device__ constexpr inline auto
+            ROCWMMA_HOST_DEVICE constexpr inline auto
                 MappingBase<MappingBaseT_impl>::projCoordB(CoordC const& coordC)
             {
                 return make_coord2d(0u, get<1>(coordC));
@@ -68,24 +68,32 @@ namespace rocwmma
             template <MappingBaseT>
             __device__ constexpr inline auto MappingBase<MappingBaseT_impl>::macroTileSizeC()
             {
-                return WaveSpace::workgroupDim() * waveTileSizeC();
+                return macroTileSizeC(WaveSpace::workgroupDim());
             }
 
             template <MappingBaseT>
-            __device__ constexpr inline auto MappingBase<MappingBaseT_impl>::waveTileSizeC()
+            ROCWMMA_HOST_DEVICE constexpr inline auto
+                MappingBase<MappingBaseT_impl>::macroTileSizeC(Coord2d const& workgroupDim)
+            {
+                return workgroupDim * waveTileSizeC();
+            }
+
+            template <MappingBaseT>
+            ROCWMMA_HOST_DEVICE constexpr inline auto
+                MappingBase<MappingBaseT_impl>::waveTileSizeC()
             {
                 return blockSizeC() * make_coord2d(BlocksX, BlocksY);
             }
 
             template <MappingBaseT>
-            __device__ constexpr inline auto MappingBase<MappingBaseT_impl>::blockSizeC()
+            ROCWMMA_HOST_DEVICE constexpr inline auto MappingBase<MappingBaseT_impl>::blockSizeC()
             {
                 return make_coord2d((uint32_t)GetIOShape_t<MfmaFragC>::BlockHeight,
                                     (uint32_t)GetIOShape_t<MfmaFragC>::BlockWidth);
             }
 
             template <MappingBaseT>
-            __device__ constexpr inline auto MappingBase<MappingBaseT_impl>::kDim()
+            ROCWMMA_HOST_DEVICE constexpr inline auto MappingBase<MappingBaseT_impl>::kDim()
             {
                 return BlockK;
             }
@@ -97,35 +105,56 @@ namespace rocwmma
             template <MappingBaseT>
             __device__ constexpr inline auto MappingBase<MappingBaseT_impl>::waveOffsetA()
             {
-                return projCoordA(waveOffsetC());
+                return waveOffsetA(WaveSpace::localWaveCoord());
             }
 
             template <MappingBaseT>
             __device__ constexpr inline auto MappingBase<MappingBaseT_impl>::waveOffsetB()
             {
-                return projCoordB(waveOffsetC());
+                return waveOffsetB(WaveSpace::localWaveCoord());
             }
 
             template <MappingBaseT>
             __device__ constexpr inline auto MappingBase<MappingBaseT_impl>::waveOffsetC()
             {
-                return WaveSpace::localWaveCoord() * waveTileSizeC();
+                return waveOffsetC(WaveSpace::localWaveCoord());
+            }
+
+            template <MappingBaseT>
+            ROCWMMA_HOST_DEVICE constexpr inline auto
+                MappingBase<MappingBaseT_impl>::waveOffsetA(Coord2d const& localWaveCoord)
+            {
+                return projCoordA(waveOffsetC(localWaveCoord));
+            }
+
+            template <MappingBaseT>
+            ROCWMMA_HOST_DEVICE constexpr inline auto
+                MappingBase<MappingBaseT_impl>::waveOffsetB(Coord2d const& localWaveCoord)
+            {
+                return projCoordB(waveOffsetC(localWaveCoord));
+            }
+
+            template <MappingBaseT>
+            ROCWMMA_HOST_DEVICE constexpr inline auto
+                MappingBase<MappingBaseT_impl>::waveOffsetC(Coord2d const& localWaveCoord)
+            {
+                return localWaveCoord * waveTileSizeC();
             }
 
             template <MappingBaseT>
-            __device__ constexpr inline auto MappingBase<MappingBaseT_impl>::blockOffsetA()
+            ROCWMMA_HOST_DEVICE constexpr inline auto MappingBase<MappingBaseT_impl>::blockOffsetA()
             {
                 return projCoordA(blockOffsetC());
             }
 
             template <MappingBaseT>
-            __device__ constexpr inline auto MappingBase<MappingBaseT_impl>::blockOffsetB()
+            ROCWMMA_HOST_DEVICE constexpr inline auto MappingBase<MappingBaseT_impl>::blockOffsetB()
             {
                 return projCoordB(blockOffsetC());
             }
 
             template <MappingBaseT>
-            __device__ constexpr inline auto MappingBase<MappingBaseT_impl>::blockOffsetC()
+            ROCWMMA_HOST_DEVICE constexpr inline auto MappingBase<MappingBaseT_impl>::blockOffsetC()
             {
                 return blockSizeC();
             }
@@ -162,6 +191,169 @@ namespace rocwmma
 #undef MappingBaseT
 #undef MappingBaseT_impl
 
+        ///
+        /// Stream-K iteration space
+        ///
+
+        template <typename TileMapping>
+        __device__ inline uint32_t StreamKMapping<TileMapping>::macroTileCount(uint32_t m,
+                                                                              uint32_t n)
+        {
+            auto macroTileSize = Base::macroTileSizeC();
+            return (m / get<0>(macroTileSize)) * (n / get<1>(macroTileSize));
+        }
+
+        template <typename TileMapping>
+        __device__ constexpr inline uint32_t StreamKMapping<TileMapping>::itersPerTile(uint32_t k)
+        {
+            return k / Base::kDim();
+        }
+
+        template <typename TileMapping>
+        __device__ inline uint32_t StreamKMapping<TileMapping>::iterBegin(uint32_t workgroupId,
+                                                                         uint32_t totalIters)
+        {
+            // Even split, where the first (totalIters % gridDim.x) workgroups
+            // are assigned one extra iteration.
+            auto itersPerWorkgroup = totalIters / gridDim.x;
+            auto remainder         = totalIters % gridDim.x;
+            return workgroupId * itersPerWorkgroup + min(workgroupId, remainder);
+        }
+
+        ///
+        /// Stream-K global matrix coords
+        ///
+
+        template <typename TileMapping>
+        __device__ inline auto StreamKMapping<TileMapping>::macroTileCoordC(uint32_t tileIdx,
+                                                                           uint32_t m)
+        {
+            auto macroTileSize = Base::macroTileSizeC();
+            auto tilesX        = m / get<0>(macroTileSize);
+            return make_coord2d(tileIdx % tilesX, tileIdx / tilesX) * macroTileSize;
+        }
+
+        template <typename TileMapping>
+        template <typename CoordC>
+        __device__ constexpr inline auto
+            StreamKMapping<TileMapping>::waveTileCoordC(CoordC const& macroTileCoord)
+        {
+            return macroTileCoord + Base::waveOffsetC();
+        }
+
+        template <typename TileMapping>
+        template <typename CoordC>
+        __device__ constexpr inline auto
+            StreamKMapping<TileMapping>::readCoordA(CoordC const& macroTileCoord)
+        {
+            // Follow the A/B read granularity of the tile mapping
+            return Base::readABWaveTile() ? Base::projCoordA(waveTileCoordC(macroTileCoord))
+                                          : Base::projCoordA(macroTileCoord);
+        }
+
+        template <typename TileMapping>
+        template <typename CoordC>
+        __device__ constexpr inline auto
+            StreamKMapping<TileMapping>::readCoordB(CoordC const& macroTileCoord)
+        {
+            return Base::readABWaveTile() ? Base::projCoordB(waveTileCoordC(macroTileCoord))
+                                          : Base::projCoordB(macroTileCoord);
+        }
+
+        template <typename TileMapping>
+        template <typename CoordC>
+        __device__ constexpr inline auto
+            StreamKMapping<TileMapping>::readCoordC(CoordC const& macroTileCoord)
+        {
+            return waveTileCoordC(macroTileCoord);
+        }
+
+        template <typename TileMapping>
+        template <typename CoordC>
+        __device__ constexpr inline auto
+            StreamKMapping<TileMapping>::writeCoordD(CoordC const& macroTileCoord)
+        {
+            return waveTileCoordC(macroTileCoord);
+        }
+
+        ///
+        /// Split-K iteration space
+        ///
+
+        template <typename TileMapping>
+        __device__ constexpr inline uint32_t SplitKMapping<TileMapping>::kIters(uint32_t k)
+        {
+            return k / Base::kDim();
+        }
+
+        template <typename TileMapping>
+        __device__ inline uint32_t SplitKMapping<TileMapping>::splitCount()
+        {
+            return gridDim.z;
+        }
+
+        template <typename TileMapping>
+        __device__ inline uint32_t SplitKMapping<TileMapping>::splitIdx()
+        {
+            return blockIdx.z;
+        }
+
+        template <typename TileMapping>
+        __device__ inline uint32_t SplitKMapping<TileMapping>::kIterBegin(uint32_t splitIdx,
+                                                                         uint32_t kIters)
+        {
+            // Even split, where the first (kIters % gridDim.z) partitions
+            // are assigned one extra iteration.
+            auto itersPerSplit = kIters / gridDim.z;
+            auto remainder     = kIters % gridDim.z;
+            return splitIdx * itersPerSplit + min(splitIdx, remainder);
+        }
+
+        ///
+        /// Rasterized global matrix coords
+        ///
+
+        template <typename TileMapping, typename RasterOrder>
+        __device__ inline auto RasterizedMapping<TileMapping, RasterOrder>::macroTileCoordC()
+        {
+            auto tileIdx   = blockIdx.x + blockIdx.y * gridDim.x;
+            auto tileCoord = RasterOrder::tileCoord(tileIdx, gridDim.x, gridDim.y);
+            return tileCoord * Base::macroTileSizeC();
+        }
+
+        template <typename TileMapping, typename RasterOrder>
+        __device__ inline auto RasterizedMapping<TileMapping, RasterOrder>::waveTileCoordC()
+        {
+            return macroTileCoordC() + Base::waveOffsetC();
+        }
+
+        template <typename TileMapping, typename RasterOrder>
+        __device__ inline auto RasterizedMapping<TileMapping, RasterOrder>::readCoordA()
+        {
+            // Follow the A/B read granularity of the tile mapping
+            return Base::readABWaveTile() ? Base::projCoordA(waveTileCoordC())
+                                          : Base::projCoordA(macroTileCoordC());
+        }
+
+        template <typename TileMapping, typename RasterOrder>
+        __device__ inline auto RasterizedMapping<TileMapping, RasterOrder>::readCoordB()
+        {
+            return Base::readABWaveTile() ? Base::projCoordB(waveTileCoordC())
+                                          : Base::projCoordB(macroTileCoordC());
+        }
+
+        template <typename TileMapping, typename RasterOrder>
+        __device__ inline auto RasterizedMapping<TileMapping, RasterOrder>::readCoordC()
+        {
+            return waveTileCoordC();
+        }
+
+        template <typename TileMapping, typename RasterOrder>
+        __device__ inline auto RasterizedMapping<TileMapping, RasterOrder>::writeCoordD()
+        {
+            return waveTileCoordC();
+        }
+
     } // namespace CooperativeGemm
 
 } // namespace rocwmma
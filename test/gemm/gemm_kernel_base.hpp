@@ -31,6 +31,7 @@
 #include <sstream>
 #include <string>
 
+#include "common.hpp"
 #include "gemm_resource.hpp"
 #include "hip_device.hpp"
 
@@ -45,6 +46,13 @@ namespace rocwmma
         std::tuple<int64_t, int64_t, int64_t> problemSize;
         double                                alpha;
         double                                beta;
+
+        // Count of K partitions for split-K kernels.
+        // 0 = the kernel chooses its own split factor.
+        uint32_t splitK = 0u;
+
+        // Seed of the random A, B and C fills
+        uint64_t fillSeed = 0u;
     };
 
     // Typeless Kernel interface to use with testing harness.
@@ -111,7 +119,16 @@ namespace rocwmma
                                     uint32_t, // ldc
                                     uint32_t, // ldd
                                     ComputeT, // Alpha
-                                    ComputeT); // Beta
+                                    ComputeT, // Beta
+                                    void*); // Workspace
+
+        // Random fill streams of the input matrices
+        enum : uint32_t
+        {
+            FillStreamA = 0u,
+            FillStreamB = 1u,
+            FillStreamC = 2u
+        };
 
     protected:
         GemmKernelBase();
@@ -120,6 +137,12 @@ namespace rocwmma
         // Kernels MUST provide the device kernel function.
         virtual KernelFunc kernelImpl() const = 0;
 
+        // Kernels MAY provide a variant of the device kernel function
+        // that stores D with the cache_streaming policy. It is validated
+        // against the default kernel, and when benchmarking, it is timed
+        // alongside the default kernel for comparison.
+        virtual KernelFunc streamingKernelImpl() const;
+
         // Launch parameters.
         // Base calculations for grid and block dimensions
         // assume one output block per wave.
@@ -127,6 +150,15 @@ namespace rocwmma
         virtual dim3     gridDim() const;
         virtual dim3     blockDim() const;
 
+        // Kernels MAY request a zero-initialized device workspace (in bytes),
+        // which is passed to the device kernel function.
+        virtual uint64_t workspaceSize() const;
+
+        // Launches the given device kernel function on the problem.
+        // Kernels MAY override this to enqueue additional work with each
+        // launch, e.g. initialization of D or a reduction pass.
+        virtual void launchKernel(KernelFunc kernelFunc) const;
+
         // Kernel run checks.
         // True = run test
         // False = skip test
@@ -167,6 +199,8 @@ namespace rocwmma
         uint32_t mM, mN, mK;
         uint32_t mLda, mLdb, mLdc, mLdd;
         ComputeT mAlpha, mBeta;
+        uint32_t mSplitK;
+        uint64_t mFillSeed;
 
         // Execution flow control
         uint32_t mColdRuns;
@@ -175,10 +209,17 @@ namespace rocwmma
         bool     mValidationResult = false;
         double   mMaxRelativeError;
 
+        // Error statistics of the validation
+        CompareStats mCompareStats;
+
         // Performance
         float64_t mElapsedTimeMs, mTotalGFlops, mMeasuredTFlopsPerSec;
         int32_t   mEfficiency;
 
+        // Streaming epilogue
+        float64_t mStreamingMeasuredTFlopsPerSec;
+        int32_t   mStreamingEfficiency;
+
         // Reference
         float64_t         mRefMeasuredTFlopsPerSec;
         int32_t           mRefEfficiency;
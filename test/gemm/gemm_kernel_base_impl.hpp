@@ -45,6 +45,7 @@
 
 #if ROCWMMA_VALIDATION_TESTS
 #include "reference.hpp" // Vanilla CPU kernel
+#include "reference_cache.hpp"
 #endif // ROCWMMA_VALIDATION_TESTS
 
 #if ROCWMMA_ROCBLAS_INTEGRATION
@@ -203,6 +204,56 @@ namespace rocwmma
         return 0;
     }
 
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    uint64_t GemmKernelBase<BlockM,
+                            BlockN,
+                            BlockK,
+                            InputT,
+                            OutputT,
+                            ComputeT,
+                            LayoutA,
+                            LayoutB,
+                            LayoutC,
+                            LayoutD>::workspaceSize() const
+    {
+        // No workspace by default
+        return 0;
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    auto GemmKernelBase<BlockM,
+                        BlockN,
+                        BlockK,
+                        InputT,
+                        OutputT,
+                        ComputeT,
+                        LayoutA,
+                        LayoutB,
+                        LayoutC,
+                        LayoutD>::streamingKernelImpl() const -> KernelFunc
+    {
+        // No streaming epilogue variant by default
+        return nullptr;
+    }
+
     template <uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -252,6 +303,52 @@ namespace rocwmma
         return dim3(mTBlockX, mTBlockY);
     }
 
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    void GemmKernelBase<BlockM,
+                        BlockN,
+                        BlockK,
+                        InputT,
+                        OutputT,
+                        ComputeT,
+                        LayoutA,
+                        LayoutB,
+                        LayoutC,
+                        LayoutD>::launchKernel(KernelFunc kernelFunc) const
+    {
+        auto& dataInstance = DataStorage::instance();
+        hipExtLaunchKernelGGL(kernelFunc, // Kernel to launch
+                              (gridDim()), // Wg grid size
+                              (blockDim()), // Thread block size
+                              (ldsUsage()), // sharedMemBytes
+                              0, // stream
+                              nullptr, // Event start
+                              nullptr, // event stop
+                              0, // flags
+                              mM, // M
+                              mN, // N
+                              mK, // K
+                              dataInstance->deviceA().get(), // A*
+                              dataInstance->deviceB().get(), // B*
+                              dataInstance->deviceC().get(), // C*
+                              dataInstance->deviceD().get(), // D*
+                              mLda, // lda
+                              mLdb, // ldb
+                              mLdc, // ldc
+                              mLdd, // ldd
+                              mAlpha, // alpha
+                              mBeta, // beta
+                              dataInstance->deviceWorkspace().get()); // workspace
+    }
+
     // Kernel run checks. Virtual as different GEMM kernels have different requirements
     // True = run test
     // False = skip test
@@ -391,6 +488,8 @@ namespace rocwmma
         mM = mN = mK = 0u;
         mLda = mLdb = mLdc = mLdd = 0u;
         mAlpha = mBeta = static_cast<ComputeT>(0u);
+        mSplitK        = 0u;
+        mFillSeed      = 0u;
 
         mColdRuns = (bool)(ROCWMMA_VALIDATION_TESTS) ? 0u : 2u;
         mHotRuns  = (bool)(ROCWMMA_VALIDATION_TESTS) ? 1u : 10u;
@@ -398,10 +497,14 @@ namespace rocwmma
         mRunFlag          = true;
         mValidationResult = false;
         mMaxRelativeError = 0.0;
+        mCompareStats     = CompareStats{};
 
         mElapsedTimeMs = mTotalGFlops = mMeasuredTFlopsPerSec = 0.0;
         mEfficiency                                           = -1;
 
+        mStreamingMeasuredTFlopsPerSec = 0.0;
+        mStreamingEfficiency           = -1;
+
         mMeasuredTFlopsPerSec = 0.0;
         mRefEfficiency        = -1;
     }
@@ -461,7 +564,13 @@ namespace rocwmma
                       << "Problem Size(GFlops), "
                       << "TFlops/s, "
                       << "Efficiency(%), "
+                      << ((bool)ROCWMMA_BENCHMARK_TESTS
+                              ? "Streaming TFlops/s, Streaming Efficiency(%), "
+                              : "")
                       << (mBenchRef ? "rocBLAS TFlops/s(%), rocBLAS Efficiency(%), " : "")
+                      << ((bool)ROCWMMA_VALIDATION_TESTS
+                              ? "maxRelativeError, meanRelativeError, maxULP, "
+                              : "")
                       << "Result" << std::endl;
     }
 
@@ -503,17 +612,34 @@ namespace rocwmma
                    << "n/a"
                    << ", "
                    << "n/a"
-                   << ", " << (mBenchRef ? "n/a, n/a, " : "") << "SKIPPED" << std::endl;
+                   << ", " << ((bool)ROCWMMA_BENCHMARK_TESTS ? "n/a, n/a, " : "")
+                   << (mBenchRef ? "n/a, n/a, " : "")
+                   << ((bool)ROCWMMA_VALIDATION_TESTS ? "n/a, n/a, n/a, " : "") << "SKIPPED"
+                   << std::endl;
         }
         else
         {
 
             stream << mElapsedTimeMs << ", " << mTotalGFlops << ", " << mMeasuredTFlopsPerSec
                    << ", " << mEfficiency << ", "
+                   << ((bool)ROCWMMA_BENCHMARK_TESTS
+                           ? (mStreamingEfficiency < 0
+                                  ? std::string("n/a, n/a, ")
+                                  : (std::to_string(mStreamingMeasuredTFlopsPerSec) + ", "
+                                     + std::to_string(mStreamingEfficiency) + ", "))
+                           : "")
                    << (mBenchRef ? (std::to_string(mRefMeasuredTFlopsPerSec) + ", "
                                     + std::to_string(mRefEfficiency) + ", ")
-                                 : "")
-                   << ((bool)ROCWMMA_VALIDATION_TESTS ? (mValidationResult ? "PASSED" : "FAILED")
+                                 : "");
+
+            // Error statistics of the validation
+            if((bool)ROCWMMA_VALIDATION_TESTS)
+            {
+                stream << mMaxRelativeError << ", " << mCompareStats.meanRelativeError() << ", "
+                       << mCompareStats.maxUlp << ", ";
+            }
+
+            stream << ((bool)ROCWMMA_VALIDATION_TESTS ? (mValidationResult ? "PASSED" : "FAILED")
                                                       : "BENCH")
                    << std::endl;
         }
@@ -556,6 +682,8 @@ namespace rocwmma
                        static_cast<uint32_t const&>(std::get<2>(problem.problemSize)));
         std::tie(mAlpha, mBeta) = std::tie((ComputeT const&)static_cast<ComputeT>(problem.alpha),
                                            (ComputeT const&)static_cast<ComputeT>(problem.beta));
+        mSplitK   = problem.splitK;
+        mFillSeed = problem.fillSeed;
         std::tie(mLda, mLdb, mLdc, mLdd)
             = std::tie((std::is_same<LayoutA, row_major>::value ? mK : mM),
                        (std::is_same<LayoutB, row_major>::value ? mN : mK),
@@ -575,20 +703,25 @@ namespace rocwmma
             // Initialize matrix storage
             dataInstance->resizeStorage(problem.problemSize);
 
-            // Initialize matrix data on device
-            MatrixUtil<LayoutA>::fillLaunchKernel(dataInstance->deviceA().get(), mM, mK);
-            MatrixUtil<LayoutB>::fillLaunchKernel(dataInstance->deviceB().get(), mK, mN);
-            MatrixUtil<LayoutC>::fillLaunchKernel(dataInstance->deviceC().get(), mM, mN);
+            // Initialize the kernel workspace, if any
+            if(auto bytes = workspaceSize(); bytes > 0u)
+            {
+                dataInstance->resizeWorkspace(bytes);
+                CHECK_HIP_ERROR(hipMemset(dataInstance->deviceWorkspace().get(), 0, bytes));
+            }
+
+            // Initialize matrix data on device. A, B and C use separate streams
+            // of the random fill, so that they are independent of each other.
+            MatrixUtil<LayoutA>::fillRandomLaunchKernel(
+                dataInstance->deviceA().get(), mM, mK, mFillSeed, FillStreamA);
+            MatrixUtil<LayoutB>::fillRandomLaunchKernel(
+                dataInstance->deviceB().get(), mK, mN, mFillSeed, FillStreamB);
+            MatrixUtil<LayoutC>::fillRandomLaunchKernel(
+                dataInstance->deviceC().get(), mM, mN, mFillSeed, FillStreamC);
             MatrixUtil<LayoutD>::fillValLaunchKernel(dataInstance->deviceD().get(),
                                                      mM,
                                                      mN,
                                                      std::numeric_limits<OutputT>::signaling_NaN());
-
-            // Initialize the host data if we are to use Cpu validation.
-            if constexpr(mRunRefFlag && mIsCpuRef)
-            {
-                dataInstance->copyDeviceToHostAll();
-            }
         }
     }
 
@@ -619,30 +752,7 @@ namespace rocwmma
             /// Run ROCWMMA kernel
             ///
 
-            auto rocwmmaKernel = [this]() {
-                auto& dataInstance = DataStorage::instance();
-                hipExtLaunchKernelGGL((this->kernelImpl()), // Kernel to launch
-                                      (this->gridDim()), // Wg grid size
-                                      (this->blockDim()), // Thread block size
-                                      (this->ldsUsage()), // sharedMemBytes
-                                      0, // stream
-                                      nullptr, // Event start
-                                      nullptr, // event stop
-                                      0, // flags
-                                      this->mM, // M
-                                      this->mN, // N
-                                      this->mK, // K
-                                      dataInstance->deviceA().get(), // A*
-                                      dataInstance->deviceB().get(), // B*
-                                      dataInstance->deviceC().get(), // C*
-                                      dataInstance->deviceD().get(), // D*
-                                      this->mLda, // lda
-                                      this->mLdb, // ldb
-                                      this->mLdc, // ldc
-                                      this->mLdd, // ldd
-                                      this->mAlpha, // alpha
-                                      this->mBeta); // beta
-            };
+            auto rocwmmaKernel = [this]() { launchKernel(this->kernelImpl()); };
 
             // Cold runs for frequency warm-up
             for(uint32_t i = 0; i < mColdRuns; ++i)
@@ -680,6 +790,63 @@ namespace rocwmma
             CHECK_HIP_ERROR(hipEventDestroy(startEvent));
             CHECK_HIP_ERROR(hipEventDestroy(stopEvent));
 
+            ///
+            /// Validate and time the streaming epilogue, if available.
+            /// Results of D are identical, only the cache policy of the store differs.
+            ///
+            auto streamingKernelFunc = streamingKernelImpl();
+            if((bool)ROCWMMA_VALIDATION_TESTS && streamingKernelFunc != nullptr)
+            {
+                // The streaming D must match the default D exactly. It is then left in
+                // D, to be validated against the reference as well.
+                auto& dataInstance = DataStorage::instance();
+                auto  defaultD     = dataInstance->template allocDevice<OutputT>(mM * mN);
+                dataInstance->copyData(defaultD, dataInstance->deviceD(), mM * mN);
+
+                // Reset device D with NaN, so that missed stores are caught
+                MatrixUtil<LayoutD>::fillValLaunchKernel(
+                    dataInstance->deviceD().get(),
+                    mM,
+                    mN,
+                    std::numeric_limits<OutputT>::signaling_NaN());
+
+                launchKernel(streamingKernelFunc);
+
+                auto streamingStats = compareStatsLaunchKernel<OutputT, OutputT, LayoutD, LayoutD>(
+                    dataInstance->deviceD().get(), defaultD.get(), mM, mN, 1u, 0.0);
+
+                EXPECT_TRUE(streamingStats.passed) << "Streaming epilogue: " << streamingStats;
+            }
+
+            if((bool)ROCWMMA_BENCHMARK_TESTS && streamingKernelFunc != nullptr)
+            {
+                for(uint32_t i = 0; i < mColdRuns; ++i)
+                {
+                    launchKernel(streamingKernelFunc);
+                }
+
+                CHECK_HIP_ERROR(hipEventCreate(&startEvent));
+                CHECK_HIP_ERROR(hipEventCreate(&stopEvent));
+                CHECK_HIP_ERROR(hipEventRecord(startEvent));
+                for(uint32_t i = 0; i < mHotRuns; ++i)
+                {
+                    launchKernel(streamingKernelFunc);
+                }
+                CHECK_HIP_ERROR(hipEventRecord(stopEvent));
+                CHECK_HIP_ERROR(hipEventSynchronize(stopEvent));
+
+                auto streamingTimeMs = 0.0f;
+                CHECK_HIP_ERROR(hipEventElapsedTime(&streamingTimeMs, startEvent, stopEvent));
+                CHECK_HIP_ERROR(hipEventDestroy(startEvent));
+                CHECK_HIP_ERROR(hipEventDestroy(stopEvent));
+
+                mStreamingMeasuredTFlopsPerSec
+                    = calculateTFlopsPerSec(mM, mN, mK, float64_t(streamingTimeMs))
+                      * static_cast<float64_t>(mHotRuns);
+                mStreamingEfficiency
+                    = round(mStreamingMeasuredTFlopsPerSec / devicePeakGFlopsPerSec * 100000.0);
+            }
+
             if constexpr(mRunRefFlag)
             {
                 // Reference kernel selection
@@ -690,19 +857,63 @@ namespace rocwmma
 
 #if ROCWMMA_VALIDATION_TESTS
 
-                    // Define fallback CPU kernel
+                    // Define fallback CPU kernel. The result only depends on the problem,
+                    // so it is shared with all other kernel variants through the cache.
                     auto cpuKernel = [this]() {
                         auto& dataInstance = DataStorage::instance();
-                        gemm_CPU<InputT, OutputT, ComputeT, LayoutA, LayoutB, LayoutC, LayoutD>(
-                            this->mM,
-                            this->mN,
-                            this->mK,
-                            dataInstance->hostA().get(),
-                            dataInstance->hostB().get(),
-                            dataInstance->hostC().get(),
-                            dataInstance->hostD().get(),
-                            this->mAlpha,
-                            this->mBeta);
+
+                        auto key = ReferenceKey("gemm_CPU", this->mFillSeed);
+                        key.field("m", this->mM)
+                            .field("n", this->mN)
+                            .field("k", this->mK)
+                            .type<InputT>("InputT")
+                            .type<OutputT>("OutputT")
+                            .type<ComputeT>("ComputeT")
+                            .type<LayoutA>("LayoutA")
+                            .type<LayoutB>("LayoutB")
+                            .type<LayoutC>("LayoutC")
+                            .type<LayoutD>("LayoutD")
+                            .bits("alpha", this->mAlpha)
+                            .bits("beta", this->mBeta);
+
+                        auto bytes  = static_cast<uint64_t>(this->mM) * this->mN * sizeof(OutputT);
+                        auto output = ReferenceBuffer{dataInstance->hostD().get(), bytes};
+
+                        ReferenceCache::instance()->run(key, {output}, [this, &dataInstance]() {
+                            // Generate the same inputs as the device on host, instead
+                            // of copying them back. Only needed if the cache misses.
+                            MatrixUtil<LayoutA>::fillRandom(dataInstance->hostA().get(),
+                                                            this->mM,
+                                                            this->mK,
+                                                            this->mFillSeed,
+                                                            FillStreamA);
+                            MatrixUtil<LayoutB>::fillRandom(dataInstance->hostB().get(),
+                                                            this->mK,
+                                                            this->mN,
+                                                            this->mFillSeed,
+                                                            FillStreamB);
+                            MatrixUtil<LayoutC>::fillRandom(dataInstance->hostC().get(),
+                                                            this->mM,
+                                                            this->mN,
+                                                            this->mFillSeed,
+                                                            FillStreamC);
+
+                            gemm_CPU<InputT,
+                                     OutputT,
+                                     ComputeT,
+                                     LayoutA,
+                                     LayoutB,
+                                     LayoutC,
+                                     LayoutD>(this->mM,
+                                              this->mN,
+                                              this->mK,
+                                              dataInstance->hostA().get(),
+                                              dataInstance->hostB().get(),
+                                              dataInstance->hostC().get(),
+                                              dataInstance->hostD().get(),
+                                              this->mAlpha,
+                                              this->mBeta);
+                        });
                     };
 
                     // Assign cpu func
@@ -790,8 +1001,8 @@ namespace rocwmma
                     // rocBLAS matrix C is always in col_major, so adjust it if needed
                     if(!std::is_same<LayoutC, col_major>::value)
                     {
-                        MatrixUtil<col_major>::fillLaunchKernel(
-                            dataInstance->deviceC().get(), mM, mN);
+                        MatrixUtil<col_major>::fillRandomLaunchKernel(
+                            dataInstance->deviceC().get(), mM, mN, mFillSeed, FillStreamC);
                     }
 
                     // Reset device D with NaN
@@ -913,11 +1124,11 @@ namespace rocwmma
             // FMA operations will be very prone to significant errors.
             double errorTolerance = sizeof(ComputeT) < sizeof(float32_t) ? 100.0 : 10.0;
 
-            std::tie(mValidationResult, mMaxRelativeError)
-                = compareEqualLaunchKernel<OutputT, OutputT, LayoutD, DeviceRefLayout>(
-                    rocWMMAResult, refResult, mM, mN, errorTolerance);
+            mCompareStats = compareStatsLaunchKernel<OutputT, OutputT, LayoutD, DeviceRefLayout>(
+                rocWMMAResult, refResult, mM, mN, 1u, errorTolerance);
+            std::tie(mValidationResult, mMaxRelativeError) = compareResult<OutputT>(mCompareStats);
 
-            EXPECT_TRUE(mValidationResult) << "Max relative error: " << mMaxRelativeError;
+            EXPECT_TRUE(mValidationResult) << mCompareStats;
         }
     }
 
@@ -0,0 +1,240 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GEMM_LDS_ANALYSIS_HPP
+#define GEMM_LDS_ANALYSIS_HPP
+
+#include <algorithm>
+#include <string>
+#include <type_traits>
+
+#include "gemm_config.hpp"
+#include "lds_bank_analyzer.hpp"
+
+namespace rocwmma
+{
+    namespace CooperativeGemm
+    {
+        namespace LdsAnalysis
+        {
+            /*
+            * Host model of the LDS traffic of one pipeline stage of a cooperative
+            * GEMM, for static bank conflict analysis of its LdsMapping:
+            *
+            * - Local writes (LW): each writer wave's share of the cooperative
+            *   store of every GR fragment of A and B into LDS.
+            * - Local reads (LR): every consumer wave's load of its MFMA
+            *   fragments of A and B from LDS.
+            *
+            * The LDS coordinates and cooperative schedules are those of the
+            * GemmConfig, evaluated for each wave coordinate of a grid of
+            * (rows, cols) consumer waves. Every stage buffer has the same
+            * layout, so one stage is representative of all of them.
+            */
+
+            struct GemmLdsReport
+            {
+                LdsReport localWrites;
+                LdsReport localReads;
+
+                // Size of one stage of the LDS buffer
+                uint64_t ldsBytes;
+            };
+
+            // LDS accesses of one stage of the GemmConfig on a grid of (wgRows,
+            // wgCols) consumer waves. With non-zero TBlockX / TBlockY, the grid
+            // must be (TBlockX / AMDGCN_WAVE_SIZE, TBlockY).
+            template <typename GemmConfig,
+                      uint32_t BlockM,
+                      uint32_t BlockN,
+                      uint32_t BlockK,
+                      typename InputT,
+                      typename LayoutA,
+                      typename LayoutB,
+                      typename LayoutLds,
+                      uint32_t BlocksX,
+                      uint32_t BlocksY,
+                      uint32_t TBlockX = 0,
+                      uint32_t TBlockY = 0>
+            struct GemmLdsAnalyzer
+            {
+                // Output types and layouts do not affect the LDS
+                using GlobalMapping = typename GemmConfig::template GlobalMapping<BlockM,
+                                                                                  BlockN,
+                                                                                  BlockK,
+                                                                                  InputT,
+                                                                                  float32_t,
+                                                                                  float32_t,
+                                                                                  LayoutA,
+                                                                                  LayoutB,
+                                                                                  row_major,
+                                                                                  row_major,
+                                                                                  BlocksX,
+                                                                                  BlocksY,
+                                                                                  TBlockX,
+                                                                                  TBlockY>;
+
+                using LdsMapping =
+                    typename GemmConfig::template LdsMapping<GlobalMapping, LayoutLds>;
+                using CoopSchedulerA =
+                    typename GemmConfig::template CoopSchedulerA<TBlockX, TBlockY>;
+                using CoopSchedulerB =
+                    typename GemmConfig::template CoopSchedulerB<TBlockX, TBlockY>;
+
+                using DataLayoutLds = typename LdsMapping::DataLayout;
+
+                // Producer waves are launched after the consumer waves, and are
+                // the only writers.
+                constexpr static uint32_t ProducerRows
+                    = Schedule::ProducerRowCount<CoopSchedulerA>::value;
+                static_assert(ProducerRows == Schedule::ProducerRowCount<CoopSchedulerB>::value,
+                              "A and B must have the same writer waves");
+
+                // The driver uses the template WaveCount coop IO when it is constexpr
+                constexpr static Coord2d TBlockDim
+                    = rocwmma::detail::waveCount(make_coord2d(TBlockX, TBlockY));
+                constexpr static uint32_t WaveCountA
+                    = Schedule::WaveCountIsConstexpr<CoopSchedulerA>::value
+                          ? CoopSchedulerA::waveCount(TBlockDim)
+                          : 1u;
+                constexpr static uint32_t WaveCountB
+                    = Schedule::WaveCountIsConstexpr<CoopSchedulerB>::value
+                          ? CoopSchedulerB::waveCount(TBlockDim)
+                          : 1u;
+
+                // GR buffers are either arrays of block fragments, or one fragment
+                constexpr static uint32_t GRCountA = std::max(
+                    1u, (uint32_t)std::extent<typename GlobalMapping::GRBuffA>::value);
+                constexpr static uint32_t GRCountB = std::max(
+                    1u, (uint32_t)std::extent<typename GlobalMapping::GRBuffB>::value);
+
+                static GemmLdsReport analyze(uint32_t wgRows, uint32_t wgCols)
+                {
+                    auto workgroupDim = make_coord2d(wgRows, wgCols);
+                    auto sizeLds      = LdsMapping::sizeLds(workgroupDim);
+                    auto ldLds        = LdsMapping::ldLds(workgroupDim);
+
+                    std::string label = std::string(dataTypeToString<GemmConfig>()) + " "
+                                        + dataTypeToString<LayoutLds>() + " "
+                                        + dataTypeToString<InputT>() + " "
+                                        + std::to_string(BlockM) + "x" + std::to_string(BlockN)
+                                        + "x" + std::to_string(BlockK) + " Blocks "
+                                        + std::to_string(BlocksX) + "x" + std::to_string(BlocksY)
+                                        + " Waves " + std::to_string(wgRows) + "x"
+                                        + std::to_string(wgCols);
+
+                    GemmLdsReport result{LdsReport(label + " LW"),
+                                         LdsReport(label + " LR"),
+                                         static_cast<uint64_t>(get<0>(sizeLds)) * get<1>(sizeLds)
+                                             * sizeof(InputT)};
+
+                    auto writerCol0 = ProducerRows == 0u ? 0u : wgCols;
+                    auto writerCols = ProducerRows == 0u ? wgCols : ProducerRows;
+                    for(uint32_t row = 0u; row < wgRows; row++)
+                    {
+                        for(uint32_t col = writerCol0; col < writerCol0 + writerCols; col++)
+                        {
+                            localWrite(
+                                result.localWrites, ldLds, make_coord2d(row, col), workgroupDim);
+                        }
+                    }
+
+                    for(uint32_t row = 0u; row < wgRows; row++)
+                    {
+                        for(uint32_t col = 0u; col < wgCols; col++)
+                        {
+                            localRead(
+                                result.localReads, ldLds, make_coord2d(row, col), workgroupDim);
+                        }
+                    }
+
+                    return result;
+                }
+
+            private:
+                // As the driver's localWriteCoopA/B of the GR buffers
+                static void localWrite(LdsReport&     report,
+                                       uint32_t       ldLds,
+                                       Coord2d const& waveCoord,
+                                       Coord2d const& workgroupDim)
+                {
+                    using LWFragA = typename LdsMapping::LWFragA;
+                    using LWFragB = typename LdsMapping::LWFragB;
+
+                    auto coordA = LdsMapping::writeCoordA(waveCoord, workgroupDim);
+                    for(uint32_t i = 0u; i < GRCountA; i++)
+                    {
+                        report.append(analyzeLdsCoopStore<LWFragA, DataLayoutLds, WaveCountA>(
+                            ldLds,
+                            coordA,
+                            CoopSchedulerA::waveIndex(waveCoord, workgroupDim),
+                            CoopSchedulerA::waveCount(workgroupDim)));
+                        coordA = coordA + LdsMapping::blockOffsetA();
+                    }
+
+                    auto coordB = LdsMapping::writeCoordB(waveCoord, workgroupDim);
+                    for(uint32_t i = 0u; i < GRCountB; i++)
+                    {
+                        report.append(analyzeLdsCoopStore<LWFragB, DataLayoutLds, WaveCountB>(
+                            ldLds,
+                            coordB,
+                            CoopSchedulerB::waveIndex(waveCoord, workgroupDim),
+                            CoopSchedulerB::waveCount(workgroupDim)));
+                        coordB = coordB + LdsMapping::blockOffsetB();
+                    }
+                }
+
+                // As the driver's localReadA/B of the MFMA buffers
+                static void localRead(LdsReport&     report,
+                                      uint32_t       ldLds,
+                                      Coord2d const& waveCoord,
+                                      Coord2d const& workgroupDim)
+                {
+                    using LRFragA = typename LdsMapping::LRFragA;
+                    using LRFragB = typename LdsMapping::LRFragB;
+
+                    auto coordA = LdsMapping::readCoordA(waveCoord, workgroupDim);
+                    for(uint32_t i = 0u; i < BlocksX; i++)
+                    {
+                        report.append(analyzeLdsLoad<LRFragA, DataLayoutLds>(ldLds, coordA));
+                        coordA = coordA + LdsMapping::blockOffsetA();
+                    }
+
+                    auto coordB = LdsMapping::readCoordB(waveCoord, workgroupDim);
+                    for(uint32_t i = 0u; i < BlocksY; i++)
+                    {
+                        report.append(analyzeLdsLoad<LRFragB, DataLayoutLds>(ldLds, coordB));
+                        coordB = coordB + LdsMapping::blockOffsetB();
+                    }
+                }
+            };
+
+        } // namespace LdsAnalysis
+
+    } // namespace CooperativeGemm
+
+} // namespace rocwmma
+
+#endif // GEMM_LDS_ANALYSIS_HPP
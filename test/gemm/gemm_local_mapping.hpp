@@ -26,6 +26,8 @@
 #ifndef GEMM_LOCAL_MAPPING_HPP
 #define GEMM_LOCAL_MAPPING_HPP
 
+#include <algorithm>
+
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 #include <rocwmma/rocwmma.hpp>
@@ -37,7 +39,59 @@ namespace rocwmma
 {
     namespace LocalMapping
     {
-        template <typename GlobalMapping, typename LayoutLds>
+        namespace detail
+        {
+            /*
+            * Xor swizzle for LDS lines of LineLength elements, which are accessed by
+            * fragment IO of up to VectorWidth contiguous elements.
+            *
+            * The LDS has 32 banks of 4 bytes, such that lines of K-contiguous fragment
+            * blocks (LineLength = BlockK) start in the same banks and consecutive lanes
+            * conflict. Chunks of whole IO vectors are permuted by the line index:
+            * - Lines shorter than the 128 byte bank span are grouped (LineGroup), as
+            *   consecutive lines of the group already occupy different banks.
+            * - The permuted chunks of one line span at most all 32 banks.
+            * - The permutation repeats in at most 16 lines, such that it is aligned to
+            *   all block, wave and stage offsets in LDS (BlockDim >= 16).
+            */
+            template <typename DataT, uint32_t LineLength, uint32_t VectorWidth>
+            struct LdsSwizzle
+            {
+            private:
+                constexpr static uint32_t BankSpanBytes = 128u;
+                constexpr static uint32_t MaxLines      = 16u;
+                constexpr static uint32_t LineBytes     = LineLength * (uint32_t)sizeof(DataT);
+                constexpr static uint32_t VectorBytes   = VectorWidth * (uint32_t)sizeof(DataT);
+
+            public:
+                constexpr static uint32_t ChunkSize = VectorWidth;
+                constexpr static uint32_t LineGroup = std::max(1u, BankSpanBytes / LineBytes);
+                constexpr static uint32_t ChunkCount
+                    = std::max(1u,
+                               std::min({LineLength / ChunkSize,
+                                         BankSpanBytes / VectorBytes,
+                                         MaxLines / LineGroup}));
+
+                static_assert(LineLength % (ChunkSize * ChunkCount) == 0u,
+                              "LDS lines must contain whole groups of swizzled chunks");
+
+                using Type = xor_swizzle<ChunkSize, ChunkCount, LineGroup>;
+
+                template <typename LayoutLds>
+                using DataLayout
+                    = DataLayout::XorSwizzle<LayoutLds, ChunkSize, ChunkCount, LineGroup>;
+            };
+
+            // Widest IO vector of the given fragments
+            template <typename... FragTs>
+            constexpr static inline uint32_t maxVectorWidth()
+            {
+                return std::max({(uint32_t)GetIOConfig_t<FragTs>::IOLayout::VW...});
+            }
+
+        } // namespace detail
+
+        template <typename GlobalMapping, typename LayoutLds, bool SwizzleLds = false>
         struct LdsMappingTN
         {
             /*
@@ -73,10 +127,12 @@ namespace rocwmma
             *
             * TLDR: Take the Global Read fragments, transpose A and write the resulting frags into LDS
             * stacked beside each other using BlockK as common height.
+            *
+            * SwizzleLds: col_major LDS columns are K-contiguous and BlockK long, such that
+            * consecutive columns of LR frags fall into the same banks. These are xor swizzled
+            * in the LDS. row_major LDS rows are lane-contiguous and are not swizzled.
             */
 
-            using DataLayout = DataLayout::Array1d<LayoutLds>;
-
             /// LOCAL WRITE -> GR frags
             // K = BlockHeight
             // GRFragA Transposed
@@ -118,14 +174,29 @@ namespace rocwmma
         private:
             constexpr static uint32_t LdsHeight = GetIOShape_t<LWFragA>::BlockHeight;
 
+            using LdsSwizzle = detail::
+                LdsSwizzle<GetDataType_t<LWFragA>,
+                           LdsHeight,
+                           detail::maxVectorWidth<LWFragA, LWFragB, LRFragA, LRFragB>()>;
+
+        public:
+            constexpr static bool IsSwizzled
+                = SwizzleLds && std::is_same<LayoutLds, col_major>::value;
+
+            using Swizzle    = typename LdsSwizzle::Type;
+            using DataLayout
+                = std::conditional_t<IsSwizzled,
+                                     typename LdsSwizzle::template DataLayout<LayoutLds>,
+                                     DataLayout::Array1d<LayoutLds>>;
+
         public: // Implicit interface for local mapping object
             // Offset of the current wave in the LDS macro tile
             __device__ constexpr static inline auto waveOffsetA();
             __device__ constexpr static inline auto waveOffsetB();
 
             // Block offset between local mfma fragments
-            __device__ constexpr static inline auto blockOffsetA();
-            __device__ constexpr static inline auto blockOffsetB();
+            ROCWMMA_HOST_DEVICE constexpr static inline auto blockOffsetA();
+            ROCWMMA_HOST_DEVICE constexpr static inline auto blockOffsetB();
 
             // The base lds write / read coordinates
             __device__ constexpr static inline auto writeCoordA();
@@ -140,6 +211,26 @@ namespace rocwmma
             // Leading dimension of lds matrix
             __device__ constexpr static inline auto ldLds();
 
+            // The same coordinates and dimensions, for the wave at localWaveCoord in a
+            // workgroup of workgroupDim waves. These are host callable for analysis.
+            ROCWMMA_HOST_DEVICE constexpr static inline auto
+                waveOffsetA(Coord2d const& localWaveCoord);
+            ROCWMMA_HOST_DEVICE constexpr static inline auto
+                waveOffsetB(Coord2d const& localWaveCoord);
+
+            ROCWMMA_HOST_DEVICE constexpr static inline auto
+                writeCoordA(Coord2d const& localWaveCoord, Coord2d const& workgroupDim);
+            ROCWMMA_HOST_DEVICE constexpr static inline auto
+                writeCoordB(Coord2d const& localWaveCoord, Coord2d const& workgroupDim);
+
+            ROCWMMA_HOST_DEVICE constexpr static inline auto
+                readCoordA(Coord2d const& localWaveCoord, Coord2d const& workgroupDim);
+            ROCWMMA_HOST_DEVICE constexpr static inline auto
+                readCoordB(Coord2d const& localWaveCoord, Coord2d const& workgroupDim);
+
+            ROCWMMA_HOST_DEVICE constexpr static inline auto sizeLds(Coord2d const& workgroupDim);
+            ROCWMMA_HOST_DEVICE constexpr static inline auto ldLds(Coord2d const& workgroupDim);
+
             template <uint32_t WaveCount = 1>
             __device__ constexpr static inline auto
                 formatLWFragA(typename GlobalMapping::GRFragA const& grFragA)
@@ -156,7 +247,7 @@ namespace rocwmma
             }
         };
 
-        template <typename GlobalMapping, typename LayoutLds>
+        template <typename GlobalMapping, typename LayoutLds, bool SwizzleLds = false>
         struct LdsMappingNT
         {
             /* LdsMappingNT (Block Width = LDS Width = BlockK)
@@ -203,10 +294,12 @@ namespace rocwmma
             *
             * TLDR: Take the Global Read fragments, transpose B and write the resulting frags into LDS
             * stacked on top of each other using BlockK as common width.
+            *
+            * SwizzleLds: row_major LDS rows are K-contiguous and BlockK long, such that
+            * consecutive rows of LR frags fall into the same banks. These are xor swizzled
+            * in the LDS. col_major LDS columns are lane-contiguous and are not swizzled.
             */
 
-            using DataLayout = DataLayout::Array1d<LayoutLds>;
-
             /// LOCAL WRITE -> GR frags
             // K = BlockWidth
             // GRFragA unchanged
@@ -248,14 +341,29 @@ namespace rocwmma
         private:
             constexpr static uint32_t LdsWidth = GetIOShape_t<LWFragA>::BlockWidth;
 
+            using LdsSwizzle = detail::
+                LdsSwizzle<GetDataType_t<LWFragA>,
+                           LdsWidth,
+                           detail::maxVectorWidth<LWFragA, LWFragB, LRFragA, LRFragB>()>;
+
+        public:
+            constexpr static bool IsSwizzled
+                = SwizzleLds && std::is_same<LayoutLds, row_major>::value;
+
+            using Swizzle    = typename LdsSwizzle::Type;
+            using DataLayout
+                = std::conditional_t<IsSwizzled,
+                                     typename LdsSwizzle::template DataLayout<LayoutLds>,
+                                     DataLayout::Array1d<LayoutLds>>;
+
         public: // Implicit interface for local mapping object
             // Offset of the current wave in the LDS macro tile
             __device__ constexpr static inline auto waveOffsetA();
             __device__ constexpr static inline auto waveOffsetB();
 
             // Block offset between local mfma fragments
-            __device__ constexpr static inline auto blockOffsetA();
-            __device__ constexpr static inline auto blockOffsetB();
+            ROCWMMA_HOST_DEVICE constexpr static inline auto blockOffsetA();
+            ROCWMMA_HOST_DEVICE constexpr static inline auto blockOffsetB();
 
             // The base lds write / read coordinates
             __device__ constexpr static inline auto writeCoordA();
@@ -270,6 +378,26 @@ namespace rocwmma
             // Leading dimension of shared memory usage
             __device__ constexpr static inline auto ldLds();
 
+            // The same coordinates and dimensions, for the wave at localWaveCoord in a
+            // workgroup of workgroupDim waves. These are host callable for analysis.
+            ROCWMMA_HOST_DEVICE constexpr static inline auto
+                waveOffsetA(Coord2d const& localWaveCoord);
+            ROCWMMA_HOST_DEVICE constexpr static inline auto
+                waveOffsetB(Coord2d const& localWaveCoord);
+
+            ROCWMMA_HOST_DEVICE constexpr static inline auto
+                writeCoordA(Coord2d const& localWaveCoord, Coord2d const& workgroupDim);
+            ROCWMMA_HOST_DEVICE constexpr static inline auto
+                writeCoordB(Coord2d const& localWaveCoord, Coord2d const& workgroupDim);
+
+            ROCWMMA_HOST_DEVICE constexpr static inline auto
+                readCoordA(Coord2d const& localWaveCoord, Coord2d const& workgroupDim);
+            ROCWMMA_HOST_DEVICE constexpr static inline auto
+                readCoordB(Coord2d const& localWaveCoord, Coord2d const& workgroupDim);
+
+            ROCWMMA_HOST_DEVICE constexpr static inline auto sizeLds(Coord2d const& workgroupDim);
+            ROCWMMA_HOST_DEVICE constexpr static inline auto ldLds(Coord2d const& workgroupDim);
+
             template <uint32_t WaveCount = 1>
             __device__ constexpr static inline auto
                 formatLWFragA(typename GlobalMapping::GRFragA const& grFragA)
@@ -345,6 +473,9 @@ namespace rocwmma
             * and read them back. Only works with MFMA friendly fragments.
             */
 
+            // Register file rows are lane-contiguous, and do not need swizzling.
+            constexpr static bool IsSwizzled = false;
+
             using DataLayout = DataLayout::Array1d<LayoutLds>;
 
             /// LOCAL WRITE -> GR frags (MFMA blocks)
@@ -384,8 +515,8 @@ namespace rocwmma
             constexpr static uint32_t LdsWidth = Constants::AMDGCN_WAVE_SIZE;
 
             // Project coordinates into stacked register file space
-            __device__ constexpr static inline auto projCoordA(Coord2d const& coordA);
-            __device__ constexpr static inline auto projCoordB(Coord2d const& coordB);
+            ROCWMMA_HOST_DEVICE constexpr static inline auto projCoordA(Coord2d const& coordA);
+            ROCWMMA_HOST_DEVICE constexpr static inline auto projCoordB(Coord2d const& coordB);
 
         public: // Implicit interface for local mapping object
             // Offset of the current wave in the LDS macro tile
@@ -393,8 +524,8 @@ namespace rocwmma
             __device__ constexpr static inline auto waveOffsetB();
 
             // Block offset between local mfma fragments
-            __device__ constexpr static inline auto blockOffsetA();
-            __device__ constexpr static inline auto blockOffsetB();
+            ROCWMMA_HOST_DEVICE constexpr static inline auto blockOffsetA();
+            ROCWMMA_HOST_DEVICE constexpr static inline auto blockOffsetB();
 
             // The base lds write / read coordinates
             __device__ constexpr static inline auto writeCoordA();
@@ -409,6 +540,26 @@ namespace rocwmma
             // Leading dimension of lds matrix
             __device__ constexpr static inline auto ldLds();
 
+            // The same coordinates and dimensions, for the wave at localWaveCoord in a
+            // workgroup of workgroupDim waves. These are host callable for analysis.
+            ROCWMMA_HOST_DEVICE constexpr static inline auto
+                waveOffsetA(Coord2d const& localWaveCoord);
+            ROCWMMA_HOST_DEVICE constexpr static inline auto
+                waveOffsetB(Coord2d const& localWaveCoord);
+
+            ROCWMMA_HOST_DEVICE constexpr static inline auto
+                writeCoordA(Coord2d const& localWaveCoord, Coord2d const& workgroupDim);
+            ROCWMMA_HOST_DEVICE constexpr static inline auto
+                writeCoordB(Coord2d const& localWaveCoord, Coord2d const& workgroupDim);
+
+            ROCWMMA_HOST_DEVICE constexpr static inline auto
+                readCoordA(Coord2d const& localWaveCoord, Coord2d const& workgroupDim);
+            ROCWMMA_HOST_DEVICE constexpr static inline auto
+                readCoordB(Coord2d const& localWaveCoord, Coord2d const& workgroupDim);
+
+            ROCWMMA_HOST_DEVICE constexpr static inline auto sizeLds(Coord2d const& workgroupDim);
+            ROCWMMA_HOST_DEVICE constexpr static inline auto ldLds(Coord2d const& workgroupDim);
+
             template <uint32_t WaveCount = 1>
             __device__ constexpr static inline auto
                 formatLWFragA(typename GlobalMapping::GRFragA const& grFragA)
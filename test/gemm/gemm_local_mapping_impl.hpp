@@ -34,175 +34,308 @@ namespace rocwmma
     namespace LocalMapping
     {
 
-#define LdsMappingT typename GlobalMapping, typename LayoutLds
+#define LdsMappingT typename GlobalMapping, typename LayoutLds, bool SwizzleLds
 
-#define LdsMappingT_impl GlobalMapping, LayoutLds
+#define LdsMappingT_impl GlobalMapping, LayoutLds, SwizzleLds
 
         template <LdsMappingT>
         __device__ constexpr inline auto LdsMappingTN<LdsMappingT_impl>::waveOffsetA()
         {
-            return swap(GlobalMapping::waveOffsetA());
+            return waveOffsetA(GlobalMapping::WaveSpace::localWaveCoord());
         }
 
         template <LdsMappingT>
         __device__ constexpr inline auto LdsMappingTN<LdsMappingT_impl>::waveOffsetB()
         {
-            return GlobalMapping::waveOffsetB();
+            return waveOffsetB(GlobalMapping::WaveSpace::localWaveCoord());
         }
 
         template <LdsMappingT>
-        __device__ constexpr inline auto LdsMappingTN<LdsMappingT_impl>::blockOffsetA()
+        ROCWMMA_HOST_DEVICE constexpr inline auto
+            LdsMappingTN<LdsMappingT_impl>::waveOffsetA(Coord2d const& localWaveCoord)
+        {
+            return swap(GlobalMapping::waveOffsetA(localWaveCoord));
+        }
+
+        template <LdsMappingT>
+        ROCWMMA_HOST_DEVICE constexpr inline auto
+            LdsMappingTN<LdsMappingT_impl>::waveOffsetB(Coord2d const& localWaveCoord)
+        {
+            return GlobalMapping::waveOffsetB(localWaveCoord);
+        }
+
+        template <LdsMappingT>
+        ROCWMMA_HOST_DEVICE constexpr inline auto LdsMappingTN<LdsMappingT_impl>::blockOffsetA()
         {
             return swap(GlobalMapping::blockOffsetA());
         }
 
         template <LdsMappingT>
-        __device__ constexpr inline auto LdsMappingTN<LdsMappingT_impl>::blockOffsetB()
+        ROCWMMA_HOST_DEVICE constexpr inline auto LdsMappingTN<LdsMappingT_impl>::blockOffsetB()
         {
             return GlobalMapping::blockOffsetB();
         }
 
         template <LdsMappingT>
         __device__ constexpr inline auto LdsMappingTN<LdsMappingT_impl>::writeCoordA()
+        {
+            return writeCoordA(GlobalMapping::WaveSpace::localWaveCoord(),
+                               GlobalMapping::WaveSpace::workgroupDim());
+        }
+
+        template <LdsMappingT>
+        __device__ constexpr inline auto LdsMappingTN<LdsMappingT_impl>::writeCoordB()
+        {
+            return writeCoordB(GlobalMapping::WaveSpace::localWaveCoord(),
+                               GlobalMapping::WaveSpace::workgroupDim());
+        }
+
+        template <LdsMappingT>
+        __device__ constexpr inline auto LdsMappingTN<LdsMappingT_impl>::readCoordA()
+        {
+            return readCoordA(GlobalMapping::WaveSpace::localWaveCoord(),
+                              GlobalMapping::WaveSpace::workgroupDim());
+        }
+
+        template <LdsMappingT>
+        __device__ constexpr inline auto LdsMappingTN<LdsMappingT_impl>::readCoordB()
+        {
+            return readCoordB(GlobalMapping::WaveSpace::localWaveCoord(),
+                              GlobalMapping::WaveSpace::workgroupDim());
+        }
+
+        template <LdsMappingT>
+        __device__ constexpr inline auto LdsMappingTN<LdsMappingT_impl>::sizeLds()
+        {
+            return sizeLds(GlobalMapping::WaveSpace::workgroupDim());
+        }
+
+        template <LdsMappingT>
+        __device__ constexpr inline auto LdsMappingTN<LdsMappingT_impl>::ldLds()
+        {
+            return ldLds(GlobalMapping::WaveSpace::workgroupDim());
+        }
+
+        template <LdsMappingT>
+        ROCWMMA_HOST_DEVICE constexpr inline auto
+            LdsMappingTN<LdsMappingT_impl>::writeCoordA(Coord2d const& localWaveCoord,
+                                                        Coord2d const& workgroupDim)
         {
             // Base lds coordA = (0, 0).
             // For local write, must add wave offset if global read tile is a wave tile
             auto baseCoordA = make_coord2d(0u, 0u);
-            return GlobalMapping::readABWaveTile() ? baseCoordA + waveOffsetA() : baseCoordA;
+            return GlobalMapping::readABWaveTile() ? baseCoordA + waveOffsetA(localWaveCoord)
+                                                   : baseCoordA;
         }
 
         template <LdsMappingT>
-        __device__ constexpr inline auto LdsMappingTN<LdsMappingT_impl>::writeCoordB()
+        ROCWMMA_HOST_DEVICE constexpr inline auto
+            LdsMappingTN<LdsMappingT_impl>::writeCoordB(Coord2d const& localWaveCoord,
+                                                        Coord2d const& workgroupDim)
         {
             // B data will start right after A data
             // For local write, must add wave offset if global read tile is a wave tile
-            auto baseCoordB = swap(GlobalMapping::projCoordA(GlobalMapping::macroTileSizeC()));
-            return GlobalMapping::readABWaveTile() ? baseCoordB + waveOffsetB() : baseCoordB;
+            auto baseCoordB
+                = swap(GlobalMapping::projCoordA(GlobalMapping::macroTileSizeC(workgroupDim)));
+            return GlobalMapping::readABWaveTile() ? baseCoordB + waveOffsetB(localWaveCoord)
+                                                   : baseCoordB;
         }
 
         template <LdsMappingT>
-        __device__ constexpr inline auto LdsMappingTN<LdsMappingT_impl>::readCoordA()
+        ROCWMMA_HOST_DEVICE constexpr inline auto
+            LdsMappingTN<LdsMappingT_impl>::readCoordA(Coord2d const& localWaveCoord,
+                                                       Coord2d const& workgroupDim)
         {
             // Base lds coordA = (0, 0).
             // For local read, will be in MFMA format, so we need the wave offset
             auto baseCoordA = make_coord2d(0u, 0u);
-            return baseCoordA + waveOffsetA();
+            return baseCoordA + waveOffsetA(localWaveCoord);
         }
 
         template <LdsMappingT>
-        __device__ constexpr inline auto LdsMappingTN<LdsMappingT_impl>::readCoordB()
+        ROCWMMA_HOST_DEVICE constexpr inline auto
+            LdsMappingTN<LdsMappingT_impl>::readCoordB(Coord2d const& localWaveCoord,
+                                                       Coord2d const& workgroupDim)
         {
             // B data will start right after A data
             // For local read, will be in MFMA format, so we need the wave offset
-            auto baseCoordB = swap(GlobalMapping::projCoordA(GlobalMapping::macroTileSizeC()));
-            return baseCoordB + waveOffsetB();
+            auto baseCoordB
+                = swap(GlobalMapping::projCoordA(GlobalMapping::macroTileSizeC(workgroupDim)));
+            return baseCoordB + waveOffsetB(localWaveCoord);
         }
 
         template <LdsMappingT>
-        __device__ constexpr inline auto LdsMappingTN<LdsMappingT_impl>::sizeLds()
+        ROCWMMA_HOST_DEVICE constexpr inline auto
+            LdsMappingTN<LdsMappingT_impl>::sizeLds(Coord2d const& workgroupDim)
         {
-            auto macroTileC = GlobalMapping::macroTileSizeC();
+            auto macroTileC = GlobalMapping::macroTileSizeC(workgroupDim);
             return make_coord2d(LdsHeight, get<0>(macroTileC) + get<1>(macroTileC));
         }
 
         template <LdsMappingT>
-        __device__ constexpr inline auto LdsMappingTN<LdsMappingT_impl>::ldLds()
+        ROCWMMA_HOST_DEVICE constexpr inline auto
+            LdsMappingTN<LdsMappingT_impl>::ldLds(Coord2d const& workgroupDim)
         {
-            return DataLayout::leadingDim(sizeLds());
+            return DataLayout::leadingDim(sizeLds(workgroupDim));
         }
 
 #undef LdsMappingT
 #undef LdsMappingT_impl
 
-#define LdsMappingT typename GlobalMapping, typename LayoutLds
+#define LdsMappingT typename GlobalMapping, typename LayoutLds, bool SwizzleLds
 
-#define LdsMappingT_impl GlobalMapping, LayoutLds
+#define LdsMappingT_impl GlobalMapping, LayoutLds, SwizzleLds
 
         template <LdsMappingT>
         __device__ constexpr inline auto LdsMappingNT<LdsMappingT_impl>::waveOffsetA()
         {
-            return GlobalMapping::waveOffsetA();
+            return waveOffsetA(GlobalMapping::WaveSpace::localWaveCoord());
         }
 
         template <LdsMappingT>
         __device__ constexpr inline auto LdsMappingNT<LdsMappingT_impl>::waveOffsetB()
         {
-            return swap(GlobalMapping::waveOffsetB());
+            return waveOffsetB(GlobalMapping::WaveSpace::localWaveCoord());
+        }
+
+        template <LdsMappingT>
+        ROCWMMA_HOST_DEVICE constexpr inline auto
+            LdsMappingNT<LdsMappingT_impl>::waveOffsetA(Coord2d const& localWaveCoord)
+        {
+            return GlobalMapping::waveOffsetA(localWaveCoord);
         }
 
         template <LdsMappingT>
-        __device__ constexpr inline auto LdsMappingNT<LdsMappingT_impl>::blockOffsetA()
+        ROCWMMA_HOST_DEVICE constexpr inline auto
+            LdsMappingNT<LdsMappingT_impl>::waveOffsetB(Coord2d const& localWaveCoord)
+        {
+            return swap(GlobalMapping::waveOffsetB(localWaveCoord));
+        }
+
+        template <LdsMappingT>
+        ROCWMMA_HOST_DEVICE constexpr inline auto LdsMappingNT<LdsMappingT_impl>::blockOffsetA()
         {
             return GlobalMapping::blockOffsetA();
         }
 
         template <LdsMappingT>
-        __device__ constexpr inline auto LdsMappingNT<LdsMappingT_impl>::blockOffsetB()
+        ROCWMMA_HOST_DEVICE constexpr inline auto LdsMappingNT<LdsMappingT_impl>::blockOffsetB()
         {
             return swap(GlobalMapping::blockOffsetB());
         }
 
         template <LdsMappingT>
         __device__ constexpr inline auto LdsMappingNT<LdsMappingT_impl>::writeCoordA()
+        {
+            return writeCoordA(GlobalMapping::WaveSpace::localWaveCoord(),
+                               GlobalMapping::WaveSpace::workgroupDim());
+        }
+
+        template <LdsMappingT>
+        __device__ constexpr inline auto LdsMappingNT<LdsMappingT_impl>::writeCoordB()
+        {
+            return writeCoordB(GlobalMapping::WaveSpace::localWaveCoord(),
+                               GlobalMapping::WaveSpace::workgroupDim());
+        }
+
+        template <LdsMappingT>
+        __device__ constexpr inline auto LdsMappingNT<LdsMappingT_impl>::readCoordA()
+        {
+            return readCoordA(GlobalMapping::WaveSpace::localWaveCoord(),
+                              GlobalMapping::WaveSpace::workgroupDim());
+        }
+
+        template <LdsMappingT>
+        __device__ constexpr inline auto LdsMappingNT<LdsMappingT_impl>::readCoordB()
+        {
+            return readCoordB(GlobalMapping::WaveSpace::localWaveCoord(),
+                              GlobalMapping::WaveSpace::workgroupDim());
+        }
+
+        template <LdsMappingT>
+        __device__ constexpr inline auto LdsMappingNT<LdsMappingT_impl>::sizeLds()
+        {
+            return sizeLds(GlobalMapping::WaveSpace::workgroupDim());
+        }
+
+        template <LdsMappingT>
+        __device__ constexpr inline auto LdsMappingNT<LdsMappingT_impl>::ldLds()
+        {
+            return ldLds(GlobalMapping::WaveSpace::workgroupDim());
+        }
+
+        template <LdsMappingT>
+        ROCWMMA_HOST_DEVICE constexpr inline auto
+            LdsMappingNT<LdsMappingT_impl>::writeCoordA(Coord2d const& localWaveCoord,
+                                                        Coord2d const& workgroupDim)
         {
             // Base lds coordA = (0, 0).
             // For local write, must add wave offset if global read tile is a wave tile
             auto baseCoordA = make_coord2d(0u, 0u);
-            return GlobalMapping::readABWaveTile() ? baseCoordA + waveOffsetA() : baseCoordA;
+            return GlobalMapping::readABWaveTile() ? baseCoordA + waveOffsetA(localWaveCoord)
+                                                   : baseCoordA;
         }
 
         template <LdsMappingT>
-        __device__ constexpr inline auto LdsMappingNT<LdsMappingT_impl>::writeCoordB()
+        ROCWMMA_HOST_DEVICE constexpr inline auto
+            LdsMappingNT<LdsMappingT_impl>::writeCoordB(Coord2d const& localWaveCoord,
+                                                        Coord2d const& workgroupDim)
         {
             // B data will start right after A data
             // For local write, must add wave offset if global read tile is a wave tile
-            auto baseCoordB = GlobalMapping::projCoordA(GlobalMapping::macroTileSizeC());
-            return GlobalMapping::readABWaveTile() ? baseCoordB + waveOffsetB() : baseCoordB;
+            auto baseCoordB
+                = GlobalMapping::projCoordA(GlobalMapping::macroTileSizeC(workgroupDim));
+            return GlobalMapping::readABWaveTile() ? baseCoordB + waveOffsetB(localWaveCoord)
+                                                   : baseCoordB;
         }
 
         template <LdsMappingT>
-        __device__ constexpr inline auto LdsMappingNT<LdsMappingT_impl>::readCoordA()
+        ROCWMMA_HOST_DEVICE constexpr inline auto
+            LdsMappingNT<LdsMappingT_impl>::readCoordA(Coord2d const& localWaveCoord,
+                                                       Coord2d const& workgroupDim)
         {
             // Base lds coordA = (0, 0).
-            // For local write, must add wave offset if global read tile is a wave tile
+            // For local read, will be in MFMA format, so we need the wave offset
             auto baseCoordA = make_coord2d(0u, 0u);
-            return baseCoordA + waveOffsetA();
+            return baseCoordA + waveOffsetA(localWaveCoord);
         }
 
         template <LdsMappingT>
-        __device__ constexpr inline auto LdsMappingNT<LdsMappingT_impl>::readCoordB()
+        ROCWMMA_HOST_DEVICE constexpr inline auto
+            LdsMappingNT<LdsMappingT_impl>::readCoordB(Coord2d const& localWaveCoord,
+                                                       Coord2d const& workgroupDim)
         {
             // B data will start right after A data
-            // For local write, must add wave offset if global read tile is a wave tile
-            auto baseCoordB = GlobalMapping::projCoordA(GlobalMapping::macroTileSizeC());
-            return baseCoordB + waveOffsetB();
+            // For local read, will be in MFMA format, so we need the wave offset
+            auto baseCoordB
+                = GlobalMapping::projCoordA(GlobalMapping::macroTileSizeC(workgroupDim));
+            return baseCoordB + waveOffsetB(localWaveCoord);
         }
 
         template <LdsMappingT>
-        __device__ constexpr inline auto LdsMappingNT<LdsMappingT_impl>::sizeLds()
+        ROCWMMA_HOST_DEVICE constexpr inline auto
+            LdsMappingNT<LdsMappingT_impl>::sizeLds(Coord2d const& workgroupDim)
         {
-            auto macroTileC = GlobalMapping::macroTileSizeC();
+            auto macroTileC = GlobalMapping::macroTileSizeC(workgroupDim);
             return make_coord2d(get<0>(macroTileC) + get<1>(macroTileC), LdsWidth);
         }
 
         template <LdsMappingT>
-        __device__ constexpr inline auto LdsMappingNT<LdsMappingT_impl>::ldLds()
+        ROCWMMA_HOST_DEVICE constexpr inline auto
+            LdsMappingNT<LdsMappingT_impl>::ldLds(Coord2d const& workgroupDim)
         {
-            return DataLayout::leadingDim(sizeLds());
+            return DataLayout::leadingDim(sizeLds(workgroupDim));
         }
 
 #undef LdsMappingT
 #undef LdsMappingT_impl
 
-#undef LdsMappingT
-#undef LdsMappingT_impl
-
 #define LdsMappingT typename GlobalMapping, typename LayoutLds
 
 #define LdsMappingT_impl GlobalMapping, LayoutLds
 
         template <LdsMappingT>
-        __device__ constexpr inline auto
+        ROCWMMA_HOST_DEVICE constexpr inline auto
             LdsMappingRF<LdsMappingT_impl>::projCoordA(Coord2d const& coordA)
         {
             // Scale the A coordinate to register file height
@@ -210,7 +343,7 @@ namespace rocwmma
         }
 
         template <LdsMappingT>
-        __device__ constexpr inline auto
+        ROCWMMA_HOST_DEVICE constexpr inline auto
             LdsMappingRF<LdsMappingT_impl>::projCoordB(Coord2d const& coordB)
         {
             // Scale the B coordinate to register file height
@@ -220,23 +353,37 @@ namespace rocwmma
         template <LdsMappingT>
         __device__ constexpr inline auto LdsMappingRF<LdsMappingT_impl>::waveOffsetA()
         {
-            return projCoordA(GlobalMapping::waveOffsetA());
+            return waveOffsetA(GlobalMapping::WaveSpace::localWaveCoord());
         }
 
         template <LdsMappingT>
         __device__ constexpr inline auto LdsMappingRF<LdsMappingT_impl>::waveOffsetB()
         {
-            return projCoordB(GlobalMapping::waveOffsetB());
+            return waveOffsetB(GlobalMapping::WaveSpace::localWaveCoord());
+        }
+
+        template <LdsMappingT>
+        ROCWMMA_HOST_DEVICE constexpr inline auto
+            LdsMappingRF<LdsMappingT_impl>::waveOffsetA(Coord2d const& localWaveCoord)
+        {
+            return projCoordA(GlobalMapping::waveOffsetA(localWaveCoord));
+        }
+
+        template <LdsMappingT>
+        ROCWMMA_HOST_DEVICE constexpr inline auto
+            LdsMappingRF<LdsMappingT_impl>::waveOffsetB(Coord2d const& localWaveCoord)
+        {
+            return projCoordB(GlobalMapping::waveOffsetB(localWaveCoord));
         }
 
         template <LdsMappingT>
-        __device__ constexpr inline auto LdsMappingRF<LdsMappingT_impl>::blockOffsetA()
+        ROCWMMA_HOST_DEVICE constexpr inline auto LdsMappingRF<LdsMappingT_impl>::blockOffsetA()
         {
             return projCoordA(GlobalMapping::blockOffsetA());
         }
 
         template <LdsMappingT>
-        __device__ constexpr inline auto LdsMappingRF<LdsMappingT_impl>::blockOffsetB()
+        ROCWMMA_HOST_DEVICE constexpr inline auto LdsMappingRF<LdsMappingT_impl>::blockOffsetB()
         {
             return projCoordB(GlobalMapping::blockOffsetB());
         }
@@ -244,42 +391,94 @@ namespace rocwmma
         template <LdsMappingT>
         __device__ constexpr inline auto LdsMappingRF<LdsMappingT_impl>::writeCoordA()
         {
-            // Assuming base coord of (0, 0) for LDS
-            return waveOffsetA();
+            return writeCoordA(GlobalMapping::WaveSpace::localWaveCoord(),
+                               GlobalMapping::WaveSpace::workgroupDim());
         }
 
         template <LdsMappingT>
         __device__ constexpr inline auto LdsMappingRF<LdsMappingT_impl>::writeCoordB()
         {
-            return projCoordA(GlobalMapping::macroTileSizeC()) + waveOffsetB();
+            return writeCoordB(GlobalMapping::WaveSpace::localWaveCoord(),
+                               GlobalMapping::WaveSpace::workgroupDim());
         }
 
         template <LdsMappingT>
         __device__ constexpr inline auto LdsMappingRF<LdsMappingT_impl>::readCoordA()
         {
-            // Assuming base coord of (0, 0) for LDS
-            return waveOffsetA();
+            return readCoordA(GlobalMapping::WaveSpace::localWaveCoord(),
+                              GlobalMapping::WaveSpace::workgroupDim());
         }
 
         template <LdsMappingT>
         __device__ constexpr inline auto LdsMappingRF<LdsMappingT_impl>::readCoordB()
         {
-            return projCoordA(GlobalMapping::macroTileSizeC()) + waveOffsetB();
+            return readCoordB(GlobalMapping::WaveSpace::localWaveCoord(),
+                              GlobalMapping::WaveSpace::workgroupDim());
         }
 
         template <LdsMappingT>
         __device__ constexpr inline auto LdsMappingRF<LdsMappingT_impl>::sizeLds()
         {
-            auto macroTileC = GlobalMapping::macroTileSizeC();
+            return sizeLds(GlobalMapping::WaveSpace::workgroupDim());
+        }
+
+        template <LdsMappingT>
+        __device__ constexpr inline auto LdsMappingRF<LdsMappingT_impl>::ldLds()
+        {
+            return ldLds(GlobalMapping::WaveSpace::workgroupDim());
+        }
+
+        template <LdsMappingT>
+        ROCWMMA_HOST_DEVICE constexpr inline auto
+            LdsMappingRF<LdsMappingT_impl>::writeCoordA(Coord2d const& localWaveCoord,
+                                                        Coord2d const& workgroupDim)
+        {
+            // Assuming base coord of (0, 0) for LDS
+            return waveOffsetA(localWaveCoord);
+        }
+
+        template <LdsMappingT>
+        ROCWMMA_HOST_DEVICE constexpr inline auto
+            LdsMappingRF<LdsMappingT_impl>::writeCoordB(Coord2d const& localWaveCoord,
+                                                        Coord2d const& workgroupDim)
+        {
+            return projCoordA(GlobalMapping::macroTileSizeC(workgroupDim))
+                   + waveOffsetB(localWaveCoord);
+        }
+
+        template <LdsMappingT>
+        ROCWMMA_HOST_DEVICE constexpr inline auto
+            LdsMappingRF<LdsMappingT_impl>::readCoordA(Coord2d const& localWaveCoord,
+                                                       Coord2d const& workgroupDim)
+        {
+            // Assuming base coord of (0, 0) for LDS
+            return waveOffsetA(localWaveCoord);
+        }
+
+        template <LdsMappingT>
+        ROCWMMA_HOST_DEVICE constexpr inline auto
+            LdsMappingRF<LdsMappingT_impl>::readCoordB(Coord2d const& localWaveCoord,
+                                                       Coord2d const& workgroupDim)
+        {
+            return projCoordA(GlobalMapping::macroTileSizeC(workgroupDim))
+                   + waveOffsetB(localWaveCoord);
+        }
+
+        template <LdsMappingT>
+        ROCWMMA_HOST_DEVICE constexpr inline auto
+            LdsMappingRF<LdsMappingT_impl>::sizeLds(Coord2d const& workgroupDim)
+        {
+            auto macroTileC = GlobalMapping::macroTileSizeC(workgroupDim);
             return make_coord2d((get<0>(macroTileC) + get<1>(macroTileC)) * GlobalMapping::kDim()
                                     / LdsWidth,
                                 LdsWidth);
         }
 
         template <LdsMappingT>
-        __device__ constexpr inline auto LdsMappingRF<LdsMappingT_impl>::ldLds()
+        ROCWMMA_HOST_DEVICE constexpr inline auto
+            LdsMappingRF<LdsMappingT_impl>::ldLds(Coord2d const& workgroupDim)
         {
-            return DataLayout::leadingDim(sizeLds());
+            return DataLayout::leadingDim(sizeLds(workgroupDim));
         }
 
 #undef LdsMappingT
@@ -0,0 +1,235 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GEMM_RASTERIZATION_HPP
+#define GEMM_RASTERIZATION_HPP
+
+#include <iomanip>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include <rocwmma/rocwmma.hpp>
+#pragma GCC diagnostic pop
+
+namespace rocwmma
+{
+    namespace Rasterization
+    {
+        /*
+        * Rasterization orders re-map the linear workgroup dispatch index to the
+        * coordinate of the output macro tile it computes. Workgroups are
+        * dispatched with blockIdx.x moving fastest, such that without re-mapping
+        * the tiles of C are visited one entire column (of tilesX tiles) at a
+        * time. Concurrently resident workgroups then touch the whole of A,
+        * while B tiles are evicted from L2 before they are revisited.
+        *
+        * Each order is a bijection of the tileIdx in [0, tilesX * tilesY) to
+        * tile coordinates (x, y) in [0, tilesX) x [0, tilesY), for any grid
+        * size. Orders are host / device functions, so that they may be
+        * validated and inspected on the host.
+        *
+        * Tile coordinate x runs along M (rows of C), and y along N (cols of C).
+        */
+
+        namespace detail
+        {
+            // Size of the group / window starting at a tile, when fewer than
+            // the full dimension of tiles may remain.
+            ROCWMMA_HOST_DEVICE constexpr static inline uint32_t clampedDim(uint32_t remaining,
+                                                                             uint32_t dim)
+            {
+                return remaining < dim ? remaining : dim;
+            }
+
+        } // namespace detail
+
+        // Dispatch order: column-major walk over all tiles
+        struct ColMajor
+        {
+            ROCWMMA_HOST_DEVICE constexpr static inline Coord2d
+                tileCoord(uint32_t tileIdx, uint32_t tilesX, uint32_t /*tilesY*/)
+            {
+                return make_coord2d(tileIdx % tilesX, tileIdx / tilesX);
+            }
+        };
+
+        // Tiles are visited in bands of GroupM rows. Each band is walked
+        // column by column, such that consecutive workgroups share the same
+        // tile of B, while only GroupM tiles of A are live at once.
+        // The last band may be narrower than GroupM.
+        template <uint32_t GroupM>
+        struct GroupedM
+        {
+            static_assert(GroupM > 0u, "GroupM must be greater than 0");
+
+            ROCWMMA_HOST_DEVICE constexpr static inline Coord2d
+                tileCoord(uint32_t tileIdx, uint32_t tilesX, uint32_t tilesY)
+            {
+                auto tilesPerGroup = GroupM * tilesY;
+                auto groupStartX   = (tileIdx / tilesPerGroup) * GroupM;
+                auto groupSizeX    = detail::clampedDim(tilesX - groupStartX, GroupM);
+                auto localIdx      = tileIdx % tilesPerGroup;
+                return make_coord2d(groupStartX + localIdx % groupSizeX, localIdx / groupSizeX);
+            }
+        };
+
+        namespace detail
+        {
+            // Space-filling curves are applied within square windows of
+            // (2^Log2Window x 2^Log2Window) tiles. Windows are visited in the
+            // same banded order as GroupedM, with band height of one window.
+            // Partial windows on the ragged right / bottom edges of the grid
+            // fall back to column-major order within the window.
+            template <uint32_t Log2Window, typename CurveT>
+            struct WindowedCurve
+            {
+                static_assert(Log2Window > 0u && Log2Window < 16u, "Invalid window size");
+
+                constexpr static uint32_t WindowDim = 1u << Log2Window;
+
+                ROCWMMA_HOST_DEVICE constexpr static inline Coord2d
+                    tileCoord(uint32_t tileIdx, uint32_t tilesX, uint32_t tilesY)
+                {
+                    auto tilesPerBand = WindowDim * tilesY;
+                    auto bandStartX   = (tileIdx / tilesPerBand) * WindowDim;
+                    auto bandSizeX    = clampedDim(tilesX - bandStartX, WindowDim);
+
+                    // All windows but the last in each band are WindowDim wide
+                    auto bandIdx      = tileIdx % tilesPerBand;
+                    auto windowStartY = (bandIdx / (bandSizeX * WindowDim)) * WindowDim;
+                    auto windowSizeY  = clampedDim(tilesY - windowStartY, WindowDim);
+                    auto localIdx     = bandIdx - windowStartY * bandSizeX;
+
+                    if(bandSizeX == WindowDim && windowSizeY == WindowDim)
+                    {
+                        auto local = CurveT::template decode<Log2Window>(localIdx);
+                        return make_coord2d(bandStartX + get<0>(local),
+                                            windowStartY + get<1>(local));
+                    }
+
+                    return make_coord2d(bandStartX + localIdx % bandSizeX,
+                                        windowStartY + localIdx / bandSizeX);
+                }
+            };
+
+            struct MortonCurve
+            {
+                // De-interleave even bits to x and odd bits to y
+                template <uint32_t Log2Dim>
+                ROCWMMA_HOST_DEVICE constexpr static inline Coord2d decode(uint32_t d)
+                {
+                    uint32_t x = 0u;
+                    uint32_t y = 0u;
+                    for(uint32_t i = 0u; i < Log2Dim; i++)
+                    {
+                        x |= ((d >> (2u * i)) & 1u) << i;
+                        y |= ((d >> (2u * i + 1u)) & 1u) << i;
+                    }
+                    return make_coord2d(x, y);
+                }
+            };
+
+            struct HilbertCurve
+            {
+                // Iterative Hilbert index to coordinate, from the finest level up
+                template <uint32_t Log2Dim>
+                ROCWMMA_HOST_DEVICE constexpr static inline Coord2d decode(uint32_t d)
+                {
+                    uint32_t x = 0u;
+                    uint32_t y = 0u;
+                    for(uint32_t s = 1u; s < (1u << Log2Dim); s *= 2u)
+                    {
+                        uint32_t rx = 1u & (d / 2u);
+                        uint32_t ry = 1u & (d ^ rx);
+
+                        // Rotate the quadrant
+                        if(ry == 0u)
+                        {
+                            if(rx == 1u)
+                            {
+                                x = s - 1u - x;
+                                y = s - 1u - y;
+                            }
+                            auto t = x;
+                            x      = y;
+                            y      = t;
+                        }
+
+                        x += s * rx;
+                        y += s * ry;
+                        d /= 4u;
+                    }
+                    return make_coord2d(x, y);
+                }
+            };
+
+        } // namespace detail
+
+        // Z-order (Morton) curve within square windows of 2^Log2Window tiles
+        template <uint32_t Log2Window>
+        struct Morton : public detail::WindowedCurve<Log2Window, detail::MortonCurve>
+        {
+        };
+
+        // Hilbert curve within square windows of 2^Log2Window tiles.
+        // Consecutive tiles are always adjacent within a window.
+        template <uint32_t Log2Window>
+        struct Hilbert : public detail::WindowedCurve<Log2Window, detail::HilbertCurve>
+        {
+        };
+
+        // Prints the grid of (tilesX x tilesY) tiles, where each tile is
+        // labelled with its position in the visit order.
+        template <typename RasterOrder>
+        inline void printVisitOrder(std::ostream& stream, uint32_t tilesX, uint32_t tilesY)
+        {
+            auto tileCount = tilesX * tilesY;
+            auto order     = std::vector<uint32_t>(tileCount);
+            for(uint32_t i = 0u; i < tileCount; i++)
+            {
+                auto coord = RasterOrder::tileCoord(i, tilesX, tilesY);
+                order[get<0>(coord) * tilesY + get<1>(coord)] = i;
+            }
+
+            auto width = static_cast<int>(std::to_string(tileCount).size()) + 1;
+            for(uint32_t x = 0u; x < tilesX; x++)
+            {
+                for(uint32_t y = 0u; y < tilesY; y++)
+                {
+                    stream << std::setw(width) << order[x * tilesY + y];
+                }
+                stream << std::endl;
+            }
+        }
+
+    } // namespace Rasterization
+
+} // namespace rocwmma
+
+#endif // GEMM_RASTERIZATION_HPP
@@ -98,6 +98,7 @@ namespace rocwmma
         void copyDeviceToHostAll();
         void resizeStorage(ProblemDims const& size);
         void resizeStorage(MatrixElements const& size);
+        void resizeWorkspace(int64_t bytes);
 
         HostPtrT<InputT>&  hostA();
         HostPtrT<InputT>&  hostB();
@@ -109,15 +110,20 @@ namespace rocwmma
         DevicePtrT<OutputT>& deviceC();
         DevicePtrT<OutputT>& deviceD();
 
+        // Opaque kernel workspace
+        DevicePtrT<uint8_t>& deviceWorkspace();
+
         void reset() final;
 
     protected:
         DevicePtrT<InputT>  mDeviceA, mDeviceB;
         DevicePtrT<OutputT> mDeviceC, mDeviceD;
+        DevicePtrT<uint8_t> mDeviceWorkspace;
         HostPtrT<InputT>    mHostA, mHostB;
         HostPtrT<OutputT>   mHostC, mHostD;
         MatrixElements      mCurrentMatrixElements;
         MatrixElements      mCurrentAllocElements;
+        int64_t             mCurrentWorkspaceBytes;
     };
 
 } // namespace rocwmma
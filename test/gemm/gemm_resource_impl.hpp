@@ -39,12 +39,14 @@ namespace rocwmma
         , mDeviceB(Base::template allocDevice<InputT>(0))
         , mDeviceC(Base::template allocDevice<OutputT>(0))
         , mDeviceD(Base::template allocDevice<OutputT>(0))
+        , mDeviceWorkspace(Base::template allocDevice<uint8_t>(0))
         , mHostA(Base::template allocHost<InputT>(0))
         , mHostB(Base::template allocHost<InputT>(0))
         , mHostC(Base::template allocHost<OutputT>(0))
         , mHostD(Base::template allocHost<OutputT>(0))
         , mCurrentMatrixElements({0, 0, 0, 0})
         , mCurrentAllocElements({0, 0, 0, 0})
+        , mCurrentWorkspaceBytes(0)
     {
     }
 
@@ -55,12 +57,14 @@ namespace rocwmma
         , mDeviceB(std::move(rhs.mDeviceB))
         , mDeviceC(std::move(rhs.mDeviceC))
         , mDeviceD(std::move(rhs.mDeviceD))
+        , mDeviceWorkspace(std::move(rhs.mDeviceWorkspace))
         , mHostA(std::move(rhs.mHostA))
         , mHostB(std::move(rhs.mHostB))
         , mHostC(std::move(rhs.mHostC))
         , mHostD(std::move(rhs.mHostD))
         , mCurrentMatrixElements(rhs.mCurrentMatrixElements)
         , mCurrentAllocElements(rhs.mCurrentAllocElements)
+        , mCurrentWorkspaceBytes(rhs.mCurrentWorkspaceBytes)
     {
     }
 
@@ -128,6 +132,17 @@ namespace rocwmma
         mCurrentMatrixElements = newMatrixElements;
     }
 
+    template <typename InputT, typename OutputT>
+    void GemmResource<InputT, OutputT>::resizeWorkspace(int64_t bytes)
+    {
+        // Only realloc if required (e.g. current allocation won't fit new size)
+        if(mCurrentWorkspaceBytes < bytes)
+        {
+            Base::reallocDevice(mDeviceWorkspace, bytes);
+            mCurrentWorkspaceBytes = bytes;
+        }
+    }
+
     template <typename InputT, typename OutputT>
     void GemmResource<InputT, OutputT>::reset()
     {
@@ -135,8 +150,10 @@ namespace rocwmma
         Base::reallocDeviceHostPair(mDeviceB, mHostB, 0);
         Base::reallocDeviceHostPair(mDeviceC, mHostC, 0);
         Base::reallocDeviceHostPair(mDeviceD, mHostD, 0);
+        Base::reallocDevice(mDeviceWorkspace, 0);
         mCurrentAllocElements  = {0, 0, 0, 0};
         mCurrentMatrixElements = {0, 0, 0, 0};
+        mCurrentWorkspaceBytes = 0;
     }
 
     template <typename InputT, typename OutputT>
@@ -187,6 +204,12 @@ namespace rocwmma
         return mDeviceD;
     }
 
+    template <typename InputT, typename OutputT>
+    auto GemmResource<InputT, OutputT>::deviceWorkspace() -> DevicePtrT<uint8_t>&
+    {
+        return mDeviceWorkspace;
+    }
+
 } // namespace rocwmma
 
 #endif // ROCWMMA_GEMM_RESOURCE_IMPL_HPP
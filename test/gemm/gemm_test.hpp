@@ -70,7 +70,10 @@ namespace rocwmma
             }
             sLastResourceRun = kernel->getResource();
 
-            ProblemParams params = {threadBlock, problemSize, alpha, beta};
+            auto& options = RocwmmaLogging::instance();
+
+            ProblemParams params = {
+                threadBlock, problemSize, alpha, beta, options->splitK(), options->fillSeed()};
 
             // Walk through kernel workflow
             kernel->setup(params);
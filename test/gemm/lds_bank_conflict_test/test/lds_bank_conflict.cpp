@@ -0,0 +1,348 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "gemm_lds_analysis.hpp"
+#include "rocwmma_logging.hpp"
+
+namespace rocwmma
+{
+    using namespace CooperativeGemm;
+
+    // Every LDS byte in one stage is accessed the expected number of times, and
+    // nothing beyond it.
+    inline void expectCoverage(LdsReport const& report, uint64_t ldsBytes, bool exactlyOnce)
+    {
+        auto coverage = report.byteCoverage(ldsBytes);
+
+        EXPECT_EQ(coverage.back(), 0u) << report.label() << " out of bounds";
+        EXPECT_TRUE(std::all_of(coverage.begin(), coverage.end() - 1, [=](uint32_t count) {
+            return exactlyOnce ? count == 1u : count >= 1u;
+        })) << report.label()
+            << " coverage";
+    }
+
+    // Expected bank passes of the local writes and local reads of one LDS stage
+    struct LdsPasses
+    {
+        uint32_t localWrites;
+        uint32_t localReads;
+    };
+
+    // Reports go to the test output file, when one is given
+    inline void logReport(LdsReport const& report)
+    {
+        auto& ostream = RocwmmaLogging::instance()->ostream();
+        if(ostream.isOpen())
+        {
+            ostream.fstream() << report;
+        }
+    }
+
+    // Invariants of the LDS traffic of any GemmConfig, and its pass counts.
+    // Not every mapping is conflict free, so the expected passes pin the
+    // conflicts of each config: any change to them shows up here.
+    template <typename GemmConfig,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename LayoutLds,
+              uint32_t BlocksX,
+              uint32_t BlocksY,
+              uint32_t TBlockX = 0,
+              uint32_t TBlockY = 0>
+    LdsAnalysis::GemmLdsReport
+        analyzeGemmLds(uint32_t wgRows, uint32_t wgCols, LdsPasses const& expected)
+    {
+        using Analyzer = LdsAnalysis::GemmLdsAnalyzer<GemmConfig,
+                                                      BlockM,
+                                                      BlockN,
+                                                      BlockK,
+                                                      InputT,
+                                                      col_major,
+                                                      row_major,
+                                                      LayoutLds,
+                                                      BlocksX,
+                                                      BlocksY,
+                                                      TBlockX,
+                                                      TBlockY>;
+
+        auto report = Analyzer::analyze(wgRows, wgCols);
+
+        // Each element is written by one wave, and read by at least one
+        expectCoverage(report.localWrites, report.ldsBytes, true);
+        expectCoverage(report.localReads, report.ldsBytes, false);
+
+        EXPECT_EQ(report.localWrites.passes(), expected.localWrites) << report.localWrites.label();
+        EXPECT_EQ(report.localReads.passes(), expected.localReads) << report.localReads.label();
+
+        logReport(report.localWrites);
+        logReport(report.localReads);
+        return report;
+    }
+
+    template <typename GemmConfig, uint32_t BlockDim, uint32_t BlockK, typename InputT>
+    void analyzeTileConfig(LdsPasses const& rowMajorLds, LdsPasses const& colMajorLds)
+    {
+        // 2x2 waves, each with a 2x2 wave tile of blocks
+        analyzeGemmLds<GemmConfig, BlockDim, BlockDim, BlockK, InputT, row_major, 2u, 2u>(
+            2u, 2u, rowMajorLds);
+        analyzeGemmLds<GemmConfig, BlockDim, BlockDim, BlockK, InputT, col_major, 2u, 2u>(
+            2u, 2u, colMajorLds);
+    }
+
+    template <typename GemmConfig, uint32_t BlockDim, uint32_t BlockK, typename InputT>
+    void analyzeWorkgroupConfig(LdsPasses const& rowMajorLds, LdsPasses const& colMajorLds)
+    {
+        // Workgroup of (128, 2) consumer threads = 2x2 waves
+        constexpr uint32_t TBlockX = 2u * Constants::AMDGCN_WAVE_SIZE;
+        constexpr uint32_t TBlockY = 2u;
+
+        analyzeGemmLds<GemmConfig,
+                       BlockDim,
+                       BlockDim,
+                       BlockK,
+                       InputT,
+                       row_major,
+                       2u,
+                       2u,
+                       TBlockX,
+                       TBlockY>(2u, 2u, rowMajorLds);
+        analyzeGemmLds<GemmConfig,
+                       BlockDim,
+                       BlockDim,
+                       BlockK,
+                       InputT,
+                       col_major,
+                       2u,
+                       2u,
+                       TBlockX,
+                       TBlockY>(2u, 2u, colMajorLds);
+    }
+
+    // The swizzled LDS reads of K-contiguous LDS layouts are no worse than
+    // those of the base config, and conflict free for 16-bit data or wider.
+    template <typename SwizzledConfig,
+              typename BaseConfig,
+              typename LayoutLds,
+              uint32_t BlockDim,
+              uint32_t BlockK,
+              typename InputT>
+    void expectSwizzleImproves(LdsPasses const& basePasses, LdsPasses const& swizzledPasses)
+    {
+        auto base
+            = analyzeGemmLds<BaseConfig, BlockDim, BlockDim, BlockK, InputT, LayoutLds, 2u, 2u>(
+                2u, 2u, basePasses);
+        auto swizzled
+            = analyzeGemmLds<SwizzledConfig, BlockDim, BlockDim, BlockK, InputT, LayoutLds, 2u, 2u>(
+                2u, 2u, swizzledPasses);
+
+        EXPECT_LE(swizzled.localReads.passes(), base.localReads.passes())
+            << swizzled.localReads.label();
+        if(sizeof(InputT) >= 2u)
+        {
+            EXPECT_EQ(swizzled.localReads.passes(), swizzled.localReads.idealPasses())
+                << swizzled.localReads.label();
+        }
+    }
+
+    // The NT and TN configs are transposes of each other, with the same passes
+    template <uint32_t BlockDim, uint32_t BlockK, typename InputT>
+    void expectSwizzleImproves(LdsPasses const& blockBase,
+                               LdsPasses const& blockSwizzled,
+                               LdsPasses const& waveBase,
+                               LdsPasses const& waveSwizzled)
+    {
+        expectSwizzleImproves<Swizzled::BlockLdsNT,
+                              BlockLevel::LdsNT,
+                              row_major,
+                              BlockDim,
+                              BlockK,
+                              InputT>(blockBase, blockSwizzled);
+        expectSwizzleImproves<Swizzled::BlockLdsTN,
+                              BlockLevel::LdsTN,
+                              col_major,
+                              BlockDim,
+                              BlockK,
+                              InputT>(blockBase, blockSwizzled);
+        expectSwizzleImproves<Swizzled::WaveLdsNT,
+                              WaveLevel::LdsNT,
+                              row_major,
+                              BlockDim,
+                              BlockK,
+                              InputT>(waveBase, waveSwizzled);
+        expectSwizzleImproves<Swizzled::WaveLdsTN,
+                              WaveLevel::LdsTN,
+                              col_major,
+                              BlockDim,
+                              BlockK,
+                              InputT>(waveBase, waveSwizzled);
+    }
+
+} // namespace rocwmma
+
+TEST(LdsBankConflictTest, BankModel)
+{
+    using namespace rocwmma;
+
+    std::vector<uint64_t> consecutive, strided, broadcast;
+    for(uint64_t lane = 0u; lane < 64u; lane++)
+    {
+        consecutive.push_back(lane * 4u);
+        strided.push_back(lane * 128u);
+        broadcast.push_back(0u);
+    }
+
+    // 32 lanes of dwords per phase
+    EXPECT_EQ(LdsBankModel::instructionPasses(consecutive, 4u), 2u);
+    EXPECT_EQ(LdsBankModel::idealPasses(64u, 4u), 2u);
+
+    // Every lane of a phase in the same bank
+    EXPECT_EQ(LdsBankModel::instructionPasses(strided, 4u), 64u);
+
+    // The same dword is broadcast to every lane
+    EXPECT_EQ(LdsBankModel::instructionPasses(broadcast, 4u), 2u);
+
+    // 8 lanes of 16 bytes per phase
+    std::vector<uint64_t> vectors;
+    for(uint64_t lane = 0u; lane < 64u; lane++)
+    {
+        vectors.push_back(lane * 16u);
+    }
+    EXPECT_EQ(LdsBankModel::instructionPasses(vectors, 16u), 8u);
+    EXPECT_EQ(LdsBankModel::idealPasses(64u, 16u), 8u);
+}
+
+TEST(LdsBankConflictTest, FragmentIO)
+{
+    using namespace rocwmma;
+
+    using FragT    = fragment<matrix_a, 16, 16, 32, float16_t, row_major>;
+    using IOConfig = GetIOConfig_t<FragT>;
+    using Linear   = DataLayout::Array1d<row_major>;
+
+    // One access per IO vector of every lane
+    auto loaded = analyzeLdsLoad<FragT, Linear>(32u);
+    EXPECT_EQ(loaded.accesses().size(), IOConfig::IOTraits::IOCount);
+    for(auto const& access : loaded.accesses())
+    {
+        EXPECT_FALSE(access.isWrite);
+        EXPECT_EQ(access.laneOffsets.size(), Constants::AMDGCN_WAVE_SIZE);
+        EXPECT_EQ(access.ioBytes, IOConfig::IOLayout::VW * sizeof(float16_t));
+        EXPECT_GE(access.passes, access.idealPasses);
+    }
+    expectCoverage(loaded, 16u * 32u * sizeof(float16_t), true);
+
+    // Stores use the same layouts as loads
+    auto stored = analyzeLdsStore<FragT, Linear>(32u);
+    EXPECT_EQ(stored.passes(), loaded.passes());
+    EXPECT_TRUE(stored.accesses().front().isWrite);
+
+    // Cooperative shares of the waves together cover the block once
+    LdsReport coop("coop");
+    for(uint32_t wave = 0u; wave < 4u; wave++)
+    {
+        coop.append(analyzeLdsCoopStore<FragT, Linear>(32u, make_coord2d(16u, 0u), wave, 4u));
+    }
+
+    constexpr uint64_t BlockBytes = 16u * 32u * sizeof(float16_t);
+    auto               coverage   = coop.byteCoverage(2u * BlockBytes);
+    auto               blockBegin = coverage.begin() + BlockBytes;
+    EXPECT_TRUE(std::all_of(
+        coverage.begin(), blockBegin, [](uint32_t count) { return count == 0u; }));
+    EXPECT_TRUE(
+        std::all_of(blockBegin, coverage.end() - 1, [](uint32_t count) { return count == 1u; }));
+    EXPECT_EQ(coverage.back(), 0u);
+}
+
+TEST(LdsBankConflictTest, BlockLevel)
+{
+    using namespace rocwmma;
+    analyzeTileConfig<BlockLevel::LdsNT, 16u, 32u, float16_t>({256u, 512u}, {256u, 512u});
+    analyzeTileConfig<BlockLevel::LdsNT, 32u, 32u, float32_t>({2048u, 4096u}, {256u, 512u});
+    analyzeTileConfig<BlockLevel::LdsNT, 16u, 32u, int8_t>({128u, 256u}, {256u, 512u});
+    analyzeTileConfig<BlockLevel::LdsTN, 16u, 32u, float16_t>({256u, 512u}, {256u, 512u});
+    analyzeTileConfig<BlockLevel::LdsTN, 32u, 32u, float32_t>({256u, 512u}, {2048u, 4096u});
+    analyzeTileConfig<BlockLevel::LdsTN, 16u, 32u, int8_t>({256u, 512u}, {128u, 256u});
+    analyzeTileConfig<BlockLevel::LdsRF, 16u, 32u, float16_t>({64u, 128u}, {512u, 1024u});
+    analyzeTileConfig<BlockLevel::LdsRF, 32u, 32u, float32_t>({256u, 512u}, {2048u, 4096u});
+    analyzeTileConfig<BlockLevel::LdsRF, 16u, 32u, int8_t>({32u, 64u}, {256u, 512u});
+}
+
+TEST(LdsBankConflictTest, WaveLevel)
+{
+    using namespace rocwmma;
+    analyzeTileConfig<WaveLevel::LdsNT, 16u, 32u, float16_t>({256u, 512u}, {128u, 512u});
+    analyzeTileConfig<WaveLevel::LdsNT, 32u, 32u, float32_t>({2048u, 4096u}, {256u, 512u});
+    analyzeTileConfig<WaveLevel::LdsNT, 16u, 32u, int8_t>({64u, 256u}, {128u, 512u});
+    analyzeTileConfig<WaveLevel::LdsTN, 16u, 32u, float16_t>({128u, 512u}, {256u, 512u});
+    analyzeTileConfig<WaveLevel::LdsTN, 32u, 32u, float32_t>({256u, 512u}, {2048u, 4096u});
+    analyzeTileConfig<WaveLevel::LdsTN, 16u, 32u, int8_t>({128u, 512u}, {64u, 256u});
+}
+
+TEST(LdsBankConflictTest, WorkgroupLevel)
+{
+    using namespace rocwmma;
+    analyzeWorkgroupConfig<WorkgroupLevel::LdsNT, 16u, 32u, float16_t>({256u, 512u}, {64u, 512u});
+    analyzeWorkgroupConfig<WorkgroupLevel::LdsNT, 32u, 32u, float32_t>({2048u, 4096u},
+                                                                       {256u, 512u});
+    analyzeWorkgroupConfig<WorkgroupLevel::LdsTN, 16u, 32u, float16_t>({64u, 512u}, {256u, 512u});
+    analyzeWorkgroupConfig<WorkgroupLevel::LdsTN, 32u, 32u, float32_t>({256u, 512u},
+                                                                       {2048u, 4096u});
+}
+
+TEST(LdsBankConflictTest, ProducerConsumer)
+{
+    using namespace rocwmma;
+    // Producer waves write the same LDS layout as the workgroup level mapping
+    analyzeWorkgroupConfig<ProducerConsumer::LdsNT, 16u, 32u, float16_t>({256u, 512u},
+                                                                         {64u, 512u});
+    analyzeWorkgroupConfig<ProducerConsumer::LdsNT, 32u, 32u, float32_t>({2048u, 4096u},
+                                                                         {256u, 512u});
+    analyzeWorkgroupConfig<ProducerConsumer::LdsTN, 16u, 32u, float16_t>({64u, 512u},
+                                                                         {256u, 512u});
+    analyzeWorkgroupConfig<ProducerConsumer::LdsTN, 32u, 32u, float32_t>({256u, 512u},
+                                                                         {2048u, 4096u});
+}
+
+TEST(LdsBankConflictTest, Swizzled)
+{
+    using namespace rocwmma;
+    expectSwizzleImproves<16u, 32u, float16_t>(
+        {256u, 512u}, {64u, 128u}, {256u, 512u}, {64u, 128u});
+    expectSwizzleImproves<32u, 32u, float16_t>(
+        {512u, 1024u}, {128u, 256u}, {512u, 1024u}, {128u, 256u});
+    expectSwizzleImproves<16u, 32u, float32_t>(
+        {1024u, 2048u}, {128u, 256u}, {1024u, 2048u}, {128u, 256u});
+    expectSwizzleImproves<32u, 32u, float32_t>(
+        {2048u, 4096u}, {256u, 512u}, {2048u, 4096u}, {256u, 512u});
+    expectSwizzleImproves<16u, 32u, int8_t>({128u, 256u}, {32u, 64u}, {64u, 256u}, {32u, 128u});
+}
@@ -0,0 +1,171 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <set>
+
+#include <gtest/gtest.h>
+
+#include "gemm_local_mapping.hpp"
+#include "lds_bank_analyzer.hpp"
+
+namespace rocwmma
+{
+    // The swizzle must be a permutation of the unswizzled offsets
+    template <typename LayoutLds, typename DataLayoutT>
+    void expectPermutation(uint32_t lines, uint32_t ldm)
+    {
+        using Unswizzled = DataLayout::Array1d<LayoutLds>;
+
+        std::set<uint64_t> expected, swizzled;
+        for(uint32_t line = 0u; line < lines; line++)
+        {
+            for(uint32_t minor = 0u; minor < ldm; minor++)
+            {
+                auto coord = std::is_same<LayoutLds, row_major>::value
+                                 ? make_coord2d(line, minor)
+                                 : make_coord2d(minor, line);
+                expected.insert(Unswizzled::fromMatrixCoord(coord, ldm));
+                swizzled.insert(DataLayoutT::fromMatrixCoord(coord, ldm));
+            }
+        }
+        EXPECT_EQ(swizzled, expected);
+    }
+
+    // LR frags of K-contiguous LDS layouts, where lines of BlockK elements are
+    // stacked by BlockDim (LdsMappingNT row_major and LdsMappingTN col_major).
+    template <typename MatrixT,
+              typename LayoutLds,
+              uint32_t BlockDim,
+              uint32_t BlockK,
+              typename DataT>
+    void expectSwizzleImprovesBlock()
+    {
+        using FragT      = fragment<MatrixT, BlockDim, BlockDim, BlockK, DataT, LayoutLds>;
+        using LdsSwizzle = LocalMapping::detail::
+            LdsSwizzle<DataT, BlockK, GetIOConfig_t<FragT>::IOLayout::VW>;
+
+        using Unswizzled = DataLayout::Array1d<LayoutLds>;
+        using Swizzled   = typename LdsSwizzle::template DataLayout<LayoutLds>;
+
+        expectPermutation<LayoutLds, Swizzled>(BlockDim, BlockK);
+
+        auto unswizzled = analyzeLdsLoad<FragT, Unswizzled>(BlockK).passes();
+        auto swizzled   = analyzeLdsLoad<FragT, Swizzled>(BlockK).passes();
+        auto ideal      = analyzeLdsLoad<FragT, Unswizzled>(BlockK).idealPasses();
+
+        auto params = ::testing::Message()
+                      << "BlockDim " << BlockDim << " BlockK " << BlockK << " sizeof "
+                      << sizeof(DataT) << " ChunkSize " << LdsSwizzle::ChunkSize
+                      << " ChunkCount " << LdsSwizzle::ChunkCount << " LineGroup "
+                      << LdsSwizzle::LineGroup;
+
+        EXPECT_LE(swizzled, unswizzled) << params;
+        if(unswizzled > ideal)
+        {
+            EXPECT_LT(swizzled, unswizzled) << params;
+        }
+
+        // Only the shortest lines of 8-bit data may fall short of the ideal
+        if(sizeof(DataT) >= 2u)
+        {
+            EXPECT_EQ(swizzled, ideal) << params;
+        }
+    }
+
+    template <typename MatrixT, typename LayoutLds, typename DataT>
+    void expectSwizzleImproves()
+    {
+        expectSwizzleImprovesBlock<MatrixT, LayoutLds, 16u, 16u, DataT>();
+        expectSwizzleImprovesBlock<MatrixT, LayoutLds, 16u, 32u, DataT>();
+        expectSwizzleImprovesBlock<MatrixT, LayoutLds, 16u, 64u, DataT>();
+        expectSwizzleImprovesBlock<MatrixT, LayoutLds, 32u, 16u, DataT>();
+        expectSwizzleImprovesBlock<MatrixT, LayoutLds, 32u, 32u, DataT>();
+        expectSwizzleImprovesBlock<MatrixT, LayoutLds, 32u, 64u, DataT>();
+    }
+
+} // namespace rocwmma
+
+TEST(LdsSwizzleTest, Identity)
+{
+    using namespace rocwmma;
+
+    // A single chunk per group is not permuted
+    using Identity = DataLayout::XorSwizzle<row_major, 4u, 1u>;
+    for(uint32_t row = 0u; row < 16u; row++)
+    {
+        for(uint32_t col = 0u; col < 32u; col++)
+        {
+            EXPECT_EQ(Identity::fromMatrixCoord(make_coord2d(row, col), 32u), row * 32u + col);
+        }
+    }
+}
+
+TEST(LdsSwizzleTest, ChunksPermuteByLine)
+{
+    using namespace rocwmma;
+
+    // Chunks of 4 elements, permuted in groups of 4 chunks every 2 lines
+    using Swizzled = DataLayout::XorSwizzle<row_major, 4u, 4u, 2u>;
+    for(uint32_t row = 0u; row < 16u; row++)
+    {
+        for(uint32_t col = 0u; col < 32u; col++)
+        {
+            auto chunk = (col / 4u) ^ ((row / 2u) % 4u);
+            EXPECT_EQ(Swizzled::fromMatrixCoord(make_coord2d(row, col), 32u),
+                      row * 32u + chunk * 4u + col % 4u)
+                << "(" << row << ", " << col << ")";
+        }
+    }
+
+    // col_major lines are columns
+    using SwizzledT = DataLayout::XorSwizzle<col_major, 4u, 4u, 2u>;
+    for(uint32_t row = 0u; row < 32u; row++)
+    {
+        for(uint32_t col = 0u; col < 16u; col++)
+        {
+            EXPECT_EQ(SwizzledT::fromMatrixCoord(make_coord2d(row, col), 32u),
+                      Swizzled::fromMatrixCoord(make_coord2d(col, row), 32u));
+        }
+    }
+}
+
+TEST(LdsSwizzleTest, LdsMappingNT)
+{
+    using namespace rocwmma;
+    expectSwizzleImproves<matrix_a, row_major, int8_t>();
+    expectSwizzleImproves<matrix_a, row_major, float16_t>();
+    expectSwizzleImproves<matrix_a, row_major, float32_t>();
+    expectSwizzleImproves<matrix_a, row_major, float64_t>();
+}
+
+TEST(LdsSwizzleTest, LdsMappingTN)
+{
+    using namespace rocwmma;
+    expectSwizzleImproves<matrix_b, col_major, int8_t>();
+    expectSwizzleImproves<matrix_b, col_major, float16_t>();
+    expectSwizzleImproves<matrix_b, col_major, float32_t>();
+    expectSwizzleImproves<matrix_b, col_major, float64_t>();
+}
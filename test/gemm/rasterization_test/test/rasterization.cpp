@@ -0,0 +1,158 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <set>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "gemm_rasterization.hpp"
+
+namespace rocwmma
+{
+    // Every tile of the grid must be visited exactly once
+    template <typename RasterOrder>
+    void expectBijective(uint32_t tilesX, uint32_t tilesY)
+    {
+        std::set<std::pair<uint32_t, uint32_t>> visited;
+        for(uint32_t i = 0; i < tilesX * tilesY; i++)
+        {
+            auto coord = RasterOrder::tileCoord(i, tilesX, tilesY);
+            ASSERT_LT(get<0>(coord), tilesX) << "Tile " << i << " of " << tilesX << "x" << tilesY;
+            ASSERT_LT(get<1>(coord), tilesY) << "Tile " << i << " of " << tilesX << "x" << tilesY;
+            visited.insert(std::make_pair(get<0>(coord), get<1>(coord)));
+        }
+        EXPECT_EQ(visited.size(), tilesX * tilesY) << "Grid " << tilesX << "x" << tilesY;
+    }
+
+    template <typename RasterOrder>
+    void expectBijective()
+    {
+        for(uint32_t tilesX = 1; tilesX <= 40; tilesX++)
+        {
+            for(uint32_t tilesY = 1; tilesY <= 40; tilesY++)
+            {
+                expectBijective<RasterOrder>(tilesX, tilesY);
+            }
+        }
+    }
+
+    // Average count of distinct A / B tiles touched by each batch of
+    // concurrently resident workgroups, which approximates L2 footprint.
+    template <typename RasterOrder>
+    double averageFootprint(uint32_t tilesX, uint32_t tilesY, uint32_t concurrentTiles)
+    {
+        uint64_t footprint = 0u;
+        uint32_t batches   = 0u;
+        for(uint32_t begin = 0; begin < tilesX * tilesY; begin += concurrentTiles, batches++)
+        {
+            std::set<uint32_t> tilesA, tilesB;
+            for(uint32_t i = begin; i < std::min(begin + concurrentTiles, tilesX * tilesY); i++)
+            {
+                auto coord = RasterOrder::tileCoord(i, tilesX, tilesY);
+                tilesA.insert(get<0>(coord));
+                tilesB.insert(get<1>(coord));
+            }
+            footprint += tilesA.size() + tilesB.size();
+        }
+        return static_cast<double>(footprint) / static_cast<double>(batches);
+    }
+
+    template <typename RasterOrder>
+    std::string visitOrderString(uint32_t tilesX, uint32_t tilesY)
+    {
+        std::stringstream stream;
+        Rasterization::printVisitOrder<RasterOrder>(stream, tilesX, tilesY);
+        return stream.str();
+    }
+
+} // namespace rocwmma
+
+TEST(RasterizationTest, Bijective)
+{
+    using namespace rocwmma::Rasterization;
+    rocwmma::expectBijective<ColMajor>();
+    rocwmma::expectBijective<GroupedM<1u>>();
+    rocwmma::expectBijective<GroupedM<8u>>();
+    rocwmma::expectBijective<Morton<2u>>();
+    rocwmma::expectBijective<Morton<3u>>();
+    rocwmma::expectBijective<Hilbert<1u>>();
+    rocwmma::expectBijective<Hilbert<3u>>();
+}
+
+TEST(RasterizationTest, VisitOrder)
+{
+    using namespace rocwmma::Rasterization;
+
+    // Dispatch order walks down each column of tiles
+    EXPECT_EQ(rocwmma::visitOrderString<ColMajor>(3u, 3u), " 0 3 6\n 1 4 7\n 2 5 8\n");
+
+    // Bands of two rows, with a narrower last band
+    EXPECT_EQ(rocwmma::visitOrderString<GroupedM<2u>>(3u, 3u), " 0 2 4\n 1 3 5\n 6 7 8\n");
+
+    // Z-order within 2x2 windows, then column-major on the ragged edge
+    EXPECT_EQ(rocwmma::visitOrderString<Morton<1u>>(3u, 3u), " 0 2 4\n 1 3 5\n 6 7 8\n");
+    EXPECT_EQ(rocwmma::visitOrderString<Morton<2u>>(4u, 4u),
+              "  0  2  8 10\n  1  3  9 11\n  4  6 12 14\n  5  7 13 15\n");
+
+    // Hilbert curve within a 4x4 window
+    EXPECT_EQ(rocwmma::visitOrderString<Hilbert<2u>>(4u, 4u),
+              "  0  3  4  5\n  1  2  7  6\n 14 13  8  9\n 15 12 11 10\n");
+}
+
+TEST(RasterizationTest, HilbertAdjacency)
+{
+    using namespace rocwmma;
+    using Order = Rasterization::Hilbert<3u>;
+
+    // Consecutive tiles within a full window are neighbours
+    for(uint32_t i = 1; i < 64u; i++)
+    {
+        auto prev = Order::tileCoord(i - 1u, 8u, 8u);
+        auto curr = Order::tileCoord(i, 8u, 8u);
+        auto dist = std::abs(static_cast<int>(get<0>(curr)) - static_cast<int>(get<0>(prev)))
+                    + std::abs(static_cast<int>(get<1>(curr)) - static_cast<int>(get<1>(prev)));
+        EXPECT_EQ(dist, 1) << "Tile " << i;
+    }
+}
+
+TEST(RasterizationTest, Footprint)
+{
+    using namespace rocwmma;
+    using namespace rocwmma::Rasterization;
+
+    // Large grid with 64 concurrently resident workgroups
+    constexpr uint32_t TilesX = 96u, TilesY = 96u, Concurrent = 64u;
+
+    auto colMajor = averageFootprint<ColMajor>(TilesX, TilesY, Concurrent);
+    EXPECT_LT(averageFootprint<GroupedM<8u>>(TilesX, TilesY, Concurrent), colMajor);
+    EXPECT_LT(averageFootprint<Morton<3u>>(TilesX, TilesY, Concurrent), colMajor);
+    EXPECT_LT(averageFootprint<Hilbert<3u>>(TilesX, TilesY, Concurrent), colMajor);
+}
@@ -0,0 +1,138 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_TEST_LDS_BANK_ANALYZER_HPP
+#define ROCWMMA_TEST_LDS_BANK_ANALYZER_HPP
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "wave_emulator.hpp"
+
+namespace rocwmma
+{
+    // Host model of LDS bank conflicts, with 32 banks of 4 bytes.
+    // Each IO instruction is serviced in phases of as many lanes as fit in one
+    // pass over all banks. Each phase then needs as many passes as the greatest
+    // number of distinct dwords addressed in any one bank.
+    struct LdsBankModel
+    {
+        constexpr static uint32_t BankCount      = 32u;
+        constexpr static uint32_t BankWidthBytes = 4u;
+
+        static uint32_t lanesPerPhase(uint32_t ioBytes);
+
+        // Passes for the byte offsets of each lane in one phase
+        static uint32_t passes(std::vector<uint64_t> const& laneOffsets, uint32_t ioBytes);
+
+        // Passes for the byte offsets of every lane in one instruction
+        static uint32_t instructionPasses(std::vector<uint64_t> const& laneOffsets,
+                                          uint32_t                     ioBytes);
+
+        // Conflict free: one pass per phase
+        static uint32_t idealPasses(uint32_t laneCount, uint32_t ioBytes);
+    };
+
+    // One ds_read / ds_write instruction of a wave, with the byte offset in LDS
+    // addressed by each active lane.
+    struct LdsAccess
+    {
+        bool                  isWrite;
+        uint32_t              instruction;
+        uint32_t              ioBytes;
+        std::vector<uint64_t> laneOffsets;
+        uint32_t              passes;
+        uint32_t              idealPasses;
+
+        uint32_t conflicts() const;
+    };
+
+    // LDS accesses of one or more waves, in issue order per wave
+    class LdsReport
+    {
+    public:
+        LdsReport() = default;
+        explicit LdsReport(std::string label);
+
+        std::string const&            label() const;
+        std::vector<LdsAccess> const& accesses() const;
+
+        void append(LdsAccess access);
+        void append(LdsReport const& other);
+
+        uint32_t passes() const;
+        uint32_t idealPasses() const;
+        uint32_t conflictedAccesses() const;
+
+        // Ratio of passes to the conflict free passes
+        double conflictFactor() const;
+
+        // Highest byte addressed, plus one
+        uint64_t extentBytes() const;
+
+        // Access counts of every LDS byte in [0, bytes). Bytes addressed
+        // beyond that are counted in the last entry.
+        std::vector<uint32_t> byteCoverage(uint64_t bytes) const;
+
+        // One summary line, followed by a line per conflicted access if detailed
+        void print(std::ostream& stream, bool detailed = false) const;
+
+    private:
+        std::string            mLabel;
+        std::vector<LdsAccess> mAccesses;
+    };
+
+    std::ostream& operator<<(std::ostream& stream, LdsReport const& report);
+
+    // Accesses of one wave loading / storing FragT at blockCoord of an LDS
+    // buffer in the given data layout. The same layouts as the device IO
+    // are used, so each vector of VW elements is one instruction per lane.
+    template <typename FragT, typename DataLayoutT>
+    LdsReport analyzeLdsLoad(uint32_t ldm, Coord2d const& blockCoord = make_coord2d(0u, 0u));
+
+    template <typename FragT, typename DataLayoutT>
+    LdsReport analyzeLdsStore(uint32_t ldm, Coord2d const& blockCoord = make_coord2d(0u, 0u));
+
+    // As above, for the given wave's share of cooperative IO. Waves beyond
+    // the maximum participating in the IO have no accesses.
+    template <typename FragT, typename DataLayoutT, uint32_t WaveCount = 1u>
+    LdsReport analyzeLdsCoopLoad(uint32_t       ldm,
+                                 Coord2d const& blockCoord,
+                                 uint32_t       waveIndex,
+                                 uint32_t       waveCount);
+
+    template <typename FragT, typename DataLayoutT, uint32_t WaveCount = 1u>
+    LdsReport analyzeLdsCoopStore(uint32_t       ldm,
+                                  Coord2d const& blockCoord,
+                                  uint32_t       waveIndex,
+                                  uint32_t       waveCount);
+
+} // namespace rocwmma
+
+#include "lds_bank_analyzer_impl.hpp"
+
+#endif // ROCWMMA_TEST_LDS_BANK_ANALYZER_HPP
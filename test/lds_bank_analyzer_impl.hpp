@@ -0,0 +1,333 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_TEST_LDS_BANK_ANALYZER_IMPL_HPP
+#define ROCWMMA_TEST_LDS_BANK_ANALYZER_IMPL_HPP
+
+#include <algorithm>
+#include <iomanip>
+#include <map>
+#include <set>
+#include <utility>
+
+#include "lds_bank_analyzer.hpp"
+
+namespace rocwmma
+{
+    inline uint32_t LdsBankModel::lanesPerPhase(uint32_t ioBytes)
+    {
+        return std::max(1u, BankCount * BankWidthBytes / std::max(ioBytes, BankWidthBytes));
+    }
+
+    inline uint32_t LdsBankModel::passes(std::vector<uint64_t> const& laneOffsets,
+                                         uint32_t                     ioBytes)
+    {
+        std::map<uint32_t, std::set<uint64_t>> banks;
+        for(auto offset : laneOffsets)
+        {
+            for(auto dword = offset / BankWidthBytes;
+                dword < (offset + ioBytes + BankWidthBytes - 1u) / BankWidthBytes;
+                dword++)
+            {
+                banks[dword % BankCount].insert(dword);
+            }
+        }
+
+        size_t result = 0u;
+        for(auto const& bank : banks)
+        {
+            result = std::max(result, bank.second.size());
+        }
+        return static_cast<uint32_t>(result);
+    }
+
+    inline uint32_t LdsBankModel::instructionPasses(std::vector<uint64_t> const& laneOffsets,
+                                                    uint32_t                     ioBytes)
+    {
+        auto lanes = lanesPerPhase(ioBytes);
+
+        uint32_t result = 0u;
+        for(size_t phase = 0u; phase < laneOffsets.size(); phase += lanes)
+        {
+            auto last = std::min(phase + lanes, laneOffsets.size());
+            result += passes(
+                std::vector<uint64_t>(laneOffsets.begin() + phase, laneOffsets.begin() + last),
+                ioBytes);
+        }
+        return result;
+    }
+
+    inline uint32_t LdsBankModel::idealPasses(uint32_t laneCount, uint32_t ioBytes)
+    {
+        auto lanes = lanesPerPhase(ioBytes);
+        return (laneCount + lanes - 1u) / lanes;
+    }
+
+    inline uint32_t LdsAccess::conflicts() const
+    {
+        return passes - idealPasses;
+    }
+
+    inline LdsReport::LdsReport(std::string label)
+        : mLabel(std::move(label))
+    {
+    }
+
+    inline std::string const& LdsReport::label() const
+    {
+        return mLabel;
+    }
+
+    inline std::vector<LdsAccess> const& LdsReport::accesses() const
+    {
+        return mAccesses;
+    }
+
+    inline void LdsReport::append(LdsAccess access)
+    {
+        mAccesses.push_back(std::move(access));
+    }
+
+    inline void LdsReport::append(LdsReport const& other)
+    {
+        mAccesses.insert(mAccesses.end(), other.mAccesses.begin(), other.mAccesses.end());
+    }
+
+    inline uint32_t LdsReport::passes() const
+    {
+        uint32_t result = 0u;
+        for(auto const& access : mAccesses)
+        {
+            result += access.passes;
+        }
+        return result;
+    }
+
+    inline uint32_t LdsReport::idealPasses() const
+    {
+        uint32_t result = 0u;
+        for(auto const& access : mAccesses)
+        {
+            result += access.idealPasses;
+        }
+        return result;
+    }
+
+    inline uint32_t LdsReport::conflictedAccesses() const
+    {
+        return static_cast<uint32_t>(
+            std::count_if(mAccesses.begin(), mAccesses.end(), [](LdsAccess const& access) {
+                return access.conflicts() > 0u;
+            }));
+    }
+
+    inline double LdsReport::conflictFactor() const
+    {
+        auto ideal = idealPasses();
+        return ideal == 0u ? 1.0 : static_cast<double>(passes()) / static_cast<double>(ideal);
+    }
+
+    inline uint64_t LdsReport::extentBytes() const
+    {
+        uint64_t result = 0u;
+        for(auto const& access : mAccesses)
+        {
+            for(auto offset : access.laneOffsets)
+            {
+                result = std::max(result, offset + access.ioBytes);
+            }
+        }
+        return result;
+    }
+
+    inline std::vector<uint32_t> LdsReport::byteCoverage(uint64_t bytes) const
+    {
+        std::vector<uint32_t> result(bytes + 1u, 0u);
+        for(auto const& access : mAccesses)
+        {
+            for(auto offset : access.laneOffsets)
+            {
+                for(uint64_t i = offset; i < offset + access.ioBytes; i++)
+                {
+                    result[std::min(i, bytes)]++;
+                }
+            }
+        }
+        return result;
+    }
+
+    inline void LdsReport::print(std::ostream& stream, bool detailed) const
+    {
+        stream << mLabel << ": " << mAccesses.size() << " accesses, " << passes()
+               << " passes (ideal " << idealPasses() << "), " << conflictedAccesses()
+               << " conflicted, factor " << std::fixed << std::setprecision(2)
+               << conflictFactor() << std::defaultfloat << "\n";
+
+        if(detailed)
+        {
+            for(auto const& access : mAccesses)
+            {
+                if(access.conflicts() > 0u)
+                {
+                    stream << "    " << (access.isWrite ? "ds_write_b" : "ds_read_b")
+                           << access.ioBytes * 8u << " #" << access.instruction << ": "
+                           << access.passes << " passes (ideal " << access.idealPasses
+                           << ")\n";
+                }
+            }
+        }
+    }
+
+    inline std::ostream& operator<<(std::ostream& stream, LdsReport const& report)
+    {
+        report.print(stream);
+        return stream;
+    }
+
+    namespace detail
+    {
+        // Collects the byte offset of the first element of each IO vector.
+        // Vector elements are contiguous in LDS, including in swizzled layouts
+        // whose chunks hold whole vectors. As on device, the block origin is
+        // offset in the unswizzled layout.
+        template <typename FragT, typename DataLayoutT, uint32_t VectorWidth>
+        class LdsAccessBuilder
+        {
+        public:
+            LdsAccessBuilder(uint32_t ldm, Coord2d const& blockCoord)
+                : mLdm(ldm)
+                , mBlockOffset(DataLayout::Array1d<typename DataLayoutT::Orientation>::
+                                   fromMatrixCoord(blockCoord, ldm))
+            {
+            }
+
+            void operator()(uint32_t index, Coord2d const& coord)
+            {
+                if(index % VectorWidth == 0u)
+                {
+                    auto offset = mBlockOffset + DataLayoutT::fromMatrixCoord(coord, mLdm);
+                    mVectors[index / VectorWidth].push_back(static_cast<uint64_t>(offset)
+                                                            * sizeof(GetDataType_t<FragT>));
+                }
+            }
+
+            LdsReport report(bool isWrite) const
+            {
+                constexpr uint32_t IOBytes = VectorWidth * sizeof(GetDataType_t<FragT>);
+
+                LdsReport result;
+                for(auto const& vector : mVectors)
+                {
+                    result.append(
+                        LdsAccess{isWrite,
+                                  vector.first,
+                                  IOBytes,
+                                  vector.second,
+                                  LdsBankModel::instructionPasses(vector.second, IOBytes),
+                                  LdsBankModel::idealPasses(
+                                      static_cast<uint32_t>(vector.second.size()), IOBytes)});
+                }
+                return result;
+            }
+
+        private:
+            uint32_t                                  mLdm;
+            uint32_t                                  mBlockOffset;
+            std::map<uint32_t, std::vector<uint64_t>> mVectors;
+        };
+
+        template <typename FragT, typename DataLayoutT>
+        LdsReport analyzeLdsIO(uint32_t ldm, Coord2d const& blockCoord, bool isWrite)
+        {
+            constexpr uint32_t VW = GetIOConfig_t<FragT>::IOLayout::VW;
+
+            LdsAccessBuilder<FragT, DataLayoutT, VW> builder(ldm, blockCoord);
+
+            // Lanes in order, so that each instruction's offsets are ordered by lane
+            for(uint32_t lane = 0u; lane < Constants::AMDGCN_WAVE_SIZE; lane++)
+            {
+                for(uint32_t i = 0u; i < FragT::num_elements; i++)
+                {
+                    builder(i, emulator::detail::elementCoord<FragT>(lane, i));
+                }
+            }
+            return builder.report(isWrite);
+        }
+
+        template <typename FragT, typename DataLayoutT, uint32_t WaveCount>
+        LdsReport analyzeLdsCoopIO(uint32_t       ldm,
+                                   Coord2d const& blockCoord,
+                                   uint32_t       waveIndex,
+                                   uint32_t       waveCount,
+                                   bool           isWrite)
+        {
+            constexpr uint32_t VW = GetCoopIOConfig_t<FragT, WaveCount>::IOLayout::VW;
+
+            LdsAccessBuilder<FragT, DataLayoutT, VW> builder(ldm, blockCoord);
+            forEachCoopElement<FragT, WaveCount>(
+                waveIndex, waveCount, [&](uint32_t, uint32_t i, Coord2d const& coord) {
+                    builder(i, coord);
+                });
+            return builder.report(isWrite);
+        }
+
+    } // namespace detail
+
+    template <typename FragT, typename DataLayoutT>
+    LdsReport analyzeLdsLoad(uint32_t ldm, Coord2d const& blockCoord)
+    {
+        return detail::analyzeLdsIO<FragT, DataLayoutT>(ldm, blockCoord, false);
+    }
+
+    template <typename FragT, typename DataLayoutT>
+    LdsReport analyzeLdsStore(uint32_t ldm, Coord2d const& blockCoord)
+    {
+        return detail::analyzeLdsIO<FragT, DataLayoutT>(ldm, blockCoord, true);
+    }
+
+    template <typename FragT, typename DataLayoutT, uint32_t WaveCount>
+    LdsReport analyzeLdsCoopLoad(uint32_t       ldm,
+                                 Coord2d const& blockCoord,
+                                 uint32_t       waveIndex,
+                                 uint32_t       waveCount)
+    {
+        return detail::analyzeLdsCoopIO<FragT, DataLayoutT, WaveCount>(
+            ldm, blockCoord, waveIndex, waveCount, false);
+    }
+
+    template <typename FragT, typename DataLayoutT, uint32_t WaveCount>
+    LdsReport analyzeLdsCoopStore(uint32_t       ldm,
+                                  Coord2d const& blockCoord,
+                                  uint32_t       waveIndex,
+                                  uint32_t       waveCount)
+    {
+        return detail::analyzeLdsCoopIO<FragT, DataLayoutT, WaveCount>(
+            ldm, blockCoord, waveIndex, waveCount, true);
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_TEST_LDS_BANK_ANALYZER_IMPL_HPP
@@ -0,0 +1,107 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_TEST_RANDOM_HPP
+#define ROCWMMA_TEST_RANDOM_HPP
+
+#include <type_traits>
+
+#include <rocwmma/internal/config.hpp>
+#include <rocwmma/internal/types.hpp>
+
+namespace rocwmma
+{
+    // Counter-based random numbers (Philox4x32-10, Salmon et al., SC'11).
+    // Every value is a pure function of (seed, stream, index), so that a
+    // matrix is generated identically by any number of host threads or
+    // device lanes, in any order, without any generator state.
+    struct Philox4x32
+    {
+        constexpr static uint32_t Rounds = 10u;
+
+        constexpr static uint32_t Multiplier0 = 0xD2511F53u;
+        constexpr static uint32_t Multiplier1 = 0xCD9E8D57u;
+        constexpr static uint32_t Weyl0       = 0x9E3779B9u;
+        constexpr static uint32_t Weyl1       = 0xBB67AE85u;
+
+        struct Block
+        {
+            uint32_t data[4];
+        };
+
+        // Random block of the 128b counter under the 64b key
+        ROCWMMA_HOST_DEVICE constexpr static inline Block
+            generate(Block counter, uint32_t key0, uint32_t key1)
+        {
+            for(uint32_t i = 0; i < Rounds; i++)
+            {
+                uint64_t product0 = static_cast<uint64_t>(Multiplier0) * counter.data[0];
+                uint64_t product1 = static_cast<uint64_t>(Multiplier1) * counter.data[2];
+
+                counter = Block{{static_cast<uint32_t>(product1 >> 32u) ^ counter.data[1] ^ key0,
+                                 static_cast<uint32_t>(product1),
+                                 static_cast<uint32_t>(product0 >> 32u) ^ counter.data[3] ^ key1,
+                                 static_cast<uint32_t>(product0)}};
+
+                key0 += Weyl0;
+                key1 += Weyl1;
+            }
+            return counter;
+        }
+
+        // 32 random bits for the element index of the stream. Streams keep
+        // the matrices filled with the same seed independent.
+        ROCWMMA_HOST_DEVICE constexpr static inline uint32_t
+            generate(uint64_t seed, uint32_t stream, uint64_t index)
+        {
+            auto counter = Block{{static_cast<uint32_t>(index),
+                                  static_cast<uint32_t>(index >> 32u),
+                                  stream,
+                                  0u}};
+            auto key0 = static_cast<uint32_t>(seed);
+            auto key1 = static_cast<uint32_t>(seed >> 32u);
+            return generate(counter, key0, key1).data[0];
+        }
+    };
+
+    // Random fill value of the element index. Values are integers in [-2, 2]
+    // for signed types and [0, 4] otherwise, as with the deterministic fills.
+    // These are exactly representable in every data type, so that conversions
+    // agree on host and device.
+    template <typename DataT>
+    ROCWMMA_HOST_DEVICE inline DataT randomFillValue(uint64_t seed, uint32_t stream, uint64_t index)
+    {
+        auto value = static_cast<int32_t>(Philox4x32::generate(seed, stream, index) % 5u);
+        if(std::is_signed<DataT>::value)
+        {
+            value -= 2;
+        }
+        return static_cast<DataT>(static_cast<float>(value));
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_TEST_RANDOM_HPP
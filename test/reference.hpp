@@ -34,6 +34,9 @@
 namespace rocwmma
 {
 
+    // Reference D = alpha * (A x B) + beta * C.
+    // Cache-blocked and vectorized. Each element of D accumulates its products
+    // in increasing k, so that results are identical to gemm_CPU_naive.
     template <typename InputT,
               typename OutputT,
               typename ComputeT,
@@ -51,6 +54,74 @@ namespace rocwmma
                   ComputeT       alpha,
                   ComputeT       beta);
 
+    // Straightforward triple loop of the above, kept to validate and
+    // benchmark gemm_CPU against.
+    template <typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    void gemm_CPU_naive(uint32_t       m,
+                        uint32_t       n,
+                        uint32_t       k,
+                        InputT const*  a,
+                        InputT const*  b,
+                        OutputT const* c,
+                        OutputT*       d,
+                        ComputeT       alpha,
+                        ComputeT       beta);
+
+    // 2:4 structured sparse compression of the row_major m x k matrix a.
+    // In every group of 4 consecutive elements in k, the 2 of largest magnitude
+    // are kept in values (row_major m x k / 2), and their positions in the
+    // group in metadata (row_major m x ceil(k / 32) words of 8 groups).
+    template <typename DataT>
+    void compress_2to4_CPU(
+        DataT const* a, DataT* values, uint32_t* metadata, uint32_t m, uint32_t k);
+
+    // Expands compressed values and metadata into the row_major m x k matrix a.
+    template <typename DataT>
+    void decompress_2to4_CPU(
+        DataT const* values, uint32_t const* metadata, DataT* a, uint32_t m, uint32_t k);
+
+    // Reference for the sparse gemm, where A is given in compressed form.
+    template <typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    void gemm_sparse_CPU(uint32_t        m,
+                         uint32_t        n,
+                         uint32_t        k,
+                         InputT const*   values,
+                         uint32_t const* metadata,
+                         InputT const*   b,
+                         OutputT const*  c,
+                         OutputT*        d,
+                         ComputeT        alpha,
+                         ComputeT        beta);
+
+    // Packs count 4-bit integer values in memory order, two per byte of packed
+    // with the first in the low nibble. PackedT is int4x2_t or uint4x2_t.
+    template <typename PackedT>
+    void pack_int4_CPU(int8_t const* values, PackedT* packed, uint64_t count);
+
+    // Expands the packed k x n matrix to the matrix dequant in the same layout.
+    // If scales is not null, each element is dequantized as (q - zero) * scale with
+    // the scale and zero-point of its group of groupSize in k. Scales and zeros are
+    // ceil(k / groupSize) x n matrices in the same layout, and zeros may be null.
+    template <typename PackedT, typename DataT, typename LayoutT>
+    void dequant_int4_CPU(PackedT const* packed,
+                          DataT*         dequant,
+                          uint32_t       k,
+                          uint32_t       n,
+                          DataT const*   scales    = nullptr,
+                          DataT const*   zeros     = nullptr,
+                          uint32_t       groupSize = 1u);
+
     template <typename DataT>
     void
         dlrm_fwd_CPU(DataT const* input, DataT* output, uint32_t m, uint32_t k, uint32_t batchSize);
@@ -72,7 +143,8 @@ namespace rocwmma
     void cross_lane_bcast_CPU(uint32_t*       dataOut,
                               uint32_t const* dataIn,
                               uint32_t        elementCount,
-                              uint32_t        fillVal = 0u);
+                              uint32_t        fillVal  = 0u,
+                              uint32_t        waveSize = Constants::AMDGCN_WAVE_SIZE);
 
     template <uint32_t BlockIdx,
               uint32_t GroupSize,
@@ -82,7 +154,8 @@ namespace rocwmma
     void cross_lane_block_bcast_CPU(uint32_t*       dataOut,
                                     uint32_t const* dataIn,
                                     uint32_t        elementCount,
-                                    uint32_t        fillVal = 0u);
+                                    uint32_t        fillVal  = 0u,
+                                    uint32_t        waveSize = Constants::AMDGCN_WAVE_SIZE);
 
     template <uint32_t Select0,
               uint32_t Select1,
@@ -96,7 +169,8 @@ namespace rocwmma
                                    uint32_t const* src0,
                                    uint32_t const* src1,
                                    uint32_t        elementCount,
-                                   uint32_t        fillVal = 0u);
+                                   uint32_t        fillVal  = 0u,
+                                   uint32_t        waveSize = Constants::AMDGCN_WAVE_SIZE);
 
     template <uint32_t GroupSize,
               uint32_t RowMask   = 0xF,
@@ -105,7 +179,8 @@ namespace rocwmma
     void cross_lane_wfall_bcast_CPU(uint32_t*       dataOut,
                                     uint32_t const* dataIn,
                                     uint32_t        elementCount,
-                                    uint32_t        fillVal = 0u);
+                                    uint32_t        fillVal  = 0u,
+                                    uint32_t        waveSize = Constants::AMDGCN_WAVE_SIZE);
 
     template <uint32_t GroupSize,
               uint32_t RowMask   = 0xF,
@@ -114,7 +189,8 @@ namespace rocwmma
     void cross_lane_reverse_CPU(uint32_t*       dataOut,
                                 uint32_t const* dataIn,
                                 uint32_t        elementCount,
-                                uint32_t        fillVal = 0u);
+                                uint32_t        fillVal  = 0u,
+                                uint32_t        waveSize = Constants::AMDGCN_WAVE_SIZE);
 
     template <uint32_t RotateDir,
               uint32_t RotateDist,
@@ -125,7 +201,8 @@ namespace rocwmma
     void cross_lane_rotate_CPU(uint32_t*       dataOut,
                                uint32_t const* dataIn,
                                uint32_t        elementCount,
-                               uint32_t        fillVal = 0u);
+                               uint32_t        fillVal  = 0u,
+                               uint32_t        waveSize = Constants::AMDGCN_WAVE_SIZE);
 
     template <uint32_t ShiftDir,
               uint32_t ShiftDist,
@@ -136,7 +213,8 @@ namespace rocwmma
     void cross_lane_shift_CPU(uint32_t*       dataOut,
                               uint32_t const* dataIn,
                               uint32_t        elementCount,
-                              uint32_t        fillVal = 0u);
+                              uint32_t        fillVal  = 0u,
+                              uint32_t        waveSize = Constants::AMDGCN_WAVE_SIZE);
 
     template <uint32_t Select0,
               uint32_t Select1,
@@ -149,7 +227,8 @@ namespace rocwmma
     void cross_lane_shuffle_CPU(uint32_t*       dataOut,
                                 uint32_t const* dataIn,
                                 uint32_t        elementCount,
-                                uint32_t        fillVal = 0u);
+                                uint32_t        fillVal  = 0u,
+                                uint32_t        waveSize = Constants::AMDGCN_WAVE_SIZE);
 
     template <uint32_t GroupSize,
               uint32_t RowMask   = 0xF,
@@ -158,7 +237,8 @@ namespace rocwmma
     void cross_lane_swap_CPU(uint32_t*       dataOut,
                              uint32_t const* dataIn,
                              uint32_t        elementCount,
-                             uint32_t        fillVal = 0u);
+                             uint32_t        fillVal  = 0u,
+                             uint32_t        waveSize = Constants::AMDGCN_WAVE_SIZE);
 
     template <typename DataT,
               typename CrossLaneOp,
@@ -169,7 +249,8 @@ namespace rocwmma
     void cross_lane_ref_dispatch_CPU(DataT*       dataOut,
                                      DataT const* dataIn,
                                      uint32_t     elementCount,
-                                     DataT        fillVal = DataT(0.0f));
+                                     DataT        fillVal  = DataT(0.0f),
+                                     uint32_t     waveSize = Constants::AMDGCN_WAVE_SIZE);
 
 } // namespace rocwmma
 
@@ -0,0 +1,161 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_TEST_REFERENCE_CACHE_HPP
+#define ROCWMMA_TEST_REFERENCE_CACHE_HPP
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <rocwmma/internal/utils.hpp>
+
+#include "singleton.hpp"
+
+namespace rocwmma
+{
+    // Cache of CPU reference results. The same problem is validated by every
+    // kernel variant sharing it (block sizes, thread blocks, gemm configs), and
+    // again on every run of the suite, so its reference is computed only once.
+    //
+    // Results are looked up by a hash of the problem descriptor, first in
+    // memory, then in memory-mapped files of the cache directory when one is
+    // given with --ref_cache_dir or ROCWMMA_REF_CACHE_DIR. The descriptor is
+    // stored alongside the results, so hash collisions are never served.
+
+    // Describes everything the reference result depends on: the reference
+    // function, problem sizes, types, layouts, scalars and the input fill.
+    class ReferenceKey
+    {
+    public:
+        // Bump when reference functions or input fills change their results
+        constexpr static uint32_t Version = 2u;
+
+        explicit ReferenceKey(std::string const& reference, uint64_t fillSeed = 0u);
+
+        // Appends a named field to the descriptor
+        ReferenceKey& field(char const* name, std::string const& value);
+        ReferenceKey& field(char const* name, uint64_t value);
+
+        // Appends the exact bit pattern of the value, e.g. for alpha and beta
+        template <typename T>
+        ReferenceKey& bits(char const* name, T const& value);
+
+        template <typename T>
+        ReferenceKey& type(char const* name)
+        {
+            return field(name, dataTypeToString<T>());
+        }
+
+        std::string const& descriptor() const;
+
+        // 64b FNV-1a of the descriptor
+        uint64_t hash() const;
+
+    private:
+        std::string mDescriptor;
+    };
+
+    // Host memory of one reference output
+    struct ReferenceBuffer
+    {
+        void*    data;
+        uint64_t bytes;
+    };
+
+    class ReferenceCache : public LazySingleton<ReferenceCache>
+    {
+    public:
+        // Default host memory budget of cached results
+        constexpr static uint64_t DefaultMemoryBytes = 1ull << 30;
+
+        // Directory is taken from the test options, or the environment
+        ReferenceCache();
+        explicit ReferenceCache(std::string const& directory,
+                                uint64_t           memoryBytes = DefaultMemoryBytes);
+
+        ReferenceCache(ReferenceCache const&)            = delete;
+        ReferenceCache& operator=(ReferenceCache const&) = delete;
+        ~ReferenceCache()                                = default;
+
+        // Copies the cached result into outputs. Returns false on a miss,
+        // including results cached with different output sizes.
+        bool fetch(ReferenceKey const& key, std::vector<ReferenceBuffer> const& outputs);
+
+        // Caches the result held in outputs, in memory and in the directory.
+        void store(ReferenceKey const& key, std::vector<ReferenceBuffer> const& outputs);
+
+        // Fills outputs from the cache, or with refFunc() which is then cached.
+        template <typename RefFunc>
+        void run(ReferenceKey const&                 key,
+                 std::vector<ReferenceBuffer> const& outputs,
+                 RefFunc&&                           refFunc);
+
+        // Empty when results are only cached in memory
+        std::string const& directory() const;
+
+        uint64_t memoryHits() const;
+        uint64_t diskHits() const;
+        uint64_t misses() const;
+
+        // Drops the results cached in memory
+        void clear();
+
+    private:
+        struct Entry
+        {
+            std::string                    descriptor;
+            std::vector<std::vector<char>> buffers;
+        };
+
+        bool fetchMemory(ReferenceKey const& key, std::vector<ReferenceBuffer> const& outputs);
+        bool fetchDisk(ReferenceKey const& key, std::vector<ReferenceBuffer> const& outputs);
+        void storeMemory(ReferenceKey const& key, std::vector<ReferenceBuffer> const& outputs);
+        void storeDisk(ReferenceKey const& key, std::vector<ReferenceBuffer> const& outputs);
+
+        std::string filePath(ReferenceKey const& key) const;
+
+        std::string mDirectory;
+        uint64_t    mMemoryBytes;
+        uint64_t    mMemoryUsed;
+
+        // Entries in insertion order, evicted oldest first
+        std::unordered_map<uint64_t, Entry> mEntries;
+        std::list<uint64_t>                 mOrder;
+
+        uint64_t mMemoryHits, mDiskHits, mMisses;
+
+        mutable std::mutex mMutex;
+    };
+
+} // namespace rocwmma
+
+#include "reference_cache_impl.hpp"
+
+#endif // ROCWMMA_TEST_REFERENCE_CACHE_HPP
@@ -0,0 +1,465 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_TEST_REFERENCE_CACHE_IMPL_HPP
+#define ROCWMMA_TEST_REFERENCE_CACHE_IMPL_HPP
+
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "reference_cache.hpp"
+#include "rocwmma_logging.hpp"
+
+namespace rocwmma
+{
+    namespace detail
+    {
+        // Layout of the cache files:
+        // ReferenceFileHeader | uint64_t bytes[bufferCount] | descriptor | buffers...
+        struct ReferenceFileHeader
+        {
+            constexpr static char Magic[8] = {'R', 'W', 'M', 'M', 'A', 'R', 'E', 'F'};
+
+            char     magic[8];
+            uint32_t version;
+            uint32_t bufferCount;
+            uint64_t descriptorBytes;
+        };
+
+        // Read-only mapping of a whole file, unmapped on destruction
+        class MappedFile
+        {
+        public:
+            explicit MappedFile(std::string const& path)
+                : mData(nullptr)
+                , mBytes(0u)
+            {
+                auto fd = ::open(path.c_str(), O_RDONLY);
+                if(fd < 0)
+                {
+                    return;
+                }
+
+                struct stat info;
+                if(::fstat(fd, &info) == 0 && info.st_size > 0)
+                {
+                    auto data = ::mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                    if(data != MAP_FAILED)
+                    {
+                        mData  = static_cast<char const*>(data);
+                        mBytes = info.st_size;
+                    }
+                }
+                ::close(fd);
+            }
+
+            ~MappedFile()
+            {
+                if(mData != nullptr)
+                {
+                    ::munmap(const_cast<char*>(mData), mBytes);
+                }
+            }
+
+            MappedFile(MappedFile const&)            = delete;
+            MappedFile& operator=(MappedFile const&) = delete;
+
+            char const* data() const
+            {
+                return mData;
+            }
+
+            uint64_t size() const
+            {
+                return mBytes;
+            }
+
+        private:
+            char const* mData;
+            uint64_t    mBytes;
+        };
+
+    } // namespace detail
+
+    ///
+    /// ReferenceKey
+    ///
+
+    inline ReferenceKey::ReferenceKey(std::string const& reference, uint64_t fillSeed)
+        : mDescriptor(reference)
+    {
+        field("version", Version);
+        field("fillSeed", fillSeed);
+    }
+
+    inline ReferenceKey& ReferenceKey::field(char const* name, std::string const& value)
+    {
+        mDescriptor += std::string(";") + name + "=" + value;
+        return *this;
+    }
+
+    inline ReferenceKey& ReferenceKey::field(char const* name, uint64_t value)
+    {
+        return field(name, std::to_string(value));
+    }
+
+    template <typename T>
+    inline ReferenceKey& ReferenceKey::bits(char const* name, T const& value)
+    {
+        unsigned char bytes[sizeof(T)];
+        std::memcpy(bytes, &value, sizeof(T));
+
+        std::ostringstream hex;
+        hex << std::hex << std::setfill('0');
+        for(auto byte : bytes)
+        {
+            hex << std::setw(2) << static_cast<uint32_t>(byte);
+        }
+        return field(name, hex.str());
+    }
+
+    inline std::string const& ReferenceKey::descriptor() const
+    {
+        return mDescriptor;
+    }
+
+    inline uint64_t ReferenceKey::hash() const
+    {
+        uint64_t result = 0xcbf29ce484222325ull;
+        for(auto c : mDescriptor)
+        {
+            result = (result ^ static_cast<unsigned char>(c)) * 0x100000001b3ull;
+        }
+        return result;
+    }
+
+    ///
+    /// ReferenceCache
+    ///
+
+    inline ReferenceCache::ReferenceCache()
+        : ReferenceCache(RocwmmaLogging::instance()->refCacheDir())
+    {
+        if(mDirectory.empty())
+        {
+            if(auto env = std::getenv("ROCWMMA_REF_CACHE_DIR"))
+            {
+                mDirectory = env;
+            }
+        }
+    }
+
+    inline ReferenceCache::ReferenceCache(std::string const& directory, uint64_t memoryBytes)
+        : mDirectory(directory)
+        , mMemoryBytes(memoryBytes)
+        , mMemoryUsed(0u)
+        , mMemoryHits(0u)
+        , mDiskHits(0u)
+        , mMisses(0u)
+    {
+    }
+
+    inline bool ReferenceCache::fetch(ReferenceKey const&                 key,
+                                      std::vector<ReferenceBuffer> const& outputs)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        if(fetchMemory(key, outputs))
+        {
+            mMemoryHits++;
+            return true;
+        }
+
+        if(fetchDisk(key, outputs))
+        {
+            mDiskHits++;
+
+            // Keep disk hits in memory for the following variants of the problem
+            storeMemory(key, outputs);
+            return true;
+        }
+
+        mMisses++;
+        return false;
+    }
+
+    inline void ReferenceCache::store(ReferenceKey const&                 key,
+                                      std::vector<ReferenceBuffer> const& outputs)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        storeMemory(key, outputs);
+        storeDisk(key, outputs);
+    }
+
+    template <typename RefFunc>
+    inline void ReferenceCache::run(ReferenceKey const&                 key,
+                                    std::vector<ReferenceBuffer> const& outputs,
+                                    RefFunc&&                           refFunc)
+    {
+        if(!fetch(key, outputs))
+        {
+            refFunc();
+            store(key, outputs);
+        }
+    }
+
+    inline std::string const& ReferenceCache::directory() const
+    {
+        return mDirectory;
+    }
+
+    inline uint64_t ReferenceCache::memoryHits() const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mMemoryHits;
+    }
+
+    inline uint64_t ReferenceCache::diskHits() const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mDiskHits;
+    }
+
+    inline uint64_t ReferenceCache::misses() const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mMisses;
+    }
+
+    inline void ReferenceCache::clear()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mEntries.clear();
+        mOrder.clear();
+        mMemoryUsed = 0u;
+    }
+
+    inline bool ReferenceCache::fetchMemory(ReferenceKey const&                 key,
+                                            std::vector<ReferenceBuffer> const& outputs)
+    {
+        auto it = mEntries.find(key.hash());
+        if(it == mEntries.end() || it->second.descriptor != key.descriptor()
+           || it->second.buffers.size() != outputs.size())
+        {
+            return false;
+        }
+
+        auto& buffers = it->second.buffers;
+        for(uint32_t i = 0; i < outputs.size(); i++)
+        {
+            if(buffers[i].size() != outputs[i].bytes)
+            {
+                return false;
+            }
+        }
+
+        for(uint32_t i = 0; i < outputs.size(); i++)
+        {
+            std::memcpy(outputs[i].data, buffers[i].data(), outputs[i].bytes);
+        }
+        return true;
+    }
+
+    inline bool ReferenceCache::fetchDisk(ReferenceKey const&                 key,
+                                          std::vector<ReferenceBuffer> const& outputs)
+    {
+        using Header = detail::ReferenceFileHeader;
+
+        if(mDirectory.empty())
+        {
+            return false;
+        }
+
+        detail::MappedFile file(filePath(key));
+        auto               data = file.data();
+        auto               size = file.size();
+
+        // Validate the header, output sizes and descriptor before reading any result
+        auto const& descriptor = key.descriptor();
+        auto        offset     = sizeof(Header) + outputs.size() * sizeof(uint64_t);
+        if(data == nullptr || size < offset + descriptor.size())
+        {
+            return false;
+        }
+
+        Header header;
+        std::memcpy(&header, data, sizeof(Header));
+        if(std::memcmp(header.magic, Header::Magic, sizeof(Header::Magic)) != 0
+           || header.version != ReferenceKey::Version || header.bufferCount != outputs.size()
+           || header.descriptorBytes != descriptor.size())
+        {
+            return false;
+        }
+
+        auto total = offset + descriptor.size();
+        for(uint32_t i = 0; i < outputs.size(); i++)
+        {
+            uint64_t bytes;
+            std::memcpy(&bytes, data + sizeof(Header) + i * sizeof(uint64_t), sizeof(uint64_t));
+            if(bytes != outputs[i].bytes)
+            {
+                return false;
+            }
+            total += bytes;
+        }
+
+        if(size != total || std::memcmp(data + offset, descriptor.data(), descriptor.size()) != 0)
+        {
+            return false;
+        }
+
+        offset += descriptor.size();
+        for(auto const& output : outputs)
+        {
+            std::memcpy(output.data, data + offset, output.bytes);
+            offset += output.bytes;
+        }
+        return true;
+    }
+
+    inline void ReferenceCache::storeMemory(ReferenceKey const&                 key,
+                                            std::vector<ReferenceBuffer> const& outputs)
+    {
+        uint64_t bytes = 0u;
+        for(auto const& output : outputs)
+        {
+            bytes += output.bytes;
+        }
+
+        // Results larger than the whole budget are only cached on disk
+        if(bytes > mMemoryBytes)
+        {
+            return;
+        }
+
+        auto hash = key.hash();
+        if(auto it = mEntries.find(hash); it != mEntries.end())
+        {
+            for(auto const& buffer : it->second.buffers)
+            {
+                mMemoryUsed -= buffer.size();
+            }
+            mEntries.erase(it);
+            mOrder.remove(hash);
+        }
+
+        while(mMemoryUsed + bytes > mMemoryBytes)
+        {
+            auto oldest = mEntries.find(mOrder.front());
+            for(auto const& buffer : oldest->second.buffers)
+            {
+                mMemoryUsed -= buffer.size();
+            }
+            mEntries.erase(oldest);
+            mOrder.pop_front();
+        }
+
+        Entry entry;
+        entry.descriptor = key.descriptor();
+        for(auto const& output : outputs)
+        {
+            auto data = static_cast<char const*>(output.data);
+            entry.buffers.emplace_back(data, data + output.bytes);
+        }
+
+        mEntries.emplace(hash, std::move(entry));
+        mOrder.push_back(hash);
+        mMemoryUsed += bytes;
+    }
+
+    inline void ReferenceCache::storeDisk(ReferenceKey const&                 key,
+                                          std::vector<ReferenceBuffer> const& outputs)
+    {
+        using Header = detail::ReferenceFileHeader;
+
+        if(mDirectory.empty())
+        {
+            return;
+        }
+
+        // The cache is best effort: results that cannot be written are
+        // simply recomputed by the next run.
+        std::error_code error;
+        std::filesystem::create_directories(mDirectory, error);
+
+        // Write to a file private to this process, then publish it atomically
+        // so that concurrent test processes never read a partial result.
+        auto path = filePath(key);
+        auto temp = path + "." + std::to_string(::getpid()) + ".tmp";
+
+        Header header;
+        std::memcpy(header.magic, Header::Magic, sizeof(Header::Magic));
+        header.version         = ReferenceKey::Version;
+        header.bufferCount     = outputs.size();
+        header.descriptorBytes = key.descriptor().size();
+
+        {
+            std::ofstream file(temp, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<char const*>(&header), sizeof(Header));
+            for(auto const& output : outputs)
+            {
+                file.write(reinterpret_cast<char const*>(&output.bytes), sizeof(uint64_t));
+            }
+            file.write(key.descriptor().data(), key.descriptor().size());
+            for(auto const& output : outputs)
+            {
+                file.write(static_cast<char const*>(output.data), output.bytes);
+            }
+
+            if(!file)
+            {
+                file.close();
+                std::filesystem::remove(temp, error);
+                return;
+            }
+        }
+
+        std::filesystem::rename(temp, path, error);
+        if(error)
+        {
+            std::filesystem::remove(temp, error);
+        }
+    }
+
+    inline std::string ReferenceCache::filePath(ReferenceKey const& key) const
+    {
+        std::ostringstream name;
+        name << std::hex << std::setfill('0') << std::setw(16) << key.hash() << ".ref";
+        return (std::filesystem::path(mDirectory) / name.str()).string();
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_TEST_REFERENCE_CACHE_IMPL_HPP
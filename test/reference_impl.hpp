@@ -26,13 +26,65 @@
 #ifndef ROCWMMA_REFERENCE_IMPL_HPP
 #define ROCWMMA_REFERENCE_IMPL_HPP
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 #include "hip_device.hpp"
 #include "reference.hpp"
+#include <rocwmma/internal/dequant_load.hpp>
 #include <rocwmma/internal/pack_util.hpp>
 
 namespace rocwmma
 {
 
+    namespace detail
+    {
+        // Cache blocking of gemm_CPU. The accumulator tile and the packed A and B
+        // panels of one k step are private to each thread and fit in L2, and the
+        // micro kernel streams rows of B across MR rows of accumulators in L1.
+        struct GemmBlockingCPU
+        {
+            constexpr static uint32_t MC = 64u;
+            constexpr static uint32_t NC = 128u;
+            constexpr static uint32_t KC = 256u;
+            constexpr static uint32_t MR = 4u;
+        };
+
+        // acc[Rows x nc] += aPanel[Rows x kc] * bPanel[kc x nc], with acc rows NC apart.
+        // Every accumulator adds its products in increasing k, and vectorizes in n.
+        template <uint32_t Rows, typename ComputeT>
+        inline void gemmMicroKernelCPU(ComputeT*       acc,
+                                       ComputeT const* aPanel,
+                                       ComputeT const* bPanel,
+                                       uint32_t        kc,
+                                       uint32_t        nc)
+        {
+            constexpr uint32_t NC = GemmBlockingCPU::NC;
+
+            for(uint32_t h = 0; h < kc; h++)
+            {
+                ComputeT a[Rows];
+                for(uint32_t r = 0; r < Rows; r++)
+                {
+                    a[r] = aPanel[r * kc + h];
+                }
+
+                auto bRow = bPanel + h * nc;
+#pragma omp simd
+                for(uint32_t j = 0; j < nc; j++)
+                {
+                    auto bj = bRow[j];
+                    for(uint32_t r = 0; r < Rows; r++)
+                    {
+                        acc[r * NC + j] += a[r] * bj;
+                    }
+                }
+            }
+        }
+
+    } // namespace detail
+
     template <typename InputT,
               typename OutputT,
               typename ComputeT,
@@ -49,6 +101,120 @@ namespace rocwmma
                   OutputT*       d,
                   ComputeT       alpha,
                   ComputeT       beta)
+    {
+        using Blocking = detail::GemmBlockingCPU;
+
+        constexpr uint32_t MC = Blocking::MC;
+        constexpr uint32_t NC = Blocking::NC;
+        constexpr uint32_t KC = Blocking::KC;
+        constexpr uint32_t MR = Blocking::MR;
+
+        int lda = std::is_same<LayoutA, row_major>::value ? k : m;
+        int ldb = std::is_same<LayoutB, row_major>::value ? n : k;
+        int ldc = std::is_same<LayoutC, row_major>::value ? n : m;
+        int ldd = std::is_same<LayoutD, row_major>::value ? n : m;
+
+        auto rowMjr = [](uint32_t row, uint32_t col, uint32_t ld) {
+            return static_cast<uint64_t>(row) * ld + col;
+        };
+        auto colMjr = [](uint32_t row, uint32_t col, uint32_t ld) {
+            return static_cast<uint64_t>(col) * ld + row;
+        };
+
+        auto aIndex = std::is_same<LayoutA, row_major>::value ? rowMjr : colMjr;
+        auto bIndex = std::is_same<LayoutB, row_major>::value ? rowMjr : colMjr;
+        auto cIndex = std::is_same<LayoutC, row_major>::value ? rowMjr : colMjr;
+        auto dIndex = std::is_same<LayoutD, row_major>::value ? rowMjr : colMjr;
+
+        int64_t tilesM = (m + MC - 1u) / MC;
+        int64_t tilesN = (n + NC - 1u) / NC;
+
+#pragma omp parallel
+        {
+            // Thread private tiles, with inputs converted to ComputeT once when packed
+            std::vector<ComputeT> acc(MC * NC);
+            std::vector<ComputeT> aPanel(MC * KC);
+            std::vector<ComputeT> bPanel(KC * NC);
+
+#pragma omp for collapse(2) schedule(dynamic)
+            for(int64_t tileM = 0; tileM < tilesM; tileM++)
+            {
+                for(int64_t tileN = 0; tileN < tilesN; tileN++)
+                {
+                    uint32_t i0 = tileM * MC;
+                    uint32_t j0 = tileN * NC;
+                    uint32_t mc = std::min(MC, m - i0);
+                    uint32_t nc = std::min(NC, n - j0);
+
+                    std::fill(acc.begin(), acc.end(), static_cast<ComputeT>(0));
+
+                    // K steps in order, so that the accumulation order is that of
+                    // gemm_CPU_naive and the results are identical.
+                    for(uint32_t h0 = 0; h0 < k; h0 += KC)
+                    {
+                        uint32_t kc = std::min(KC, k - h0);
+
+                        for(uint32_t i = 0; i < mc; i++)
+                        {
+                            for(uint32_t h = 0; h < kc; h++)
+                            {
+                                aPanel[i * kc + h]
+                                    = static_cast<ComputeT>(a[aIndex(i0 + i, h0 + h, lda)]);
+                            }
+                        }
+
+                        for(uint32_t h = 0; h < kc; h++)
+                        {
+                            for(uint32_t j = 0; j < nc; j++)
+                            {
+                                bPanel[h * nc + j]
+                                    = static_cast<ComputeT>(b[bIndex(h0 + h, j0 + j, ldb)]);
+                            }
+                        }
+
+                        uint32_t i = 0;
+                        for(; i + MR <= mc; i += MR)
+                        {
+                            detail::gemmMicroKernelCPU<MR>(
+                                &acc[i * NC], &aPanel[i * kc], bPanel.data(), kc, nc);
+                        }
+                        for(; i < mc; i++)
+                        {
+                            detail::gemmMicroKernelCPU<1u>(
+                                &acc[i * NC], &aPanel[i * kc], bPanel.data(), kc, nc);
+                        }
+                    }
+
+                    for(uint32_t i = 0; i < mc; i++)
+                    {
+                        for(uint32_t j = 0; j < nc; j++)
+                        {
+                            d[dIndex(i0 + i, j0 + j, ldd)] = static_cast<OutputT>(
+                                alpha * acc[i * NC + j]
+                                + beta * static_cast<ComputeT>(c[cIndex(i0 + i, j0 + j, ldc)]));
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    template <typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    void gemm_CPU_naive(uint32_t       m,
+                        uint32_t       n,
+                        uint32_t       k,
+                        InputT const*  a,
+                        InputT const*  b,
+                        OutputT const* c,
+                        OutputT*       d,
+                        ComputeT       alpha,
+                        ComputeT       beta)
     {
         int lda = std::is_same<LayoutA, row_major>::value ? k : m;
         int ldb = std::is_same<LayoutB, row_major>::value ? n : k;
@@ -80,6 +246,169 @@ namespace rocwmma
         }
     }
 
+    template <typename DataT>
+    void compress_2to4_CPU(
+        DataT const* a, DataT* values, uint32_t* metadata, uint32_t m, uint32_t k)
+    {
+        constexpr uint32_t GroupSize     = 4u;
+        constexpr uint32_t GroupsPerWord = 8u;
+
+        auto groups    = k / GroupSize;
+        auto words     = (k + GroupSize * GroupsPerWord - 1u) / (GroupSize * GroupsPerWord);
+        auto magnitude = [](DataT x) { return std::abs(static_cast<float>(x)); };
+
+#pragma omp parallel for
+        for(int row = 0; row < m; row++)
+        {
+            std::fill(metadata + row * words, metadata + (row + 1) * words, 0u);
+
+            for(uint32_t g = 0; g < groups; g++)
+            {
+                auto group = a + row * k + g * GroupSize;
+
+                // Keep the two largest, in order of position
+                uint32_t first = 0u, second = 1u;
+                if(magnitude(group[second]) > magnitude(group[first]))
+                {
+                    std::swap(first, second);
+                }
+                for(uint32_t i = 2u; i < GroupSize; i++)
+                {
+                    if(magnitude(group[i]) > magnitude(group[first]))
+                    {
+                        second = first;
+                        first  = i;
+                    }
+                    else if(magnitude(group[i]) > magnitude(group[second]))
+                    {
+                        second = i;
+                    }
+                }
+                if(first > second)
+                {
+                    std::swap(first, second);
+                }
+
+                values[row * (k / 2u) + g * 2u]      = group[first];
+                values[row * (k / 2u) + g * 2u + 1u] = group[second];
+                metadata[row * words + g / GroupsPerWord]
+                    |= (first | (second << 2u)) << ((g % GroupsPerWord) * GroupSize);
+            }
+        }
+    }
+
+    template <typename DataT>
+    void decompress_2to4_CPU(
+        DataT const* values, uint32_t const* metadata, DataT* a, uint32_t m, uint32_t k)
+    {
+        constexpr uint32_t GroupSize     = 4u;
+        constexpr uint32_t GroupsPerWord = 8u;
+
+        auto groups = k / GroupSize;
+        auto words  = (k + GroupSize * GroupsPerWord - 1u) / (GroupSize * GroupsPerWord);
+
+#pragma omp parallel for
+        for(int row = 0; row < m; row++)
+        {
+            std::fill(a + row * k, a + (row + 1) * k, static_cast<DataT>(0));
+
+            for(uint32_t g = 0; g < groups; g++)
+            {
+                auto bits = metadata[row * words + g / GroupsPerWord]
+                            >> ((g % GroupsPerWord) * GroupSize);
+
+                a[row * k + g * GroupSize + (bits & 0x3u)] = values[row * (k / 2u) + g * 2u];
+                a[row * k + g * GroupSize + ((bits >> 2u) & 0x3u)]
+                    = values[row * (k / 2u) + g * 2u + 1u];
+            }
+        }
+    }
+
+    template <typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    void gemm_sparse_CPU(uint32_t        m,
+                         uint32_t        n,
+                         uint32_t        k,
+                         InputT const*   values,
+                         uint32_t const* metadata,
+                         InputT const*   b,
+                         OutputT const*  c,
+                         OutputT*        d,
+                         ComputeT        alpha,
+                         ComputeT        beta)
+    {
+        std::vector<InputT> a(static_cast<size_t>(m) * k);
+        decompress_2to4_CPU(values, metadata, a.data(), m, k);
+
+        gemm_CPU<InputT, OutputT, ComputeT, row_major, LayoutB, LayoutC, LayoutD>(
+            m, n, k, a.data(), b, c, d, alpha, beta);
+    }
+
+    template <typename PackedT>
+    void pack_int4_CPU(int8_t const* values, PackedT* packed, uint64_t count)
+    {
+        using Int4Traits = detail::Int4Traits<PackedT>;
+
+#pragma omp parallel for
+        for(int64_t i = 0; i < static_cast<int64_t>(count / 2u); i++)
+        {
+            packed[i].data = Int4Traits::pack(values[2 * i], values[2 * i + 1]);
+        }
+
+        // Odd tail shares its byte with zero
+        if(count % 2u)
+        {
+            packed[count / 2u].data = Int4Traits::pack(values[count - 1u], 0);
+        }
+    }
+
+    template <typename PackedT, typename DataT, typename LayoutT>
+    void dequant_int4_CPU(PackedT const* packed,
+                          DataT*         dequant,
+                          uint32_t       k,
+                          uint32_t       n,
+                          DataT const*   scales,
+                          DataT const*   zeros,
+                          uint32_t       groupSize)
+    {
+        using Int4Traits = detail::Int4Traits<PackedT>;
+
+        auto rowMjr = [](uint32_t row, uint32_t col, uint32_t ld) { return row * ld + col; };
+        auto colMjr = [](uint32_t row, uint32_t col, uint32_t ld) { return col * ld + row; };
+
+        auto index  = std::is_same<LayoutT, row_major>::value ? rowMjr : colMjr;
+        auto groups = (k + groupSize - 1u) / groupSize;
+        auto ld     = std::is_same<LayoutT, row_major>::value ? n : k;
+        auto lds    = std::is_same<LayoutT, row_major>::value ? n : groups;
+
+#pragma omp parallel for
+        for(int row = 0; row < k; row++)
+        {
+            for(uint32_t col = 0; col < n; col++)
+            {
+                auto idx = index(row, col, ld);
+                auto q   = Int4Traits::unpack(packed[idx / 2u].data, idx % 2u);
+
+                if(scales != nullptr)
+                {
+                    auto groupIdx = index(row / groupSize, col, lds);
+                    auto zero
+                        = zeros != nullptr ? static_cast<float32_t>(zeros[groupIdx]) : 0.0f;
+                    dequant[idx] = static_cast<DataT>((static_cast<float32_t>(q) - zero)
+                                                      * static_cast<float32_t>(scales[groupIdx]));
+                }
+                else
+                {
+                    dequant[idx] = static_cast<DataT>(static_cast<float32_t>(q));
+                }
+            }
+        }
+    }
+
     template <typename DataT>
     void dlrm_fwd_CPU(DataT const* input, DataT* output, uint32_t m, uint32_t k, uint32_t batchSize)
     {
@@ -187,9 +516,9 @@ namespace rocwmma
     void cross_lane_bcast_CPU(PackedT*       dataOut,
                               PackedT const* dataIn,
                               uint32_t       elementCount,
-                              uint32_t       fillVal /* = 0u */)
+                              uint32_t       fillVal /* = 0u */,
+                              uint32_t       waveSize /* = Constants::AMDGCN_WAVE_SIZE */)
     {
-        auto waveSize = HipDevice::instance()->warpSize();
         auto groupSize
             = (GroupSize == CrossLaneOps::Properties::OP_GROUP_SIZE_WARP) ? waveSize : GroupSize;
 
@@ -242,9 +571,9 @@ namespace rocwmma
     void cross_lane_block_bcast_CPU(PackedT*       dataOut,
                                     PackedT const* dataIn,
                                     uint32_t       elementCount,
-                                    uint32_t       fillVal /* = 0u */)
+                                    uint32_t       fillVal /* = 0u */,
+                                    uint32_t       waveSize /* = Constants::AMDGCN_WAVE_SIZE */)
     {
-        auto waveSize = HipDevice::instance()->warpSize();
         auto groupSize
             = (BlockSize == CrossLaneOps::Properties::OP_GROUP_SIZE_WARP) ? waveSize : BlockSize;
 
@@ -300,9 +629,9 @@ namespace rocwmma
                                    PackedT const* src0,
                                    PackedT const* src1,
                                    uint32_t       elementCount,
-                                   uint32_t       fillVal /* = 0u */)
+                                   uint32_t       fillVal /* = 0u */,
+                                   uint32_t       waveSize /* = Constants::AMDGCN_WAVE_SIZE */)
     {
-        auto waveSize = HipDevice::instance()->warpSize();
         auto groupSize
             = (GroupSize == CrossLaneOps::Properties::OP_GROUP_SIZE_WARP) ? waveSize : GroupSize;
 
@@ -382,9 +711,9 @@ namespace rocwmma
     void cross_lane_wfall_bcast_CPU(PackedT*       dataOut,
                                     PackedT const* dataIn,
                                     uint32_t       elementCount,
-                                    uint32_t       fillVal /* = 0u */)
+                                    uint32_t       fillVal /* = 0u */,
+                                    uint32_t       waveSize /* = Constants::AMDGCN_WAVE_SIZE */)
     {
-        auto waveSize = HipDevice::instance()->warpSize();
         auto groupSize
             = (GroupSize == CrossLaneOps::Properties::OP_GROUP_SIZE_WARP) ? waveSize : GroupSize;
 
@@ -438,9 +767,9 @@ namespace rocwmma
     void cross_lane_reverse_CPU(PackedT*       dataOut,
                                 PackedT const* dataIn,
                                 uint32_t       elementCount,
-                                uint32_t       fillVal /* = 0u */)
+                                uint32_t       fillVal /* = 0u */,
+                                uint32_t       waveSize /* = Constants::AMDGCN_WAVE_SIZE */)
     {
-        auto waveSize = HipDevice::instance()->warpSize();
         auto groupSize
             = (GroupSize == CrossLaneOps::Properties::OP_GROUP_SIZE_WARP) ? waveSize : GroupSize;
 
@@ -488,9 +817,9 @@ namespace rocwmma
     void cross_lane_rotate_CPU(PackedT*       dataOut,
                                PackedT const* dataIn,
                                uint32_t       elementCount,
-                               uint32_t       fillVal /* = 0u */)
+                               uint32_t       fillVal /* = 0u */,
+                               uint32_t       waveSize /* = Constants::AMDGCN_WAVE_SIZE */)
     {
-        auto waveSize = HipDevice::instance()->warpSize();
         auto groupSize
             = (GroupSize == CrossLaneOps::Properties::OP_GROUP_SIZE_WARP) ? waveSize : GroupSize;
 
@@ -540,9 +869,9 @@ namespace rocwmma
     void cross_lane_shift_CPU(PackedT*       dataOut,
                               PackedT const* dataIn,
                               uint32_t       elementCount,
-                              uint32_t       fillVal /* = 0u */)
+                              uint32_t       fillVal /* = 0u */,
+                              uint32_t       waveSize /* = Constants::AMDGCN_WAVE_SIZE */)
     {
-        auto waveSize = HipDevice::instance()->warpSize();
         auto groupSize
             = (GroupSize == CrossLaneOps::Properties::OP_GROUP_SIZE_WARP) ? waveSize : GroupSize;
 
@@ -603,9 +932,9 @@ namespace rocwmma
     void cross_lane_shuffle_CPU(PackedT*       dataOut,
                                 PackedT const* dataIn,
                                 uint32_t       elementCount,
-                                uint32_t       fillVal /* = 0u */)
+                                uint32_t       fillVal /* = 0u */,
+                                uint32_t       waveSize /* = Constants::AMDGCN_WAVE_SIZE */)
     {
-        auto waveSize = HipDevice::instance()->warpSize();
         auto groupSize
             = (GroupSize == CrossLaneOps::Properties::OP_GROUP_SIZE_WARP) ? waveSize : GroupSize;
 
@@ -670,9 +999,9 @@ namespace rocwmma
     void cross_lane_swap_CPU(PackedT*       dataOut,
                              PackedT const* dataIn,
                              uint32_t       elementCount,
-                             uint32_t       fillVal /* = 0u */)
+                             uint32_t       fillVal /* = 0u */,
+                             uint32_t       waveSize /* = Constants::AMDGCN_WAVE_SIZE */)
     {
-        auto waveSize = HipDevice::instance()->warpSize();
         auto groupSize
             = (GroupSize == CrossLaneOps::Properties::OP_GROUP_SIZE_WARP) ? waveSize : GroupSize;
 
@@ -720,14 +1049,16 @@ namespace rocwmma
     void cross_lane_ref_dispatch_CPU(DataT*       dataOut,
                                      DataT const* dataIn,
                                      uint32_t     elementCount,
-                                     DataT        fillVal = DataT(0))
+                                     DataT        fillVal  = DataT(0),
+                                     uint32_t     waveSize = HipDevice::instance()->warpSize())
     {
         using PackedT = typename PackTraits<DataT>::PackedT;
         // Interface to device kernel
         using RefFunc = void (*)(PackedT*, // dataOut
                                  PackedT const*, // dataIn
                                  uint32_t, // elementCount
-                                 uint32_t); // fillVal
+                                 uint32_t, // fillVal
+                                 uint32_t); // waveSize
 
         RefFunc dispatcher = nullptr;
 
@@ -835,7 +1166,7 @@ namespace rocwmma
         // Finally, run the reference function
         if(dispatcher != nullptr)
         {
-            dispatcher(writeOut, readIn, elementCount, static_cast<uint32_t>(fillVal));
+            dispatcher(writeOut, readIn, elementCount, static_cast<uint32_t>(fillVal), waveSize);
         }
     }
 
@@ -850,7 +1181,8 @@ namespace rocwmma
                                      DataT const* dataIn0,
                                      DataT const* dataIn1,
                                      uint32_t     elementCount,
-                                     DataT        fillVal = DataT(0))
+                                     DataT        fillVal  = DataT(0),
+                                     uint32_t     waveSize = HipDevice::instance()->warpSize())
     {
         using PackedT = typename PackTraits<DataT>::PackedT;
         // Interface to cpu reference kernel
@@ -858,7 +1190,8 @@ namespace rocwmma
                                  PackedT const*, // dataIn0
                                  PackedT const*, // dataIn1
                                  uint32_t, // elementCount
-                                 uint32_t); // fillVal
+                                 uint32_t, // fillVal
+                                 uint32_t); // waveSize
 
         RefFunc dispatcher = nullptr;
 
@@ -891,7 +1224,8 @@ namespace rocwmma
         // Finally, run the reference function
         if(dispatcher != nullptr)
         {
-            dispatcher(writeOut, src0In, src1In, elementCount, static_cast<uint32_t>(fillVal));
+            dispatcher(
+                writeOut, src0In, src1In, elementCount, static_cast<uint32_t>(fillVal), waveSize);
         }
     }
 
@@ -54,6 +54,9 @@ namespace rocwmma
             , mOmitFailed(false)
             , mOmitPassed(false)
             , mOmitCout(false)
+            , mSplitK(0u)
+            , mRefCacheDir()
+            , mFillSeed(0u)
         {
         }
 
@@ -101,6 +104,39 @@ namespace rocwmma
                     }
                     setOmits(std::stoi(args[i + 1]));
                 }
+                if(args[i] == "--split_k")
+                {
+                    if(i + 2 >= argc)
+                    {
+                        std::cerr << "Missing split-K factor\n";
+                        std::cerr << "Usage: --split_k *integer_factor*\n";
+                        exit(EXIT_FAILURE);
+                    }
+                    mSplitK = std::stoi(args[i + 1]);
+                    i++;
+                }
+                if(args[i] == "--ref_cache_dir")
+                {
+                    if(i + 2 >= argc)
+                    {
+                        std::cerr << "Missing reference cache directory\n";
+                        std::cerr << "Usage: --ref_cache_dir *directory*\n";
+                        exit(EXIT_FAILURE);
+                    }
+                    mRefCacheDir = args[i + 1];
+                    i++;
+                }
+                if(args[i] == "--fill_seed")
+                {
+                    if(i + 2 >= argc)
+                    {
+                        std::cerr << "Missing fill seed\n";
+                        std::cerr << "Usage: --fill_seed *integer_seed*\n";
+                        exit(EXIT_FAILURE);
+                    }
+                    mFillSeed = std::stoull(args[i + 1]);
+                    i++;
+                }
             }
 
             mOstream.initializeStream(fileName);
@@ -131,10 +167,34 @@ namespace rocwmma
             return mOmitCout;
         }
 
+        // Count of K partitions requested for split-K kernels (0 = kernel default)
+        uint32_t splitK()
+        {
+            return mSplitK;
+        }
+
+        // Directory of cached CPU reference results (empty = ROCWMMA_REF_CACHE_DIR)
+        std::string const& refCacheDir()
+        {
+            return mRefCacheDir;
+        }
+
+        // Seed of the random matrix fills of GEMM and DLRM tests
+        uint64_t fillSeed()
+        {
+            return mFillSeed;
+        }
+
     protected:
         rocwmmaOStream mOstream;
 
         bool mOmitSkipped, mOmitFailed, mOmitPassed, mOmitCout;
+
+        uint32_t mSplitK;
+
+        std::string mRefCacheDir;
+
+        uint64_t mFillSeed;
     };
 }
 
@@ -0,0 +1,188 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DETAIL_COALESCING_HPP
+#define ROCWMMA_DETAIL_COALESCING_HPP
+
+#include <algorithm>
+#include <string>
+#include <tuple>
+
+#include <gtest/gtest.h>
+
+#include "coalescing_analyzer.hpp"
+#include "rocwmma_logging.hpp"
+#include "unit_test_params.hpp"
+
+namespace rocwmma
+{
+    // Fragments of the load / store unit tests, where BlockN is the
+    // BlockK of matrix_a and matrix_b.
+    template <typename MatrixT, uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct TestFragment;
+
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct TestFragment<matrix_a, BlockM, BlockN, DataT, Layout>
+    {
+        using Type = fragment<matrix_a, BlockM, 1, BlockN, DataT, Layout>;
+        constexpr static const char* Name = "matrix_a";
+    };
+
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct TestFragment<matrix_b, BlockM, BlockN, DataT, Layout>
+    {
+        using Type = fragment<matrix_b, 1, BlockN, BlockM, DataT, Layout>;
+        constexpr static const char* Name = "matrix_b";
+    };
+
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct TestFragment<accumulator, BlockM, BlockN, DataT, Layout>
+    {
+        using Type = fragment<accumulator, BlockM, BlockN, 1, DataT, Layout>;
+        constexpr static const char* Name = "accumulator";
+    };
+
+    // Leading dimension of a wide matrix, whose lines never share a cache line
+    constexpr static uint32_t WideLdm = 4096u;
+
+    // Waves sharing cooperative IO
+    constexpr static uint32_t CoopWaves = 4u;
+
+    // Each byte of the block is accessed exactly once, and nothing beyond it
+    inline void expectBlockCoverage(CoalescingReport const& report, uint64_t blockBytes)
+    {
+        auto coverage = report.byteCoverage(blockBytes);
+        EXPECT_TRUE(std::all_of(
+            coverage.begin(), coverage.end() - 1, [](uint32_t count) { return count == 1u; }))
+            << report.label();
+        EXPECT_EQ(coverage.back(), 0u) << report.label();
+    }
+
+    // Summary lines go to the test output stream, if one is open
+    inline void logReport(CoalescingReport const& report)
+    {
+        auto& ostream = RocwmmaLogging::instance()->ostream();
+        if(ostream.isOpen())
+        {
+            ostream.fstream() << report;
+        }
+    }
+
+    // Label of the fragment block, with its shape, type and layout
+    template <typename FragT>
+    std::string fragmentLabel(std::string const& name)
+    {
+        using Shape = GetIOShape_t<FragT>;
+        return name + " " + std::to_string(Shape::BlockHeight) + "x"
+               + std::to_string(Shape::BlockWidth) + " "
+               + dataTypeToString<GetDataType_t<FragT>>() + " "
+               + dataTypeToString<GetDataLayout_t<FragT>>();
+    }
+
+    // Leading dimension of the block packed in memory
+    template <typename FragT>
+    constexpr uint32_t packedLdm()
+    {
+        using Shape = GetIOShape_t<FragT>;
+        return std::is_same<GetDataLayout_t<FragT>, row_major>::value ? Shape::BlockWidth
+                                                                        : Shape::BlockHeight;
+    }
+
+    // Vectors are naturally aligned, so never split over cache lines
+    inline void expectAlignedVectors(CoalescingReport const& report)
+    {
+        for(auto const& access : report.accesses())
+        {
+            EXPECT_EQ(access.splitVectors(64u), 0u) << report.label() << " #" << access.instruction;
+            EXPECT_GE(access.linesTouched(64u), access.idealLines(64u)) << report.label();
+            EXPECT_GE(access.linesTouched(128u), access.idealLines(128u)) << report.label();
+        }
+    }
+
+    template <typename FragT>
+    void expectCoalescing(std::string const& name)
+    {
+        using Shape    = GetIOShape_t<FragT>;
+        using DataT    = GetDataType_t<FragT>;
+        using IOLayout = typename GetIOConfig_t<FragT>::IOLayout;
+
+        static_assert(IOLayout::VW * sizeof(DataT) <= 64u, "Vectors wider than a cache line");
+
+        constexpr uint64_t BlockBytes
+            = static_cast<uint64_t>(Shape::BlockHeight) * Shape::BlockWidth * sizeof(DataT);
+        constexpr uint32_t PackedLdm = packedLdm<FragT>();
+
+        std::string label = fragmentLabel<FragT>(name);
+
+        // Block packed in memory, and a block of a wide matrix
+        CoalescingReport packed(label + " packed VW " + std::to_string(IOLayout::VW));
+        packed.append(analyzeGlobalIO<FragT>(PackedLdm));
+        expectBlockCoverage(packed, BlockBytes);
+        expectAlignedVectors(packed);
+
+        CoalescingReport wide(label + " ldm " + std::to_string(WideLdm));
+        wide.append(analyzeGlobalIO<FragT>(WideLdm));
+        expectAlignedVectors(wide);
+
+        // Cooperative IO shares of the waves together cover the block
+        CoalescingReport coop(label + " coop x" + std::to_string(CoopWaves));
+        for(uint32_t wave = 0u; wave < CoopWaves; wave++)
+        {
+            coop.append(analyzeGlobalCoopIO<FragT>(PackedLdm, wave, CoopWaves));
+        }
+        expectBlockCoverage(coop, BlockBytes);
+        expectAlignedVectors(coop);
+
+        logReport(packed);
+        logReport(wide);
+        logReport(coop);
+    }
+
+    template <typename MatrixT, typename DataT, typename BlockM, typename BlockN, typename Layout>
+    void expectCoalescing(std::tuple<DataT, BlockM, BlockN, Layout>*)
+    {
+        using TestFragmentT = TestFragment<MatrixT, BlockM::value, BlockN::value, DataT, Layout>;
+        expectCoalescing<typename TestFragmentT::Type>(TestFragmentT::Name);
+    }
+
+    // Runs each combination of the test params, as tuples of
+    // (DataT, BlockM, BlockN, Layout)
+    template <typename MatrixT, typename... Params>
+    void expectCoalescingAll(std::tuple<Params...>*)
+    {
+        (expectCoalescing<MatrixT>(static_cast<Params*>(nullptr)), ...);
+    }
+
+    template <typename MatrixT, typename Types, typename BlockSizes, typename Layouts>
+    void expectCoalescingAll()
+    {
+        using Params = typename CombineLists<Types, BlockSizes, Layouts>::Result;
+        expectCoalescingAll<MatrixT>(static_cast<Params*>(nullptr));
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DETAIL_COALESCING_HPP
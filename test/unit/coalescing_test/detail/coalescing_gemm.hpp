@@ -0,0 +1,227 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DETAIL_COALESCING_GEMM_HPP
+#define ROCWMMA_DETAIL_COALESCING_GEMM_HPP
+
+#include <set>
+#include <string>
+#include <tuple>
+
+#include "coalescing.hpp"
+#include "gemm_common_test_params.hpp"
+#include "gemm_config.hpp"
+
+namespace rocwmma
+{
+    // Thread blocks of the GEMM kernel dispatch, as (TBlockX, TBlockY).
+    // Host layouts are those of wave64 targets.
+    using GemmThreadBlocks
+        = std::tuple<std::tuple<I<Constants::AMDGCN_WAVE_SIZE>, I<1>>,
+                     std::tuple<I<Constants::AMDGCN_WAVE_SIZE>, I<2>>,
+                     std::tuple<I<Constants::AMDGCN_WAVE_SIZE>, I<4>>,
+                     std::tuple<I<Constants::AMDGCN_WAVE_SIZE * 2u>, I<1>>,
+                     std::tuple<I<Constants::AMDGCN_WAVE_SIZE * 2u>, I<2>>,
+                     std::tuple<I<Constants::AMDGCN_WAVE_SIZE * 2u>, I<4>>,
+                     std::tuple<I<Constants::AMDGCN_WAVE_SIZE * 4u>, I<1>>,
+                     std::tuple<I<Constants::AMDGCN_WAVE_SIZE * 4u>, I<2>>,
+                     std::tuple<I<Constants::AMDGCN_WAVE_SIZE * 4u>, I<4>>>;
+
+    // Wave tiles of blocks of the cooperative GEMM tests
+    using GemmBlocksAll = typename Concat<GemmCommonTestParams::TestBlocks1x1,
+                                          GemmCommonTestParams::TestBlocks1x2,
+                                          GemmCommonTestParams::TestBlocks1x4,
+                                          GemmCommonTestParams::TestBlocks1x8,
+                                          GemmCommonTestParams::TestBlocks2x1,
+                                          GemmCommonTestParams::TestBlocks2x2,
+                                          GemmCommonTestParams::TestBlocks2x4,
+                                          GemmCommonTestParams::TestBlocks2x8,
+                                          GemmCommonTestParams::TestBlocks4x1,
+                                          GemmCommonTestParams::TestBlocks4x2,
+                                          GemmCommonTestParams::TestBlocks4x4,
+                                          GemmCommonTestParams::TestBlocks4x8,
+                                          GemmCommonTestParams::TestBlocks8x1,
+                                          GemmCommonTestParams::TestBlocks8x2,
+                                          GemmCommonTestParams::TestBlocks8x4,
+                                          GemmCommonTestParams::TestBlocks8x8>::Result;
+
+    using GemmBlocksSmall = typename Concat<GemmCommonTestParams::TestBlocks1x1,
+                                            GemmCommonTestParams::TestBlocks2x2,
+                                            GemmCommonTestParams::TestBlocks4x4>::Result;
+
+    using GemmLayoutsAll = typename Concat<GemmCommonTestParams::TestLayoutsNN,
+                                           GemmCommonTestParams::TestLayoutsNT,
+                                           GemmCommonTestParams::TestLayoutsTN,
+                                           GemmCommonTestParams::TestLayoutsTT>::Result;
+
+    // Calls func(static_cast<T*>(nullptr)) for each T of the list
+    template <typename... Ts, typename Func>
+    void forEachParam(std::tuple<Ts...>*, Func&& func)
+    {
+        (func(static_cast<Ts*>(nullptr)), ...);
+    }
+
+    // Each wave's share of a cooperative global read, for the compile-time
+    // wave count of the GEMM driver. Global read fragments shared by
+    // several configurations are analyzed once.
+    template <typename FragT, uint32_t WaveCount>
+    void expectGemmCoopCoalescing(std::set<std::string>& analyzed, std::string const& name)
+    {
+        using Shape    = GetIOShape_t<FragT>;
+        using DataT    = GetDataType_t<FragT>;
+        using IOLayout = typename GetCoopIOConfig_t<FragT, WaveCount>::IOLayout;
+
+        static_assert(IOLayout::VW * sizeof(DataT) <= 64u, "Vectors wider than a cache line");
+
+        constexpr uint64_t BlockBytes
+            = static_cast<uint64_t>(Shape::BlockHeight) * Shape::BlockWidth * sizeof(DataT);
+
+        auto label = fragmentLabel<FragT>(name) + " coop x" + std::to_string(WaveCount);
+        if(!analyzed.insert(label).second)
+        {
+            return;
+        }
+
+        CoalescingReport coop(label);
+        for(uint32_t wave = 0u; wave < WaveCount; wave++)
+        {
+            coop.append(analyzeGlobalCoopIO<FragT, WaveCount>(packedLdm<FragT>(), wave, WaveCount));
+        }
+        expectBlockCoverage(coop, BlockBytes);
+        expectAlignedVectors(coop);
+
+        logReport(coop);
+    }
+
+    // Global read fragments of A and B, and the wave counts of their
+    // schedulers, as instantiated by the cooperative GEMM kernels.
+    template <typename GemmConfig,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename BlockM,
+              typename BlockN,
+              typename BlockK,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename BlocksX,
+              typename BlocksY,
+              typename TBlockX,
+              typename TBlockY>
+    void expectGemmCoalescing(std::set<std::string>& analyzed)
+    {
+        using GlobalMapping = typename GemmConfig::template GlobalMapping<BlockM::value,
+                                                                          BlockN::value,
+                                                                          BlockK::value,
+                                                                          InputT,
+                                                                          OutputT,
+                                                                          ComputeT,
+                                                                          LayoutA,
+                                                                          LayoutB,
+                                                                          LayoutC,
+                                                                          LayoutC,
+                                                                          BlocksX::value,
+                                                                          BlocksY::value,
+                                                                          TBlockX::value,
+                                                                          TBlockY::value>;
+
+        using CoopSchedulerA =
+            typename GemmConfig::template CoopSchedulerA<TBlockX::value, TBlockY::value>;
+        using CoopSchedulerB =
+            typename GemmConfig::template CoopSchedulerB<TBlockX::value, TBlockY::value>;
+
+        expectGemmCoopCoalescing<typename GlobalMapping::GRFragA, CoopSchedulerA::waveCount()>(
+            analyzed, "gemm matrix_a");
+        expectGemmCoopCoalescing<typename GlobalMapping::GRFragB, CoopSchedulerB::waveCount()>(
+            analyzed, "gemm matrix_b");
+    }
+
+    // Every combination of a list of GemmConfigs with the GEMM test params,
+    // as lists of (InputT, OutputT, ComputeT), (BlockM, BlockN, BlockK),
+    // (LayoutA, LayoutB, LayoutC) and (BlocksX, BlocksY), for each thread
+    // block of the kernel dispatch.
+    template <typename Configs,
+              typename Types,
+              typename BlockSizes,
+              typename Layouts,
+              typename Blocks>
+    void expectGemmCoalescingAll(std::set<std::string>& analyzed)
+    {
+        // clang-format off
+        forEachParam(static_cast<Configs*>(nullptr), [&](auto* config) {
+        forEachParam(static_cast<Types*>(nullptr), [&](auto* types) {
+        forEachParam(static_cast<BlockSizes*>(nullptr), [&](auto* blockSize) {
+        forEachParam(static_cast<Layouts*>(nullptr), [&](auto* layouts) {
+        forEachParam(static_cast<Blocks*>(nullptr), [&](auto* blocks) {
+        forEachParam(static_cast<GemmThreadBlocks*>(nullptr), [&](auto* threadBlock) {
+            using Config      = std::remove_pointer_t<decltype(config)>;
+            using TypesT      = std::remove_pointer_t<decltype(types)>;
+            using BlockSizeT  = std::remove_pointer_t<decltype(blockSize)>;
+            using LayoutsT    = std::remove_pointer_t<decltype(layouts)>;
+            using BlocksT     = std::remove_pointer_t<decltype(blocks)>;
+            using ThreadBlock = std::remove_pointer_t<decltype(threadBlock)>;
+
+            expectGemmCoalescing<Config,
+                                 std::tuple_element_t<0, TypesT>,
+                                 std::tuple_element_t<1, TypesT>,
+                                 std::tuple_element_t<2, TypesT>,
+                                 std::tuple_element_t<0, BlockSizeT>,
+                                 std::tuple_element_t<1, BlockSizeT>,
+                                 std::tuple_element_t<2, BlockSizeT>,
+                                 std::tuple_element_t<0, LayoutsT>,
+                                 std::tuple_element_t<1, LayoutsT>,
+                                 std::tuple_element_t<2, LayoutsT>,
+                                 std::tuple_element_t<0, BlocksT>,
+                                 std::tuple_element_t<1, BlocksT>,
+                                 std::tuple_element_t<0, ThreadBlock>,
+                                 std::tuple_element_t<1, ThreadBlock>>(analyzed);
+        });});});});});});
+        // clang-format on
+    }
+
+    // 16x16 and 32x32 MFMA block sizes of the GEMM tests, with their types
+    template <typename Configs, typename Blocks>
+    void expectGemmCoalescingAll()
+    {
+        using Params = GemmCommonTestParams;
+
+        std::set<std::string> analyzed;
+        expectGemmCoalescingAll<Configs,
+                                Params::TestTypes16x16,
+                                Params::TestBlockSizes16x16MediumBlockK,
+                                GemmLayoutsAll,
+                                Blocks>(analyzed);
+        expectGemmCoalescingAll<Configs,
+                                Params::TestTypes32x32,
+                                Params::TestBlockSizes32x32SmallBlockK,
+                                GemmLayoutsAll,
+                                Blocks>(analyzed);
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DETAIL_COALESCING_GEMM_HPP
@@ -0,0 +1,78 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "detail/coalescing.hpp"
+
+// Every IOConfig of the matrix_b load / store unit tests
+TEST(CoalescingTest, MatrixB16)
+{
+    using namespace rocwmma;
+    using Params = UnitTestParams;
+    expectCoalescingAll<matrix_b,
+                        Params::TestTypes16,
+                        Params::TestBlockSizes16,
+                        Params::TestLayoutsAll>();
+}
+
+TEST(CoalescingTest, MatrixB32)
+{
+    using namespace rocwmma;
+    using Params = UnitTestParams;
+    expectCoalescingAll<matrix_b,
+                        Params::TestTypesIOC,
+                        Params::TestBlockSizes32,
+                        Params::TestLayoutsAll>();
+}
+
+TEST(CoalescingTest, MatrixB64)
+{
+    using namespace rocwmma;
+    using Params = UnitTestParams;
+    expectCoalescingAll<matrix_b,
+                        Params::TestTypesIOC,
+                        Params::TestBlockSizes64,
+                        Params::TestLayoutsAll>();
+}
+
+TEST(CoalescingTest, MatrixB128)
+{
+    using namespace rocwmma;
+    using Params = UnitTestParams;
+    expectCoalescingAll<matrix_b,
+                        Params::TestTypesIOC,
+                        Params::TestBlockSizes128,
+                        Params::TestLayoutsAll>();
+}
+
+TEST(CoalescingTest, MatrixB256)
+{
+    using namespace rocwmma;
+    using Params = UnitTestParams;
+    expectCoalescingAll<matrix_b,
+                        Params::TestTypesIOC,
+                        Params::TestBlockSizes256,
+                        Params::TestLayoutsAll>();
+}
@@ -0,0 +1,63 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "detail/coalescing_gemm.hpp"
+
+// Global reads of the wave level cooperative GEMMs
+TEST(CoalescingTest, GemmWaveLevel)
+{
+    using namespace rocwmma::CooperativeGemm;
+    using Configs = std::tuple<WaveLevel::LdsNT, WaveLevel::LdsTN>;
+    rocwmma::expectGemmCoalescingAll<Configs, rocwmma::GemmBlocksAll>();
+}
+
+TEST(CoalescingTest, GemmWaveLevelDerived)
+{
+    using namespace rocwmma::CooperativeGemm;
+    using Configs = std::tuple<Rasterized::GroupedM8WaveLdsNT,
+                               Rasterized::Morton8x8WaveLdsNT,
+                               Rasterized::Hilbert8x8WaveLdsNT,
+                               Pipelined::Stages3WaveLdsNT,
+                               Pipelined::Stages3WaveLdsTN,
+                               Pipelined::Stages4WaveLdsNT,
+                               Pipelined::Stages4WaveLdsTN,
+                               Swizzled::WaveLdsNT,
+                               Swizzled::WaveLdsTN>;
+    rocwmma::expectGemmCoalescingAll<Configs, rocwmma::GemmBlocksSmall>();
+}
+
+// Global reads of the split-K and Stream-K GEMMs
+TEST(CoalescingTest, GemmKPartitioned)
+{
+    using namespace rocwmma::CooperativeGemm;
+    using Configs = std::tuple<StreamK::LdsNT,
+                               StreamK::LdsTN,
+                               SplitK::LdsNT,
+                               SplitK::LdsTN,
+                               SplitK::AtomicLdsNT,
+                               SplitK::AtomicLdsTN>;
+    rocwmma::expectGemmCoalescingAll<Configs, rocwmma::GemmBlocksSmall>();
+}
@@ -0,0 +1,124 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DEVICE_RAGGED_GEMM_HPP
+#define ROCWMMA_DEVICE_RAGGED_GEMM_HPP
+
+// Silence warnings for calls on unsupported architectures.
+// Unsupported architectures will generate no-ops and test
+// will be avoided at runtime anyway.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include <rocwmma/internal/mapping_util.hpp>
+#include <rocwmma/rocwmma.hpp>
+#pragma GCC diagnostic pop
+
+namespace rocwmma
+{
+    // Each wave computes one BlockM x BlockN block of D = alpha * A x B + beta * C.
+    // M, N and K need not be multiples of the block sizes: every block is read
+    // and written with the bounds-aware fragment IO, which zero-fills the
+    // elements of A, B and C beyond the matrix edges and masks the stores to D.
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC>
+    __global__ void RaggedGemm(uint32_t       m,
+                               uint32_t       n,
+                               uint32_t       k,
+                               InputT const*  a,
+                               InputT const*  b,
+                               OutputT const* c,
+                               OutputT*       d,
+                               uint32_t       lda,
+                               uint32_t       ldb,
+                               uint32_t       ldc,
+                               uint32_t       ldd,
+                               ComputeT       alpha,
+                               ComputeT       beta)
+    {
+        using FragA   = fragment<matrix_a, BlockM, BlockN, BlockK, InputT, LayoutA>;
+        using FragB   = fragment<matrix_b, BlockM, BlockN, BlockK, InputT, LayoutB>;
+        using FragC   = fragment<accumulator, BlockM, BlockN, BlockK, OutputT, LayoutC>;
+        using FragAcc = fragment<accumulator, BlockM, BlockN, BlockK, ComputeT>;
+
+        using MappingA = MappingUtil<BlockM, BlockK, InputT, LayoutA>;
+        using MappingB = MappingUtil<BlockK, BlockN, InputT, LayoutB>;
+        using MappingC = MappingUtil<BlockM, BlockN, OutputT, LayoutC>;
+
+        // Target C / D block on 2D grid
+        auto matrixCoordC = MappingC::matrixCoord();
+        auto row          = get<0>(matrixCoordC);
+        auto col          = get<1>(matrixCoordC);
+
+        if(row >= m || col >= n)
+        {
+            return;
+        }
+
+        auto fragAcc = FragAcc();
+        fill_fragment(fragAcc, static_cast<ComputeT>(0));
+
+        // Accumulate A * B, with a partial K step at the end
+        for(uint32_t kk = 0; kk < k; kk += BlockK)
+        {
+            auto fragA = FragA();
+            auto fragB = FragB();
+
+            load_matrix_sync(fragA,
+                             MappingA::dataCoord(a, make_coord2d(row, kk), lda),
+                             lda,
+                             m - row,
+                             k - kk);
+            load_matrix_sync(fragB,
+                             MappingB::dataCoord(b, make_coord2d(kk, col), ldb),
+                             ldb,
+                             k - kk,
+                             n - col);
+            mma_sync(fragAcc, fragA, fragB, fragAcc);
+        }
+
+        auto fragC = FragC();
+        load_matrix_sync(fragC, MappingC::dataCoord(c, matrixCoordC, ldc), ldc, m - row, n - col);
+
+        // D = alpha * accumAB + beta * C
+#pragma unroll
+        for(int i = 0; i < fragC.num_elements; ++i)
+        {
+            fragC.x[i] = OutputT(alpha * ComputeT(fragAcc.x[i]) + beta * ComputeT(fragC.x[i]));
+        }
+
+        store_matrix_sync(MappingC::dataCoord(d, matrixCoordC, ldd), fragC, ldd, m - row, n - col);
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DEVICE_RAGGED_GEMM_HPP
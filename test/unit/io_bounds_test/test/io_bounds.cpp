@@ -0,0 +1,263 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright 2021-2023 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <rocwmma/internal/io_bounds.hpp>
+
+#include "common.hpp"
+#include "device/ragged_gemm.hpp"
+#include "hip_device.hpp"
+#include "hip_resource.hpp"
+#include "reference.hpp"
+
+namespace rocwmma
+{
+    // Runs the RaggedGemm kernel for odd M / N / K and checks D against gemm_CPU.
+    // D is allocated with padding, which must remain untouched.
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC>
+    void runRaggedGemm(uint32_t m, uint32_t n, uint32_t k)
+    {
+        using InputT   = float16_t;
+        using OutputT  = float32_t;
+        using ComputeT = float32_t;
+
+        constexpr uint32_t Pad = 3u;
+
+        auto lda = std::is_same<LayoutA, row_major>::value ? k : m;
+        auto ldb = std::is_same<LayoutB, row_major>::value ? n : k;
+        auto ldc = std::is_same<LayoutC, row_major>::value ? n : m;
+
+        // Padded output to detect out-of-bounds stores
+        auto padM = m + Pad;
+        auto padN = n + Pad;
+        auto ldd  = std::is_same<LayoutC, row_major>::value ? padN : padM;
+
+        auto const alpha = static_cast<ComputeT>(2.0f);
+        auto const beta  = static_cast<ComputeT>(-1.0f);
+
+        std::vector<InputT>  a(m * k), b(k * n);
+        std::vector<OutputT> c(m * n), d(padM * padN), dRef(m * n);
+        MatrixUtil<LayoutA>::fill(a, m, k);
+        MatrixUtil<LayoutB>::fill(b, k, n);
+        MatrixUtil<LayoutC>::fill(c, m, n);
+        MatrixUtil<LayoutC>::fillVal(d, padM, padN, std::numeric_limits<OutputT>::quiet_NaN());
+
+        auto deviceA = HipResource::allocDevice<InputT>(a.size());
+        auto deviceB = HipResource::allocDevice<InputT>(b.size());
+        auto deviceC = HipResource::allocDevice<OutputT>(c.size());
+        auto deviceD = HipResource::allocDevice<OutputT>(d.size());
+
+        auto copyToDevice = [](auto& dst, auto const& src) {
+            using DataT = typename std::decay_t<decltype(src)>::value_type;
+            auto bytes  = src.size() * sizeof(DataT);
+            CHECK_HIP_ERROR(hipMemcpy(dst.get(), src.data(), bytes, hipMemcpyHostToDevice));
+        };
+        copyToDevice(deviceA, a);
+        copyToDevice(deviceB, b);
+        copyToDevice(deviceC, c);
+        copyToDevice(deviceD, d);
+
+        // One wave per workgroup, and one output block per wave
+        auto gridDim  = dim3(ceilDiv(m, BlockM), ceilDiv(n, BlockN));
+        auto blockDim = dim3(HipDevice::instance()->warpSize(), 1);
+        auto kernel   = RaggedGemm<BlockM,
+                                   BlockN,
+                                   BlockK,
+                                   InputT,
+                                   OutputT,
+                                   ComputeT,
+                                   LayoutA,
+                                   LayoutB,
+                                   LayoutC>;
+        hipLaunchKernelGGL(kernel,
+                           gridDim,
+                           blockDim,
+                           0,
+                           0,
+                           m,
+                           n,
+                           k,
+                           deviceA.get(),
+                           deviceB.get(),
+                           deviceC.get(),
+                           deviceD.get(),
+                           lda,
+                           ldb,
+                           ldc,
+                           ldd,
+                           alpha,
+                           beta);
+        CHECK_HIP_ERROR(hipGetLastError());
+
+        CHECK_HIP_ERROR(hipMemcpy(
+            d.data(), deviceD.get(), d.size() * sizeof(OutputT), hipMemcpyDeviceToHost));
+
+        gemm_CPU<InputT, OutputT, ComputeT, LayoutA, LayoutB, LayoutC, LayoutC>(
+            m, n, k, a.data(), b.data(), c.data(), dRef.data(), alpha, beta);
+
+        // Element offsets in (row, col) matrix space
+        auto offset = [](uint32_t row, uint32_t col, uint32_t ld) {
+            return std::is_same<LayoutC, row_major>::value ? row * ld + col : col * ld + row;
+        };
+
+        // Pack the m x n region of D to compare with the reference
+        std::vector<OutputT> dPacked(m * n);
+        for(uint32_t row = 0; row < m; row++)
+        {
+            for(uint32_t col = 0; col < n; col++)
+            {
+                dPacked[offset(row, col, ldc)] = d[offset(row, col, ldd)];
+            }
+        }
+
+        auto result = compareEqual<OutputT, OutputT, LayoutC, LayoutC>(dPacked, dRef, m, n);
+        EXPECT_TRUE(std::get<0>(result)) << "Max relative error: " << std::get<1>(result);
+
+        // Padding must not be written
+        for(uint32_t row = 0; row < padM; row++)
+        {
+            for(uint32_t col = 0; col < padN; col++)
+            {
+                if(row >= m || col >= n)
+                {
+                    EXPECT_TRUE(std::isnan(d[offset(row, col, ldd)]))
+                        << "Out of bounds store at (" << row << ", " << col << ")";
+                }
+            }
+        }
+    }
+
+    // f16 inputs with 16 x 16 x 16 blocks are supported by every known target
+    inline bool raggedGemmSupported()
+    {
+        return HipDevice::instance()->getGcnArch() != HipDevice::UNSUPPORTED_ARCH;
+    }
+
+} // namespace rocwmma
+
+TEST(IOBoundsTest, VectorPredicates)
+{
+    using namespace rocwmma;
+    using RowBounds = detail::IOBounds<row_major, 4u>;
+    using ColBounds = detail::IOBounds<col_major, 4u>;
+
+    auto extent = make_coord2d(5u, 6u);
+
+    // Row major vectors advance along columns
+    EXPECT_TRUE(RowBounds::isVectorInBounds(make_coord2d(4u, 2u), extent));
+    EXPECT_FALSE(RowBounds::isVectorInBounds(make_coord2d(4u, 3u), extent));
+    EXPECT_TRUE(RowBounds::isElementInBounds(make_coord2d(4u, 3u), extent, 2u));
+    EXPECT_FALSE(RowBounds::isElementInBounds(make_coord2d(4u, 3u), extent, 3u));
+    EXPECT_FALSE(RowBounds::isElementInBounds(make_coord2d(5u, 0u), extent, 0u));
+
+    // Col major vectors advance along rows
+    EXPECT_TRUE(ColBounds::isVectorInBounds(make_coord2d(1u, 5u), extent));
+    EXPECT_FALSE(ColBounds::isVectorInBounds(make_coord2d(2u, 5u), extent));
+    EXPECT_TRUE(ColBounds::isElementInBounds(make_coord2d(2u, 5u), extent, 2u));
+    EXPECT_FALSE(ColBounds::isElementInBounds(make_coord2d(2u, 5u), extent, 3u));
+    EXPECT_FALSE(ColBounds::isElementInBounds(make_coord2d(0u, 6u), extent, 0u));
+
+    // Interior blocks
+    EXPECT_TRUE((detail::isBlockInBounds<16u, 16u>(make_coord2d(16u, 17u))));
+    EXPECT_FALSE((detail::isBlockInBounds<16u, 16u>(make_coord2d(15u, 17u))));
+    EXPECT_FALSE((detail::isBlockInBounds<16u, 16u>(make_coord2d(16u, 1u))));
+}
+
+TEST(IOBoundsTest, LinearExtent)
+{
+    using namespace rocwmma;
+    using RowBounds = detail::IOBounds<row_major, 4u>;
+    using ColBounds = detail::IOBounds<col_major, 4u>;
+
+    // Span from the block origin to the last element in the extent
+    EXPECT_EQ(RowBounds::linearExtent(make_coord2d(5u, 6u), 64u), 4u * 64u + 6u);
+    EXPECT_EQ(ColBounds::linearExtent(make_coord2d(5u, 6u), 64u), 5u * 64u + 5u);
+
+    // Empty extents span nothing
+    EXPECT_EQ(RowBounds::linearExtent(make_coord2d(0u, 6u), 64u), 0u);
+    EXPECT_EQ(ColBounds::linearExtent(make_coord2d(5u, 0u), 64u), 0u);
+
+    // Large extents must not overflow 32 bits
+    EXPECT_EQ(RowBounds::linearExtent(make_coord2d(1u << 20, 1u), 1u << 16),
+              ((1ull << 20) - 1ull) * (1ull << 16) + 1ull);
+}
+
+TEST(IOBoundsTest, RaggedGemmNN)
+{
+    using namespace rocwmma;
+    if(!raggedGemmSupported())
+    {
+        GTEST_SKIP() << "Unsupported device";
+    }
+    runRaggedGemm<16, 16, 16, col_major, col_major, col_major>(33, 17, 45);
+    runRaggedGemm<16, 16, 16, col_major, col_major, col_major>(61, 100, 37);
+    runRaggedGemm<16, 16, 16, col_major, col_major, col_major>(1, 1, 1);
+}
+
+TEST(IOBoundsTest, RaggedGemmTN)
+{
+    using namespace rocwmma;
+    if(!raggedGemmSupported())
+    {
+        GTEST_SKIP() << "Unsupported device";
+    }
+    runRaggedGemm<16, 16, 16, row_major, col_major, row_major>(33, 17, 45);
+    runRaggedGemm<16, 16, 16, row_major, col_major, row_major>(127, 65, 19);
+    runRaggedGemm<16, 16, 16, row_major, col_major, row_major>(97, 41, 3);
+}
+
+TEST(IOBoundsTest, RaggedGemmNT)
+{
+    using namespace rocwmma;
+    if(!raggedGemmSupported())
+    {
+        GTEST_SKIP() << "Unsupported device";
+    }
+    runRaggedGemm<16, 16, 16, col_major, row_major, col_major>(61, 100, 37);
+    runRaggedGemm<16, 16, 16, col_major, row_major, row_major>(97, 41, 3);
+}
+
+TEST(IOBoundsTest, RaggedGemmInterior)
+{
+    using namespace rocwmma;
+    if(!raggedGemmSupported())
+    {
+        GTEST_SKIP() << "Unsupported device";
+    }
+    // Multiples of the block sizes take the unpredicated path only
+    runRaggedGemm<16, 16, 16, row_major, row_major, row_major>(64, 32, 48);
+}
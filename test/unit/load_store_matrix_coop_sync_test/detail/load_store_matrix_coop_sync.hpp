@@ -78,12 +78,63 @@ namespace rocwmma
         }
     };
 
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct LoadStoreMatrixCoopSyncKernelStreamingA final
+        : public LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>;
+
+    protected:
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(
+                LoadStoreMatrixCoopSyncA<BlockM, BlockN, DataT, Layout, cache_streaming>);
+        }
+    };
+
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct LoadStoreMatrixCoopSyncKernelStreamingB final
+        : public LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>;
+
+    protected:
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(
+                LoadStoreMatrixCoopSyncB<BlockM, BlockN, DataT, Layout, cache_streaming>);
+        }
+    };
+
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct LoadStoreMatrixCoopSyncKernelStreamingAcc final
+        : public LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>;
+
+    protected:
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(
+                LoadStoreMatrixCoopSyncAcc<BlockM, BlockN, DataT, Layout, cache_streaming>);
+        }
+    };
+
     using LoadStoreMatrixCoopSyncGeneratorA
         = LoadStoreMatrixSyncGenerator<LoadStoreMatrixCoopSyncKernelA>;
     using LoadStoreMatrixCoopSyncGeneratorB
         = LoadStoreMatrixSyncGenerator<LoadStoreMatrixCoopSyncKernelB>;
     using LoadStoreMatrixCoopSyncGeneratorAcc
         = LoadStoreMatrixSyncGenerator<LoadStoreMatrixCoopSyncKernelAcc>;
+    using LoadStoreMatrixCoopSyncGeneratorStreamingA
+        = LoadStoreMatrixSyncGenerator<LoadStoreMatrixCoopSyncKernelStreamingA>;
+    using LoadStoreMatrixCoopSyncGeneratorStreamingB
+        = LoadStoreMatrixSyncGenerator<LoadStoreMatrixCoopSyncKernelStreamingB>;
+    using LoadStoreMatrixCoopSyncGeneratorStreamingAcc
+        = LoadStoreMatrixSyncGenerator<LoadStoreMatrixCoopSyncKernelStreamingAcc>;
 
 } // namespace rocwmma
 
@@ -40,6 +40,7 @@ namespace rocwmma
               uint32_t BlockN,
               typename DataT,
               typename DataLayout,
+              typename CachePolicy = cache_default,
               typename std::enable_if_t<
                   FragSize_guard<BlockM,
                                  BlockN,
@@ -102,8 +103,8 @@ namespace rocwmma
                     auto  blockCoord = startBlockCoord + make_coord2d(i, j);
                     auto* read       = Mapping::dataCoord(in, Mapping::matrixCoord(blockCoord), ld);
                     auto* write = Mapping::dataCoord(out, Mapping::matrixCoord(blockCoord), ld);
-                    load_matrix_coop_sync(frag, read, ld, workIndex, workCount);
-                    store_matrix_coop_sync(write, frag, ld, workIndex, workCount);
+                    load_matrix_coop_sync<CachePolicy>(frag, read, ld, workIndex, workCount);
+                    store_matrix_coop_sync<CachePolicy>(write, frag, ld, workIndex, workCount);
                 }
             }
         }
@@ -113,6 +114,7 @@ namespace rocwmma
               uint32_t BlockN,
               typename DataT,
               typename DataLayout,
+              typename CachePolicy = cache_default,
               typename std::enable_if_t<
                   !FragSize_guard<BlockM,
                                   BlockN,
@@ -134,6 +136,7 @@ namespace rocwmma
               uint32_t BlockN,
               typename DataT,
               typename DataLayout,
+              typename CachePolicy = cache_default,
               typename std::enable_if_t<
                   FragSize_guard<BlockM,
                                  BlockN,
@@ -196,8 +199,8 @@ namespace rocwmma
                     auto  blockCoord = startBlockCoord + make_coord2d(i, j);
                     auto* read       = Mapping::dataCoord(in, Mapping::matrixCoord(blockCoord), ld);
                     auto* write = Mapping::dataCoord(out, Mapping::matrixCoord(blockCoord), ld);
-                    load_matrix_coop_sync(frag, read, ld, workIndex, workCount);
-                    store_matrix_coop_sync(write, frag, ld, workIndex, workCount);
+                    load_matrix_coop_sync<CachePolicy>(frag, read, ld, workIndex, workCount);
+                    store_matrix_coop_sync<CachePolicy>(write, frag, ld, workIndex, workCount);
                 }
             }
         }
@@ -207,6 +210,7 @@ namespace rocwmma
               uint32_t BlockN,
               typename DataT,
               typename DataLayout,
+              typename CachePolicy = cache_default,
               typename std::enable_if_t<
                   !FragSize_guard<BlockM,
                                   BlockN,
@@ -228,6 +232,7 @@ namespace rocwmma
               uint32_t BlockN,
               typename DataT,
               typename DataLayout,
+              typename CachePolicy = cache_default,
               typename std::enable_if_t<
                   FragSize_guard<BlockM,
                                  BlockN,
@@ -290,8 +295,8 @@ namespace rocwmma
                     auto  blockCoord = startBlockCoord + make_coord2d(i, j);
                     auto* read       = Mapping::dataCoord(in, Mapping::matrixCoord(blockCoord), ld);
                     auto* write = Mapping::dataCoord(out, Mapping::matrixCoord(blockCoord), ld);
-                    load_matrix_coop_sync(frag, read, ld, workIndex, workCount);
-                    store_matrix_coop_sync(write, frag, ld, workIndex, workCount);
+                    load_matrix_coop_sync<CachePolicy>(frag, read, ld, workIndex, workCount);
+                    store_matrix_coop_sync<CachePolicy>(write, frag, ld, workIndex, workCount);
                 }
             }
         }
@@ -301,6 +306,7 @@ namespace rocwmma
               uint32_t BlockN,
               typename DataT,
               typename DataLayout,
+              typename CachePolicy = cache_default,
               typename std::enable_if_t<
                   !FragSize_guard<BlockM,
                                   BlockN,
@@ -167,6 +167,224 @@ namespace rocwmma
         }
     };
 
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct LoadStoreMatrixSyncKernelBufferA final
+        : public LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>;
+
+    protected:
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(
+                LoadStoreMatrixSyncBufferA<BlockM, BlockN, DataT, Layout>);
+        }
+    };
+
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct LoadStoreMatrixSyncKernelBufferB final
+        : public LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>;
+
+    protected:
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(
+                LoadStoreMatrixSyncBufferB<BlockM, BlockN, DataT, Layout>);
+        }
+    };
+
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct LoadStoreMatrixSyncKernelBufferAcc final
+        : public LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>;
+
+    protected:
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(
+                LoadStoreMatrixSyncBufferAcc<BlockM, BlockN, DataT, Layout>);
+        }
+    };
+
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct LoadStoreMatrixSyncKernelStreamingA final
+        : public LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>;
+
+    protected:
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(
+                LoadStoreMatrixSyncStreamingA<BlockM, BlockN, DataT, Layout>);
+        }
+    };
+
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct LoadStoreMatrixSyncKernelStreamingB final
+        : public LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>;
+
+    protected:
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(
+                LoadStoreMatrixSyncStreamingB<BlockM, BlockN, DataT, Layout>);
+        }
+    };
+
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct LoadStoreMatrixSyncKernelStreamingAcc final
+        : public LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>;
+
+    protected:
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(
+                LoadStoreMatrixSyncStreamingAcc<BlockM, BlockN, DataT, Layout>);
+        }
+    };
+
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct LoadStoreMatrixSyncKernelAsyncMixedA final
+        : public LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>;
+
+    protected:
+        // Each wave stages its block in LDS
+        uint32_t ldsUsage() const final
+        {
+            auto waveCount = Base::mTBlockX / Base::DeviceInfo::instance()->warpSize()
+                             * Base::mTBlockY;
+            return waveCount * BlockM * BlockN * sizeof(DataT);
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(
+                LoadStoreMatrixSyncAsyncMixedA<BlockM, BlockN, DataT, Layout>);
+        }
+    };
+
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct LoadStoreMatrixSyncKernelEpilogueAcc final
+        : public LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>;
+
+    protected:
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(
+                LoadStoreMatrixSyncEpilogueAcc<BlockM, BlockN, DataT, Layout>);
+        }
+    };
+
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct LoadStoreMatrixSyncKernelEpilogueFp8Acc final
+        : public LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>;
+
+    protected:
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(
+                LoadStoreMatrixSyncEpilogueFp8Acc<BlockM, BlockN, DataT, Layout>);
+        }
+    };
+
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct LoadStoreMatrixSyncKernelAtomicAddAcc final
+        : public LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>;
+
+    protected:
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(
+                LoadStoreMatrixSyncAtomicAddAcc<BlockM, BlockN, DataT, Layout>);
+        }
+    };
+
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct LoadStoreMatrixSyncKernelElementCoordA final
+        : public LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>;
+
+    protected:
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(
+                LoadStoreMatrixSyncElementCoordA<BlockM, BlockN, DataT, Layout>);
+        }
+    };
+
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct LoadStoreMatrixSyncKernelElementCoordB final
+        : public LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>;
+
+    protected:
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(
+                LoadStoreMatrixSyncElementCoordB<BlockM, BlockN, DataT, Layout>);
+        }
+    };
+
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct LoadStoreMatrixSyncKernelElementCoordAcc final
+        : public LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>;
+
+    protected:
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(
+                LoadStoreMatrixSyncElementCoordAcc<BlockM, BlockN, DataT, Layout>);
+        }
+    };
+
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct LoadStoreMatrixSyncKernelDequantB final
+        : public LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>;
+
+    protected:
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(
+                LoadStoreMatrixSyncDequantB<BlockM, BlockN, DataT, Layout>);
+        }
+    };
+
     template <template <uint32_t, uint32_t, typename, typename> class KernelClass>
     struct LoadStoreMatrixSyncGenerator
     {
@@ -201,6 +419,35 @@ namespace rocwmma
     using LoadStoreMatrixSyncGeneratorAcc
         = LoadStoreMatrixSyncGenerator<LoadStoreMatrixSyncKernelAcc>;
 
+    using LoadStoreMatrixSyncGeneratorBufferA
+        = LoadStoreMatrixSyncGenerator<LoadStoreMatrixSyncKernelBufferA>;
+    using LoadStoreMatrixSyncGeneratorBufferB
+        = LoadStoreMatrixSyncGenerator<LoadStoreMatrixSyncKernelBufferB>;
+    using LoadStoreMatrixSyncGeneratorBufferAcc
+        = LoadStoreMatrixSyncGenerator<LoadStoreMatrixSyncKernelBufferAcc>;
+    using LoadStoreMatrixSyncGeneratorStreamingA
+        = LoadStoreMatrixSyncGenerator<LoadStoreMatrixSyncKernelStreamingA>;
+    using LoadStoreMatrixSyncGeneratorStreamingB
+        = LoadStoreMatrixSyncGenerator<LoadStoreMatrixSyncKernelStreamingB>;
+    using LoadStoreMatrixSyncGeneratorStreamingAcc
+        = LoadStoreMatrixSyncGenerator<LoadStoreMatrixSyncKernelStreamingAcc>;
+    using LoadStoreMatrixSyncGeneratorAsyncMixedA
+        = LoadStoreMatrixSyncGenerator<LoadStoreMatrixSyncKernelAsyncMixedA>;
+    using LoadStoreMatrixSyncGeneratorEpilogueAcc
+        = LoadStoreMatrixSyncGenerator<LoadStoreMatrixSyncKernelEpilogueAcc>;
+    using LoadStoreMatrixSyncGeneratorEpilogueFp8Acc
+        = LoadStoreMatrixSyncGenerator<LoadStoreMatrixSyncKernelEpilogueFp8Acc>;
+    using LoadStoreMatrixSyncGeneratorAtomicAddAcc
+        = LoadStoreMatrixSyncGenerator<LoadStoreMatrixSyncKernelAtomicAddAcc>;
+    using LoadStoreMatrixSyncGeneratorDequantB
+        = LoadStoreMatrixSyncGenerator<LoadStoreMatrixSyncKernelDequantB>;
+    using LoadStoreMatrixSyncGeneratorElementCoordA
+        = LoadStoreMatrixSyncGenerator<LoadStoreMatrixSyncKernelElementCoordA>;
+    using LoadStoreMatrixSyncGeneratorElementCoordB
+        = LoadStoreMatrixSyncGenerator<LoadStoreMatrixSyncKernelElementCoordB>;
+    using LoadStoreMatrixSyncGeneratorElementCoordAcc
+        = LoadStoreMatrixSyncGenerator<LoadStoreMatrixSyncKernelElementCoordAcc>;
+
 } // namespace rocwmma
 
 #endif // ROCWMMA_DETAIL_LOAD_STORE_MATRIX_SYNC_HPP
@@ -29,6 +29,8 @@
 
 #include <rocwmma/internal/mapping_util.hpp>
 #include <rocwmma/rocwmma.hpp>
+#include <rocwmma/rocwmma_dequant.hpp>
+#include <rocwmma/rocwmma_epilogue.hpp>
 
 #include "unit_test_traits.hpp"
 
@@ -203,6 +205,1004 @@ namespace rocwmma
     {
     }
 
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  FragSize_guard<BlockM,
+                                 BlockN,
+                                 DataT,
+                                 DataLayout,
+                                 Constants::AMDGCN_WAVE_SIZE,
+                                 Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncBufferA(uint32_t     m,
+                                               uint32_t     n,
+                                               DataT const* in,
+                                               DataT*       out,
+                                               uint32_t     ld,
+                                               DataT        param1,
+                                               DataT        param2)
+    {
+        using Mapping = MappingUtil<BlockM, BlockN, DataT, DataLayout>;
+
+        // Mapping:
+        // Incoming -> Matrix A (ColNT)
+        // BlockM -> BlockM
+        // <Dummy> -> BlockN
+        // BlockN -> BlockK
+        using FragT = fragment<matrix_a, BlockM, 1, BlockN, DataT, DataLayout>;
+
+        auto frag = FragT();
+
+        // Map, then load and store through the buffer_io policy.
+        auto* read  = Mapping::dataCoord(in, ld);
+        auto* write = Mapping::dataCoord(out, ld);
+        load_matrix_sync<buffer_io<>>(frag, read, ld);
+        store_matrix_sync<buffer_io<>>(write, frag, ld);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  !FragSize_guard<BlockM,
+                                  BlockN,
+                                  DataT,
+                                  DataLayout,
+                                  Constants::AMDGCN_WAVE_SIZE,
+                                  Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncBufferA(uint32_t     m,
+                                               uint32_t     n,
+                                               DataT const* in,
+                                               DataT*       out,
+                                               uint32_t     ld,
+                                               DataT        param1,
+                                               DataT        param2)
+    {
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  FragSize_guard<BlockM,
+                                 BlockN,
+                                 DataT,
+                                 DataLayout,
+                                 Constants::AMDGCN_WAVE_SIZE,
+                                 Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncBufferB(uint32_t     m,
+                                               uint32_t     n,
+                                               DataT const* in,
+                                               DataT*       out,
+                                               uint32_t     ld,
+                                               DataT        param1,
+                                               DataT        param2)
+    {
+        using Mapping = MappingUtil<BlockM, BlockN, DataT, DataLayout>;
+
+        // Mapping:
+        // Incoming -> Matrix B (RowNT)
+        // <Dummy> -> BlockM
+        // BlockN -> BlockN
+        // BlockM -> BlockK
+        using FragT = fragment<matrix_b, 1, BlockN, BlockM, DataT, DataLayout>;
+
+        auto frag = FragT();
+
+        // Map, then load and store through the buffer_io policy.
+        auto* read  = Mapping::dataCoord(in, ld);
+        auto* write = Mapping::dataCoord(out, ld);
+        load_matrix_sync<buffer_io<>>(frag, read, ld);
+        store_matrix_sync<buffer_io<>>(write, frag, ld);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  !FragSize_guard<BlockM,
+                                  BlockN,
+                                  DataT,
+                                  DataLayout,
+                                  Constants::AMDGCN_WAVE_SIZE,
+                                  Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncBufferB(uint32_t     m,
+                                               uint32_t     n,
+                                               DataT const* in,
+                                               DataT*       out,
+                                               uint32_t     ld,
+                                               DataT        param1,
+                                               DataT        param2)
+    {
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  FragSize_guard<BlockM,
+                                 BlockN,
+                                 DataT,
+                                 DataLayout,
+                                 Constants::AMDGCN_WAVE_SIZE,
+                                 Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncBufferAcc(uint32_t     m,
+                                                 uint32_t     n,
+                                                 DataT const* in,
+                                                 DataT*       out,
+                                                 uint32_t     ld,
+                                                 DataT        param1,
+                                                 DataT        param2)
+    {
+        using Mapping = MappingUtil<BlockM, BlockN, DataT, DataLayout>;
+
+        // Mapping:
+        // Incoming -> Matrix C (Row4T)
+        // BlockM -> BlockM
+        // BlockN -> BlockN
+        // <Dummy> -> BlockK
+        using FragT = fragment<accumulator, BlockM, BlockN, 1, DataT, DataLayout>;
+
+        auto frag = FragT();
+
+        // Map, then load and store through the buffer_io policy.
+        auto* read  = Mapping::dataCoord(in, ld);
+        auto* write = Mapping::dataCoord(out, ld);
+        load_matrix_sync<buffer_io<>>(frag, read, ld);
+        store_matrix_sync<buffer_io<>>(write, frag, ld);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  !FragSize_guard<BlockM,
+                                  BlockN,
+                                  DataT,
+                                  DataLayout,
+                                  Constants::AMDGCN_WAVE_SIZE,
+                                  Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncBufferAcc(uint32_t     m,
+                                                 uint32_t     n,
+                                                 DataT const* in,
+                                                 DataT*       out,
+                                                 uint32_t     ld,
+                                                 DataT        param1,
+                                                 DataT        param2)
+    {
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  FragSize_guard<BlockM,
+                                 BlockN,
+                                 DataT,
+                                 DataLayout,
+                                 Constants::AMDGCN_WAVE_SIZE,
+                                 Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncStreamingA(uint32_t     m,
+                                                  uint32_t     n,
+                                                  DataT const* in,
+                                                  DataT*       out,
+                                                  uint32_t     ld,
+                                                  DataT        param1,
+                                                  DataT        param2)
+    {
+        using Mapping = MappingUtil<BlockM, BlockN, DataT, DataLayout>;
+
+        // Mapping:
+        // Incoming -> Matrix A (ColNT)
+        // BlockM -> BlockM
+        // <Dummy> -> BlockN
+        // BlockN -> BlockK
+        auto frag = fragment<matrix_a, BlockM, 1, BlockN, DataT, DataLayout>();
+
+        // Map, then load and store with the streaming cache policy.
+        auto* read  = Mapping::dataCoord(in, ld);
+        auto* write = Mapping::dataCoord(out, ld);
+        load_matrix_sync<cache_streaming>(frag, read, ld);
+        store_matrix_sync<cache_streaming>(write, frag, ld);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  !FragSize_guard<BlockM,
+                                  BlockN,
+                                  DataT,
+                                  DataLayout,
+                                  Constants::AMDGCN_WAVE_SIZE,
+                                  Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncStreamingA(uint32_t     m,
+                                                  uint32_t     n,
+                                                  DataT const* in,
+                                                  DataT*       out,
+                                                  uint32_t     ld,
+                                                  DataT        param1,
+                                                  DataT        param2)
+    {
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  FragSize_guard<BlockM,
+                                 BlockN,
+                                 DataT,
+                                 DataLayout,
+                                 Constants::AMDGCN_WAVE_SIZE,
+                                 Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncStreamingB(uint32_t     m,
+                                                  uint32_t     n,
+                                                  DataT const* in,
+                                                  DataT*       out,
+                                                  uint32_t     ld,
+                                                  DataT        param1,
+                                                  DataT        param2)
+    {
+        using Mapping = MappingUtil<BlockM, BlockN, DataT, DataLayout>;
+
+        // Mapping:
+        // Incoming -> Matrix B (RowNT)
+        // <Dummy> -> BlockM
+        // BlockN -> BlockN
+        // BlockM -> BlockK
+        auto frag = fragment<matrix_b, 1, BlockN, BlockM, DataT, DataLayout>();
+
+        // Map, then load and store with the streaming cache policy.
+        auto* read  = Mapping::dataCoord(in, ld);
+        auto* write = Mapping::dataCoord(out, ld);
+        load_matrix_sync<cache_streaming>(frag, read, ld);
+        store_matrix_sync<cache_streaming>(write, frag, ld);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  !FragSize_guard<BlockM,
+                                  BlockN,
+                                  DataT,
+                                  DataLayout,
+                                  Constants::AMDGCN_WAVE_SIZE,
+                                  Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncStreamingB(uint32_t     m,
+                                                  uint32_t     n,
+                                                  DataT const* in,
+                                                  DataT*       out,
+                                                  uint32_t     ld,
+                                                  DataT        param1,
+                                                  DataT        param2)
+    {
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  FragSize_guard<BlockM,
+                                 BlockN,
+                                 DataT,
+                                 DataLayout,
+                                 Constants::AMDGCN_WAVE_SIZE,
+                                 Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncStreamingAcc(uint32_t     m,
+                                                    uint32_t     n,
+                                                    DataT const* in,
+                                                    DataT*       out,
+                                                    uint32_t     ld,
+                                                    DataT        param1,
+                                                    DataT        param2)
+    {
+        using Mapping = MappingUtil<BlockM, BlockN, DataT, DataLayout>;
+
+        // Mapping:
+        // Incoming -> Matrix C (Row4T)
+        // BlockM -> BlockM
+        // BlockN -> BlockN
+        // <Dummy> -> BlockK
+        auto frag = fragment<accumulator, BlockM, BlockN, 1, DataT, DataLayout>();
+
+        // Map, then load and store with the streaming cache policy.
+        auto* read  = Mapping::dataCoord(in, ld);
+        auto* write = Mapping::dataCoord(out, ld);
+        load_matrix_sync<cache_streaming>(frag, read, ld);
+        store_matrix_sync<cache_streaming>(write, frag, ld);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  !FragSize_guard<BlockM,
+                                  BlockN,
+                                  DataT,
+                                  DataLayout,
+                                  Constants::AMDGCN_WAVE_SIZE,
+                                  Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncStreamingAcc(uint32_t     m,
+                                                    uint32_t     n,
+                                                    DataT const* in,
+                                                    DataT*       out,
+                                                    uint32_t     ld,
+                                                    DataT        param1,
+                                                    DataT        param2)
+    {
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  FragSize_guard<BlockM,
+                                 BlockN,
+                                 DataT,
+                                 DataLayout,
+                                 Constants::AMDGCN_WAVE_SIZE,
+                                 Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncAsyncMixedA(uint32_t     m,
+                                                   uint32_t     n,
+                                                   DataT const* in,
+                                                   DataT*       out,
+                                                   uint32_t     ld,
+                                                   DataT        param1,
+                                                   DataT        param2)
+    {
+        using Mapping = MappingUtil<BlockM, BlockN, DataT, DataLayout>;
+
+        constexpr bool IsRowMjr = std::is_same<DataLayout, row_major>::value;
+
+        // Each wave stages its own block in LDS, with a compact leading dimension
+        constexpr uint32_t ldl = IsRowMjr ? BlockN : BlockM;
+
+        HIP_DYNAMIC_SHARED(void*, localMemPtr);
+        auto waveIdx = (threadIdx.y * blockDim.x + threadIdx.x) / Constants::AMDGCN_WAVE_SIZE;
+        auto* staged = reinterpret_cast<DataT*>(localMemPtr) + waveIdx * BlockM * BlockN;
+
+        // Mapping:
+        // Incoming -> Matrix A (ColNT)
+        // BlockM -> BlockM
+        // <Dummy> -> BlockN
+        // BlockN -> BlockK
+        using FragT = fragment<matrix_a, BlockM, 1, BlockN, DataT, DataLayout>;
+
+        auto* read  = Mapping::dataCoord(in, ld);
+        auto* write = Mapping::dataCoord(out, ld);
+
+        auto frag = FragT();
+        load_matrix_sync(frag, read, ld);
+        store_matrix_sync(staged, frag, ldl);
+        synchronize_workgroup();
+
+        // The global loads issued after the LDS loads must not relax the LDS
+        // wait: only lgkmcnt is waited on, and only by the pending LDS loads.
+        auto fragLds    = FragT();
+        auto fragGlobal = FragT();
+        load_matrix_async(fragLds, staged, ldl);
+        load_matrix_async(fragGlobal, read, ld);
+        wait_fragment(loaded_from<lds_memory>(fragLds), loaded_from<global_memory>(fragGlobal));
+        wait_fragment(loaded_from<global_memory>(fragGlobal));
+
+        // Elements on which both fragments disagree are offset by one,
+        // which fails validation.
+        for(uint32_t i = 0; i < FragT::num_elements; i++)
+        {
+            auto lds = static_cast<float32_t>(fragLds[i]);
+            if(lds != static_cast<float32_t>(fragGlobal[i]))
+            {
+                fragLds[i] = static_cast<DataT>(lds + 1.0f);
+            }
+        }
+
+        store_matrix_sync(write, fragLds, ld);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  !FragSize_guard<BlockM,
+                                  BlockN,
+                                  DataT,
+                                  DataLayout,
+                                  Constants::AMDGCN_WAVE_SIZE,
+                                  Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncAsyncMixedA(uint32_t     m,
+                                                   uint32_t     n,
+                                                   DataT const* in,
+                                                   DataT*       out,
+                                                   uint32_t     ld,
+                                                   DataT        param1,
+                                                   DataT        param2)
+    {
+    }
+
+    // Passes the accumulator through only if the source element read by the
+    // epilogue store matches it, so the output equals the input if both the
+    // accumulator and the source matrix were visited at the same coordinates.
+    template <typename DataT>
+    struct EpilogueMatchSource
+    {
+        DataT const* c   = nullptr;
+        uint32_t     ldc = 0u;
+
+        __device__ inline DataT
+            operator()(DataT acc, DataT source, uint32_t /*row*/, uint32_t /*col*/) const
+        {
+            return acc == source ? acc : static_cast<DataT>(0);
+        }
+    };
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  FragSize_guard<BlockM,
+                                 BlockN,
+                                 DataT,
+                                 DataLayout,
+                                 Constants::AMDGCN_WAVE_SIZE,
+                                 Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncEpilogueAcc(uint32_t     m,
+                                                   uint32_t     n,
+                                                   DataT const* in,
+                                                   DataT*       out,
+                                                   uint32_t     ld,
+                                                   DataT        param1,
+                                                   DataT        param2)
+    {
+        using Mapping = MappingUtil<BlockM, BlockN, DataT, DataLayout>;
+
+        // Mapping:
+        // Incoming -> Matrix C (Row4T)
+        // BlockM -> BlockM
+        // BlockN -> BlockN
+        // <Dummy> -> BlockK
+        auto frag = fragment<accumulator, BlockM, BlockN, 1, DataT, DataLayout>();
+
+        // Map, load the accumulator, then store through the epilogue
+        // which reads the same block as its source matrix.
+        auto* read  = Mapping::dataCoord(in, ld);
+        auto* write = Mapping::dataCoord(out, ld);
+        load_matrix_sync(frag, read, ld);
+        store_matrix_sync_epilogue(write, frag, ld, EpilogueMatchSource<DataT>{read, ld});
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  !FragSize_guard<BlockM,
+                                  BlockN,
+                                  DataT,
+                                  DataLayout,
+                                  Constants::AMDGCN_WAVE_SIZE,
+                                  Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncEpilogueAcc(uint32_t     m,
+                                                   uint32_t     n,
+                                                   DataT const* in,
+                                                   DataT*       out,
+                                                   uint32_t     ld,
+                                                   DataT        param1,
+                                                   DataT        param2)
+    {
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  FragSize_guard<BlockM,
+                                 BlockN,
+                                 DataT,
+                                 DataLayout,
+                                 Constants::AMDGCN_WAVE_SIZE,
+                                 Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncEpilogueFp8Acc(uint32_t     m,
+                                                      uint32_t     n,
+                                                      DataT const* in,
+                                                      DataT*       out,
+                                                      uint32_t     ld,
+                                                      DataT        param1,
+                                                      DataT        param2)
+    {
+        using Mapping = MappingUtil<BlockM, BlockN, DataT, DataLayout>;
+
+        constexpr bool IsRowMjr = std::is_same<DataLayout, row_major>::value;
+
+        // Largest tested workgroup
+        constexpr uint32_t MaxWaves = 8u;
+
+        // Each wave quantizes its own block to LDS, with a compact leading dimension
+        constexpr uint32_t ldq = IsRowMjr ? BlockN : BlockM;
+
+        __shared__ float8_t  quantized[MaxWaves][BlockM * BlockN];
+        __shared__ float32_t amax;
+
+        auto waveIdx  = (threadIdx.y * blockDim.x + threadIdx.x) / Constants::AMDGCN_WAVE_SIZE;
+        auto threadId = threadIdx.y * blockDim.x + threadIdx.x;
+
+        // Only the first thread folds the workgroup amax into amax,
+        // so it may initialize it without synchronization.
+        if(threadId == 0u)
+        {
+            amax = 0.0f;
+        }
+
+        // Mapping:
+        // Incoming -> Matrix C (Row4T)
+        // BlockM -> BlockM
+        // BlockN -> BlockN
+        // <Dummy> -> BlockK
+        auto frag = fragment<accumulator, BlockM, BlockN, 1, DataT, DataLayout>();
+
+        auto* read  = Mapping::dataCoord(in, ld);
+        auto* write = Mapping::dataCoord(out, ld);
+        load_matrix_sync(frag, read, ld);
+
+        // Test inputs are small integers, which remain exact in fp8
+        // when doubled by scale_a and quartered by scale_d.
+        auto epilogue    = epilogue_fp8_quantize<float8_t, DataT>{};
+        epilogue.scale_a = static_cast<DataT>(2.0f);
+        epilogue.scale_d = static_cast<DataT>(0.25f);
+        store_matrix_sync_epilogue(quantized[waveIdx], frag, ldq, epilogue);
+
+        // Also synchronizes the quantized stores
+        reduce_amax_sync(&amax, epilogue.amax);
+
+        // The first thread folds the workgroup amax into amax after the last
+        // barrier of the reduction, so the other waves must wait to read it.
+        synchronize_workgroup();
+
+        // Input magnitudes of every workgroup are at most 2 and include 2,
+        // hence amax = 4 after scale_a. Dequantize, then normalize with
+        // amax so that the output only matches if amax does too.
+        using FragT = decltype(frag);
+        for(uint32_t i = 0; i < FragT::num_elements; i++)
+        {
+            auto offset = DataLayout::fromMatrixCoord(FragT::elementCoord(i), ldq);
+            auto q      = static_cast<float32_t>(quantized[waveIdx][offset]);
+            frag[i]     = static_cast<DataT>(q * 2.0f * (4.0f / amax));
+        }
+
+        store_matrix_sync(write, frag, ld);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  !FragSize_guard<BlockM,
+                                  BlockN,
+                                  DataT,
+                                  DataLayout,
+                                  Constants::AMDGCN_WAVE_SIZE,
+                                  Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncEpilogueFp8Acc(uint32_t     m,
+                                                      uint32_t     n,
+                                                      DataT const* in,
+                                                      DataT*       out,
+                                                      uint32_t     ld,
+                                                      DataT        param1,
+                                                      DataT        param2)
+    {
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  FragSize_guard<BlockM,
+                                 BlockN,
+                                 DataT,
+                                 DataLayout,
+                                 Constants::AMDGCN_WAVE_SIZE,
+                                 Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncAtomicAddAcc(uint32_t     m,
+                                                    uint32_t     n,
+                                                    DataT const* in,
+                                                    DataT*       out,
+                                                    uint32_t     ld,
+                                                    DataT        param1,
+                                                    DataT        param2)
+    {
+        using Mapping = MappingUtil<BlockM, BlockN, DataT, DataLayout>;
+
+        // Mapping:
+        // Incoming -> Matrix C (Row4T)
+        // BlockM -> BlockM
+        // BlockN -> BlockN
+        // <Dummy> -> BlockK
+        auto frag  = fragment<accumulator, BlockM, BlockN, 1, DataT, DataLayout>();
+        auto zeros = fragment<accumulator, BlockM, BlockN, 1, DataT, DataLayout>();
+
+        auto* read  = Mapping::dataCoord(in, ld);
+        auto* write = Mapping::dataCoord(out, ld);
+        load_matrix_sync(frag, read, ld);
+
+        // Clear the output, then accumulate 2 * in - in. Each element is
+        // owned by the same thread for every store, so the plain store of
+        // zeros is ordered before the atomics.
+        fill_fragment(zeros, static_cast<DataT>(0));
+        store_matrix_sync(write, zeros, ld);
+        store_matrix_atomic_add_sync(write, frag, ld);
+        store_matrix_atomic_add_sync(write, frag, ld);
+
+        for(uint32_t i = 0; i < decltype(frag)::num_elements; i++)
+        {
+            frag[i] = static_cast<DataT>(-static_cast<float32_t>(frag[i]));
+        }
+        store_matrix_atomic_add_sync(write, frag, ld);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  !FragSize_guard<BlockM,
+                                  BlockN,
+                                  DataT,
+                                  DataLayout,
+                                  Constants::AMDGCN_WAVE_SIZE,
+                                  Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncAtomicAddAcc(uint32_t     m,
+                                                    uint32_t     n,
+                                                    DataT const* in,
+                                                    DataT*       out,
+                                                    uint32_t     ld,
+                                                    DataT        param1,
+                                                    DataT        param2)
+    {
+    }
+
+    // Gathers each fragment element from its mapped matrix coordinate, then
+    // stores the fragment. The output matches the input only if the element
+    // coordinates agree with the fragment's load / store layout.
+    template <typename FragT, typename MappingT, typename DataT>
+    __device__ inline void gatherElementCoords(FragT& frag, DataT const* read, uint32_t ld)
+    {
+        for(uint32_t i = 0; i < FragT::num_elements; i++)
+        {
+            frag[i] = read[MappingT::dataOffset(FragT::elementCoord(i), ld)];
+        }
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  FragSize_guard<BlockM,
+                                 BlockN,
+                                 DataT,
+                                 DataLayout,
+                                 Constants::AMDGCN_WAVE_SIZE,
+                                 Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncElementCoordA(uint32_t     m,
+                                                     uint32_t     n,
+                                                     DataT const* in,
+                                                     DataT*       out,
+                                                     uint32_t     ld,
+                                                     DataT        param1,
+                                                     DataT        param2)
+    {
+        using Mapping = MappingUtil<BlockM, BlockN, DataT, DataLayout>;
+
+        // Mapping:
+        // Incoming -> Matrix A (ColNT)
+        // BlockM -> BlockM
+        // <Dummy> -> BlockN
+        // BlockN -> BlockK
+        using FragT = fragment<matrix_a, BlockM, 1, BlockN, DataT, DataLayout>;
+
+        auto frag = FragT();
+
+        // Map, gather by element coordinates, then store.
+        auto* read  = Mapping::dataCoord(in, ld);
+        auto* write = Mapping::dataCoord(out, ld);
+        gatherElementCoords<FragT, Mapping>(frag, read, ld);
+        store_matrix_sync(write, frag, ld);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  !FragSize_guard<BlockM,
+                                  BlockN,
+                                  DataT,
+                                  DataLayout,
+                                  Constants::AMDGCN_WAVE_SIZE,
+                                  Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncElementCoordA(uint32_t     m,
+                                                     uint32_t     n,
+                                                     DataT const* in,
+                                                     DataT*       out,
+                                                     uint32_t     ld,
+                                                     DataT        param1,
+                                                     DataT        param2)
+    {
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  FragSize_guard<BlockM,
+                                 BlockN,
+                                 DataT,
+                                 DataLayout,
+                                 Constants::AMDGCN_WAVE_SIZE,
+                                 Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncElementCoordB(uint32_t     m,
+                                                     uint32_t     n,
+                                                     DataT const* in,
+                                                     DataT*       out,
+                                                     uint32_t     ld,
+                                                     DataT        param1,
+                                                     DataT        param2)
+    {
+        using Mapping = MappingUtil<BlockM, BlockN, DataT, DataLayout>;
+
+        // Mapping:
+        // Incoming -> Matrix B (RowNT)
+        // <Dummy> -> BlockM
+        // BlockN -> BlockN
+        // BlockM -> BlockK
+        using FragT = fragment<matrix_b, 1, BlockN, BlockM, DataT, DataLayout>;
+
+        auto frag = FragT();
+
+        // Map, gather by element coordinates, then store.
+        auto* read  = Mapping::dataCoord(in, ld);
+        auto* write = Mapping::dataCoord(out, ld);
+        gatherElementCoords<FragT, Mapping>(frag, read, ld);
+        store_matrix_sync(write, frag, ld);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  !FragSize_guard<BlockM,
+                                  BlockN,
+                                  DataT,
+                                  DataLayout,
+                                  Constants::AMDGCN_WAVE_SIZE,
+                                  Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncElementCoordB(uint32_t     m,
+                                                     uint32_t     n,
+                                                     DataT const* in,
+                                                     DataT*       out,
+                                                     uint32_t     ld,
+                                                     DataT        param1,
+                                                     DataT        param2)
+    {
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  FragSize_guard<BlockM,
+                                 BlockN,
+                                 DataT,
+                                 DataLayout,
+                                 Constants::AMDGCN_WAVE_SIZE,
+                                 Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncElementCoordAcc(uint32_t     m,
+                                                       uint32_t     n,
+                                                       DataT const* in,
+                                                       DataT*       out,
+                                                       uint32_t     ld,
+                                                       DataT        param1,
+                                                       DataT        param2)
+    {
+        using Mapping = MappingUtil<BlockM, BlockN, DataT, DataLayout>;
+
+        // Mapping:
+        // Incoming -> Matrix C (Row4T)
+        // BlockM -> BlockM
+        // BlockN -> BlockN
+        // <Dummy> -> BlockK
+        using FragT = fragment<accumulator, BlockM, BlockN, 1, DataT, DataLayout>;
+
+        auto frag = FragT();
+
+        // Map, gather by element coordinates, then store.
+        auto* read  = Mapping::dataCoord(in, ld);
+        auto* write = Mapping::dataCoord(out, ld);
+        gatherElementCoords<FragT, Mapping>(frag, read, ld);
+        store_matrix_sync(write, frag, ld);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  !FragSize_guard<BlockM,
+                                  BlockN,
+                                  DataT,
+                                  DataLayout,
+                                  Constants::AMDGCN_WAVE_SIZE,
+                                  Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncElementCoordAcc(uint32_t     m,
+                                                       uint32_t     n,
+                                                       DataT const* in,
+                                                       DataT*       out,
+                                                       uint32_t     ld,
+                                                       DataT        param1,
+                                                       DataT        param2)
+    {
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  FragSize_guard<BlockM,
+                                 BlockN,
+                                 DataT,
+                                 DataLayout,
+                                 Constants::AMDGCN_WAVE_SIZE,
+                                 Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncDequantB(uint32_t     m,
+                                                uint32_t     n,
+                                                DataT const* in,
+                                                DataT*       out,
+                                                uint32_t     ld,
+                                                DataT        param1,
+                                                DataT        param2)
+    {
+        // Test inputs are small integers which are exact in 4 bits.
+        // Floating point types are also dequantized with per-group signs
+        // and zero-points, such that a group mismatch changes the result.
+        constexpr bool IsScaled = !std::is_integral<DataT>::value;
+
+        using Mapping = MappingUtil<BlockM, BlockN, DataT, DataLayout>;
+        using PackedT = std::conditional_t<IsScaled || std::is_signed<DataT>::value,
+                                           int4x2_t,
+                                           uint4x2_t>;
+        using Int4    = detail::Int4Traits<PackedT>;
+
+        constexpr bool     IsRowMjr  = std::is_same<DataLayout, row_major>::value;
+        constexpr uint32_t GroupSize = 8u;
+        constexpr uint32_t Groups    = BlockM / GroupSize;
+
+        // Largest tested workgroup
+        constexpr uint32_t MaxWaves = 8u;
+
+        // Each wave packs its own block in LDS, with compact leading dimensions
+        constexpr uint32_t ldp = IsRowMjr ? BlockN : BlockM;
+        constexpr uint32_t lds = IsRowMjr ? BlockN : Groups;
+
+        __shared__ PackedT   packed[MaxWaves][BlockM * BlockN / 2u];
+        __shared__ float32_t scaleBuf[MaxWaves][Groups * BlockN];
+        __shared__ float32_t zeroBuf[MaxWaves][Groups * BlockN];
+
+        auto waveIdx = (threadIdx.y * blockDim.x + threadIdx.x) / Constants::AMDGCN_WAVE_SIZE;
+        auto laneIdx = threadIdx.x % Constants::AMDGCN_WAVE_SIZE;
+        auto scales  = reinterpret_cast<DataT*>(scaleBuf[waveIdx]);
+        auto zeros   = reinterpret_cast<DataT*>(zeroBuf[waveIdx]);
+
+        // Group sign and zero-point of the element (row, col)
+        auto sign = [](uint32_t row, uint32_t col) {
+            return ((row / GroupSize + col) & 1u) ? -1 : 1;
+        };
+        auto zero = [](uint32_t row, uint32_t /*col*/) {
+            return static_cast<int32_t>((row / GroupSize) & 1u);
+        };
+
+        auto* read  = Mapping::dataCoord(in, ld);
+        auto* write = Mapping::dataCoord(out, ld);
+
+        // Local packed offset to the (row, col) coordinate of the block
+        auto coord = [](uint32_t offset) {
+            return IsRowMjr ? make_coord2d(offset / ldp, offset % ldp)
+                            : make_coord2d(offset % ldp, offset / ldp);
+        };
+
+        auto quantize = [&](uint32_t offset) {
+            auto elementCoord = coord(offset);
+            auto row          = get<0>(elementCoord);
+            auto col          = get<1>(elementCoord);
+            auto value        = static_cast<int32_t>(static_cast<float32_t>(
+                read[DataLayout::fromMatrixCoord(elementCoord, ld)]));
+            return IsScaled ? sign(row, col) * value + zero(row, col) : value;
+        };
+
+        for(uint32_t i = laneIdx; i < BlockM * BlockN / 2u; i += Constants::AMDGCN_WAVE_SIZE)
+        {
+            packed[waveIdx][i].data = Int4::pack(quantize(2u * i), quantize(2u * i + 1u));
+        }
+
+        if constexpr(IsScaled)
+        {
+            for(uint32_t i = laneIdx; i < Groups * BlockN; i += Constants::AMDGCN_WAVE_SIZE)
+            {
+                auto groupCoord = IsRowMjr ? make_coord2d(i / lds, i % lds)
+                                           : make_coord2d(i % lds, i / lds);
+                auto row        = get<0>(groupCoord) * GroupSize;
+                auto col        = get<1>(groupCoord);
+
+                scales[i] = static_cast<DataT>(static_cast<float32_t>(sign(row, col)));
+                zeros[i]  = static_cast<DataT>(static_cast<float32_t>(zero(row, col)));
+            }
+        }
+
+        __syncthreads();
+
+        // Mapping:
+        // Incoming -> Matrix B (RowNT)
+        // <Dummy> -> BlockM
+        // BlockN -> BlockN
+        // BlockM -> BlockK
+        auto frag = fragment<matrix_b, 1, BlockN, BlockM, DataT, DataLayout>();
+
+        // Dequant load from packed LDS, and store.
+        if constexpr(IsScaled)
+        {
+            load_matrix_sync_dequant<GroupSize>(frag, packed[waveIdx], ldp, scales, zeros, lds);
+        }
+        else
+        {
+            load_matrix_sync_dequant(frag, packed[waveIdx], ldp);
+        }
+        store_matrix_sync(write, frag, ld);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  !FragSize_guard<BlockM,
+                                  BlockN,
+                                  DataT,
+                                  DataLayout,
+                                  Constants::AMDGCN_WAVE_SIZE,
+                                  Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncDequantB(uint32_t     m,
+                                                uint32_t     n,
+                                                DataT const* in,
+                                                DataT*       out,
+                                                uint32_t     ld,
+                                                DataT        param1,
+                                                DataT        param2)
+    {
+    }
+
 } // namespace rocwmma
 
 #endif // ROCWMMA_DEVICE_LOAD_STORE_MATRIX_SYNC_HPP
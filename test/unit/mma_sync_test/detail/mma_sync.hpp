@@ -0,0 +1,326 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DETAIL_MMA_SYNC_HPP
+#define ROCWMMA_DETAIL_MMA_SYNC_HPP
+
+#include "device/mma_sync.hpp"
+#include "helper_macros.hpp"
+#include "reference.hpp"
+#include "unit_kernel_base.hpp"
+
+namespace rocwmma
+{
+
+    // Wrapper into the actual device function
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct MmaSyncKernel : public UnitKernelBase<BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = UnitKernelBase<BlockM, BlockN, DataT, Layout>;
+
+    public:
+        MmaSyncKernel()          = default;
+        virtual ~MmaSyncKernel() = default;
+
+        void setupImpl(typename Base::DataStorage::ProblemSize const& probsize) final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            // Initialize matrix storage
+            const int64_t sizeD = Base::mM * Base::mN;
+            dataInstance->resizeStorage(probsize);
+
+            // Initialize data on host
+            MatrixUtil<Layout>::fillLaunchKernel(
+                dataInstance->deviceIn().get(), Base::mM, Base::mN);
+            MatrixUtil<Layout>::fillValLaunchKernel(dataInstance->deviceOut().get(),
+                                                    Base::mM,
+                                                    Base::mN,
+                                                    std::numeric_limits<DataT>::signaling_NaN());
+        }
+
+        void validateResultsImpl() final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            const int64_t sizeD = Base::mM * Base::mN;
+
+            double errorTolerance = 10.0;
+
+            std::tie(Base::mValidationResult, Base::mMaxRelativeError)
+                = compareEqualLaunchKernel<DataT, DataT, Layout, Layout>(
+                    dataInstance->deviceIn().get(),
+                    dataInstance->deviceOut().get(),
+                    Base::mM,
+                    Base::mN,
+                    errorTolerance);
+        }
+
+        bool checkDevice() const final
+        {
+            auto deviceArch = Base::DeviceInfo::instance()->getGcnArch();
+
+            // Mixed fp8 / bf8 mfma is only available on gfx94x
+            return (deviceArch == Base::DeviceInfo::GFX940
+                    || deviceArch == Base::DeviceInfo::GFX941
+                    || deviceArch == Base::DeviceInfo::GFX942);
+        }
+
+        virtual typename Base::KernelFunc kernelImpl() const = 0;
+    };
+
+    // fp8 (e4m3) A x bf8 (e5m2) B
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct MmaSyncKernelF8Bf8 final : public MmaSyncKernel<BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = MmaSyncKernel<BlockM, BlockN, DataT, Layout>;
+
+    protected:
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(
+                mmaSyncMixedF8<BlockM, BlockN, DataT, Layout, float8_t, bfloat8_t>);
+        }
+    };
+
+    // bf8 (e5m2) A x fp8 (e4m3) B
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct MmaSyncKernelBf8F8 final : public MmaSyncKernel<BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = MmaSyncKernel<BlockM, BlockN, DataT, Layout>;
+
+    protected:
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(
+                mmaSyncMixedF8<BlockM, BlockN, DataT, Layout, bfloat8_t, float8_t>);
+        }
+    };
+
+    // 2:4 sparse A x dense B, with A compressed on host. The compressed values,
+    // metadata and B live in buffers of their own types, so the kernel replaces
+    // the launch of the base. C is taken from the input and D is the output.
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout, typename InputT>
+    struct MmaSyncSparseKernel : public UnitKernelBase<BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = UnitKernelBase<BlockM, BlockN, DataT, Layout>;
+
+        template <typename T>
+        using HostPtrT = HipResource::HostPtrT<T>;
+
+        // Logical K of each sparse mma step, and of the whole problem
+        constexpr static uint32_t BlockK = 32u;
+        constexpr static uint32_t K      = 2u * BlockK;
+
+        // Metadata words per row of A
+        constexpr static uint32_t MetadataWordK
+            = detail::SparseLayout<BlockM, BlockN, BlockK, InputT>::MetadataWordK;
+        constexpr static uint32_t Ldi = (K + MetadataWordK - 1u) / MetadataWordK;
+
+    public:
+        MmaSyncSparseKernel()          = default;
+        virtual ~MmaSyncSparseKernel() = default;
+
+        void setupImpl(typename Base::DataStorage::ProblemSize const& probsize) final
+        {
+            using DataStorage  = typename Base::DataStorage;
+            auto& dataInstance = DataStorage::instance();
+
+            auto m = Base::mM;
+            auto n = Base::mN;
+
+            // C and D storage
+            dataInstance->resizeStorage(probsize);
+            MatrixUtil<Layout>::fill(dataInstance->hostIn().get(), m, n);
+            dataInstance->copyData(dataInstance->deviceIn(), dataInstance->hostIn(), m * n);
+            MatrixUtil<Layout>::fillValLaunchKernel(dataInstance->deviceOut().get(),
+                                                    m,
+                                                    n,
+                                                    std::numeric_limits<DataT>::signaling_NaN());
+
+            // Prune A to 2:4 by compressing it. The dense reference uses the
+            // pruned A expanded back from the compressed form.
+            auto a       = DataStorage::template allocHost<InputT>(m * K);
+            mA           = DataStorage::template allocHost<InputT>(m * K);
+            mValues      = DataStorage::template allocHost<InputT>(m * K / 2u);
+            mMetadata    = DataStorage::template allocHost<uint32_t>(m * Ldi);
+            mB           = DataStorage::template allocHost<InputT>(K * n);
+            MatrixUtil<row_major>::fill(a.get(), m, K);
+            MatrixUtil<col_major>::fill(mB.get(), K, n);
+
+            compress_2to4_CPU(a.get(), mValues.get(), mMetadata.get(), m, K);
+            decompress_2to4_CPU(mValues.get(), mMetadata.get(), mA.get(), m, K);
+        }
+
+        void exec() final
+        {
+            if(Base::mRunFlag)
+            {
+                using DataStorage  = typename Base::DataStorage;
+                auto& dataInstance = DataStorage::instance();
+
+                auto m = Base::mM;
+                auto n = Base::mN;
+
+                auto values   = DataStorage::template allocDevice<InputT>(m * K / 2u);
+                auto metadata = DataStorage::template allocDevice<uint32_t>(m * Ldi);
+                auto b        = DataStorage::template allocDevice<InputT>(K * n);
+                DataStorage::copyData(values, mValues, m * K / 2u);
+                DataStorage::copyData(metadata, mMetadata, m * Ldi);
+                DataStorage::copyData(b, mB, K * n);
+
+                hipEvent_t startEvent, stopEvent;
+                CHECK_HIP_ERROR(hipEventCreate(&startEvent));
+                CHECK_HIP_ERROR(hipEventCreate(&stopEvent));
+
+                hipExtLaunchKernelGGL(
+                    (mmaSyncSparse<BlockM, BlockN, BlockK, DataT, Layout, InputT>),
+                    (Base::gridDim()),
+                    (Base::blockDim()),
+                    (Base::ldsUsage()),
+                    0,
+                    startEvent,
+                    stopEvent,
+                    0,
+                    m,
+                    n,
+                    K,
+                    values.get(),
+                    metadata.get(),
+                    b.get(),
+                    dataInstance->deviceIn().get(),
+                    dataInstance->deviceOut().get(),
+                    Base::mLd);
+
+                auto timeMs = 0.0f;
+                CHECK_HIP_ERROR(hipEventSynchronize(stopEvent));
+                CHECK_HIP_ERROR(hipEventElapsedTime(&timeMs, startEvent, stopEvent));
+                CHECK_HIP_ERROR(hipEventDestroy(startEvent));
+                CHECK_HIP_ERROR(hipEventDestroy(stopEvent));
+
+                Base::mElapsedTimeMs = float64_t(timeMs);
+            }
+        }
+
+        void validateResultsImpl() final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            auto m = Base::mM;
+            auto n = Base::mN;
+
+            auto& kernelResult = dataInstance->hostOut();
+            dataInstance->copyData(kernelResult, dataInstance->deviceOut(), m * n);
+
+            // Dense reference on the pruned A
+            std::vector<DataT> reference(m * n);
+            gemm_CPU<InputT, DataT, DataT, row_major, col_major, Layout, Layout>(
+                m,
+                n,
+                K,
+                mA.get(),
+                mB.get(),
+                dataInstance->hostIn().get(),
+                reference.data(),
+                static_cast<DataT>(1),
+                static_cast<DataT>(1));
+
+            double errorTolerance = 10.0;
+
+            std::tie(Base::mValidationResult, Base::mMaxRelativeError)
+                = compareEqual<DataT, DataT, Layout, Layout>(
+                    kernelResult.get(), reference.data(), m, n, errorTolerance);
+        }
+
+        bool checkDevice() const final
+        {
+            auto deviceArch = Base::DeviceInfo::instance()->getGcnArch();
+
+            // Sparse mfma is only available on gfx94x
+            return (deviceArch == Base::DeviceInfo::GFX940
+                    || deviceArch == Base::DeviceInfo::GFX941
+                    || deviceArch == Base::DeviceInfo::GFX942);
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(nullptr);
+        }
+
+    private:
+        HostPtrT<InputT>   mA, mValues, mB;
+        HostPtrT<uint32_t> mMetadata;
+    };
+
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    using MmaSyncSparseKernelF16 = MmaSyncSparseKernel<BlockM, BlockN, DataT, Layout, float16_t>;
+
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    using MmaSyncSparseKernelBf16
+        = MmaSyncSparseKernel<BlockM, BlockN, DataT, Layout, bfloat16_t>;
+
+    template <template <uint32_t, uint32_t, typename, typename> class KernelClass>
+    struct MmaSyncGenerator
+    {
+        // Indices to test parameters
+        enum : uint32_t
+        {
+            DataT  = 0,
+            BlockM = 1,
+            BlockN = 2,
+            Layout = 3
+        };
+
+        using ResultT = std::shared_ptr<KernelI>;
+
+        template <typename... Ts>
+        static ResultT generate(std::tuple<Ts...> testParams)
+        {
+            // Map GTest params to Kernel params
+            using TestParamsT = std::tuple<Ts...>;
+            using KernelT = KernelClass<std::tuple_element_t<BlockM, TestParamsT>::value, // BlockM
+                                        std::tuple_element_t<BlockN, TestParamsT>::value, // BlockN
+                                        std::tuple_element_t<DataT, TestParamsT>, // DataT
+                                        std::tuple_element_t<Layout, TestParamsT> // Layout
+                                        >;
+
+            return std::make_shared<KernelT>();
+        }
+    };
+
+    using MmaSyncGeneratorF8Bf8 = MmaSyncGenerator<MmaSyncKernelF8Bf8>;
+    using MmaSyncGeneratorBf8F8 = MmaSyncGenerator<MmaSyncKernelBf8F8>;
+
+    using MmaSyncGeneratorSparseF16  = MmaSyncGenerator<MmaSyncSparseKernelF16>;
+    using MmaSyncGeneratorSparseBf16 = MmaSyncGenerator<MmaSyncSparseKernelBf16>;
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DETAIL_MMA_SYNC_HPP
@@ -0,0 +1,237 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DEVICE_MMA_SYNC_HPP
+#define ROCWMMA_DEVICE_MMA_SYNC_HPP
+
+#include "unit_test_traits.hpp"
+#include <rocwmma/internal/mapping_util.hpp>
+#include <rocwmma/rocwmma.hpp>
+#include <rocwmma/rocwmma_sparse.hpp>
+
+namespace rocwmma
+{
+
+    // Mixed fp8 / bf8 and sparse mfma are only available on gfx94x
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename Layout,
+              uint32_t WaveSize,
+              uint32_t ArchId>
+    struct Gfx94xMma_guard
+    {
+        using TestTraits = UnitTestTraits<BlockM, BlockN, DataT, Layout, WaveSize, ArchId>;
+
+        constexpr static bool enable()
+        {
+            return FragSize_guard<BlockM, BlockN, DataT, Layout, WaveSize, ArchId>::enable()
+                   && ((bool)TestTraits::IsGfx940 || (bool)TestTraits::IsGfx941
+                       || (bool)TestTraits::IsGfx942);
+        }
+    };
+
+    // Each wave computes D = A x B, where A is the input block split into
+    // BlockK wide steps and B is a BlockN x BlockN identity split into
+    // matching steps. Input values are exact in both fp8 formats, so
+    // the output must match the input.
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename InputTA,
+              typename InputTB,
+              typename std::enable_if_t<
+                  Gfx94xMma_guard<BlockM,
+                                  BlockN,
+                                  DataT,
+                                  DataLayout,
+                                  Constants::AMDGCN_WAVE_SIZE,
+                                  Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void mmaSyncMixedF8(uint32_t     m,
+                                   uint32_t     n,
+                                   DataT const* in,
+                                   DataT*       out,
+                                   uint32_t     ld,
+                                   DataT        param1,
+                                   DataT        param2)
+    {
+        // Native fp8 / bf8 mfma block K
+        constexpr uint32_t BlockK = (BlockM == 16u) ? 32u : 16u;
+        constexpr uint32_t KSteps = (BlockN + BlockK - 1u) / BlockK;
+
+        using Mapping = MappingUtil<BlockM, BlockN, DataT, DataLayout>;
+        using FragA   = fragment<matrix_a, BlockM, BlockN, BlockK, InputTA, row_major>;
+        using FragB   = fragment<matrix_b, BlockM, BlockN, BlockK, InputTB, col_major>;
+        using FragAcc = fragment<accumulator, BlockM, BlockN, BlockK, DataT, DataLayout>;
+
+        auto fragA   = FragA();
+        auto fragB   = FragB();
+        auto fragAcc = FragAcc();
+        fill_fragment(fragAcc, static_cast<DataT>(0));
+
+        auto const* read = Mapping::dataCoord(in, ld);
+
+        for(uint32_t k = 0; k < KSteps; k++)
+        {
+            auto kOffset = make_coord2d(0u, k * BlockK);
+
+            for(uint32_t i = 0; i < FragA::num_elements; i++)
+            {
+                auto coord = FragA::elementCoord(i) + kOffset;
+                fragA[i]   = get<1>(coord) < BlockN
+                                 ? static_cast<InputTA>(read[Mapping::dataOffset(coord, ld)])
+                                 : static_cast<InputTA>(0.0f);
+            }
+
+            for(uint32_t i = 0; i < FragB::num_elements; i++)
+            {
+                auto coord = FragB::elementCoord(i);
+                fragB[i]   = static_cast<InputTB>(
+                    (get<0>(coord) + k * BlockK) == get<1>(coord) ? 1.0f : 0.0f);
+            }
+
+            mma_sync(fragAcc, fragA, fragB, fragAcc);
+        }
+
+        // Map and store
+        store_matrix_sync(Mapping::dataCoord(out, ld), fragAcc, ld);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename InputTA,
+              typename InputTB,
+              typename std::enable_if_t<
+                  !Gfx94xMma_guard<BlockM,
+                                   BlockN,
+                                   DataT,
+                                   DataLayout,
+                                   Constants::AMDGCN_WAVE_SIZE,
+                                   Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void mmaSyncMixedF8(uint32_t     m,
+                                   uint32_t     n,
+                                   DataT const* in,
+                                   DataT*       out,
+                                   uint32_t     ld,
+                                   DataT        param1,
+                                   DataT        param2)
+    {
+    }
+
+    // Each wave computes its block of D = A x B + C over the full K, where A is
+    // M x K in 2:4 compressed form (row_major values and metadata) and B is a
+    // col_major K x N matrix. C and D are M x N in DataLayout.
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout,
+              typename InputT,
+              typename std::enable_if_t<
+                  Gfx94xMma_guard<BlockM,
+                                  BlockN,
+                                  DataT,
+                                  DataLayout,
+                                  Constants::AMDGCN_WAVE_SIZE,
+                                  Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void mmaSyncSparse(uint32_t        m,
+                                  uint32_t        n,
+                                  uint32_t        k,
+                                  InputT const*   values,
+                                  uint32_t const* metadata,
+                                  InputT const*   b,
+                                  DataT const*    c,
+                                  DataT*          d,
+                                  uint32_t        ld)
+    {
+        using Mapping = MappingUtil<BlockM, BlockN, DataT, DataLayout>;
+        using FragA   = sparse_fragment<BlockM, BlockN, BlockK, InputT>;
+        using FragB   = fragment<matrix_b, BlockM, BlockN, BlockK, InputT, col_major>;
+        using FragAcc = fragment<accumulator, BlockM, BlockN, BlockK, DataT, DataLayout>;
+
+        constexpr uint32_t MetadataWordK = FragA::Layout::MetadataWordK;
+
+        auto ldv = k / 2u;
+        auto ldi = (k + MetadataWordK - 1u) / MetadataWordK;
+
+        auto matrixCoord = Mapping::matrixCoord();
+        auto row         = get<0>(matrixCoord);
+        auto col         = get<1>(matrixCoord);
+
+        auto fragA   = FragA();
+        auto fragB   = FragB();
+        auto fragAcc = FragAcc();
+
+        load_matrix_sync(fragAcc, Mapping::dataCoord(c, ld), ld);
+
+        // BlockK is a multiple of the metadata word, so every step starts on a word
+        for(uint32_t kk = 0; kk < k; kk += BlockK)
+        {
+            load_matrix_sync(fragA,
+                             values + row * ldv + kk / 2u,
+                             ldv,
+                             metadata + row * ldi + kk / MetadataWordK,
+                             ldi);
+            load_matrix_sync(fragB, b + col * k + kk, k);
+
+            mma_sync(fragAcc, fragA, fragB, fragAcc);
+        }
+
+        // Map and store
+        store_matrix_sync(Mapping::dataCoord(d, ld), fragAcc, ld);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout,
+              typename InputT,
+              typename std::enable_if_t<
+                  !Gfx94xMma_guard<BlockM,
+                                   BlockN,
+                                   DataT,
+                                   DataLayout,
+                                   Constants::AMDGCN_WAVE_SIZE,
+                                   Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void mmaSyncSparse(uint32_t        m,
+                                  uint32_t        n,
+                                  uint32_t        k,
+                                  InputT const*   values,
+                                  uint32_t const* metadata,
+                                  InputT const*   b,
+                                  DataT const*    c,
+                                  DataT*          d,
+                                  uint32_t        ld)
+    {
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DEVICE_MMA_SYNC_HPP
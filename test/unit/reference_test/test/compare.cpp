@@ -0,0 +1,123 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "common.hpp"
+
+namespace rocwmma
+{
+    // Reference of 1s, where the result is off by the given ULPs at element i
+    template <typename DataT, typename LayoutA = row_major, typename LayoutB = row_major>
+    CompareStats compareUlps(std::vector<uint32_t> const& ulps, uint32_t m, uint32_t n)
+    {
+        auto eps = static_cast<float>(std::numeric_limits<DataT>::epsilon());
+
+        std::vector<DataT> result(m * n), reference(m * n, static_cast<DataT>(1.0f));
+        for(uint32_t i = 0; i < result.size(); i++)
+        {
+            auto ulp  = i < ulps.size() ? ulps[i] : 0u;
+            result[i] = static_cast<DataT>(1.0f + static_cast<float>(ulp) * eps);
+        }
+
+        uint32_t lda = std::is_same<LayoutA, row_major>::value ? n : m;
+        uint32_t ldb = std::is_same<LayoutB, row_major>::value ? n : m;
+        return compareStats<DataT, DataT, LayoutA, LayoutB>(
+            result.data(), reference.data(), m, n, lda, ldb);
+    }
+
+} // namespace rocwmma
+
+TEST(CompareTest, Exact)
+{
+    using namespace rocwmma;
+
+    auto stats = compareUlps<float32_t>({}, 67u, 129u);
+    EXPECT_TRUE(stats.passed);
+    EXPECT_EQ(stats.count, 67u * 129u);
+    EXPECT_EQ(stats.maxUlp, 0u);
+    EXPECT_EQ(stats.maxRelativeError, 0.0);
+    EXPECT_EQ(stats.ulpHistogram[0], stats.count);
+}
+
+TEST(CompareTest, UlpHistogram)
+{
+    using namespace rocwmma;
+
+    // Mixed layouts compare the same logical elements
+    auto ulps  = std::vector<uint32_t>{1u, 2u, 3u, 4u, 7u, 8u, 100u};
+    auto stats = compareUlps<float32_t, row_major, col_major>(ulps, 1u, 300u);
+    EXPECT_EQ(stats.maxUlp, 100u);
+    EXPECT_EQ(stats.ulpHistogram[0], 300u - ulps.size());
+    EXPECT_EQ(stats.ulpHistogram[1], 1u);
+    EXPECT_EQ(stats.ulpHistogram[2], 2u);
+    EXPECT_EQ(stats.ulpHistogram[3], 2u);
+    EXPECT_EQ(stats.ulpHistogram[4], 1u);
+    EXPECT_EQ(stats.ulpHistogram[7], 1u);
+    EXPECT_GT(stats.meanRelativeError(), 0.0);
+    EXPECT_LT(stats.meanRelativeError(), stats.maxRelativeError);
+
+    // The default tolerance is 10 eps of relative error
+    EXPECT_FALSE(stats.passed);
+    EXPECT_TRUE(compareUlps<float32_t>({15u}, 16u, 16u).passed);
+}
+
+TEST(CompareTest, NarrowTypes)
+{
+    using namespace rocwmma;
+
+    // ULPs are counted in the precision of the compared type
+    EXPECT_EQ(compareUlps<float16_t>({3u}, 16u, 16u).maxUlp, 3u);
+    EXPECT_EQ(compareUlps<bfloat16_t>({3u}, 16u, 16u).maxUlp, 3u);
+    EXPECT_EQ(compareUlps<float8_t>({3u}, 16u, 16u).maxUlp, 3u);
+    EXPECT_EQ(compareUlps<bfloat8_t>({1u}, 16u, 16u).maxUlp, 1u);
+}
+
+TEST(CompareTest, NonFinite)
+{
+    using namespace rocwmma;
+
+    std::vector<float32_t> result(64u * 64u, 1.0f), reference(64u * 64u, 1.0f);
+    result[5]   = std::numeric_limits<float32_t>::infinity();
+    result[700] = std::numeric_limits<float32_t>::quiet_NaN();
+    result[900] = 2.0f;
+
+    auto stats = compareStats<float32_t, float32_t, row_major, row_major>(
+        result.data(), reference.data(), 64u, 64u, 64u, 64u);
+    EXPECT_FALSE(stats.passed);
+    EXPECT_EQ(stats.infCount, 1u);
+    EXPECT_EQ(stats.nanCount, 1u);
+    EXPECT_EQ(stats.ulpHistogram[0], 64u * 64u - 3u);
+    EXPECT_DOUBLE_EQ(stats.maxRelativeError, 0.25);
+
+    auto result2 = compareEqual<float32_t, float32_t, row_major, row_major>(
+        result.data(), reference.data(), 64u, 64u);
+    EXPECT_FALSE(std::get<0>(result2));
+    EXPECT_TRUE(std::isinf(std::get<1>(result2)));
+}
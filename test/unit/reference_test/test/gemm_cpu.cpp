@@ -0,0 +1,171 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "common.hpp"
+#include "reference.hpp"
+#include "rocwmma_logging.hpp"
+
+namespace rocwmma
+{
+    // The blocked reference must reproduce the naive triple loop bit for bit
+    template <typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    void runGemmCPU(uint32_t m, uint32_t n, uint32_t k)
+    {
+        std::vector<InputT>  a(m * k), b(k * n);
+        std::vector<OutputT> c(m * n), d(m * n), dRef(m * n);
+        MatrixUtil<LayoutA>::fill(a, m, k);
+        MatrixUtil<LayoutB>::fill(b, k, n);
+        MatrixUtil<LayoutC>::fill(c, m, n);
+
+        auto alpha = static_cast<ComputeT>(2);
+        auto beta  = static_cast<ComputeT>(-1);
+
+        gemm_CPU<InputT, OutputT, ComputeT, LayoutA, LayoutB, LayoutC, LayoutD>(
+            m, n, k, a.data(), b.data(), c.data(), d.data(), alpha, beta);
+        gemm_CPU_naive<InputT, OutputT, ComputeT, LayoutA, LayoutB, LayoutC, LayoutD>(
+            m, n, k, a.data(), b.data(), c.data(), dRef.data(), alpha, beta);
+
+        EXPECT_EQ(std::memcmp(d.data(), dRef.data(), d.size() * sizeof(OutputT)), 0)
+            << dataTypeToString<InputT>() << " " << dataTypeToString<LayoutA>()
+            << dataTypeToString<LayoutB>() << dataTypeToString<LayoutC>()
+            << dataTypeToString<LayoutD>() << " " << m << "x" << n << "x" << k;
+    }
+
+    template <typename InputT, typename OutputT, typename ComputeT>
+    void runGemmCPULayouts(uint32_t m, uint32_t n, uint32_t k)
+    {
+        runGemmCPU<InputT, OutputT, ComputeT, row_major, row_major, row_major, row_major>(m, n, k);
+        runGemmCPU<InputT, OutputT, ComputeT, row_major, col_major, col_major, row_major>(m, n, k);
+        runGemmCPU<InputT, OutputT, ComputeT, col_major, row_major, row_major, col_major>(m, n, k);
+        runGemmCPU<InputT, OutputT, ComputeT, col_major, col_major, col_major, col_major>(m, n, k);
+    }
+
+    // Sizes both within a single block, and with partial blocks and micro tiles in every
+    // dimension, as well as degenerate problems.
+    template <typename InputT, typename OutputT, typename ComputeT>
+    void runGemmCPUSizes()
+    {
+        runGemmCPULayouts<InputT, OutputT, ComputeT>(16u, 16u, 16u);
+        runGemmCPULayouts<InputT, OutputT, ComputeT>(67u, 131u, 263u);
+        runGemmCPULayouts<InputT, OutputT, ComputeT>(130u, 257u, 515u);
+        runGemmCPULayouts<InputT, OutputT, ComputeT>(1u, 3u, 7u);
+        runGemmCPULayouts<InputT, OutputT, ComputeT>(5u, 9u, 0u);
+    }
+
+} // namespace rocwmma
+
+TEST(ReferenceTest, GemmCPUf32)
+{
+    rocwmma::runGemmCPUSizes<rocwmma::float32_t, rocwmma::float32_t, rocwmma::float32_t>();
+}
+
+TEST(ReferenceTest, GemmCPUf64)
+{
+    rocwmma::runGemmCPUSizes<rocwmma::float64_t, rocwmma::float64_t, rocwmma::float64_t>();
+}
+
+TEST(ReferenceTest, GemmCPUf16)
+{
+    rocwmma::runGemmCPUSizes<rocwmma::float16_t, rocwmma::float16_t, rocwmma::float32_t>();
+    rocwmma::runGemmCPUSizes<rocwmma::float16_t, rocwmma::float32_t, rocwmma::float32_t>();
+}
+
+TEST(ReferenceTest, GemmCPUbf16)
+{
+    rocwmma::runGemmCPUSizes<rocwmma::bfloat16_t, rocwmma::bfloat16_t, rocwmma::float32_t>();
+}
+
+TEST(ReferenceTest, GemmCPUi8)
+{
+    rocwmma::runGemmCPUSizes<rocwmma::int8_t, rocwmma::int32_t, rocwmma::int32_t>();
+}
+
+TEST(ReferenceTest, GemmCPUf8)
+{
+    rocwmma::runGemmCPUSizes<rocwmma::float8_t, rocwmma::float32_t, rocwmma::float32_t>();
+}
+
+TEST(ReferenceTest, GemmCPUbf8)
+{
+    rocwmma::runGemmCPUSizes<rocwmma::bfloat8_t, rocwmma::float32_t, rocwmma::float32_t>();
+}
+
+TEST(ReferenceTest, GemmCPUxf32)
+{
+    rocwmma::runGemmCPUSizes<rocwmma::xfloat32_t, rocwmma::float32_t, rocwmma::float32_t>();
+}
+
+#if ROCWMMA_BENCHMARK_TESTS
+
+// Reports the speedup of the blocked reference to the test output stream.
+// Timing is not asserted on, as it depends on the host.
+TEST(ReferenceTest, GemmCPUPerf)
+{
+    using namespace rocwmma;
+    using clock = std::chrono::steady_clock;
+
+    constexpr uint32_t Size = 1024u;
+
+    std::vector<float16_t> a(Size * Size), b(Size * Size);
+    std::vector<float32_t> c(Size * Size), d(Size * Size), dRef(Size * Size);
+    MatrixUtil<row_major>::fill(a, Size, Size);
+    MatrixUtil<col_major>::fill(b, Size, Size);
+    MatrixUtil<row_major>::fill(c, Size, Size);
+
+    auto start = clock::now();
+    gemm_CPU_naive<float16_t, float32_t, float32_t, row_major, col_major, row_major, row_major>(
+        Size, Size, Size, a.data(), b.data(), c.data(), dRef.data(), 2.0f, -1.0f);
+    auto naive = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+
+    start = clock::now();
+    gemm_CPU<float16_t, float32_t, float32_t, row_major, col_major, row_major, row_major>(
+        Size, Size, Size, a.data(), b.data(), c.data(), d.data(), 2.0f, -1.0f);
+    auto blocked = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+
+    auto& ostream = RocwmmaLogging::instance()->ostream();
+    if(ostream.isOpen())
+    {
+        ostream.fstream() << "gemm_CPU " << Size << "^3 f16 NT: naive " << naive
+                          << " ms, blocked " << blocked << " ms (" << naive / blocked << "x)"
+                          << std::endl;
+    }
+
+    EXPECT_EQ(std::memcmp(d.data(), dRef.data(), d.size() * sizeof(float32_t)), 0);
+}
+
+#endif // ROCWMMA_BENCHMARK_TESTS
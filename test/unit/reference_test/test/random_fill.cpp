@@ -0,0 +1,159 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+
+#include <algorithm>
+#include <set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "common.hpp"
+#include "random.hpp"
+
+namespace rocwmma
+{
+    // Random fill of M x N, returned in row_major order
+    template <typename DataT, typename Layout>
+    std::vector<DataT> fillRandomRowMajor(uint32_t m, uint32_t n, uint64_t seed, uint32_t stream)
+    {
+        std::vector<DataT> mat(m * n), result(m * n);
+        MatrixUtil<Layout>::fillRandom(mat, m, n, seed, stream);
+
+        for(uint32_t i = 0; i < m; i++)
+        {
+            for(uint32_t j = 0; j < n; j++)
+            {
+                auto idx          = std::is_same<Layout, row_major>::value ? i * n + j : j * m + i;
+                result[i * n + j] = mat[idx];
+            }
+        }
+        return result;
+    }
+
+    template <typename DataT>
+    void expectFillRange(uint32_t m, uint32_t n)
+    {
+        auto mat = fillRandomRowMajor<DataT, col_major>(m, n, 5u, 0u);
+
+        std::set<float> values;
+        for(auto const& value : mat)
+        {
+            values.insert(static_cast<float>(value));
+        }
+
+        auto expected = std::is_signed<DataT>::value
+                            ? std::set<float>{-2.0f, -1.0f, 0.0f, 1.0f, 2.0f}
+                            : std::set<float>{0.0f, 1.0f, 2.0f, 3.0f, 4.0f};
+        EXPECT_EQ(values, expected) << dataTypeToString<DataT>();
+    }
+
+} // namespace rocwmma
+
+TEST(RandomFillTest, Philox)
+{
+    using namespace rocwmma;
+
+    // Known answers of Philox4x32-10 from the Random123 distribution
+    auto expectBlock = [](Philox4x32::Block counter,
+                          uint32_t          key0,
+                          uint32_t          key1,
+                          Philox4x32::Block expected) {
+        auto result = Philox4x32::generate(counter, key0, key1);
+        for(uint32_t i = 0; i < 4u; i++)
+        {
+            EXPECT_EQ(result.data[i], expected.data[i]) << "Word " << i;
+        }
+    };
+
+    expectBlock({{0u, 0u, 0u, 0u}}, 0u, 0u, {{0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u}});
+    expectBlock({{0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu}},
+                0xffffffffu,
+                0xffffffffu,
+                {{0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu}});
+    expectBlock({{0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u}},
+                0xa4093822u,
+                0x299f31d0u,
+                {{0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u}});
+}
+
+TEST(RandomFillTest, Layouts)
+{
+    using namespace rocwmma;
+
+    // Both layouts hold the same logical matrix
+    auto rowMajor = fillRandomRowMajor<float32_t, row_major>(67u, 129u, 11u, 1u);
+    auto colMajor = fillRandomRowMajor<float32_t, col_major>(67u, 129u, 11u, 1u);
+    EXPECT_EQ(rowMajor, colMajor);
+
+    // Elements are a pure function of their logical index
+    for(uint32_t i = 0; i < rowMajor.size(); i++)
+    {
+        ASSERT_EQ(rowMajor[i], randomFillValue<float32_t>(11u, 1u, i));
+    }
+
+    // Batches continue the element indices of the previous batch
+    std::vector<float32_t> single(67u * 129u), batched(67u * 129u * 3u);
+    MatrixUtil<col_major>::fillRandom(single, 67u, 129u, 11u, 1u);
+    MatrixUtil<col_major>::fillRandom(batched.data(), 67u, 129u, 3u, 11u, 1u);
+    EXPECT_TRUE(std::equal(single.begin(), single.end(), batched.begin()));
+
+    // Last row of the last batch
+    auto batchOffset = 2u * 67u * 129u;
+    for(uint32_t j = 0; j < 129u; j++)
+    {
+        ASSERT_EQ(batched[batchOffset + j * 67u + 66u],
+                  randomFillValue<float32_t>(11u, 1u, batchOffset + 66u * 129u + j));
+    }
+}
+
+TEST(RandomFillTest, Streams)
+{
+    using namespace rocwmma;
+
+    auto base        = fillRandomRowMajor<float32_t, row_major>(64u, 64u, 0u, 0u);
+    auto otherSeed   = fillRandomRowMajor<float32_t, row_major>(64u, 64u, 1u, 0u);
+    auto otherStream = fillRandomRowMajor<float32_t, row_major>(64u, 64u, 0u, 1u);
+
+    EXPECT_EQ(base, (fillRandomRowMajor<float32_t, row_major>(64u, 64u, 0u, 0u)));
+    EXPECT_NE(base, otherSeed);
+    EXPECT_NE(base, otherStream);
+    EXPECT_NE(otherSeed, otherStream);
+}
+
+TEST(RandomFillTest, Range)
+{
+    using namespace rocwmma;
+
+    expectFillRange<float32_t>(64u, 64u);
+    expectFillRange<float64_t>(64u, 64u);
+    expectFillRange<float16_t>(64u, 64u);
+    expectFillRange<bfloat16_t>(64u, 64u);
+    expectFillRange<float8_t>(64u, 64u);
+    expectFillRange<int8_t>(64u, 64u);
+    expectFillRange<int32_t>(64u, 64u);
+    expectFillRange<uint8_t>(64u, 64u);
+}
@@ -0,0 +1,162 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <filesystem>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "reference_cache.hpp"
+
+namespace rocwmma
+{
+    // Fresh, empty cache directory for each test
+    inline std::string makeCacheDir(std::string const& name)
+    {
+        auto dir = std::filesystem::temp_directory_path() / ("rocwmma_ref_cache_" + name);
+        std::filesystem::remove_all(dir);
+        return dir.string();
+    }
+
+    inline ReferenceKey makeGemmKey(uint32_t m, float32_t alpha)
+    {
+        auto key = ReferenceKey("gemm_CPU");
+        key.field("m", m).type<float32_t>("InputT").bits("alpha", alpha);
+        return key;
+    }
+
+} // namespace rocwmma
+
+TEST(ReferenceCacheTest, Key)
+{
+    using namespace rocwmma;
+
+    EXPECT_EQ(makeGemmKey(16u, 1.0f).hash(), makeGemmKey(16u, 1.0f).hash());
+    EXPECT_NE(makeGemmKey(16u, 1.0f).hash(), makeGemmKey(32u, 1.0f).hash());
+
+    // Scalars are keyed by their exact bits
+    EXPECT_NE(makeGemmKey(16u, 0.0f).descriptor(), makeGemmKey(16u, -0.0f).descriptor());
+    EXPECT_NE(ReferenceKey("gemm_CPU", 0u).hash(), ReferenceKey("gemm_CPU", 1u).hash());
+}
+
+TEST(ReferenceCacheTest, Memory)
+{
+    using namespace rocwmma;
+
+    ReferenceCache cache("", 64u * sizeof(float32_t));
+
+    std::vector<float32_t> d(32u), dRef(32u);
+    for(uint32_t i = 0; i < d.size(); i++)
+    {
+        d[i] = static_cast<float32_t>(i);
+    }
+
+    uint32_t runs    = 0u;
+    auto     refFunc = [&]() {
+        dRef = d;
+        runs++;
+    };
+
+    auto key    = makeGemmKey(32u, 1.0f);
+    auto output = ReferenceBuffer{dRef.data(), dRef.size() * sizeof(float32_t)};
+    cache.run(key, {output}, refFunc);
+    std::fill(dRef.begin(), dRef.end(), -1.0f);
+    cache.run(key, {output}, refFunc);
+
+    EXPECT_EQ(runs, 1u);
+    EXPECT_EQ(dRef, d);
+    EXPECT_EQ(cache.memoryHits(), 1u);
+    EXPECT_EQ(cache.misses(), 1u);
+
+    // Outputs of a different size are a miss
+    std::vector<float32_t> small(16u);
+    EXPECT_FALSE(cache.fetch(key, {{small.data(), small.size() * sizeof(float32_t)}}));
+
+    // Oldest results are evicted beyond the memory budget
+    auto other = makeGemmKey(33u, 1.0f);
+    cache.store(other, {output});
+    cache.store(makeGemmKey(34u, 1.0f), {output});
+    EXPECT_FALSE(cache.fetch(key, {output}));
+    EXPECT_TRUE(cache.fetch(other, {output}));
+}
+
+TEST(ReferenceCacheTest, Disk)
+{
+    using namespace rocwmma;
+
+    auto dir = makeCacheDir("disk");
+    auto key = makeGemmKey(64u, 2.0f);
+
+    std::vector<float32_t> d(64u * 64u), grad(64u);
+    for(uint32_t i = 0; i < d.size(); i++)
+    {
+        d[i] = static_cast<float32_t>(i % 7) - 3.0f;
+    }
+    for(uint32_t i = 0; i < grad.size(); i++)
+    {
+        grad[i] = static_cast<float32_t>(i);
+    }
+
+    {
+        ReferenceCache cache(dir);
+        cache.store(key,
+                    {{d.data(), d.size() * sizeof(float32_t)},
+                     {grad.data(), grad.size() * sizeof(float32_t)}});
+    }
+
+    // A new process only finds the results on disk
+    std::vector<float32_t> dRef(d.size()), gradRef(grad.size());
+    std::vector<ReferenceBuffer> outputs = {{dRef.data(), dRef.size() * sizeof(float32_t)},
+                                            {gradRef.data(), gradRef.size() * sizeof(float32_t)}};
+
+    ReferenceCache cache(dir);
+    EXPECT_TRUE(cache.fetch(key, outputs));
+    EXPECT_EQ(dRef, d);
+    EXPECT_EQ(gradRef, grad);
+    EXPECT_EQ(cache.diskHits(), 1u);
+
+    // Disk hits are then served from memory
+    EXPECT_TRUE(cache.fetch(key, outputs));
+    EXPECT_EQ(cache.memoryHits(), 1u);
+
+    // Unknown problems, and files holding another problem, are misses
+    EXPECT_FALSE(cache.fetch(makeGemmKey(64u, 3.0f), outputs));
+
+    // Simulate a hash collision with the file of another problem
+    auto collision = makeGemmKey(65u, 2.0f);
+    std::ostringstream name;
+    name << std::hex << std::setfill('0') << std::setw(16) << collision.hash() << ".ref";
+    for(auto const& entry : std::filesystem::directory_iterator(dir))
+    {
+        std::filesystem::copy_file(entry.path(), std::filesystem::path(dir) / name.str());
+        break;
+    }
+    EXPECT_FALSE(ReferenceCache(dir).fetch(collision, outputs));
+
+    std::filesystem::remove_all(dir);
+}
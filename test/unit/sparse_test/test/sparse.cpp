@@ -0,0 +1,189 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <rocwmma/rocwmma_sparse.hpp>
+
+#include "common.hpp"
+#include "reference.hpp"
+
+namespace rocwmma
+{
+    // Host emulation of the sparse fragment load and sparse mma operand pairing.
+    // Each lane expands its compressed values with its metadata exactly as the
+    // smfmac does, which must reproduce the pruned block of A. The logical K of
+    // every expanded element must also match the K of the matrix_b element in the
+    // same lane and position, or the products would pair the wrong elements.
+    template <uint32_t BlockM, uint32_t BlockK, typename DataT>
+    void runSparseFragmentEmulation()
+    {
+        using Layout = detail::SparseLayout<BlockM, BlockM, BlockK, DataT>;
+        using FragB  = fragment<matrix_b, BlockM, BlockM, BlockK, DataT, col_major>;
+
+        auto ldv = BlockK / 2u;
+        auto ldi = (BlockK + Layout::MetadataWordK - 1u) / Layout::MetadataWordK;
+
+        std::vector<DataT>    a(BlockM * BlockK), pruned(BlockM * BlockK);
+        std::vector<DataT>    values(BlockM * ldv);
+        std::vector<uint32_t> metadata(BlockM * ldi);
+        MatrixUtil<row_major>::fill(a, BlockM, BlockK);
+
+        compress_2to4_CPU(a.data(), values.data(), metadata.data(), BlockM, BlockK);
+        decompress_2to4_CPU(values.data(), metadata.data(), pruned.data(), BlockM, BlockK);
+
+        std::vector<DataT>    expanded(BlockM * BlockK, static_cast<DataT>(0));
+        std::vector<uint32_t> visits(BlockM * BlockK, 0u);
+
+        for(uint32_t lane = 0; lane < Layout::WaveSize; lane++)
+        {
+            for(uint32_t v = 0; v < Layout::VectorCount; v++)
+            {
+                auto row = get<0>(Layout::vectorCoord(lane, v));
+                auto k0  = get<1>(Layout::vectorCoord(lane, v));
+
+                auto metadataCoord = Layout::metadataCoord(lane, v);
+                auto word = metadata[get<0>(metadataCoord) * ldi + get<1>(metadataCoord)];
+                auto vectorMetadata = Layout::vectorMetadata(lane, v, word);
+
+                for(uint32_t i = 0; i < Layout::ValueVW; i++)
+                {
+                    auto valueCoord = Layout::valueCoord(lane, v * Layout::ValueVW + i);
+                    auto k          = k0 + Layout::valueOffset(i, vectorMetadata);
+
+                    expanded[row * BlockK + k]
+                        = values[get<0>(valueCoord) * ldv + get<1>(valueCoord)];
+                }
+
+                for(uint32_t i = 0; i < Layout::DenseVW; i++)
+                {
+                    auto coordB = FragB::elementCoord(lane, v * Layout::DenseVW + i);
+                    EXPECT_EQ(get<0>(coordB), k0 + i)
+                        << "Lane " << lane << " vector " << v << " element " << i;
+
+                    visits[row * BlockK + k0 + i]++;
+                }
+            }
+        }
+
+        for(uint32_t i = 0; i < BlockM * BlockK; i++)
+        {
+            EXPECT_EQ(visits[i], 1u) << "Element " << i << " is not covered exactly once";
+            EXPECT_EQ(static_cast<float>(expanded[i]), static_cast<float>(pruned[i]))
+                << "Element " << i;
+        }
+    }
+
+} // namespace rocwmma
+
+TEST(SparseTest, CompressDecompress)
+{
+    using namespace rocwmma;
+    using DataT = float32_t;
+
+    constexpr uint32_t m = 17u, k = 72u;
+
+    auto ldi = (k + 31u) / 32u;
+
+    std::vector<DataT> a(m * k), pruned(m * k), values(m * k / 2u);
+    std::vector<uint32_t> metadata(m * ldi);
+    for(uint32_t i = 0; i < m * k; i++)
+    {
+        a[i] = static_cast<DataT>(static_cast<int32_t>((i * 7u) % 13u) - 6);
+    }
+
+    compress_2to4_CPU(a.data(), values.data(), metadata.data(), m, k);
+    decompress_2to4_CPU(values.data(), metadata.data(), pruned.data(), m, k);
+
+    for(uint32_t i = 0; i < m * k; i += 4u)
+    {
+        // At most two survivors per group, which are unchanged and of the largest magnitude
+        std::vector<float> magnitudes;
+        float              keptSum  = 0.0f;
+        uint32_t           nonZeros = 0u;
+        for(uint32_t j = i; j < i + 4u; j++)
+        {
+            EXPECT_TRUE(pruned[j] == a[j] || pruned[j] == 0.0f) << "Element " << j;
+            nonZeros += (pruned[j] != 0.0f);
+            keptSum += std::abs(pruned[j]);
+            magnitudes.push_back(std::abs(a[j]));
+        }
+        std::sort(magnitudes.begin(), magnitudes.end());
+
+        EXPECT_LE(nonZeros, 2u) << "Group " << i / 4u;
+        EXPECT_EQ(keptSum, magnitudes[2] + magnitudes[3]) << "Group " << i / 4u;
+    }
+}
+
+TEST(SparseTest, GemmReference)
+{
+    using namespace rocwmma;
+    using DataT = int8_t;
+
+    constexpr uint32_t m = 32u, n = 16u, k = 64u;
+
+    auto ldi = (k + 31u) / 32u;
+
+    std::vector<DataT>    a(m * k), pruned(m * k), values(m * k / 2u), b(k * n);
+    std::vector<int32_t>  c(m * n), d(m * n), dRef(m * n);
+    std::vector<uint32_t> metadata(m * ldi);
+    MatrixUtil<row_major>::fill(a, m, k);
+    MatrixUtil<col_major>::fill(b, k, n);
+    MatrixUtil<col_major>::fill(c, m, n);
+
+    compress_2to4_CPU(a.data(), values.data(), metadata.data(), m, k);
+    decompress_2to4_CPU(values.data(), metadata.data(), pruned.data(), m, k);
+
+    gemm_sparse_CPU<DataT, int32_t, int32_t, col_major, col_major, col_major>(
+        m, n, k, values.data(), metadata.data(), b.data(), c.data(), d.data(), 2, -1);
+    gemm_CPU<DataT, int32_t, int32_t, row_major, col_major, col_major, col_major>(
+        m, n, k, pruned.data(), b.data(), c.data(), dRef.data(), 2, -1);
+
+    EXPECT_EQ(d, dRef);
+}
+
+TEST(SparseTest, FragmentEmulationF16)
+{
+    using namespace rocwmma;
+    runSparseFragmentEmulation<16, 32, float16_t>();
+    runSparseFragmentEmulation<16, 64, float16_t>();
+    runSparseFragmentEmulation<32, 16, float16_t>();
+    runSparseFragmentEmulation<32, 64, float16_t>();
+}
+
+TEST(SparseTest, FragmentEmulationI8)
+{
+    using namespace rocwmma;
+    runSparseFragmentEmulation<16, 64, int8_t>();
+    runSparseFragmentEmulation<16, 128, int8_t>();
+    runSparseFragmentEmulation<32, 32, int8_t>();
+    runSparseFragmentEmulation<32, 64, int8_t>();
+}
@@ -147,6 +147,80 @@ namespace rocwmma
     using AossoaGenerator = TransformsGenerator<AossoaKernel>;
     using SoaaosGenerator = TransformsGenerator<SoaaosKernel>;
 
+    // Accumulator transforms use BlockM x BlockN accumulators, where VW is unused
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT>
+    struct AccumTransformsKernel : public TransformsKernel<BlockN, 1, DataT>
+    {
+        std::ostream& printHeader(std::ostream& stream = std::cout) const override
+        {
+            return stream << "WSize, DataT, BlockM, BlockN" << std::endl;
+        }
+
+        std::ostream& printKernel(std::ostream& stream = std::cout) const override
+        {
+            using DeviceInfo = HipDevice;
+            stream << "w" << DeviceInfo::instance()->warpSize() << ", " << dataTypeToString<DataT>()
+                   << ", " << BlockM << ", " << BlockN << std::endl;
+
+            return stream;
+        }
+    };
+
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT>
+    struct ReduceKernel : public AccumTransformsKernel<BlockM, BlockN, DataT>
+    {
+    protected:
+        using Base = TransformsKernelBase<DataT>;
+
+    public:
+        typename Base::KernelFunc kernelImpl() const override
+        {
+            return typename Base::KernelFunc(reduceTest<DataT, BlockM, BlockN>);
+        }
+    };
+
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT>
+    struct AccumConversionKernel : public AccumTransformsKernel<BlockM, BlockN, DataT>
+    {
+    protected:
+        using Base = TransformsKernelBase<DataT>;
+
+    public:
+        typename Base::KernelFunc kernelImpl() const override
+        {
+            return typename Base::KernelFunc(accumConversionTest<DataT, BlockM, BlockN>);
+        }
+    };
+
+    template <template <uint32_t BlockM, uint32_t BlockN, typename DataT> typename Func>
+    struct AccumTransformsGenerator
+    {
+        // Indices to test parameters
+        enum : uint32_t
+        {
+            BlockM = 0,
+            BlockN = 1,
+            DataT  = 2,
+        };
+
+        using ResultT = std::shared_ptr<KernelI>;
+
+        template <typename... Ts>
+        static ResultT generate(std::tuple<Ts...> testParams)
+        {
+            // Map GTest params to Kernel params
+            using TestParamsT = std::tuple<Ts...>;
+            using KernelT     = Func<std::tuple_element_t<BlockM, TestParamsT>::value, // BlockM
+                                 std::tuple_element_t<BlockN, TestParamsT>::value, // BlockN
+                                 std::tuple_element_t<DataT, TestParamsT> // DataT
+                                 >;
+
+            return std::make_shared<KernelT>();
+        }
+    };
+    using ReduceGenerator          = AccumTransformsGenerator<ReduceKernel>;
+    using AccumConversionGenerator = AccumTransformsGenerator<AccumConversionKernel>;
+
 } // namespace rocwmma
 
 #endif // ROCWMMA_DETAIL_TRANSFORMS_TEST_HPP
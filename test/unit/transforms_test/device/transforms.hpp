@@ -30,6 +30,7 @@
 #include "hip_device.hpp"
 #include "transforms.hpp"
 #include <rocwmma/rocwmma.hpp>
+#include <rocwmma/rocwmma_transforms.hpp>
 
 static constexpr uint32_t ERROR_VALUE   = 7u;
 static constexpr uint32_t SUCCESS_VALUE = 0u;
@@ -2600,6 +2601,177 @@ namespace rocwmma
         }
     }
 
+    // Accumulator values synthesized from their coordinates, which are
+    // small integers and therefore exact in every data and reduction type.
+    template <typename ReduceT>
+    ROCWMMA_DEVICE static inline ReduceT reduceTestValue(uint32_t row, uint32_t col)
+    {
+        return static_cast<ReduceT>((row * 3u + col * 5u) % 11u);
+    }
+
+    template <typename DataT, uint32_t BlockM, uint32_t BlockN, typename ReduceOp>
+    ROCWMMA_DEVICE static inline bool reduce_rows_cols()
+    {
+        using FragT   = fragment<accumulator, BlockM, BlockN, 1, DataT, row_major>;
+        using ReduceT = typename detail::AccumReduce<BlockM, BlockN, DataT>::ReduceT;
+
+        auto frag = FragT();
+        for(uint32_t i = 0; i < FragT::num_elements; i++)
+        {
+            auto coord = FragT::elementCoord(i);
+            frag[i]    = static_cast<DataT>(reduceTestValue<ReduceT>(get<0>(coord), get<1>(coord)));
+        }
+
+        auto rows = reduce_rows<ReduceOp>(frag);
+        auto cols = reduce_cols<ReduceOp>(frag);
+
+        // Compare each element with a serial reduction of its row and col
+        bool err = false;
+        for(uint32_t i = 0; i < FragT::num_elements; i++)
+        {
+            auto row = get<0>(FragT::elementCoord(i));
+            auto col = get<1>(FragT::elementCoord(i));
+
+            auto expectRow = reduceTestValue<ReduceT>(row, 0u);
+            for(uint32_t c = 1; c < BlockN; c++)
+            {
+                expectRow = ReduceOp{}(expectRow, reduceTestValue<ReduceT>(row, c));
+            }
+
+            auto expectCol = reduceTestValue<ReduceT>(0u, col);
+            for(uint32_t r = 1; r < BlockM; r++)
+            {
+                expectCol = ReduceOp{}(expectCol, reduceTestValue<ReduceT>(r, col));
+            }
+
+            err |= (rows[i] != static_cast<DataT>(expectRow));
+            err |= (cols[i] != static_cast<DataT>(expectCol));
+        }
+
+        return err;
+    }
+
+    template <typename DataT, uint32_t BlockM, uint32_t BlockN>
+    ROCWMMA_KERNEL void reduceTest(uint32_t     m,
+                                   uint32_t     n,
+                                   DataT const* in,
+                                   DataT*       out,
+                                   uint32_t     ld,
+                                   DataT        param1,
+                                   DataT        param2)
+    {
+        __shared__ int32_t result;
+        result = 0;
+        synchronize_workgroup();
+
+        bool err = false;
+
+        // Add tests here
+        err = err ? err : reduce_rows_cols<DataT, BlockM, BlockN, reduce_sum>();
+        err = err ? err : reduce_rows_cols<DataT, BlockM, BlockN, reduce_max>();
+        err = err ? err : reduce_rows_cols<DataT, BlockM, BlockN, reduce_min>();
+
+        // Reduce error count
+        atomicAdd(&result, (int32_t)err);
+
+        // Wait for all threads
+        synchronize_workgroup();
+
+        // Just need one thread to update output
+        if(threadIdx.x == 0 && threadIdx.y == 0 && threadIdx.z == 0 && blockIdx.x == 0
+           && blockIdx.y == 0 && blockIdx.z == 0)
+        {
+            out[0] = static_cast<DataT>(result == 0 ? SUCCESS_VALUE : ERROR_VALUE);
+        }
+    }
+
+    template <typename DataT,
+              typename OutputT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              typename MatrixT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE static inline bool accum_conversion()
+    {
+        constexpr uint32_t BlockNext = 16u;
+
+        using FragAcc = fragment<accumulator, BlockM, BlockN, 1, DataT, row_major>;
+        using FragOut
+            = ApplyAccumConversion_t<FragAcc, MatrixT, BlockNext, OutputT, DataLayoutT>;
+        using ValueT = typename detail::AccumConvert<BlockM, BlockN, DataT, FragOut>::PermuteT;
+
+        auto frag = FragAcc();
+        for(uint32_t i = 0; i < FragAcc::num_elements; i++)
+        {
+            auto coord = FragAcc::elementCoord(i);
+            frag[i]    = static_cast<DataT>(reduceTestValue<ValueT>(get<0>(coord), get<1>(coord)));
+        }
+
+        auto result = applyAccumConversion<MatrixT, BlockNext, OutputT, DataLayoutT>(frag);
+
+        // Each element must hold the accumulator value of the same coordinate
+        bool err = false;
+        for(uint32_t i = 0; i < FragOut::num_elements; i++)
+        {
+            auto coord  = FragOut::elementCoord(i);
+            auto expect = reduceTestValue<ValueT>(get<0>(coord), get<1>(coord));
+            err |= (result[i] != static_cast<OutputT>(expect));
+        }
+
+        return err;
+    }
+
+    template <typename DataT, typename OutputT, uint32_t BlockM, uint32_t BlockN>
+    ROCWMMA_DEVICE static inline bool accum_conversion_all()
+    {
+        bool err = false;
+        err = err ? err : accum_conversion<DataT, OutputT, BlockM, BlockN, matrix_a, row_major>();
+        err = err ? err : accum_conversion<DataT, OutputT, BlockM, BlockN, matrix_a, col_major>();
+        err = err ? err : accum_conversion<DataT, OutputT, BlockM, BlockN, matrix_b, row_major>();
+        err = err ? err : accum_conversion<DataT, OutputT, BlockM, BlockN, matrix_b, col_major>();
+        return err;
+    }
+
+    template <typename DataT, uint32_t BlockM, uint32_t BlockN>
+    ROCWMMA_KERNEL void accumConversionTest(uint32_t     m,
+                                            uint32_t     n,
+                                            DataT const* in,
+                                            DataT*       out,
+                                            uint32_t     ld,
+                                            DataT        param1,
+                                            DataT        param2)
+    {
+        __shared__ int32_t result;
+        result = 0;
+        synchronize_workgroup();
+
+        bool err = false;
+
+        // Add tests here
+        err = err ? err : accum_conversion_all<DataT, DataT, BlockM, BlockN>();
+
+#if !ROCWMMA_NO_HALF
+        // Narrowing conversion, as for back-to-back gemm
+        if constexpr(is_same_v<DataT, float32_t>)
+        {
+            err = err ? err : accum_conversion_all<DataT, float16_t, BlockM, BlockN>();
+        }
+#endif // !ROCWMMA_NO_HALF
+
+        // Reduce error count
+        atomicAdd(&result, (int32_t)err);
+
+        // Wait for all threads
+        synchronize_workgroup();
+
+        // Just need one thread to update output
+        if(threadIdx.x == 0 && threadIdx.y == 0 && threadIdx.z == 0 && blockIdx.x == 0
+           && blockIdx.y == 0 && blockIdx.z == 0)
+        {
+            out[0] = static_cast<DataT>(result == 0 ? SUCCESS_VALUE : ERROR_VALUE);
+        }
+    }
+
 } // namespace rocwmma
 
 #endif // ROCWMMA_DEVICE_TRANSFORMS_TEST_HPP
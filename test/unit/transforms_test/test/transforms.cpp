@@ -80,7 +80,54 @@ namespace rocwmma
     using AossoaTestParams = TestParams<AossoaGenerator, std::tuple<I<2>, I<4>, I<8>, I<16>>>;
     using SoaaosTestParams = TestParams<SoaaosGenerator, std::tuple<I<2>, I<4>, I<8>, I<16>>>;
 
+    template <typename GeneratorImpl>
+    struct AccumTestParams : public UnitTestParams
+    {
+        using Base = UnitTestParams;
+
+        using Types = typename Base::TestAllSizeTypes;
+
+        // Accumulator block sizes
+        using BlockM = std::tuple<I<16>, I<32>>;
+        using BlockN = std::tuple<I<16>, I<32>, I<64>, I<128>>;
+
+        using KernelParams = typename CombineLists<BlockM, BlockN, Types>::Result;
+
+        // Assemble the kernel generator
+        // Kernel: Accumulator transforms
+        using KernelGenerator = KernelGenerator<KernelParams, GeneratorImpl>;
+
+        // Sanity check for kernel generator
+        static_assert(std::is_same<typename GeneratorImpl::ResultT, typename Base::KernelT>::value,
+                      "Kernels from this generator do not match testing interface");
+
+        static inline std::vector<ThreadBlockT> threadBlocks()
+        {
+            auto warpSize = HipDevice::instance()->warpSize();
+            // clang-format off
+            return { {warpSize, 1}, {warpSize * 2, 1}, {warpSize * 4, 1}};
+            // clang-format on
+        }
+
+        static inline std::vector<ProblemSizeT> problemSizes()
+        {
+            // clang-format off
+            return { {1, 1} };
+            // clang-format on
+        }
+
+        static inline typename KernelGenerator::ResultT kernels()
+        {
+            return KernelGenerator::generate();
+        }
+    };
+
+    using ReduceTestParams          = AccumTestParams<ReduceGenerator>;
+    using AccumConversionTestParams = AccumTestParams<AccumConversionGenerator>;
+
 } // namespace rocwmma
 
 ROCWMMA_GENERATE_UNIT_GTEST_SUITE(AossoaTest, AossoaTestParams)
 ROCWMMA_GENERATE_UNIT_GTEST_SUITE(SoaaosTest, SoaaosTestParams)
+ROCWMMA_GENERATE_UNIT_GTEST_SUITE(ReduceTest, ReduceTestParams)
+ROCWMMA_GENERATE_UNIT_GTEST_SUITE(AccumConversionTest, AccumConversionTestParams)
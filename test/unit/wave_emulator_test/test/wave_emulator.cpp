@@ -0,0 +1,475 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <rocwmma/internal/dpp.hpp>
+#include <rocwmma/internal/swizzle.hpp>
+
+#include "common.hpp"
+#include "reference.hpp"
+#include "wave_emulator.hpp"
+
+namespace rocwmma
+{
+    // Element offset of (row, col) in the data layout
+    template <typename DataLayoutT>
+    inline uint32_t dataOffset(uint32_t row, uint32_t col, uint32_t ldm)
+    {
+        return DataLayout::Array1d<DataLayoutT>::fromMatrixCoord(make_coord2d(row, col), ldm);
+    }
+
+    // Loading and storing a fragment must copy every element of the block exactly
+    // once, and must not touch the padding of the leading dimension.
+    template <typename FragT>
+    void runRoundTrip()
+    {
+        using DataT       = GetDataType_t<FragT>;
+        using DataLayoutT = GetDataLayout_t<FragT>;
+        using Shape       = GetIOShape_t<FragT>;
+
+        constexpr uint32_t Rows = Shape::BlockHeight;
+        constexpr uint32_t Cols = Shape::BlockWidth;
+        constexpr uint32_t Ldm
+            = (std::is_same<DataLayoutT, row_major>::value ? Cols : Rows) + 3u;
+        constexpr uint32_t Lines = std::is_same<DataLayoutT, row_major>::value ? Rows : Cols;
+
+        std::vector<DataT> src(Lines * Ldm);
+        for(uint32_t i = 0; i < src.size(); i++)
+        {
+            src[i] = static_cast<DataT>(i % 251);
+        }
+        std::vector<DataT> dst(Lines * Ldm, std::numeric_limits<DataT>::quiet_NaN());
+
+        emulator::Fragment<FragT> frag;
+        emulator::load_matrix_sync(frag, src.data(), Ldm);
+        emulator::store_matrix_sync(dst.data(), frag, Ldm);
+
+        for(uint32_t row = 0; row < Rows; row++)
+        {
+            for(uint32_t col = 0; col < Cols; col++)
+            {
+                auto offset = dataOffset<DataLayoutT>(row, col, Ldm);
+                EXPECT_EQ(dst[offset], src[offset]) << "(" << row << ", " << col << ")";
+                dst[offset] = std::numeric_limits<DataT>::quiet_NaN();
+            }
+        }
+
+        // Only padding is left untouched
+        for(auto value : dst)
+        {
+            EXPECT_TRUE(std::isnan(value));
+        }
+    }
+
+    // Bounded IO zero-fills on load, and skips on store, outside of the extent
+    template <typename FragT>
+    void runBoundedIO(uint32_t rows, uint32_t cols)
+    {
+        using DataT       = GetDataType_t<FragT>;
+        using DataLayoutT = GetDataLayout_t<FragT>;
+        using Shape       = GetIOShape_t<FragT>;
+
+        constexpr uint32_t Rows = Shape::BlockHeight;
+        constexpr uint32_t Cols = Shape::BlockWidth;
+        constexpr uint32_t Ldm  = std::is_same<DataLayoutT, row_major>::value ? Cols : Rows;
+
+        std::vector<DataT> src(Rows * Cols, static_cast<DataT>(1));
+        std::vector<DataT> dst(Rows * Cols, static_cast<DataT>(-1));
+
+        emulator::Fragment<FragT> frag;
+        emulator::load_matrix_sync(frag, src.data(), Ldm, rows, cols);
+        emulator::store_matrix_sync(dst.data(), frag, Ldm);
+
+        emulator::Fragment<FragT> bounded;
+        emulator::fill_fragment(bounded, static_cast<DataT>(2));
+        emulator::store_matrix_sync(src.data(), bounded, Ldm, rows, cols);
+
+        for(uint32_t row = 0; row < Rows; row++)
+        {
+            for(uint32_t col = 0; col < Cols; col++)
+            {
+                bool inBounds = row < rows && col < cols;
+                auto offset   = dataOffset<DataLayoutT>(row, col, Ldm);
+                EXPECT_EQ(dst[offset], static_cast<DataT>(inBounds ? 1 : 0));
+                EXPECT_EQ(src[offset], static_cast<DataT>(inBounds ? 2 : 1));
+            }
+        }
+    }
+
+    // Each wave computes one BlockM x BlockN tile of D = A x B + C
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC>
+    void runTileGemm(uint32_t m, uint32_t n, uint32_t k)
+    {
+        using FragA   = fragment<matrix_a, BlockM, BlockN, BlockK, float32_t, LayoutA>;
+        using FragB   = fragment<matrix_b, BlockM, BlockN, BlockK, float32_t, LayoutB>;
+        using FragAcc = fragment<accumulator, BlockM, BlockN, BlockK, float32_t>;
+
+        auto lda = std::is_same<LayoutA, row_major>::value ? k : m;
+        auto ldb = std::is_same<LayoutB, row_major>::value ? n : k;
+        auto ldc = std::is_same<LayoutC, row_major>::value ? n : m;
+        auto layoutC
+            = std::is_same<LayoutC, row_major>::value ? mem_row_major : mem_col_major;
+
+        std::vector<float32_t> a(m * k), b(k * n), c(m * n), d(m * n), dRef(m * n);
+        MatrixUtil<LayoutA>::fill(a, m, k);
+        MatrixUtil<LayoutB>::fill(b, k, n);
+        MatrixUtil<LayoutC>::fill(c, m, n);
+
+        emulator::launch(
+            dim3(m / BlockM, n / BlockN), 1u, 0u, [&](emulator::Wave<>& wave) {
+                auto row = wave.blockIdx().x * BlockM;
+                auto col = wave.blockIdx().y * BlockN;
+
+                emulator::Fragment<FragA>   fragA;
+                emulator::Fragment<FragB>   fragB;
+                emulator::Fragment<FragAcc> fragAcc;
+                emulator::fill_fragment(fragAcc, 0.0f);
+
+                for(uint32_t i = 0; i < k; i += BlockK)
+                {
+                    emulator::load_matrix_sync(
+                        fragA, a.data() + dataOffset<LayoutA>(row, i, lda), lda);
+                    emulator::load_matrix_sync(
+                        fragB, b.data() + dataOffset<LayoutB>(i, col, ldb), ldb);
+                    emulator::mma_sync(fragAcc, fragA, fragB, fragAcc);
+                }
+
+                emulator::Fragment<FragAcc> fragC;
+                emulator::load_matrix_sync(
+                    fragC, c.data() + dataOffset<LayoutC>(row, col, ldc), ldc, layoutC);
+                for(uint32_t lane = 0; lane < wave.size(); lane++)
+                {
+                    for(uint32_t i = 0; i < FragAcc::num_elements; i++)
+                    {
+                        fragC(lane, i) = 2.0f * fragAcc(lane, i) + 0.5f * fragC(lane, i);
+                    }
+                }
+                emulator::store_matrix_sync(
+                    d.data() + dataOffset<LayoutC>(row, col, ldc), fragC, ldc, layoutC);
+            });
+
+        gemm_CPU<float32_t, float32_t, float32_t, LayoutA, LayoutB, LayoutC, LayoutC>(
+            m, n, k, a.data(), b.data(), c.data(), dRef.data(), 2.0f, 0.5f);
+
+        auto result
+            = compareEqual<float32_t, float32_t, LayoutC, LayoutC>(d.data(), dRef.data(), m, n);
+        EXPECT_TRUE(std::get<0>(result)) << "Max relative error: " << std::get<1>(result);
+    }
+
+    // Waves of a workgroup cooperatively stage a block in LDS, then each wave
+    // reads back the whole block after the barrier.
+    template <typename FragT, typename DataLayoutLds>
+    void runCoopStaging(uint32_t waveCount)
+    {
+        using DataT       = GetDataType_t<FragT>;
+        using DataLayoutT = GetDataLayout_t<FragT>;
+        using Shape       = GetIOShape_t<FragT>;
+
+        constexpr uint32_t Rows = Shape::BlockHeight;
+        constexpr uint32_t Cols = Shape::BlockWidth;
+        constexpr uint32_t Ldm  = std::is_same<DataLayoutT, row_major>::value ? Cols : Rows;
+        constexpr bool     IsSwizzled = !std::is_same<DataLayoutLds, void>::value;
+
+        std::vector<DataT> src(Rows * Cols);
+        for(uint32_t i = 0; i < src.size(); i++)
+        {
+            src[i] = static_cast<DataT>(i);
+        }
+        std::vector<DataT> dst(waveCount * Rows * Cols, static_cast<DataT>(-1));
+
+        emulator::launch(
+            dim3(1), waveCount, Rows * Cols * sizeof(DataT), [&](emulator::Wave<>& wave) {
+                emulator::Fragment<FragT> frag;
+                emulator::load_matrix_coop_sync(wave, frag, src.data(), Ldm);
+                if constexpr(IsSwizzled)
+                {
+                    emulator::store_matrix_coop_sync(wave.lds<DataT>(),
+                                                     frag,
+                                                     Ldm,
+                                                     wave.waveIndex(),
+                                                     wave.waveCount(),
+                                                     DataLayoutLds{});
+                }
+                else
+                {
+                    emulator::store_matrix_coop_sync(wave, wave.lds<DataT>(), frag, Ldm);
+                }
+
+                wave.syncthreads();
+
+                if constexpr(IsSwizzled)
+                {
+                    emulator::load_matrix_sync(frag, wave.lds<DataT>(), Ldm, DataLayoutLds{});
+                }
+                else
+                {
+                    emulator::load_matrix_sync(frag, wave.lds<DataT>(), Ldm);
+                }
+                emulator::store_matrix_sync(
+                    dst.data() + wave.waveIndex() * Rows * Cols, frag, Ldm);
+            });
+
+        for(uint32_t w = 0; w < waveCount; w++)
+        {
+            for(uint32_t i = 0; i < src.size(); i++)
+            {
+                EXPECT_EQ(dst[w * Rows * Cols + i], src[i]) << "wave " << w << ", element " << i;
+            }
+        }
+    }
+
+} // namespace rocwmma
+
+TEST(WaveEmulatorTest, LoadStoreRoundTrip)
+{
+    using namespace rocwmma;
+    runRoundTrip<fragment<matrix_a, 16, 16, 16, float32_t, row_major>>();
+    runRoundTrip<fragment<matrix_a, 16, 16, 16, float32_t, col_major>>();
+    runRoundTrip<fragment<matrix_b, 32, 32, 8, float32_t, row_major>>();
+    runRoundTrip<fragment<matrix_b, 32, 32, 8, float32_t, col_major>>();
+    runRoundTrip<fragment<accumulator, 16, 16, 16, float32_t, row_major>>();
+    runRoundTrip<fragment<accumulator, 16, 16, 4, float64_t, col_major>>();
+}
+
+TEST(WaveEmulatorTest, AccumulatorMapping)
+{
+    using namespace rocwmma;
+    using FragRow  = fragment<accumulator, 32, 32, 8, float32_t, row_major>;
+    using FragCol  = fragment<accumulator, 32, 32, 8, float32_t, col_major>;
+    using FragVoid = fragment<accumulator, 32, 32, 8, float32_t>;
+
+    // Accumulator registers hold the same elements in either data layout
+    for(uint32_t lane = 0; lane < Constants::AMDGCN_WAVE_SIZE; lane++)
+    {
+        for(uint32_t i = 0; i < FragRow::num_elements; i++)
+        {
+            auto rowCoord = FragRow::elementCoord(lane, i);
+            auto colCoord = FragCol::elementCoord(lane, i);
+            EXPECT_EQ(get<0>(rowCoord), get<0>(colCoord)) << "lane " << lane << ", element " << i;
+            EXPECT_EQ(get<1>(rowCoord), get<1>(colCoord)) << "lane " << lane << ", element " << i;
+        }
+    }
+
+    std::vector<float32_t> src(32 * 32);
+    MatrixUtil<col_major>::fill(src, 32, 32);
+
+    emulator::Fragment<FragCol>  fragCol;
+    emulator::Fragment<FragVoid> fragVoid;
+    emulator::load_matrix_sync(fragCol, src.data(), 32);
+    emulator::load_matrix_sync(fragVoid, src.data(), 32, mem_col_major);
+    for(uint32_t lane = 0; lane < Constants::AMDGCN_WAVE_SIZE; lane++)
+    {
+        for(uint32_t i = 0; i < FragCol::num_elements; i++)
+        {
+            EXPECT_EQ(fragCol(lane, i), fragVoid(lane, i));
+        }
+    }
+}
+
+TEST(WaveEmulatorTest, BoundedIO)
+{
+    using namespace rocwmma;
+    runBoundedIO<fragment<matrix_a, 16, 16, 16, float32_t, row_major>>(5, 11);
+    runBoundedIO<fragment<matrix_b, 32, 32, 8, float32_t, col_major>>(7, 1);
+    runBoundedIO<fragment<accumulator, 16, 16, 16, float32_t, col_major>>(16, 3);
+    runBoundedIO<fragment<accumulator, 16, 16, 16, float32_t, row_major>>(0, 16);
+}
+
+TEST(WaveEmulatorTest, TileGemm)
+{
+    using namespace rocwmma;
+    runTileGemm<16, 16, 16, row_major, col_major, row_major>(64, 32, 48);
+    runTileGemm<16, 16, 16, col_major, row_major, col_major>(32, 64, 32);
+    runTileGemm<32, 32, 8, col_major, col_major, row_major>(64, 64, 16);
+}
+
+TEST(WaveEmulatorTest, CoopStaging)
+{
+    using namespace rocwmma;
+    using FragA = fragment<matrix_a, 32, 32, 32, float32_t, row_major>;
+    using FragB = fragment<matrix_b, 32, 32, 16, float32_t, col_major>;
+
+    runCoopStaging<FragA, void>(1);
+    runCoopStaging<FragA, void>(4);
+    runCoopStaging<FragB, void>(2);
+    runCoopStaging<FragA, xor_swizzle<8, 4>>(4);
+    runCoopStaging<FragB, xor_swizzle<4, 4, 2>>(2);
+}
+
+TEST(WaveEmulatorTest, CoopWaveCount)
+{
+    using namespace rocwmma;
+    using FragT = fragment<matrix_a, 16, 16, 32, float32_t, col_major>;
+
+    std::vector<float32_t> src(16 * 32);
+    MatrixUtil<col_major>::fill(src, 16, 32);
+
+    // Static and runtime wave counts split the same block between the waves
+    std::vector<float32_t> dst(16 * 32, -1.0f);
+    for(uint32_t w = 0; w < 4; w++)
+    {
+        emulator::Fragment<FragT> frag;
+        emulator::load_matrix_coop_sync<4>(frag, src.data(), 16, w);
+        emulator::store_matrix_coop_sync<4>(dst.data(), frag, 16, w);
+    }
+    EXPECT_EQ(dst, src);
+
+    std::fill(dst.begin(), dst.end(), -1.0f);
+    for(uint32_t w = 0; w < 4; w++)
+    {
+        emulator::Fragment<FragT> frag;
+        emulator::load_matrix_coop_sync(frag, src.data(), 16, w, 4);
+        emulator::store_matrix_coop_sync(dst.data(), frag, 16, w, 4);
+    }
+    EXPECT_EQ(dst, src);
+}
+
+TEST(WaveEmulatorTest, Transforms)
+{
+    using namespace rocwmma;
+    using FragA   = fragment<matrix_a, 16, 16, 16, float32_t, row_major>;
+    using FragAcc = fragment<accumulator, 16, 16, 16, float32_t, row_major>;
+
+    std::vector<float32_t> src(16 * 16), dst(16 * 16);
+    MatrixUtil<row_major>::fill(src, 16, 16);
+
+    // Transpose of a row_major block is the col_major block of the same memory
+    emulator::Fragment<FragA> fragA;
+    emulator::load_matrix_sync(fragA, src.data(), 16);
+    emulator::store_matrix_sync(dst.data(), emulator::applyTranspose(fragA), 16);
+    EXPECT_EQ(dst, src);
+
+    // A new data layout keeps the block
+    emulator::store_matrix_sync(dst.data(), emulator::applyDataLayout<col_major>(fragA), 16);
+    for(uint32_t row = 0; row < 16; row++)
+    {
+        for(uint32_t col = 0; col < 16; col++)
+        {
+            EXPECT_EQ(dst[dataOffset<col_major>(row, col, 16)],
+                      src[dataOffset<row_major>(row, col, 16)]);
+        }
+    }
+
+    // Accumulators become inputs of the next multiplication over the same block
+    emulator::Fragment<FragAcc> fragAcc;
+    emulator::load_matrix_sync(fragAcc, src.data(), 16);
+    emulator::store_matrix_sync(
+        dst.data(),
+        emulator::applyAccumConversion<matrix_a, 16, float32_t, row_major>(fragAcc),
+        16);
+    EXPECT_EQ(dst, src);
+}
+
+TEST(WaveEmulatorTest, DppMasking)
+{
+    using namespace rocwmma;
+    emulator::LaneRegister<uint32_t> src, prev;
+    for(uint32_t lane = 0; lane < src.size(); lane++)
+    {
+        src[lane]  = lane;
+        prev[lane] = 1000u + lane;
+    }
+
+    // Rows 1 and 3 are masked, and keep their previous values
+    auto result = emulator::dpp<DppImpl::Ops::Reverse16, 0x5>(src, prev);
+    for(uint32_t lane = 0; lane < src.size(); lane++)
+    {
+        auto row = lane / 16u;
+        EXPECT_EQ(result[lane], (row % 2u == 0u) ? row * 16u + 15u - lane % 16u : prev[lane]);
+    }
+}
+
+TEST(WaveEmulatorTest, Wave32CrossLane)
+{
+    using namespace rocwmma;
+    emulator::LaneRegister<uint32_t, 32> src;
+    for(uint32_t lane = 0; lane < src.size(); lane++)
+    {
+        src[lane] = lane;
+    }
+
+    auto reversed = emulator::swizzle<SwizzleImpl::Ops::Reverse32>(src);
+    auto rotated  = emulator::swizzle<SwizzleImpl::Ops::RotateR16<3>>(src);
+    for(uint32_t lane = 0; lane < src.size(); lane++)
+    {
+        EXPECT_EQ(reversed[lane], 31u - lane);
+        EXPECT_EQ(rotated[lane], (lane & ~15u) + (lane + 13u) % 16u);
+    }
+}
+
+TEST(WaveEmulatorTest, BarrierWithExitedWaves)
+{
+    using namespace rocwmma;
+    std::vector<uint32_t> dst(4, 0u);
+
+    // Waves that exit early must not hold the others at the barrier
+    emulator::launch(dim3(2), 4u, 4u * sizeof(uint32_t), [&](emulator::Wave<>& wave) {
+        if(wave.waveIndex() == 0u)
+        {
+            return;
+        }
+
+        auto* lds             = wave.lds<uint32_t>();
+        lds[wave.waveIndex()] = wave.waveIndex() + wave.blockIdx().x;
+        wave.syncthreads();
+
+        auto next  = wave.waveIndex() % 3u + 1u;
+        auto value = lds[next];
+        wave.syncthreads();
+
+        lds[wave.waveIndex()] = value;
+        wave.syncthreads();
+
+        if(wave.blockIdx().x == 1u)
+        {
+            dst[wave.waveIndex()] = lds[wave.waveIndex()];
+        }
+    });
+
+    EXPECT_EQ(dst, (std::vector<uint32_t>{0u, 3u, 4u, 2u}));
+
+    // Errors in any wave are reported by the launch
+    EXPECT_THROW(emulator::launch(dim3(1), 2u, 0u,
+                                  [](emulator::Wave<>& wave) {
+                                      wave.syncthreads();
+                                      if(wave.waveIndex() == 1u)
+                                      {
+                                          throw std::runtime_error("wave error");
+                                      }
+                                  }),
+                 std::runtime_error);
+}
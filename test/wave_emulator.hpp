@@ -0,0 +1,365 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_TEST_WAVE_EMULATOR_HPP
+#define ROCWMMA_TEST_WAVE_EMULATOR_HPP
+
+#include <array>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+#include <rocwmma/rocwmma.hpp>
+#include <rocwmma/rocwmma_coop.hpp>
+#include <rocwmma/rocwmma_transforms.hpp>
+
+namespace rocwmma
+{
+    // Host emulation of wavefronts for validating fragment layouts and kernel
+    // logic without a GPU. Each wave executes every operation for all of its
+    // lanes before the next operation begins, so lanes run in lock-step. The
+    // waves of a workgroup run concurrently on host threads, and share LDS
+    // and a barrier.
+    //
+    // Kernels are written against the emulator API below, which mirrors the
+    // rocWMMA API on emulator::Fragment. Device kernel bodies themselves are
+    // not compiled for, nor run on, the host.
+    //
+    // Fragment operations take the matrix coordinate of each register element
+    // from fragment::elementCoord, the same MatrixLayout mapping that the device
+    // load / store unrolls. On host that mapping is compiled for wave64, so
+    // fragment operations are limited to WaveSize == 64. Launches, LDS, barriers
+    // and cross-lane operations accept 32 or 64 lanes.
+    //
+    // Not emulated:
+    // - Wave32 fragment layouts of gfx11 / gfx12 targets.
+    // - The MFMA / WMMA register layouts of A, B and the accumulator within
+    //   mma_sync. D = A x B + C is computed on the matrix, in ComputeT and in
+    //   k order, then placed by the accumulator IO layout. Hardware rounding
+    //   and summation order are therefore not reproduced.
+    // - Async loads, waitcnt, cache policies and buffer IO. Every memory
+    //   access takes effect immediately, in program order.
+    namespace emulator
+    {
+        // One vector register: a single value per lane
+        template <typename DataT, uint32_t WaveSize = Constants::AMDGCN_WAVE_SIZE>
+        struct LaneRegister : public std::array<DataT, WaveSize>
+        {
+        };
+
+        // Unpacked fragment elements of every lane in the wave
+        template <typename FragT, uint32_t WaveSize = Constants::AMDGCN_WAVE_SIZE>
+        class Fragment
+        {
+        public:
+            using Type  = FragT;
+            using DataT = GetDataType_t<FragT>;
+
+            constexpr static uint32_t Size = FragT::num_elements;
+
+            static_assert(WaveSize == Constants::AMDGCN_WAVE_SIZE,
+                          "Fragment layouts on host are those of wave64 targets");
+
+            Fragment();
+
+            DataT&       operator()(uint32_t lane, uint32_t index);
+            DataT const& operator()(uint32_t lane, uint32_t index) const;
+
+        private:
+            std::vector<DataT> mData;
+        };
+
+        namespace detail
+        {
+            // Workgroup state shared between its waves
+            class Workgroup
+            {
+            public:
+                Workgroup(uint32_t waveCount, uint32_t ldsBytes);
+
+                uint32_t waveCount() const;
+                uint32_t ldsBytes() const;
+                void*    lds();
+
+                // Blocks until every wave that has not exited arrives
+                void barrier();
+
+                // Exited waves no longer take part in barriers, as on device
+                void retire();
+
+            private:
+                // Opens the barrier, with the mutex held
+                void release();
+
+                std::mutex              mMutex;
+                std::condition_variable mCondition;
+                uint32_t                mWaveCount;
+                uint32_t                mActiveWaves;
+                uint32_t                mArrivedWaves;
+                uint64_t                mGeneration;
+                std::vector<uint8_t>    mLds;
+            };
+
+        } // namespace detail
+
+        // Execution context of one wave, passed to the emulated kernel
+        template <uint32_t WaveSize = Constants::AMDGCN_WAVE_SIZE>
+        class Wave
+        {
+        public:
+            Wave(detail::Workgroup& workgroup, dim3 blockIdx, uint32_t waveIndex);
+
+            constexpr static uint32_t size();
+
+            dim3     blockIdx() const;
+            uint32_t waveIndex() const;
+            uint32_t waveCount() const;
+
+            // Flat thread index of the lane within the workgroup
+            uint32_t threadId(uint32_t lane) const;
+
+            // Workgroup shared memory
+            template <typename DataT>
+            DataT*   lds() const;
+            uint32_t ldsBytes() const;
+
+            // Workgroup barrier, as __syncthreads()
+            void syncthreads() const;
+
+            // Runs func(lane) for every lane of the wave
+            template <typename Func>
+            void forEachLane(Func&& func) const;
+
+        private:
+            detail::Workgroup& mWorkgroup;
+            dim3               mBlockIdx;
+            uint32_t           mWaveIndex;
+        };
+
+        // Runs kernel(Wave<WaveSize>&) for waveCount waves in each workgroup of the grid.
+        // Workgroups run one after another. Exceptions thrown by any wave are rethrown.
+        template <uint32_t WaveSize = Constants::AMDGCN_WAVE_SIZE, typename KernelT>
+        void launch(dim3 gridDim, uint32_t waveCount, uint32_t ldsBytes, KernelT&& kernel);
+
+        ///
+        /// Fragment operations
+        ///
+
+        template <typename FragT, uint32_t WaveSize>
+        void fill_fragment(Fragment<FragT, WaveSize>& frag, GetDataType_t<FragT> value);
+
+        template <typename FragT, uint32_t WaveSize>
+        void load_matrix_sync(Fragment<FragT, WaveSize>& frag,
+                              GetDataType_t<FragT> const* data,
+                              uint32_t                    ldm);
+
+        template <typename FragT, uint32_t WaveSize>
+        void load_matrix_sync(Fragment<FragT, WaveSize>& frag,
+                              GetDataType_t<FragT> const* data,
+                              uint32_t                    ldm,
+                              layout_t                    layout);
+
+        // Elements outside of the (rows, cols) extent are zero-filled
+        template <typename FragT, uint32_t WaveSize>
+        void load_matrix_sync(Fragment<FragT, WaveSize>& frag,
+                              GetDataType_t<FragT> const* data,
+                              uint32_t                    ldm,
+                              uint32_t                    rows,
+                              uint32_t                    cols);
+
+        template <typename FragT,
+                  uint32_t WaveSize,
+                  uint32_t ChunkSize,
+                  uint32_t ChunkCount,
+                  uint32_t LineGroup>
+        void load_matrix_sync(Fragment<FragT, WaveSize>&                    frag,
+                              GetDataType_t<FragT> const*                   data,
+                              uint32_t                                      ldm,
+                              xor_swizzle<ChunkSize, ChunkCount, LineGroup> swizzle);
+
+        template <typename FragT, uint32_t WaveSize>
+        void store_matrix_sync(GetDataType_t<FragT>*            data,
+                               Fragment<FragT, WaveSize> const& frag,
+                               uint32_t                         ldm);
+
+        template <typename FragT, uint32_t WaveSize>
+        void store_matrix_sync(GetDataType_t<FragT>*            data,
+                               Fragment<FragT, WaveSize> const& frag,
+                               uint32_t                         ldm,
+                               layout_t                         layout);
+
+        // Elements outside of the (rows, cols) extent are not written
+        template <typename FragT, uint32_t WaveSize>
+        void store_matrix_sync(GetDataType_t<FragT>*            data,
+                               Fragment<FragT, WaveSize> const& frag,
+                               uint32_t                         ldm,
+                               uint32_t                         rows,
+                               uint32_t                         cols);
+
+        template <typename FragT,
+                  uint32_t WaveSize,
+                  uint32_t ChunkSize,
+                  uint32_t ChunkCount,
+                  uint32_t LineGroup>
+        void store_matrix_sync(GetDataType_t<FragT>*                         data,
+                               Fragment<FragT, WaveSize> const&              frag,
+                               uint32_t                                      ldm,
+                               xor_swizzle<ChunkSize, ChunkCount, LineGroup> swizzle);
+
+        // Cooperative IO only touches the fragment elements of the given wave
+        template <typename FragT, uint32_t WaveSize>
+        void load_matrix_coop_sync(Fragment<FragT, WaveSize>& frag,
+                                   GetDataType_t<FragT> const* data,
+                                   uint32_t                    ldm,
+                                   uint32_t                    waveIndex,
+                                   uint32_t                    waveCount);
+
+        template <uint32_t WaveCount, typename FragT, uint32_t WaveSize>
+        void load_matrix_coop_sync(Fragment<FragT, WaveSize>& frag,
+                                   GetDataType_t<FragT> const* data,
+                                   uint32_t                    ldm,
+                                   uint32_t                    waveIndex);
+
+        template <typename FragT, uint32_t WaveSize>
+        void load_matrix_coop_sync(Wave<WaveSize> const&       wave,
+                                   Fragment<FragT, WaveSize>&  frag,
+                                   GetDataType_t<FragT> const* data,
+                                   uint32_t                    ldm);
+
+        template <typename FragT, uint32_t WaveSize>
+        void store_matrix_coop_sync(GetDataType_t<FragT>*            data,
+                                    Fragment<FragT, WaveSize> const& frag,
+                                    uint32_t                         ldm,
+                                    uint32_t                         waveIndex,
+                                    uint32_t                         waveCount);
+
+        template <typename FragT,
+                  uint32_t WaveSize,
+                  uint32_t ChunkSize,
+                  uint32_t ChunkCount,
+                  uint32_t LineGroup>
+        void load_matrix_coop_sync(Fragment<FragT, WaveSize>&                    frag,
+                                   GetDataType_t<FragT> const*                   data,
+                                   uint32_t                                      ldm,
+                                   uint32_t                                      waveIndex,
+                                   uint32_t                                      waveCount,
+                                   xor_swizzle<ChunkSize, ChunkCount, LineGroup> swizzle);
+
+        template <typename FragT,
+                  uint32_t WaveSize,
+                  uint32_t ChunkSize,
+                  uint32_t ChunkCount,
+                  uint32_t LineGroup>
+        void store_matrix_coop_sync(GetDataType_t<FragT>*                         data,
+                                    Fragment<FragT, WaveSize> const&              frag,
+                                    uint32_t                                      ldm,
+                                    uint32_t                                      waveIndex,
+                                    uint32_t                                      waveCount,
+                                    xor_swizzle<ChunkSize, ChunkCount, LineGroup> swizzle);
+
+        template <uint32_t WaveCount, typename FragT, uint32_t WaveSize>
+        void store_matrix_coop_sync(GetDataType_t<FragT>*            data,
+                                    Fragment<FragT, WaveSize> const& frag,
+                                    uint32_t                         ldm,
+                                    uint32_t                         waveIndex);
+
+        template <typename FragT, uint32_t WaveSize>
+        void store_matrix_coop_sync(Wave<WaveSize> const&            wave,
+                                    GetDataType_t<FragT>*            data,
+                                    Fragment<FragT, WaveSize> const& frag,
+                                    uint32_t                         ldm);
+
+        // D = A x B + C on the matrix, accumulated in ComputeT. A matrix-level
+        // reference only: see the scope notes above.
+        template <uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename InputT,
+                  typename ComputeT,
+                  typename LayoutA,
+                  typename LayoutB,
+                  typename LayoutC,
+                  typename LayoutD,
+                  uint32_t WaveSize>
+        void mma_sync(
+            Fragment<fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutD>, WaveSize>& d,
+            Fragment<fragment<matrix_a, BlockM, BlockN, BlockK, InputT, LayoutA>, WaveSize> const&
+                a,
+            Fragment<fragment<matrix_b, BlockM, BlockN, BlockK, InputT, LayoutB>, WaveSize> const&
+                b,
+            Fragment<fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutC>,
+                     WaveSize> const& c);
+
+        ///
+        /// Transforms, which keep the matrix coordinate of every element
+        ///
+
+        template <typename FragT, uint32_t WaveSize>
+        auto applyTranspose(Fragment<FragT, WaveSize> const& frag);
+
+        template <typename DataLayoutT, typename FragT, uint32_t WaveSize>
+        auto applyDataLayout(Fragment<FragT, WaveSize> const& frag);
+
+        template <typename MatrixT,
+                  uint32_t BlockNext,
+                  typename OutputT,
+                  typename DataLayoutT,
+                  typename FragT,
+                  uint32_t WaveSize>
+        auto applyAccumConversion(Fragment<FragT, WaveSize> const& frag);
+
+        ///
+        /// Cross lane operations on packed 32b or 64b registers.
+        /// Lanes follow the host references of the cross lane ops tests.
+        ///
+
+        // Lanes masked by RowMask / BankMask keep their prev value
+        template <typename CrossLaneOp,
+                  uint32_t RowMask   = 0xF,
+                  uint32_t BankMask  = 0xF,
+                  bool     BoundCtrl = false,
+                  typename DataT,
+                  uint32_t WaveSize>
+        LaneRegister<DataT, WaveSize> dpp(LaneRegister<DataT, WaveSize> const& src,
+                                          LaneRegister<DataT, WaveSize> const& prev);
+
+        template <typename CrossLaneOp, typename DataT, uint32_t WaveSize>
+        LaneRegister<DataT, WaveSize> swizzle(LaneRegister<DataT, WaveSize> const& src);
+
+        template <typename CrossLaneOp, typename DataT, uint32_t WaveSize>
+        LaneRegister<DataT, WaveSize> permute(LaneRegister<DataT, WaveSize> const& src);
+
+        template <typename CrossLaneOp, typename DataT, uint32_t WaveSize>
+        LaneRegister<DataT, WaveSize> blend(LaneRegister<DataT, WaveSize> const& src0,
+                                            LaneRegister<DataT, WaveSize> const& src1);
+
+    } // namespace emulator
+
+} // namespace rocwmma
+
+#include "wave_emulator_impl.hpp"
+
+#endif // ROCWMMA_TEST_WAVE_EMULATOR_HPP
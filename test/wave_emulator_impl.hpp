@@ -0,0 +1,783 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_TEST_WAVE_EMULATOR_IMPL_HPP
+#define ROCWMMA_TEST_WAVE_EMULATOR_IMPL_HPP
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <thread>
+
+#include "coop_split.hpp"
+#include "reference.hpp"
+#include "wave_emulator.hpp"
+
+namespace rocwmma
+{
+    namespace emulator
+    {
+        ///
+        /// Fragment
+        ///
+
+        template <typename FragT, uint32_t WaveSize>
+        Fragment<FragT, WaveSize>::Fragment()
+            : mData(WaveSize * Size, static_cast<DataT>(0))
+        {
+        }
+
+        template <typename FragT, uint32_t WaveSize>
+        auto Fragment<FragT, WaveSize>::operator()(uint32_t lane, uint32_t index) -> DataT&
+        {
+            return mData[lane * Size + index];
+        }
+
+        template <typename FragT, uint32_t WaveSize>
+        auto Fragment<FragT, WaveSize>::operator()(uint32_t lane, uint32_t index) const
+            -> DataT const&
+        {
+            return mData[lane * Size + index];
+        }
+
+        namespace detail
+        {
+            ///
+            /// Workgroup
+            ///
+
+            inline Workgroup::Workgroup(uint32_t waveCount, uint32_t ldsBytes)
+                : mWaveCount(waveCount)
+                , mActiveWaves(waveCount)
+                , mArrivedWaves(0u)
+                , mGeneration(0u)
+                , mLds(ldsBytes, 0u)
+            {
+            }
+
+            inline uint32_t Workgroup::waveCount() const
+            {
+                return mWaveCount;
+            }
+
+            inline uint32_t Workgroup::ldsBytes() const
+            {
+                return static_cast<uint32_t>(mLds.size());
+            }
+
+            inline void* Workgroup::lds()
+            {
+                return mLds.data();
+            }
+
+            inline void Workgroup::barrier()
+            {
+                std::unique_lock<std::mutex> lock(mMutex);
+
+                auto generation = mGeneration;
+                if(++mArrivedWaves >= mActiveWaves)
+                {
+                    release();
+                }
+                else
+                {
+                    mCondition.wait(lock, [&]() { return generation != mGeneration; });
+                }
+            }
+
+            inline void Workgroup::retire()
+            {
+                std::unique_lock<std::mutex> lock(mMutex);
+
+                // Waves still waiting may now all have arrived
+                if(--mActiveWaves > 0u && mArrivedWaves >= mActiveWaves)
+                {
+                    release();
+                }
+            }
+
+            inline void Workgroup::release()
+            {
+                mArrivedWaves = 0u;
+                mGeneration++;
+                mCondition.notify_all();
+            }
+
+            ///
+            /// Fragment element mapping
+            ///
+
+            // Accumulators without a data layout have the same register mapping
+            // for either layout, so use row_major to map their elements.
+            template <typename FragT>
+            struct MappedFragment
+            {
+                using Type = FragT;
+            };
+
+            template <uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename DataT>
+            struct MappedFragment<fragment<accumulator, BlockM, BlockN, BlockK, DataT, void>>
+            {
+                using Type = fragment<accumulator, BlockM, BlockN, BlockK, DataT, row_major>;
+            };
+
+            template <typename FragT>
+            using MappedFragment_t = typename MappedFragment<FragT>::Type;
+
+            template <typename FragT>
+            struct FragmentShape
+            {
+                enum : uint32_t
+                {
+                    Height = GetIOShape_t<FragT>::BlockHeight,
+                    Width  = GetIOShape_t<FragT>::BlockWidth,
+                };
+            };
+
+            // Matrix coordinate of the element held at (lane, index), relative to the block
+            template <typename FragT>
+            inline Coord2d elementCoord(uint32_t lane, uint32_t index)
+            {
+                return MappedFragment_t<FragT>::elementCoord(lane, index);
+            }
+
+            inline bool isInBounds(Coord2d const& coord, Coord2d const& extent)
+            {
+                return (get<0>(coord) < get<0>(extent)) && (get<1>(coord) < get<1>(extent));
+            }
+
+            // Gathers every fragment element within the extent from memory
+            template <typename DataLayoutT, typename FragT, uint32_t WaveSize>
+            void gather(Fragment<FragT, WaveSize>&  frag,
+                        GetDataType_t<FragT> const* data,
+                        uint32_t                    ldm,
+                        Coord2d const&              extent)
+            {
+                using DataT = GetDataType_t<FragT>;
+
+                for(uint32_t lane = 0u; lane < WaveSize; lane++)
+                {
+                    for(uint32_t i = 0u; i < FragT::num_elements; i++)
+                    {
+                        auto coord = elementCoord<FragT>(lane, i);
+                        frag(lane, i) = isInBounds(coord, extent)
+                                            ? data[DataLayoutT::fromMatrixCoord(coord, ldm)]
+                                            : static_cast<DataT>(0);
+                    }
+                }
+            }
+
+            // Scatters every fragment element within the extent to memory
+            template <typename DataLayoutT, typename FragT, uint32_t WaveSize>
+            void scatter(GetDataType_t<FragT>*            data,
+                         Fragment<FragT, WaveSize> const& frag,
+                         uint32_t                         ldm,
+                         Coord2d const&                   extent)
+            {
+                for(uint32_t lane = 0u; lane < WaveSize; lane++)
+                {
+                    for(uint32_t i = 0u; i < FragT::num_elements; i++)
+                    {
+                        auto coord = elementCoord<FragT>(lane, i);
+                        if(isInBounds(coord, extent))
+                        {
+                            data[DataLayoutT::fromMatrixCoord(coord, ldm)] = frag(lane, i);
+                        }
+                    }
+                }
+            }
+
+            template <typename FragT>
+            constexpr Coord2d blockExtent()
+            {
+                return make_coord2d(FragmentShape<FragT>::Height, FragmentShape<FragT>::Width);
+            }
+
+            template <typename DataLayoutT, uint32_t WaveCount, typename FragT, uint32_t WaveSize>
+            void coopGather(Fragment<FragT, WaveSize>&  frag,
+                            GetDataType_t<FragT> const* data,
+                            uint32_t                    ldm,
+                            uint32_t                    waveIndex,
+                            uint32_t                    waveCount)
+            {
+                forEachCoopElement<FragT, WaveCount>(
+                    waveIndex, waveCount, [&](uint32_t lane, uint32_t i, Coord2d const& coord) {
+                        frag(lane, i) = data[DataLayoutT::fromMatrixCoord(coord, ldm)];
+                    });
+            }
+
+            template <typename DataLayoutT, uint32_t WaveCount, typename FragT, uint32_t WaveSize>
+            void coopScatter(GetDataType_t<FragT>*            data,
+                             Fragment<FragT, WaveSize> const& frag,
+                             uint32_t                         ldm,
+                             uint32_t                         waveIndex,
+                             uint32_t                         waveCount)
+            {
+                forEachCoopElement<FragT, WaveCount>(
+                    waveIndex, waveCount, [&](uint32_t lane, uint32_t i, Coord2d const& coord) {
+                        data[DataLayoutT::fromMatrixCoord(coord, ldm)] = frag(lane, i);
+                    });
+            }
+
+            // Dense row_major copy of the fragment block
+            template <typename FragT, uint32_t WaveSize>
+            std::vector<GetDataType_t<FragT>> toMatrix(Fragment<FragT, WaveSize> const& frag)
+            {
+                using Shape = FragmentShape<FragT>;
+
+                std::vector<GetDataType_t<FragT>> matrix(Shape::Height * Shape::Width);
+                scatter<DataLayout::RowMajor>(
+                    matrix.data(), frag, Shape::Width, blockExtent<FragT>());
+                return matrix;
+            }
+
+            // Fills the fragment from a dense row_major block, where the element at
+            // (row, col) is taken from (col, row) if transposed.
+            template <typename FragT, uint32_t WaveSize, typename InputT>
+            Fragment<FragT, WaveSize> fromMatrix(std::vector<InputT> const& matrix,
+                                                 uint32_t                   ldm,
+                                                 bool                       transposed)
+            {
+                using DataT = GetDataType_t<FragT>;
+
+                Fragment<FragT, WaveSize> frag;
+                for(uint32_t lane = 0u; lane < WaveSize; lane++)
+                {
+                    for(uint32_t i = 0u; i < FragT::num_elements; i++)
+                    {
+                        auto coord = elementCoord<FragT>(lane, i);
+                        auto row   = transposed ? get<1>(coord) : get<0>(coord);
+                        auto col   = transposed ? get<0>(coord) : get<1>(coord);
+                        frag(lane, i) = static_cast<DataT>(matrix[row * ldm + col]);
+                    }
+                }
+                return frag;
+            }
+
+        } // namespace detail
+
+        ///
+        /// Wave
+        ///
+
+        template <uint32_t WaveSize>
+        Wave<WaveSize>::Wave(detail::Workgroup& workgroup, dim3 blockIdx, uint32_t waveIndex)
+            : mWorkgroup(workgroup)
+            , mBlockIdx(blockIdx)
+            , mWaveIndex(waveIndex)
+        {
+        }
+
+        template <uint32_t WaveSize>
+        constexpr uint32_t Wave<WaveSize>::size()
+        {
+            return WaveSize;
+        }
+
+        template <uint32_t WaveSize>
+        dim3 Wave<WaveSize>::blockIdx() const
+        {
+            return mBlockIdx;
+        }
+
+        template <uint32_t WaveSize>
+        uint32_t Wave<WaveSize>::waveIndex() const
+        {
+            return mWaveIndex;
+        }
+
+        template <uint32_t WaveSize>
+        uint32_t Wave<WaveSize>::waveCount() const
+        {
+            return mWorkgroup.waveCount();
+        }
+
+        template <uint32_t WaveSize>
+        uint32_t Wave<WaveSize>::threadId(uint32_t lane) const
+        {
+            return mWaveIndex * WaveSize + lane;
+        }
+
+        template <uint32_t WaveSize>
+        template <typename DataT>
+        DataT* Wave<WaveSize>::lds() const
+        {
+            return reinterpret_cast<DataT*>(mWorkgroup.lds());
+        }
+
+        template <uint32_t WaveSize>
+        uint32_t Wave<WaveSize>::ldsBytes() const
+        {
+            return mWorkgroup.ldsBytes();
+        }
+
+        template <uint32_t WaveSize>
+        void Wave<WaveSize>::syncthreads() const
+        {
+            mWorkgroup.barrier();
+        }
+
+        template <uint32_t WaveSize>
+        template <typename Func>
+        void Wave<WaveSize>::forEachLane(Func&& func) const
+        {
+            for(uint32_t lane = 0u; lane < WaveSize; lane++)
+            {
+                func(lane);
+            }
+        }
+
+        template <uint32_t WaveSize, typename KernelT>
+        void launch(dim3 gridDim, uint32_t waveCount, uint32_t ldsBytes, KernelT&& kernel)
+        {
+            for(uint32_t z = 0u; z < gridDim.z; z++)
+            {
+                for(uint32_t y = 0u; y < gridDim.y; y++)
+                {
+                    for(uint32_t x = 0u; x < gridDim.x; x++)
+                    {
+                        detail::Workgroup               workgroup(waveCount, ldsBytes);
+                        std::vector<std::exception_ptr> errors(waveCount);
+                        std::vector<std::thread>        waves;
+
+                        for(uint32_t w = 0u; w < waveCount; w++)
+                        {
+                            waves.emplace_back([&, w]() {
+                                Wave<WaveSize> wave(workgroup, dim3(x, y, z), w);
+                                try
+                                {
+                                    kernel(wave);
+                                }
+                                catch(...)
+                                {
+                                    errors[w] = std::current_exception();
+                                }
+                                workgroup.retire();
+                            });
+                        }
+
+                        for(auto& wave : waves)
+                        {
+                            wave.join();
+                        }
+
+                        for(auto& error : errors)
+                        {
+                            if(error)
+                            {
+                                std::rethrow_exception(error);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        ///
+        /// Fragment operations
+        ///
+
+        template <typename FragT, uint32_t WaveSize>
+        void fill_fragment(Fragment<FragT, WaveSize>& frag, GetDataType_t<FragT> value)
+        {
+            for(uint32_t lane = 0u; lane < WaveSize; lane++)
+            {
+                for(uint32_t i = 0u; i < FragT::num_elements; i++)
+                {
+                    frag(lane, i) = value;
+                }
+            }
+        }
+
+        template <typename FragT, uint32_t WaveSize>
+        void load_matrix_sync(Fragment<FragT, WaveSize>& frag,
+                              GetDataType_t<FragT> const* data,
+                              uint32_t                    ldm)
+        {
+            static_assert(!is_same<GetDataLayout_t<FragT>, void>::value,
+                          "Must provide layout information");
+
+            using DataLayoutT = DataLayout::Array1d<GetDataLayout_t<FragT>>;
+            detail::gather<DataLayoutT>(frag, data, ldm, detail::blockExtent<FragT>());
+        }
+
+        template <typename FragT, uint32_t WaveSize>
+        void load_matrix_sync(Fragment<FragT, WaveSize>& frag,
+                              GetDataType_t<FragT> const* data,
+                              uint32_t                    ldm,
+                              layout_t                    layout)
+        {
+            auto extent = detail::blockExtent<FragT>();
+            if(layout == layout_t::mem_row_major)
+            {
+                detail::gather<DataLayout::RowMajor>(frag, data, ldm, extent);
+            }
+            else
+            {
+                detail::gather<DataLayout::ColMajor>(frag, data, ldm, extent);
+            }
+        }
+
+        template <typename FragT, uint32_t WaveSize>
+        void load_matrix_sync(Fragment<FragT, WaveSize>& frag,
+                              GetDataType_t<FragT> const* data,
+                              uint32_t                    ldm,
+                              uint32_t                    rows,
+                              uint32_t                    cols)
+        {
+            static_assert(!is_same<GetDataLayout_t<FragT>, void>::value,
+                          "Must provide layout information");
+
+            using DataLayoutT = DataLayout::Array1d<GetDataLayout_t<FragT>>;
+            detail::gather<DataLayoutT>(frag, data, ldm, make_coord2d(rows, cols));
+        }
+
+        template <typename FragT,
+                  uint32_t WaveSize,
+                  uint32_t ChunkSize,
+                  uint32_t ChunkCount,
+                  uint32_t LineGroup>
+        void load_matrix_sync(Fragment<FragT, WaveSize>&  frag,
+                              GetDataType_t<FragT> const* data,
+                              uint32_t                    ldm,
+                              xor_swizzle<ChunkSize, ChunkCount, LineGroup> /*swizzle*/)
+        {
+            static_assert(!is_same<GetDataLayout_t<FragT>, void>::value,
+                          "Must provide layout information");
+
+            using DataLayoutT = DataLayout::
+                XorSwizzle<GetDataLayout_t<FragT>, ChunkSize, ChunkCount, LineGroup>;
+            detail::gather<DataLayoutT>(frag, data, ldm, detail::blockExtent<FragT>());
+        }
+
+        template <typename FragT, uint32_t WaveSize>
+        void store_matrix_sync(GetDataType_t<FragT>*            data,
+                               Fragment<FragT, WaveSize> const& frag,
+                               uint32_t                         ldm)
+        {
+            static_assert(!is_same<GetDataLayout_t<FragT>, void>::value,
+                          "Must provide layout information");
+
+            using DataLayoutT = DataLayout::Array1d<GetDataLayout_t<FragT>>;
+            detail::scatter<DataLayoutT>(data, frag, ldm, detail::blockExtent<FragT>());
+        }
+
+        template <typename FragT, uint32_t WaveSize>
+        void store_matrix_sync(GetDataType_t<FragT>*            data,
+                               Fragment<FragT, WaveSize> const& frag,
+                               uint32_t                         ldm,
+                               layout_t                         layout)
+        {
+            auto extent = detail::blockExtent<FragT>();
+            if(layout == layout_t::mem_row_major)
+            {
+                detail::scatter<DataLayout::RowMajor>(data, frag, ldm, extent);
+            }
+            else
+            {
+                detail::scatter<DataLayout::ColMajor>(data, frag, ldm, extent);
+            }
+        }
+
+        template <typename FragT, uint32_t WaveSize>
+        void store_matrix_sync(GetDataType_t<FragT>*            data,
+                               Fragment<FragT, WaveSize> const& frag,
+                               uint32_t                         ldm,
+                               uint32_t                         rows,
+                               uint32_t                         cols)
+        {
+            static_assert(!is_same<GetDataLayout_t<FragT>, void>::value,
+                          "Must provide layout information");
+
+            using DataLayoutT = DataLayout::Array1d<GetDataLayout_t<FragT>>;
+            detail::scatter<DataLayoutT>(data, frag, ldm, make_coord2d(rows, cols));
+        }
+
+        template <typename FragT,
+                  uint32_t WaveSize,
+                  uint32_t ChunkSize,
+                  uint32_t ChunkCount,
+                  uint32_t LineGroup>
+        void store_matrix_sync(GetDataType_t<FragT>*            data,
+                               Fragment<FragT, WaveSize> const& frag,
+                               uint32_t                         ldm,
+                               xor_swizzle<ChunkSize, ChunkCount, LineGroup> /*swizzle*/)
+        {
+            static_assert(!is_same<GetDataLayout_t<FragT>, void>::value,
+                          "Must provide layout information");
+
+            using DataLayoutT = DataLayout::
+                XorSwizzle<GetDataLayout_t<FragT>, ChunkSize, ChunkCount, LineGroup>;
+            detail::scatter<DataLayoutT>(data, frag, ldm, detail::blockExtent<FragT>());
+        }
+
+        template <typename FragT, uint32_t WaveSize>
+        void load_matrix_coop_sync(Fragment<FragT, WaveSize>& frag,
+                                   GetDataType_t<FragT> const* data,
+                                   uint32_t                    ldm,
+                                   uint32_t                    waveIndex,
+                                   uint32_t                    waveCount)
+        {
+            using DataLayoutT = DataLayout::Array1d<GetDataLayout_t<FragT>>;
+            detail::coopGather<DataLayoutT, 1u>(frag, data, ldm, waveIndex, waveCount);
+        }
+
+        template <uint32_t WaveCount, typename FragT, uint32_t WaveSize>
+        void load_matrix_coop_sync(Fragment<FragT, WaveSize>& frag,
+                                   GetDataType_t<FragT> const* data,
+                                   uint32_t                    ldm,
+                                   uint32_t                    waveIndex)
+        {
+            using DataLayoutT = DataLayout::Array1d<GetDataLayout_t<FragT>>;
+            detail::coopGather<DataLayoutT, WaveCount>(frag, data, ldm, waveIndex, WaveCount);
+        }
+
+        template <typename FragT, uint32_t WaveSize>
+        void load_matrix_coop_sync(Wave<WaveSize> const&       wave,
+                                   Fragment<FragT, WaveSize>&  frag,
+                                   GetDataType_t<FragT> const* data,
+                                   uint32_t                    ldm)
+        {
+            load_matrix_coop_sync(frag, data, ldm, wave.waveIndex(), wave.waveCount());
+        }
+
+        template <typename FragT,
+                  uint32_t WaveSize,
+                  uint32_t ChunkSize,
+                  uint32_t ChunkCount,
+                  uint32_t LineGroup>
+        void load_matrix_coop_sync(Fragment<FragT, WaveSize>&  frag,
+                                   GetDataType_t<FragT> const* data,
+                                   uint32_t                    ldm,
+                                   uint32_t                    waveIndex,
+                                   uint32_t                    waveCount,
+                                   xor_swizzle<ChunkSize, ChunkCount, LineGroup> /*swizzle*/)
+        {
+            using DataLayoutT = DataLayout::
+                XorSwizzle<GetDataLayout_t<FragT>, ChunkSize, ChunkCount, LineGroup>;
+            detail::coopGather<DataLayoutT, 1u>(frag, data, ldm, waveIndex, waveCount);
+        }
+
+        template <typename FragT, uint32_t WaveSize>
+        void store_matrix_coop_sync(GetDataType_t<FragT>*            data,
+                                    Fragment<FragT, WaveSize> const& frag,
+                                    uint32_t                         ldm,
+                                    uint32_t                         waveIndex,
+                                    uint32_t                         waveCount)
+        {
+            using DataLayoutT = DataLayout::Array1d<GetDataLayout_t<FragT>>;
+            detail::coopScatter<DataLayoutT, 1u>(data, frag, ldm, waveIndex, waveCount);
+        }
+
+        template <uint32_t WaveCount, typename FragT, uint32_t WaveSize>
+        void store_matrix_coop_sync(GetDataType_t<FragT>*            data,
+                                    Fragment<FragT, WaveSize> const& frag,
+                                    uint32_t                         ldm,
+                                    uint32_t                         waveIndex)
+        {
+            using DataLayoutT = DataLayout::Array1d<GetDataLayout_t<FragT>>;
+            detail::coopScatter<DataLayoutT, WaveCount>(data, frag, ldm, waveIndex, WaveCount);
+        }
+
+        template <typename FragT, uint32_t WaveSize>
+        void store_matrix_coop_sync(Wave<WaveSize> const&            wave,
+                                    GetDataType_t<FragT>*            data,
+                                    Fragment<FragT, WaveSize> const& frag,
+                                    uint32_t                         ldm)
+        {
+            store_matrix_coop_sync(data, frag, ldm, wave.waveIndex(), wave.waveCount());
+        }
+
+        template <typename FragT,
+                  uint32_t WaveSize,
+                  uint32_t ChunkSize,
+                  uint32_t ChunkCount,
+                  uint32_t LineGroup>
+        void store_matrix_coop_sync(GetDataType_t<FragT>*            data,
+                                    Fragment<FragT, WaveSize> const& frag,
+                                    uint32_t                         ldm,
+                                    uint32_t                         waveIndex,
+                                    uint32_t                         waveCount,
+                                    xor_swizzle<ChunkSize, ChunkCount, LineGroup> /*swizzle*/)
+        {
+            using DataLayoutT = DataLayout::
+                XorSwizzle<GetDataLayout_t<FragT>, ChunkSize, ChunkCount, LineGroup>;
+            detail::coopScatter<DataLayoutT, 1u>(data, frag, ldm, waveIndex, waveCount);
+        }
+
+        template <uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename InputT,
+                  typename ComputeT,
+                  typename LayoutA,
+                  typename LayoutB,
+                  typename LayoutC,
+                  typename LayoutD,
+                  uint32_t WaveSize>
+        void mma_sync(
+            Fragment<fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutD>, WaveSize>& d,
+            Fragment<fragment<matrix_a, BlockM, BlockN, BlockK, InputT, LayoutA>, WaveSize> const&
+                a,
+            Fragment<fragment<matrix_b, BlockM, BlockN, BlockK, InputT, LayoutB>, WaveSize> const&
+                b,
+            Fragment<fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutC>,
+                     WaveSize> const& c)
+        {
+            using FragD = fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutD>;
+
+            // Blocks are dense row_major: A is BlockM x BlockK, B is BlockK x BlockN
+            auto matrixA = detail::toMatrix(a);
+            auto matrixB = detail::toMatrix(b);
+            auto matrixD = detail::toMatrix(c);
+
+            for(uint32_t row = 0u; row < BlockM; row++)
+            {
+                for(uint32_t col = 0u; col < BlockN; col++)
+                {
+                    auto accum = static_cast<ComputeT>(matrixD[row * BlockN + col]);
+                    for(uint32_t k = 0u; k < BlockK; k++)
+                    {
+                        accum += static_cast<ComputeT>(matrixA[row * BlockK + k])
+                                 * static_cast<ComputeT>(matrixB[k * BlockN + col]);
+                    }
+                    matrixD[row * BlockN + col] = accum;
+                }
+            }
+
+            d = detail::fromMatrix<FragD, WaveSize>(matrixD, BlockN, false);
+        }
+
+        ///
+        /// Transforms
+        ///
+
+        template <typename FragT, uint32_t WaveSize>
+        auto applyTranspose(Fragment<FragT, WaveSize> const& frag)
+        {
+            using FragOut = ApplyTranspose_t<FragT>;
+            return detail::fromMatrix<FragOut, WaveSize>(
+                detail::toMatrix(frag), detail::FragmentShape<FragT>::Width, true);
+        }
+
+        template <typename DataLayoutT, typename FragT, uint32_t WaveSize>
+        auto applyDataLayout(Fragment<FragT, WaveSize> const& frag)
+        {
+            using FragOut = ApplyDataLayout_t<FragT, DataLayoutT>;
+            return detail::fromMatrix<FragOut, WaveSize>(
+                detail::toMatrix(frag), detail::FragmentShape<FragT>::Width, false);
+        }
+
+        template <typename MatrixT,
+                  uint32_t BlockNext,
+                  typename OutputT,
+                  typename DataLayoutT,
+                  typename FragT,
+                  uint32_t WaveSize>
+        auto applyAccumConversion(Fragment<FragT, WaveSize> const& frag)
+        {
+            using FragOut
+                = ApplyAccumConversion_t<FragT, MatrixT, BlockNext, OutputT, DataLayoutT>;
+            return detail::fromMatrix<FragOut, WaveSize>(
+                detail::toMatrix(frag), detail::FragmentShape<FragT>::Width, false);
+        }
+
+        ///
+        /// Cross lane operations
+        ///
+
+        template <typename CrossLaneOp,
+                  uint32_t RowMask,
+                  uint32_t BankMask,
+                  bool     BoundCtrl,
+                  typename DataT,
+                  uint32_t WaveSize>
+        LaneRegister<DataT, WaveSize> dpp(LaneRegister<DataT, WaveSize> const& src,
+                                          LaneRegister<DataT, WaveSize> const& prev)
+        {
+            static_assert(PackTraits<DataT>::PackRatio == 1u,
+                          "Cross lane operations act on unpacked registers");
+
+            // References write the fill value where the device keeps prev. Those lanes
+            // are found as the only ones differing between two distinct fill values.
+            LaneRegister<DataT, WaveSize> result, probe;
+            cross_lane_ref_dispatch_CPU<DataT, CrossLaneOp, RowMask, BankMask, BoundCtrl>(
+                result.data(), src.data(), WaveSize, static_cast<DataT>(0), WaveSize);
+            cross_lane_ref_dispatch_CPU<DataT, CrossLaneOp, RowMask, BankMask, BoundCtrl>(
+                probe.data(), src.data(), WaveSize, static_cast<DataT>(1), WaveSize);
+
+            for(uint32_t lane = 0u; lane < WaveSize; lane++)
+            {
+                if(std::memcmp(&result[lane], &probe[lane], sizeof(DataT)) != 0)
+                {
+                    result[lane] = prev[lane];
+                }
+            }
+            return result;
+        }
+
+        template <typename CrossLaneOp, typename DataT, uint32_t WaveSize>
+        LaneRegister<DataT, WaveSize> swizzle(LaneRegister<DataT, WaveSize> const& src)
+        {
+            static_assert(PackTraits<DataT>::PackRatio == 1u,
+                          "Cross lane operations act on unpacked registers");
+
+            LaneRegister<DataT, WaveSize> result;
+            cross_lane_ref_dispatch_CPU<DataT, CrossLaneOp>(
+                result.data(), src.data(), WaveSize, static_cast<DataT>(0), WaveSize);
+            return result;
+        }
+
+        template <typename CrossLaneOp, typename DataT, uint32_t WaveSize>
+        LaneRegister<DataT, WaveSize> permute(LaneRegister<DataT, WaveSize> const& src)
+        {
+            static_assert(PackTraits<DataT>::PackRatio == 1u,
+                          "Cross lane operations act on unpacked registers");
+
+            LaneRegister<DataT, WaveSize> result;
+            cross_lane_ref_dispatch_CPU<DataT, CrossLaneOp>(
+                result.data(), src.data(), WaveSize, static_cast<DataT>(0), WaveSize);
+            return result;
+        }
+
+        template <typename CrossLaneOp, typename DataT, uint32_t WaveSize>
+        LaneRegister<DataT, WaveSize> blend(LaneRegister<DataT, WaveSize> const& src0,
+                                            LaneRegister<DataT, WaveSize> const& src1)
+        {
+            static_assert(PackTraits<DataT>::PackRatio == 1u,
+                          "Cross lane operations act on unpacked registers");
+
+            LaneRegister<DataT, WaveSize> result;
+            cross_lane_ref_dispatch_CPU<DataT, CrossLaneOp>(
+                result.data(), src0.data(), src1.data(), WaveSize, static_cast<DataT>(0), WaveSize);
+            return result;
+        }
+
+    } // namespace emulator
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_TEST_WAVE_EMULATOR_IMPL_HPP